@@ -14,6 +14,8 @@
 
 #include "application_sandbox/sample_application_framework/sample_application.h"
 #include "support/containers/deque.h"
+#include "support/containers/spsc_queue.h"
+#include "support/containers/triple_buffer.h"
 #include "support/entry/entry.h"
 #include "vulkan_helpers/buffer_frame_data.h"
 #include "vulkan_helpers/helper_functions.h"
@@ -23,6 +25,7 @@
 
 #include "particle_data_shared.h"
 
+#include <atomic>
 #include <chrono>
 
 #include <condition_variable>
@@ -94,10 +97,9 @@ class ASyncThreadRunner {
                     uint32_t num_async_compute_buffers)
       : allocator_(allocator),
         ready_buffers_(allocator),
-        returned_buffers_(allocator),
+        returned_buffers_(allocator, num_async_compute_buffers),
         data_(allocator),
         app_(app),
-        mailbox_buffer_(-1),
         last_update_time_(std::chrono::high_resolution_clock::now()),
         exit_(false) {
     if (!app_->async_compute_queue()) {
@@ -415,14 +417,12 @@ class ASyncThreadRunner {
       first_data_cv_.wait(lock, [this] { return first_data_ready_; });
     }
 
-    std::lock_guard<std::mutex> lock(data_mutex_);
-    if (mailbox_buffer_ == -1) {
+    if (!mailbox_.Update()) {
       // Nothing is ready;
       return index;
     }
+    const int32_t mb = mailbox_.read_buffer();
 
-    int32_t mb = mailbox_buffer_;
-    mailbox_buffer_ = -1;
     if (index != -1) {
       // Enqueues a command-buffer that transitions the buffer back to
       // the compute queue. It also sets the fence that we can wait on
@@ -442,7 +442,9 @@ class ASyncThreadRunner {
 
       app_->render_queue()->vkQueueSubmit(
           app_->render_queue(), 1, &wake_submit_info, data.return_fence_);
-      returned_buffers_.push_back(index);
+      // Every buffer is in this queue at most once, so it never fills up.
+      LOG_ASSERT(==, app_->GetLogger(), true,
+                 returned_buffers_.TryPush(static_cast<uint32_t>(index)));
     }
 
     return mb;
@@ -560,7 +562,6 @@ class ASyncThreadRunner {
   // If this returns -1, it means there are no currently available
   // buffers.
   int32_t GetNextBuffer() {
-    std::lock_guard<std::mutex> lock(data_mutex_);
     if (ready_buffers_.empty()) {
       return -1;
     }
@@ -573,31 +574,27 @@ class ASyncThreadRunner {
   // Once their fences have been signaled, then they are good
   // to be used again.
   void ProcessReturnedBuffers() {
-    std::lock_guard<std::mutex> lock(data_mutex_);
-    while (!returned_buffers_.empty()) {
-      if (VK_SUCCESS !=
-          app_->device()->vkGetFenceStatus(
-              app_->device(),
-              data_[returned_buffers_.front()]
-                  .return_fence_.get_raw_object())) {
+    while (uint32_t* returned = returned_buffers_.Front()) {
+      auto& fence = data_[*returned].return_fence_;
+      if (VK_SUCCESS != app_->device()->vkGetFenceStatus(
+                            app_->device(), fence.get_raw_object())) {
         break;
       }
-      app_->device()->vkResetFences(
-          app_->device(), 1,
-          &data_[returned_buffers_.front()].return_fence_.get_raw_object());
-      ready_buffers_.push_back(returned_buffers_.front());
-      returned_buffers_.pop_front();
+      app_->device()->vkResetFences(app_->device(), 1,
+                                    &fence.get_raw_object());
+      ready_buffers_.push_back(*returned);
+      returned_buffers_.Pop();
     }
   }
 
-  // Puts the given buffer in the mailbox. If there was a buffer
-  // already in the mailbox, moves it to the ready_buffers_.
+  // Puts the given buffer in the mailbox. If the render thread never
+  // took the buffer that was already in the mailbox, moves it to the
+  // ready_buffers_.
   void PutBufferInMailbox(int32_t buffer) {
-    std::lock_guard<std::mutex> lock(data_mutex_);
-    if (mailbox_buffer_ != -1) {
-      ready_buffers_.push_back(mailbox_buffer_);
+    mailbox_.write_buffer() = buffer;
+    if (mailbox_.Publish()) {
+      ready_buffers_.push_back(mailbox_.write_buffer());
     }
-    mailbox_buffer_ = buffer;
   }
 
   struct PrivateAsyncData {
@@ -613,11 +610,12 @@ class ASyncThreadRunner {
     containers::unique_ptr<vulkan::DescriptorSet> compute_descriptor_set_;
   };
 
-  // The list of all buffers that are currently free for simulation.
+  // The list of all buffers that are currently free for simulation. This is
+  // only used by the simulation thread.
   containers::deque<uint32_t> ready_buffers_;
-  // The list of all buffers that have been returned, and we are waiting for
-  // their fences to complete.
-  containers::deque<uint32_t> returned_buffers_;
+  // The list of all buffers that have been returned by the render thread,
+  // and we are waiting for their fences to complete.
+  containers::SpscQueue<uint32_t> returned_buffers_;
   // The actual data associated with those buffers.
   containers::vector<PrivateAsyncData> data_;
 
@@ -646,8 +644,9 @@ class ASyncThreadRunner {
   // The time that the last update was started.
   std::chrono::time_point<std::chrono::high_resolution_clock> last_update_time_;
 
-  // The current buffer sitting in the output mailbox.
-  int32_t mailbox_buffer_;
+  // The latest simulated buffer, from the simulation thread to the render
+  // thread. Neither of them ever waits for the other.
+  containers::TripleBuffer<int32_t> mailbox_;
   bool first = true;
   int current_frame = 0;
 
@@ -656,8 +655,6 @@ class ASyncThreadRunner {
   // The time of the last simulation log.
   std::chrono::time_point<std::chrono::high_resolution_clock> last_notify_time_;
 
-  // Mutex to protect the mailbox and related buffers.
-  std::mutex data_mutex_;
   // This lock + cv + value becomes our sempahore
   std::mutex first_data_mutex_;
   std::condition_variable first_data_cv_;
@@ -15,9 +15,12 @@
 #ifndef SAMPLE_APPLICATION_FRAMEWORK_SAMPLE_APPLICATION_H_
 #define SAMPLE_APPLICATION_FRAMEWORK_SAMPLE_APPLICATION_H_
 
+#include "support/containers/monotonic_allocator.h"
+#include "support/containers/profiling_allocator.h"
 #include "support/entry/entry.h"
 #include "vulkan_helpers/helper_functions.h"
 #include "vulkan_helpers/vulkan_application.h"
+#include "vulkan_wrapper/call_statistics.h"
 
 #include <chrono>
 #include <cstddef>
@@ -31,6 +34,7 @@ const static VkFormat kDepthFormat = VK_FORMAT_D16_UNORM;
 struct SampleOptions {
   bool enable_multisampling = false;
   bool enable_depth_buffer = false;
+  bool transient_depth_buffer = false;
   bool verbose_output = false;
   bool async_compute = false;
 
@@ -42,6 +46,14 @@ struct SampleOptions {
     enable_depth_buffer = true;
     return *this;
   }
+  // The depth buffer is only used inside render passes, and is never
+  // cleared, copied or read outside of one. It is bound to lazily allocated
+  // memory if the device has any.
+  SampleOptions& EnableTransientDepthBuffer() {
+    enable_depth_buffer = true;
+    transient_depth_buffer = true;
+    return *this;
+  }
   SampleOptions& EnableVerbose() {
     verbose_output = true;
     return *this;
@@ -120,6 +132,9 @@ class Sample {
   };
 
  public:
+  // The *_in_MB sizes are the most memory that each of the application's
+  // arenas may hold. Memory is only committed, in smaller chunks, as it is
+  // used.
   Sample(containers::Allocator* allocator, const entry::entry_data* entry_data,
          uint32_t host_buffer_size_in_MB, uint32_t image_memory_size_in_MB,
          uint32_t device_buffer_size_in_MB, uint32_t coherent_buffer_size_in_MB,
@@ -139,7 +154,8 @@ class Sample {
         last_frame_time_(std::chrono::high_resolution_clock::now()),
         initialization_command_buffer_(application_.GetCommandBuffer()),
         average_frame_time_(0),
-        is_valid_(true) {
+        is_valid_(true),
+        frame_allocator_(allocator) {
     if (data_->options.fixed_timestep) {
       app()->GetLogger()->LogInfo("Running with a fixed timestep of 0.1s");
     }
@@ -190,12 +206,15 @@ class Sample {
 
     vulkan::VkFence init_fence = vulkan::CreateFence(&application_.device());
 
+    application_.FlushHostWrites();
     application_.render_queue()->vkQueueSubmit(application_.render_queue(), 1,
                                                &submit_info,
                                                init_fence.get_raw_object());
     application_.device()->vkWaitForFences(application_.device(), 1,
                                            &init_fence.get_raw_object(), false,
                                            0xFFFFFFFFFFFFFFFF);
+    // Any staging memory used during initialization can now be reused.
+    application_.RetireCompletedTransientMemory();
     // Bit gross but submit all of the fences here
     for (auto& frame_data : frame_data_) {
       application_.render_queue()->vkQueueSubmit(
@@ -205,7 +224,18 @@ class Sample {
     InitializationComplete();
   }
 
-  void WaitIdle() { app()->device()->vkDeviceWaitIdle(app()->device()); }
+  void WaitIdle() {
+    app()->device()->vkDeviceWaitIdle(app()->device());
+    if (options_.transient_depth_buffer) {
+      ::VkDeviceSize allocated_size = 0;
+      ::VkDeviceSize committed_size = 0;
+      application_.GetTransientAttachmentMemory(&allocated_size,
+                                                &committed_size);
+      app()->GetLogger()->LogInfo(
+          "Transient attachments committed ", committed_size, " of ",
+          allocated_size, " bytes, saving ", allocated_size - committed_size);
+    }
+  }
 
   // The format that we are using to render. This will be either the swapchain
   // format if we are not rendering multi-sampled, or the multisampled image
@@ -228,6 +258,9 @@ class Sample {
   // application. Render() is used to actually process the commands
   // for rendering this particular frame.
   void ProcessFrame() {
+    // Attributes everything allocated during the frame in allocation
+    // profiles.
+    containers::ScopedAllocationTag allocation_tag("ProcessFrame");
     auto current_time = std::chrono::high_resolution_clock::now();
     std::chrono::duration<float> elapsed_time = current_time - last_frame_time_;
     last_frame_time_ = current_time;
@@ -260,10 +293,11 @@ class Sample {
     LOG_ASSERT(
         ==, app()->GetLogger(), VK_SUCCESS,
         app()->device()->vkResetFences(app()->device(), 1, &ready_fence));
+    application_.ReleaseIdleMemory();
     if (options_.verbose_output) {
-      app()->GetLogger()->LogInfo("Rendering frame <", elapsed_time.count(),
-                                  ">: <", image_idx, ">", " Average: <",
-                                  average_frame_time_, ">");
+      LOG_INFO(app()->GetLogger(), "Rendering frame <", elapsed_time.count(),
+               ">: <", image_idx, ">", " Average: <", average_frame_time_,
+               ">");
     }
 
     frame_data_[image_idx].ready_semaphore_ =
@@ -313,9 +347,15 @@ class Sample {
       present_ready_semaphore = *frame_data_[image_idx].transfer_semaphore_;
     }
 
-    app()->render_queue()->vkQueueSubmit(
-        app()->render_queue(), 1, &init_submit_info,
-        static_cast<::VkFence>(VK_NULL_HANDLE));
+    // Anything that Update wrote with mark_host_written is flushed here,
+    // in one batch, before any of the frame's work is submitted.
+    application_.FlushHostWrites();
+    // Transient memory used by earlier frames, and by Update, is retired
+    // with this submission. Anything that Render uses is retired with the
+    // next frame's.
+    app()->render_queue()->vkQueueSubmit(app()->render_queue(), 1,
+                                         &init_submit_info,
+                                         application_.RetireTransientMemory());
 
     Render(&app()->render_queue(), image_idx,
            &frame_data_[image_idx].child_data_);
@@ -367,6 +407,10 @@ class Sample {
                app()->present_queue()->vkQueuePresentKHR(app()->present_queue(),
                                                          &present_info),
                VK_SUCCESS);
+    if (vulkan::CallStatistics::enabled()) {
+      EndCallStatisticsFrame();
+    }
+    frame_allocator_.EndFrame();
   }
 
   void set_invalid(bool invaid) { is_valid_ = false; }
@@ -406,6 +450,23 @@ class Sample {
   }
 
  private:
+  // Ends the frame's Vulkan call statistics, and logs the most called
+  // functions if the output is verbose.
+  void EndCallStatisticsFrame() {
+    if (!options_.verbose_output) {
+      vulkan::CallStatistics::EndFrame(nullptr);
+      return;
+    }
+    containers::vector<vulkan::CallStatistics::FunctionSummary> summary(
+        &frame_allocator_);
+    vulkan::CallStatistics::EndFrame(&summary);
+    const size_t kMaxLoggedFunctions = 5;
+    for (size_t i = 0; i < summary.size() && i < kMaxLoggedFunctions; ++i) {
+      LOG_INFO(app()->GetLogger(), "  ", summary[i].name, ": <",
+               summary[i].calls, "> calls <", summary[i].nanoseconds, "> ns");
+    }
+  }
+
   // This will be called during Initialize(). The application is expected
   // to initialize any frame-specific data that it needs.
   virtual void InitializeFrameData(
@@ -489,8 +550,25 @@ class Sample {
         {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, 1}};
 
     ::VkImageView raw_view;
+    VkAllocationCallbacks* callbacks =
+        application_.device().allocation_callbacks();
 
-    if (options_.enable_depth_buffer) {
+    if (options_.transient_depth_buffer) {
+      image_create_info.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT |
+                                VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT |
+                                VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+      data->depth_stencil_ =
+          application_.CreateAndBindTransientAttachment(&image_create_info);
+      view_create_info.image = *data->depth_stencil_;
+
+      LOG_ASSERT(
+          ==, data_->log.get(), VK_SUCCESS,
+          application_.device()->vkCreateImageView(
+              application_.device(), &view_create_info, callbacks, &raw_view));
+      data->depth_view_ = containers::make_unique<vulkan::VkImageView>(
+          allocator_,
+          vulkan::VkImageView(raw_view, callbacks, &application_.device()));
+    } else if (options_.enable_depth_buffer) {
       data->depth_stencil_ =
           application_.CreateAndBindImage(&image_create_info);
       view_create_info.image = *data->depth_stencil_;
@@ -498,10 +576,10 @@ class Sample {
       LOG_ASSERT(
           ==, data_->log.get(), VK_SUCCESS,
           application_.device()->vkCreateImageView(
-              application_.device(), &view_create_info, nullptr, &raw_view));
+              application_.device(), &view_create_info, callbacks, &raw_view));
       data->depth_view_ = containers::make_unique<vulkan::VkImageView>(
           allocator_,
-          vulkan::VkImageView(raw_view, nullptr, &application_.device()));
+          vulkan::VkImageView(raw_view, callbacks, &application_.device()));
     }
 
     if (options_.enable_multisampling) {
@@ -522,10 +600,10 @@ class Sample {
     LOG_ASSERT(
         ==, data_->log.get(), VK_SUCCESS,
         application_.device()->vkCreateImageView(
-            application_.device(), &view_create_info, nullptr, &raw_view));
+            application_.device(), &view_create_info, callbacks, &raw_view));
     data->image_view = containers::make_unique<vulkan::VkImageView>(
         allocator_,
-        vulkan::VkImageView(raw_view, nullptr, &application_.device()));
+        vulkan::VkImageView(raw_view, callbacks, &application_.device()));
 
     VkImageMemoryBarrier barriers[2] = {
         {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,            // sType
@@ -772,6 +850,9 @@ class Sample {
   float average_frame_time_;
   // If this is set to false, the application cannot be safely run.
   bool is_valid_;
+  // Temporaries for a single frame, such as the call statistics summary.
+  // This is reset at the end of ProcessFrame.
+  containers::FrameAllocator frame_allocator_;
 };  // namespace sample_application
 }  // namespace sample_application
 
@@ -0,0 +1,25 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#version 450
+
+layout(location = 0) out vec4 out_color;
+
+layout(input_attachment_index = 1, binding = 1, set = 0) uniform subpassInput depth;
+
+void main() {
+    float d = subpassLoad(depth).r;
+    out_color = vec4(pow(vec3(d, d, d), vec3(10.0, 10.0, 10.0)), 1.0);
+}
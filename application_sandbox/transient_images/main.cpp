@@ -0,0 +1,605 @@
+// Copyright 2017 Google Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "application_sandbox/sample_application_framework/sample_application.h"
+#include "support/entry/entry.h"
+#include "vulkan_helpers/buffer_frame_data.h"
+#include "vulkan_helpers/helper_functions.h"
+#include "vulkan_helpers/transient_image_planner.h"
+#include "vulkan_helpers/vulkan_application.h"
+#include "vulkan_helpers/vulkan_model.h"
+
+#include <chrono>
+#include "mathfu/matrix.h"
+#include "mathfu/vector.h"
+
+using Mat44 = mathfu::Matrix<float, 4, 4>;
+using Vector4 = mathfu::Vector<float, 4>;
+
+namespace cube_model {
+#include "cube.obj.h"
+}
+const auto& cube_data = cube_model::model;
+
+namespace plane_model {
+#include "fullscreen_quad.obj.h"
+}
+const auto& plane_data = plane_model::model;
+
+uint32_t cube_vertex_shader[] =
+#include "cube.vert.spv"
+    ;
+
+uint32_t cube_fragment_shader[] =
+#include "cube.frag.spv"
+    ;
+
+uint32_t plane_vertex_shader[] =
+#include "plane.vert.spv"
+    ;
+
+uint32_t color_fragment_shader[] =
+#include "color.frag.spv"
+    ;
+
+uint32_t depth_fragment_shader[] =
+#include "depth.frag.spv"
+    ;
+
+// The screen is split into this many views. The left view shows the color of
+// the cube, and the right view shows its depth.
+const uint32_t kNumViews = 2;
+
+struct ViewFrameData {
+  // The indices of the color and depth images of the view in the planner.
+  size_t color_image_;
+  size_t depth_image_;
+  containers::unique_ptr<vulkan::VkImageView> color_image_view_;
+  containers::unique_ptr<vulkan::VkImageView> depth_image_view_;
+  containers::unique_ptr<vulkan::VkFramebuffer> framebuffer_;
+  // The descriptor set used for reading back the color and depth images.
+  containers::unique_ptr<vulkan::DescriptorSet> read_descriptor_set_;
+};
+
+struct TransientImagesFrameData {
+  containers::unique_ptr<vulkan::VkCommandBuffer> command_buffer_;
+  containers::unique_ptr<vulkan::DescriptorSet> cube_descriptor_set_;
+  // The color and depth images of view i are only used in render pass i, so
+  // the images of different views are placed in the same memory.
+  containers::unique_ptr<vulkan::TransientImagePlanner> transient_images_;
+  ViewFrameData views_[kNumViews];
+};
+
+class TransientImagesSample
+    : public sample_application::Sample<TransientImagesFrameData> {
+ public:
+  TransientImagesSample(const entry::entry_data* data)
+      : data_(data),
+        Sample<TransientImagesFrameData>(data->root_allocator, data, 1, 512,
+                                         1, 1,
+                                         sample_application::SampleOptions()),
+        cube_(data->root_allocator, data->log.get(), cube_data),
+        plane_(data->root_allocator, data->log.get(), plane_data) {}
+  virtual void InitializeApplicationData(
+      vulkan::VkCommandBuffer* initialization_buffer,
+      size_t num_swapchain_images) override {
+    cube_.InitializeData(app(), initialization_buffer);
+    plane_.InitializeData(app(), initialization_buffer);
+
+    cube_descriptor_set_layout_bindings_[0] = {
+        0,                                  // binding
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,  // descriptorType
+        1,                                  // descriptorCount
+        VK_SHADER_STAGE_VERTEX_BIT,         // stageFlags
+        nullptr                             // pImmutableSamplers
+    };
+    cube_descriptor_set_layout_bindings_[1] = {
+        1,                                  // binding
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,  // descriptorType
+        1,                                  // descriptorCount
+        VK_SHADER_STAGE_VERTEX_BIT,         // stageFlags
+        nullptr                             // pImmutableSamplers
+    };
+    read_descriptor_set_layout_bindings_[0] = {
+        0,                                    // binding
+        VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,  // descriptorType
+        1,                                    // descriptorCount
+        VK_SHADER_STAGE_FRAGMENT_BIT,         // stageFlags
+        nullptr                               // pImmutableSamplers
+    };
+    read_descriptor_set_layout_bindings_[1] = {
+        1,                                    // binding
+        VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,  // descriptorType
+        1,                                    // descriptorCount
+        VK_SHADER_STAGE_FRAGMENT_BIT,         // stageFlags
+        nullptr                               // pImmutableSamplers
+    };
+
+    cube_pipeline_layout_ = containers::make_unique<vulkan::PipelineLayout>(
+        data_->root_allocator,
+        app()->CreatePipelineLayout(
+            {{cube_descriptor_set_layout_bindings_[0],
+              cube_descriptor_set_layout_bindings_[1]}}));
+    read_pipeline_layout_ = containers::make_unique<vulkan::PipelineLayout>(
+        data_->root_allocator,
+        app()->CreatePipelineLayout(
+            {{read_descriptor_set_layout_bindings_[0],
+              read_descriptor_set_layout_bindings_[1]}}));
+
+    VkAttachmentReference depth_write_attachment = {
+        0, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+    VkAttachmentReference color_write_attachment = {
+        1, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    VkAttachmentReference read_attachments[2] = {
+        {1, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL},
+        {0, VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL}};
+    VkAttachmentReference output_attachment = {
+        2, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    // Each view is rendered by one pass. The first subpass renders the cube
+    // into the images of the view, and the second reads them back into its
+    // part of the swapchain image.
+    render_pass_ = containers::make_unique<vulkan::VkRenderPass>(
+        data_->root_allocator,
+        app()->CreateRenderPass(
+            {
+                {
+                    0,                                 // flags
+                    depth_format(),                    // format
+                    num_samples(),                     // samples
+                    VK_ATTACHMENT_LOAD_OP_CLEAR,       // loadOp
+                    VK_ATTACHMENT_STORE_OP_DONT_CARE,  // storeOp
+                    VK_ATTACHMENT_LOAD_OP_DONT_CARE,   // stenilLoadOp
+                    VK_ATTACHMENT_STORE_OP_DONT_CARE,  // stenilStoreOp
+                    VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,  // initialLayout
+                    VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL  // finalLayout
+                },  // Depth Attachment
+                {
+                    0,                                         // flags
+                    render_format(),                           // format
+                    num_samples(),                             // samples
+                    VK_ATTACHMENT_LOAD_OP_CLEAR,               // loadOp
+                    VK_ATTACHMENT_STORE_OP_DONT_CARE,          // storeOp
+                    VK_ATTACHMENT_LOAD_OP_DONT_CARE,           // stenilLoadOp
+                    VK_ATTACHMENT_STORE_OP_DONT_CARE,          // stenilStoreOp
+                    VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,  // initialLayout
+                    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL   // finalLayout
+                },  // Color Attachment
+                {
+                    0,                                         // flags
+                    render_format(),                           // format
+                    num_samples(),                             // samples
+                    VK_ATTACHMENT_LOAD_OP_DONT_CARE,           // loadOp
+                    VK_ATTACHMENT_STORE_OP_STORE,              // storeOp
+                    VK_ATTACHMENT_LOAD_OP_DONT_CARE,           // stenilLoadOp
+                    VK_ATTACHMENT_STORE_OP_DONT_CARE,          // stenilStoreOp
+                    VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,  // initialLayout
+                    VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL   // finalLayout
+                }  // Swapchain Attachment
+            },     // AttachmentDescriptions
+            {
+                {
+                    0,                                // flags
+                    VK_PIPELINE_BIND_POINT_GRAPHICS,  // pipelineBindPoint
+                    0,                                // inputAttachmentCount
+                    nullptr,                          // pInputAttachments
+                    1,                                // colorAttachmentCount
+                    &color_write_attachment,          // colorAttachment
+                    nullptr,                          // pResolveAttachments
+                    &depth_write_attachment,  // pDepthStencilAttachment
+                    0,                        // preserveAttachmentCount
+                    nullptr                   // pPreserveAttachments
+                },
+                {
+                    0,                                // flags
+                    VK_PIPELINE_BIND_POINT_GRAPHICS,  // pipelineBindPoint
+                    2,                                // inputAttachmentCount
+                    read_attachments,                 // pInputAttachments
+                    1,                                // colorAttachmentCount
+                    &output_attachment,               // colorAttachment
+                    nullptr,                          // pResolveAttachments
+                    nullptr,                          // pDepthStencilAttachment
+                    0,                                // preserveAttachmentCount
+                    nullptr                           // pPreserveAttachments
+                },
+            },  // SubpassDescriptions
+            {{
+                0,  // srcSubpass
+                1,  // dstSubpass
+                VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                    VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,  // srcStageMask
+                VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,          // dstStageMask
+                VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                    VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,  // srcAccess
+                VK_ACCESS_INPUT_ATTACHMENT_READ_BIT,  // dstAccessMask
+                VK_DEPENDENCY_BY_REGION_BIT           // dependencyFlags
+            }}  // SubpassDependencies
+            ));
+
+    // The viewport and scissor are left dynamic, since they differ between
+    // the views.
+    cube_pipeline_ = containers::make_unique<vulkan::VulkanGraphicsPipeline>(
+        data_->root_allocator,
+        app()->CreateGraphicsPipeline(cube_pipeline_layout_.get(),
+                                      render_pass_.get(), 0));
+    cube_pipeline_->AddShader(VK_SHADER_STAGE_VERTEX_BIT, "main",
+                              cube_vertex_shader);
+    cube_pipeline_->AddShader(VK_SHADER_STAGE_FRAGMENT_BIT, "main",
+                              cube_fragment_shader);
+    cube_pipeline_->SetTopology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+    cube_pipeline_->SetInputStreams(&cube_);
+    cube_pipeline_->SetSamples(num_samples());
+    cube_pipeline_->AddAttachment();
+    cube_pipeline_->Commit();
+
+    for (uint32_t i = 0; i < kNumViews; ++i) {
+      read_pipelines_[i] =
+          containers::make_unique<vulkan::VulkanGraphicsPipeline>(
+              data_->root_allocator,
+              app()->CreateGraphicsPipeline(read_pipeline_layout_.get(),
+                                            render_pass_.get(), 1));
+      read_pipelines_[i]->AddShader(VK_SHADER_STAGE_VERTEX_BIT, "main",
+                                    plane_vertex_shader);
+      if (i == 0) {
+        read_pipelines_[i]->AddShader(VK_SHADER_STAGE_FRAGMENT_BIT, "main",
+                                      color_fragment_shader);
+      } else {
+        read_pipelines_[i]->AddShader(VK_SHADER_STAGE_FRAGMENT_BIT, "main",
+                                      depth_fragment_shader);
+      }
+      read_pipelines_[i]->SetTopology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+      read_pipelines_[i]->SetInputStreams(&plane_);
+      read_pipelines_[i]->SetSamples(num_samples());
+      read_pipelines_[i]->AddAttachment();
+      read_pipelines_[i]->Commit();
+    }
+
+    camera_data_ = containers::make_unique<vulkan::BufferFrameData<CameraData>>(
+        data_->root_allocator, app(), num_swapchain_images,
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    model_data_ = containers::make_unique<vulkan::BufferFrameData<ModelData>>(
+        data_->root_allocator, app(), num_swapchain_images,
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+    const uint32_t width = app()->swapchain().width();
+    const uint32_t height = app()->swapchain().height();
+    for (uint32_t i = 0; i < kNumViews; ++i) {
+      const uint32_t left = width * i / kNumViews;
+      const uint32_t right = width * (i + 1) / kNumViews;
+      view_areas_[i] = {{static_cast<int32_t>(left), 0},
+                        {right - left, height}};
+      view_viewports_[i] = {static_cast<float>(left),
+                            0.0f,
+                            static_cast<float>(right - left),
+                            static_cast<float>(height),
+                            0.0f,
+                            1.0f};
+    }
+
+    float aspect = (float)view_areas_[0].extent.width / (float)height;
+    camera_data_->data().projection_matrix =
+        Mat44::FromScaleVector(mathfu::Vector<float, 3>{1.0f, -1.0f, 1.0f}) *
+        Mat44::Perspective(1.5708f, aspect, 0.1f, 100.0f);
+
+    model_data_->data().transform = Mat44::FromTranslationVector(
+        mathfu::Vector<float, 3>{0.0f, 0.0f, -3.0f});
+  }
+
+  virtual void InitializeFrameData(
+      TransientImagesFrameData* frame_data,
+      vulkan::VkCommandBuffer* initialization_buffer,
+      size_t frame_index) override {
+    VkImageCreateInfo image_create_info{
+        /* sType = */
+        VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        /* pNext = */ nullptr,
+        /* flags = */ 0,
+        /* imageType = */ VK_IMAGE_TYPE_2D,
+        /* format = */ VK_FORMAT_UNDEFINED,
+        /* extent = */
+        {
+            /* width = */ app()->swapchain().width(),
+            /* height = */ app()->swapchain().height(),
+            /* depth = */ app()->swapchain().depth(),
+        },
+        /* mipLevels = */ 1,
+        /* arrayLayers = */ 1,
+        /* samples = */ num_samples(),
+        /* tiling = */
+        VK_IMAGE_TILING_OPTIMAL,
+        /* usage = */ 0,
+        /* sharingMode = */
+        VK_SHARING_MODE_EXCLUSIVE,
+        /* queueFamilyIndexCount = */ 0,
+        /* pQueueFamilyIndices = */ nullptr,
+        /* initialLayout = */
+        VK_IMAGE_LAYOUT_UNDEFINED,
+    };
+    frame_data->transient_images_ =
+        containers::make_unique<vulkan::TransientImagePlanner>(
+            data_->root_allocator, data_->root_allocator, app());
+    for (uint32_t i = 0; i < kNumViews; ++i) {
+      ViewFrameData& view = frame_data->views_[i];
+      image_create_info.format = render_format();
+      image_create_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                                VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT |
+                                VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+      view.color_image_ =
+          frame_data->transient_images_->AddImage(image_create_info, i, i);
+      image_create_info.format = depth_format();
+      image_create_info.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT |
+                                VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT |
+                                VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+      view.depth_image_ =
+          frame_data->transient_images_->AddImage(image_create_info, i, i);
+    }
+    frame_data->transient_images_->Commit();
+
+    frame_data->command_buffer_ =
+        containers::make_unique<vulkan::VkCommandBuffer>(
+            data_->root_allocator, app()->GetCommandBuffer());
+
+    // Initialize cube rendering descriptor set.
+    frame_data->cube_descriptor_set_ =
+        containers::make_unique<vulkan::DescriptorSet>(
+            data_->root_allocator,
+            app()->AllocateDescriptorSet(
+                {cube_descriptor_set_layout_bindings_[0],
+                 cube_descriptor_set_layout_bindings_[1]}));
+
+    VkDescriptorBufferInfo buffer_infos[2] = {
+        {
+            camera_data_->get_buffer(),                       // buffer
+            camera_data_->get_offset_for_frame(frame_index),  // offset
+            camera_data_->size(),                             // range
+        },
+        {
+            model_data_->get_buffer(),                       // buffer
+            model_data_->get_offset_for_frame(frame_index),  // offset
+            model_data_->size(),                             // range
+        }};
+
+    VkWriteDescriptorSet write{
+        VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,  // sType
+        nullptr,                                 // pNext
+        *frame_data->cube_descriptor_set_,       // dstSet
+        0,                                       // dstbinding
+        0,                                       // dstArrayElement
+        2,                                       // descriptorCount
+        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,       // descriptorType
+        nullptr,                                 // pImageInfo
+        buffer_infos,                            // pBufferInfo
+        nullptr,                                 // pTexelBufferView
+    };
+
+    app()->device()->vkUpdateDescriptorSets(app()->device(), 1, &write, 0,
+                                            nullptr);
+
+    for (uint32_t i = 0; i < kNumViews; ++i) {
+      ViewFrameData& view = frame_data->views_[i];
+      view.color_image_view_ = CreateImageView(
+          frame_data->transient_images_->image(view.color_image_),
+          render_format(), VK_IMAGE_ASPECT_COLOR_BIT);
+      view.depth_image_view_ = CreateImageView(
+          frame_data->transient_images_->image(view.depth_image_),
+          depth_format(), VK_IMAGE_ASPECT_DEPTH_BIT);
+
+      // Initialize the descriptor set that reads back the images.
+      view.read_descriptor_set_ =
+          containers::make_unique<vulkan::DescriptorSet>(
+              data_->root_allocator,
+              app()->AllocateDescriptorSet(
+                  {read_descriptor_set_layout_bindings_[0],
+                   read_descriptor_set_layout_bindings_[1]}));
+      VkDescriptorImageInfo image_infos[2] = {
+          {
+              VK_NULL_HANDLE,                           // sampler
+              *view.color_image_view_,                  // imageView
+              VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL  // imageLayout
+          },
+          {
+              VK_NULL_HANDLE,                                  // sampler
+              *view.depth_image_view_,                         // imageView
+              VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL  // imageLayout
+          }};
+      write.dstSet = *view.read_descriptor_set_;
+      write.descriptorCount = 2;
+      write.descriptorType = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+      write.pBufferInfo = nullptr;
+      write.pImageInfo = image_infos;
+      app()->device()->vkUpdateDescriptorSets(app()->device(), 1, &write, 0,
+                                              nullptr);
+
+      VkImageView raw_views[3] = {*view.depth_image_view_,
+                                  *view.color_image_view_,
+                                  color_view(frame_data)};
+      VkFramebufferCreateInfo framebuffer_create_info{
+          VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,  // sType
+          nullptr,                                    // pNext
+          0,                                          // flags
+          *render_pass_,                              // renderPass
+          3,                                          // attachmentCount
+          raw_views,                                  // attachments
+          app()->swapchain().width(),                 // width
+          app()->swapchain().height(),                // height
+          1                                           // layers
+      };
+
+      ::VkFramebuffer raw_framebuffer;
+      app()->device()->vkCreateFramebuffer(
+          app()->device(), &framebuffer_create_info, nullptr, &raw_framebuffer);
+      view.framebuffer_ = containers::make_unique<vulkan::VkFramebuffer>(
+          data_->root_allocator,
+          vulkan::VkFramebuffer(raw_framebuffer, nullptr, &app()->device()));
+    }
+
+    // Populate the render command buffer
+    vulkan::VkCommandBuffer& cmdBuffer = (*frame_data->command_buffer_);
+    cmdBuffer->vkBeginCommandBuffer(cmdBuffer,
+                                    &sample_application::kBeginCommandBuffer);
+
+    for (uint32_t i = 0; i < kNumViews; ++i) {
+      ViewFrameData& view = frame_data->views_[i];
+      // The images of this view may share memory with the images of the
+      // other view, so their contents are undefined here.
+      frame_data->transient_images_->RecordFirstUseBarrier(
+          &cmdBuffer, view.depth_image_, VK_IMAGE_ASPECT_DEPTH_BIT,
+          VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+          VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+              VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+          VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+              VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT);
+      frame_data->transient_images_->RecordFirstUseBarrier(
+          &cmdBuffer, view.color_image_, VK_IMAGE_ASPECT_COLOR_BIT,
+          VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+          VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+          VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+
+      VkClearValue clears[3];
+      clears[0].depthStencil.depth = 1.0f;
+      vulkan::MemoryClear(&clears[1]);  // clear the color attachment
+      vulkan::MemoryClear(&clears[2]);
+
+      VkRenderPassBeginInfo pass_begin = {
+          VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,  // sType
+          nullptr,                                   // pNext
+          *render_pass_,                             // renderPass
+          *view.framebuffer_,                        // framebuffer
+          view_areas_[i],                            // renderArea
+          3,                                         // clearValueCount
+          clears                                     // clears
+      };
+
+      cmdBuffer->vkCmdBeginRenderPass(cmdBuffer, &pass_begin,
+                                      VK_SUBPASS_CONTENTS_INLINE);
+      cmdBuffer->vkCmdSetViewport(cmdBuffer, 0, 1, &view_viewports_[i]);
+      cmdBuffer->vkCmdSetScissor(cmdBuffer, 0, 1, &view_areas_[i]);
+
+      // Render the cube into the images of the view.
+      cmdBuffer->vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                   *cube_pipeline_);
+      cmdBuffer->vkCmdBindDescriptorSets(
+          cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+          ::VkPipelineLayout(*cube_pipeline_layout_), 0, 1,
+          &frame_data->cube_descriptor_set_->raw_set(), 0, nullptr);
+      cube_.Draw(&cmdBuffer);
+
+      // Read the images back into the swapchain image.
+      cmdBuffer->vkCmdNextSubpass(cmdBuffer, VK_SUBPASS_CONTENTS_INLINE);
+      cmdBuffer->vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                   *read_pipelines_[i]);
+      cmdBuffer->vkCmdBindDescriptorSets(
+          cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+          ::VkPipelineLayout(*read_pipeline_layout_), 0, 1,
+          &view.read_descriptor_set_->raw_set(), 0, nullptr);
+      plane_.Draw(&cmdBuffer);
+      cmdBuffer->vkCmdEndRenderPass(cmdBuffer);
+    }
+
+    (*frame_data->command_buffer_)
+        ->vkEndCommandBuffer(*frame_data->command_buffer_);
+  }
+
+  virtual void Update(float time_since_last_render) override {
+    model_data_->data().transform =
+        model_data_->data().transform *
+        Mat44::FromRotationMatrix(
+            Mat44::RotationX(3.14f * time_since_last_render) *
+            Mat44::RotationY(3.14f * time_since_last_render * 0.5f));
+  }
+  virtual void Render(vulkan::VkQueue* queue, size_t frame_index,
+                      TransientImagesFrameData* frame_data) override {
+    // Update our uniform buffers.
+    camera_data_->UpdateBuffer(queue, frame_index);
+    model_data_->UpdateBuffer(queue, frame_index);
+
+    VkSubmitInfo init_submit_info{
+        VK_STRUCTURE_TYPE_SUBMIT_INFO,  // sType
+        nullptr,                        // pNext
+        0,                              // waitSemaphoreCount
+        nullptr,                        // pWaitSemaphores
+        nullptr,                        // pWaitDstStageMask,
+        1,                              // commandBufferCount
+        &(frame_data->command_buffer_->get_command_buffer()),
+        0,       // signalSemaphoreCount
+        nullptr  // pSignalSemaphores
+    };
+
+    app()->render_queue()->vkQueueSubmit(app()->render_queue(), 1,
+                                         &init_submit_info,
+                                         static_cast<VkFence>(VK_NULL_HANDLE));
+  }
+
+ private:
+  struct CameraData {
+    Mat44 projection_matrix;
+  };
+
+  struct ModelData {
+    Mat44 transform;
+  };
+
+  containers::unique_ptr<vulkan::VkImageView> CreateImageView(
+      ::VkImage image, VkFormat format, VkImageAspectFlags aspect) {
+    VkImageViewCreateInfo view_create_info{
+        VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,  // sType
+        nullptr,                                   // pNext
+        0,                                         // flags
+        image,                                     // image
+        VK_IMAGE_VIEW_TYPE_2D,                     // viewType
+        format,                                    // format
+        {VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_G, VK_COMPONENT_SWIZZLE_B,
+         VK_COMPONENT_SWIZZLE_A},
+        {aspect, 0, 1, 0, 1}};
+    ::VkImageView raw_view;
+    LOG_ASSERT(==, data_->log.get(), VK_SUCCESS,
+               app()->device()->vkCreateImageView(
+                   app()->device(), &view_create_info, nullptr, &raw_view));
+    return containers::make_unique<vulkan::VkImageView>(
+        data_->root_allocator,
+        vulkan::VkImageView(raw_view, nullptr, &app()->device()));
+  }
+
+  const entry::entry_data* data_;
+  containers::unique_ptr<vulkan::PipelineLayout> cube_pipeline_layout_;
+  containers::unique_ptr<vulkan::PipelineLayout> read_pipeline_layout_;
+  containers::unique_ptr<vulkan::VulkanGraphicsPipeline> cube_pipeline_;
+  containers::unique_ptr<vulkan::VulkanGraphicsPipeline>
+      read_pipelines_[kNumViews];
+  containers::unique_ptr<vulkan::VkRenderPass> render_pass_;
+  VkDescriptorSetLayoutBinding cube_descriptor_set_layout_bindings_[2];
+  VkDescriptorSetLayoutBinding read_descriptor_set_layout_bindings_[2];
+  VkRect2D view_areas_[kNumViews];
+  VkViewport view_viewports_[kNumViews];
+  vulkan::VulkanModel cube_;
+  vulkan::VulkanModel plane_;
+
+  containers::unique_ptr<vulkan::BufferFrameData<CameraData>> camera_data_;
+  containers::unique_ptr<vulkan::BufferFrameData<ModelData>> model_data_;
+};
+
+int main_entry(const entry::entry_data* data) {
+  data->log->LogInfo("Application Startup");
+  TransientImagesSample sample(data);
+  sample.Initialize();
+
+  while (!sample.should_exit()) {
+    sample.ProcessFrame();
+  }
+  sample.WaitIdle();
+
+  data->log->LogInfo("Application Shutdown");
+  return 0;
+}
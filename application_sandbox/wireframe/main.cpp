@@ -54,7 +54,7 @@ class WireframeSample : public sample_application::Sample<WireframeFrameData> {
       : data_(data),
         Sample<WireframeFrameData>(data->root_allocator, data, 1, 512, 1, 1,
                                    sample_application::SampleOptions()
-                                       .EnableDepthBuffer()
+                                       .EnableTransientDepthBuffer()
                                        .EnableMultisampling(),
                                    requested_features),
         torus_(data->root_allocator, data->log.get(), torus_data) {}
@@ -96,7 +96,7 @@ class WireframeSample : public sample_application::Sample<WireframeFrameData> {
                  depth_format(),                    // format
                  num_samples(),                     // samples
                  VK_ATTACHMENT_LOAD_OP_CLEAR,       // loadOp
-                 VK_ATTACHMENT_STORE_OP_STORE,      // storeOp
+                 VK_ATTACHMENT_STORE_OP_DONT_CARE,  // storeOp
                  VK_ATTACHMENT_LOAD_OP_DONT_CARE,   // stenilLoadOp
                  VK_ATTACHMENT_STORE_OP_DONT_CARE,  // stenilStoreOp
                  VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,  // initialLayout
@@ -0,0 +1,120 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Creates and destroys buffers and images from several threads at once,
+// through a VulkanApplication with thread safe memory. This is meant to be
+// run against the mock ICD, so that the time is spent in the arenas rather
+// than in the driver.
+
+#include <random>
+#include <thread>
+
+#include "benchmarks/benchmark.h"
+#include "support/containers/vector.h"
+#include "support/entry/entry.h"
+#include "vulkan_helpers/vulkan_application.h"
+
+namespace {
+const uint32_t kOperationsPerThread = 20000;
+const uint32_t kLiveObjectsPerThread = 64;
+const uint32_t kMaxThreads = 8;
+// Every eighth object is an image, the rest are buffers.
+const uint32_t kImageFrequency = 8;
+
+// Replaces kOperationsPerThread objects, one at a time, in a ring of
+// kLiveObjectsPerThread buffers and images.
+void ReplaceObjects(vulkan::VulkanApplication* application,
+                    containers::Allocator* allocator, uint32_t seed) {
+  std::minstd_rand random(seed);
+  std::uniform_int_distribution<uint32_t> buffer_size(256, 256 * 1024);
+  std::uniform_int_distribution<uint32_t> image_size(16, 256);
+  containers::vector<vulkan::BufferPointer> buffers(allocator);
+  containers::vector<vulkan::ImagePointer> images(allocator);
+  buffers.resize(kLiveObjectsPerThread);
+  images.resize(kLiveObjectsPerThread);
+
+  for (uint32_t i = 0; i < kOperationsPerThread; ++i) {
+    const uint32_t slot = i % kLiveObjectsPerThread;
+    if (i % kImageFrequency == 0) {
+      const uint32_t size = image_size(random);
+      VkImageCreateInfo create_info{
+          VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,  // sType
+          nullptr,                              // pNext
+          0,                                    // flags
+          VK_IMAGE_TYPE_2D,                     // imageType
+          VK_FORMAT_R8G8B8A8_UNORM,             // format
+          {size, size, 1},                      // extent
+          1,                                    // mipLevels
+          1,                                    // arrayLayers
+          VK_SAMPLE_COUNT_1_BIT,                // samples
+          VK_IMAGE_TILING_OPTIMAL,              // tiling
+          VK_IMAGE_USAGE_SAMPLED_BIT |
+              VK_IMAGE_USAGE_TRANSFER_DST_BIT,  // usage
+          VK_SHARING_MODE_EXCLUSIVE,            // sharingMode
+          0,                                    // queueFamilyIndexCount
+          nullptr,                              // pQueueFamilyIndices
+          VK_IMAGE_LAYOUT_UNDEFINED,            // initialLayout
+      };
+      images[slot] = application->CreateAndBindImage(&create_info);
+    } else {
+      buffers[slot] = application->CreateAndBindDefaultExclusiveDeviceBuffer(
+          buffer_size(random), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    }
+  }
+}
+}  // anonymous namespace
+
+int main_entry(const entry::entry_data* data) {
+  containers::Allocator* allocator = data->root_allocator;
+  VkPhysicalDeviceFeatures features = {};
+  vulkan::VulkanApplication application(
+      allocator, data->log.get(), data, {}, features, 1024 * 1024,
+      512 * 1024 * 1024, 512 * 1024 * 1024, 1024 * 1024, false, true);
+
+  for (uint32_t thread_count = 1; thread_count <= kMaxThreads;
+       thread_count *= 2) {
+    containers::vector<std::thread> threads(allocator);
+    threads.reserve(thread_count);
+    uint64_t start = benchmark::NowNs();
+    for (uint32_t i = 0; i < thread_count; ++i) {
+      threads.push_back(
+          std::thread(ReplaceObjects, &application, allocator, i + 1));
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    uint64_t elapsed = benchmark::NowNs() - start;
+    data->log->LogInfo(thread_count, " threads:");
+    benchmark::Report(data->log.get(), "  create and destroy",
+                      uint64_t(thread_count) * kOperationsPerThread, elapsed);
+
+    // Give every chunk back, so that the next round has to grow the arenas
+    // again, from several threads at once. Slots cached by the threads go
+    // back to their slabs, slabs to their arena, and chunks to the device,
+    // each after kArenaIdleFramesBeforeRelease idle frames.
+    for (uint32_t i = 0;
+         i <= 3 * vulkan::VulkanApplication::kArenaIdleFramesBeforeRelease;
+         ++i) {
+      application.ReleaseIdleMemory();
+    }
+    vulkan::VulkanApplication::MemoryStatistics statistics;
+    application.GetMemoryStatistics(&statistics);
+    LOG_ASSERT(==, data->log.get(),
+               statistics.device_only_buffer_heap.chunk_count, 0u);
+    LOG_ASSERT(==, data->log.get(),
+               statistics.device_only_image_heap.chunk_count, 0u);
+  }
+  return 0;
+}
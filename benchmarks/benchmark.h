@@ -0,0 +1,43 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BENCHMARKS_BENCHMARK_H_
+#define BENCHMARKS_BENCHMARK_H_
+
+#include <chrono>
+#include <cstdint>
+
+#include "support/log/log.h"
+
+namespace benchmark {
+
+// Returns a monotonic timestamp in nanoseconds.
+inline uint64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Logs the average cost of one of count operations that took a total of
+// elapsed_ns nanoseconds.
+inline void Report(logging::Logger* log, const char* name, uint64_t count,
+                   uint64_t elapsed_ns) {
+  log->LogInfo(name, ": ", count, " operations, ",
+               static_cast<double>(elapsed_ns) / static_cast<double>(count),
+               " ns each");
+}
+}  // namespace benchmark
+
+#endif  // BENCHMARKS_BENCHMARK_H_
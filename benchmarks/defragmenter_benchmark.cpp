@@ -0,0 +1,110 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Fragments the device-only buffer arena by freeing every other buffer, and
+// then runs an ArenaDefragmenter over the survivors with a per-step budget.
+// This times the steps, and checks that the relocation callbacks fire and
+// that the largest free block grows. This is meant to be run against the
+// mock ICD, so that the time is spent in the defragmenter rather than in
+// the driver.
+
+#include "benchmarks/benchmark.h"
+#include "support/containers/vector.h"
+#include "support/entry/entry.h"
+#include "vulkan_helpers/arena_defragmenter.h"
+#include "vulkan_helpers/vulkan_application.h"
+
+namespace {
+const uint32_t kBufferCount = 64;
+// Large enough that the buffers are bound directly from the arena, rather
+// than from a slab pool, since slab pool buffers are never moved.
+const VkDeviceSize kBufferSize = 1024 * 1024;
+const VkDeviceSize kBytesPerStep = 4 * 1024 * 1024;
+const uint32_t kMaxSteps = 1000;
+
+// Counts the relocations of one buffer.
+void CountRelocation(void* user_data) {
+  ++*static_cast<uint32_t*>(user_data);
+}
+}  // anonymous namespace
+
+int main_entry(const entry::entry_data* data) {
+  containers::Allocator* allocator = data->root_allocator;
+  VkPhysicalDeviceFeatures features = {};
+  vulkan::VulkanApplication application(
+      allocator, data->log.get(), data, {}, features, 1024 * 1024,
+      64 * 1024 * 1024, 128 * 1024 * 1024, 1024 * 1024);
+  vulkan::VkDevice& device = application.device();
+
+  VkBufferCreateInfo create_info{
+      VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,  // sType
+      nullptr,                               // pNext
+      0,                                     // flags
+      kBufferSize,                           // size
+      VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+          VK_BUFFER_USAGE_TRANSFER_DST_BIT,  // usage
+      VK_SHARING_MODE_EXCLUSIVE,             // sharingMode
+      0,                                     // queueFamilyIndexCount
+      nullptr,                               // pQueueFamilyIndices
+  };
+
+  vulkan::ArenaDefragmenter defragmenter(allocator, &application,
+                                         kBytesPerStep);
+  containers::vector<vulkan::BufferPointer> buffers(allocator);
+  containers::vector<uint32_t> relocations(kBufferCount, 0, allocator);
+  buffers.reserve(kBufferCount);
+  for (uint32_t i = 0; i < kBufferCount; ++i) {
+    buffers.push_back(application.CreateAndBindDeviceBuffer(&create_info));
+    defragmenter.RegisterBuffer(buffers[i].get(), create_info,
+                                &CountRelocation, &relocations[i]);
+  }
+  for (uint32_t i = 0; i < kBufferCount; i += 2) {
+    defragmenter.UnregisterBuffer(buffers[i].get());
+    buffers[i].reset();
+  }
+
+  vulkan::VulkanApplication::MemoryStatistics before;
+  application.GetMemoryStatistics(&before);
+
+  uint32_t steps = 0;
+  uint64_t start = benchmark::NowNs();
+  do {
+    defragmenter.Step(&application.render_queue());
+    device->vkDeviceWaitIdle(device);
+    ++steps;
+  } while (!defragmenter.idle() && steps < kMaxSteps);
+  uint64_t elapsed = benchmark::NowNs() - start;
+  benchmark::Report(data->log.get(), "defragment step", steps, elapsed);
+
+  vulkan::VulkanApplication::MemoryStatistics after;
+  application.GetMemoryStatistics(&after);
+
+  uint32_t relocation_count = 0;
+  for (uint32_t i = 1; i < kBufferCount; i += 2) {
+    relocation_count += relocations[i];
+    defragmenter.UnregisterBuffer(buffers[i].get());
+  }
+  data->log->LogInfo("  ", relocation_count, " buffers relocated");
+  data->log->LogInfo("  largest free block ",
+                     before.device_only_buffer_heap.largest_free_block,
+                     " -> ", after.device_only_buffer_heap.largest_free_block,
+                     " bytes");
+  LOG_ASSERT(<, data->log.get(), steps, kMaxSteps);
+  LOG_ASSERT(>, data->log.get(), relocation_count, 0u);
+  LOG_ASSERT(>, data->log.get(),
+             after.device_only_buffer_heap.largest_free_block,
+             before.device_only_buffer_heap.largest_free_block);
+  return 0;
+}
@@ -0,0 +1,83 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times calls through the lazily resolved function tables in
+// vulkan_wrapper/function_table.h, against calls through a plain function
+// pointer. The tables are given a fake vkGetInstanceProcAddr, so this does
+// not need a Vulkan driver. With VULKAN_CALL_STATISTICS or VULKAN_CAPTURE
+// set, the table calls also include their overhead.
+
+#include <cstring>
+
+#include "benchmarks/benchmark.h"
+#include "support/entry/entry.h"
+#include "vulkan_wrapper/function_table.h"
+
+namespace {
+const uint32_t kCalls = 100000000;
+
+// Stands in for the driver's function. It does as little as a function
+// can while still having an effect that cannot be optimized away.
+VKAPI_ATTR VkResult VKAPI_CALL FakeEnumeratePhysicalDevices(
+    VkInstance, uint32_t* count, VkPhysicalDevice*) {
+  ++*count;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL
+FakeGetInstanceProcAddr(VkInstance, const char* name) {
+  if (strcmp(name, "vkEnumeratePhysicalDevices") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(
+        &FakeEnumeratePhysicalDevices);
+  }
+  return nullptr;
+}
+
+// The compiler cannot see through these, so it cannot inline the fake
+// functions into the loops.
+PFN_vkEnumeratePhysicalDevices volatile raw_function =
+    &FakeEnumeratePhysicalDevices;
+PFN_vkGetInstanceProcAddr volatile get_instance_proc_addr =
+    &FakeGetInstanceProcAddr;
+
+// Calls function kCalls times, and logs how long each call took.
+template <typename Function>
+void Time(logging::Logger* log, const char* name, Function& function) {
+  VkInstance instance = reinterpret_cast<VkInstance>(uintptr_t(1));
+  uint32_t count = 0;
+  const uint64_t start = benchmark::NowNs();
+  for (uint32_t i = 0; i < kCalls; ++i) {
+    function(instance, &count, nullptr);
+  }
+  const uint64_t elapsed = benchmark::NowNs() - start;
+  benchmark::Report(log, name, count, elapsed);
+}
+}  // anonymous namespace
+
+int main_entry(const entry::entry_data* data) {
+  logging::Logger* log = data->log.get();
+  VkInstance instance = reinterpret_cast<VkInstance>(uintptr_t(1));
+
+  PFN_vkEnumeratePhysicalDevices function = raw_function;
+  Time(log, "Function pointer", function);
+
+  vulkan::InstanceFunctions eager(instance, get_instance_proc_addr, log,
+                                  true);
+  Time(log, "Table, resolved eagerly", eager.vkEnumeratePhysicalDevices);
+
+  vulkan::InstanceFunctions lazy(instance, get_instance_proc_addr, log);
+  Time(log, "Table, resolved on first call", lazy.vkEnumeratePhysicalDevices);
+  return 0;
+}
@@ -0,0 +1,125 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times inserts, lookups and erases on containers::flat_hash_map, and on
+// containers::unordered_map, with keys that look like the pointers and
+// non-dispatchable handles that the maps in this repository are keyed by.
+
+#include <random>
+
+#include "benchmarks/benchmark.h"
+#include "support/containers/flat_hash_map.h"
+#include "support/containers/unordered_map.h"
+#include "support/containers/vector.h"
+#include "support/entry/entry.h"
+
+namespace {
+const uint32_t kOperations = 1000000;
+const uint32_t kMapSizes[] = {64, 4096, 262144};
+
+// The costs of each kind of operation on one map, in nanoseconds.
+struct Timings {
+  uint64_t insert_ns;
+  uint64_t hit_ns;
+  uint64_t miss_ns;
+  uint64_t erase_ns;
+  // Summed from the values found, so that the lookups cannot be skipped.
+  uint64_t checksum;
+};
+
+// Fills a map with keys, and then times kOperations lookups of present
+// keys, kOperations lookups of absent keys, and erasing and re-inserting
+// kOperations keys. keys holds the present keys followed by the absent
+// ones, and lookups holds indices into the present keys.
+template <typename Map>
+Timings Run(Map* map, const containers::vector<uint64_t>& keys,
+            size_t present, const containers::vector<uint32_t>& lookups) {
+  Timings timings = {};
+  uint64_t start = benchmark::NowNs();
+  for (size_t i = 0; i < present; ++i) {
+    map->emplace(keys[i], keys[i] >> 4);
+  }
+  timings.insert_ns = benchmark::NowNs() - start;
+
+  uint64_t sum = 0;
+  start = benchmark::NowNs();
+  for (uint32_t index : lookups) {
+    sum += map->find(keys[index])->second;
+  }
+  timings.hit_ns = benchmark::NowNs() - start;
+
+  start = benchmark::NowNs();
+  for (uint32_t index : lookups) {
+    sum += map->count(keys[present + index]);
+  }
+  timings.miss_ns = benchmark::NowNs() - start;
+
+  start = benchmark::NowNs();
+  for (uint32_t index : lookups) {
+    map->erase(keys[index]);
+    map->emplace(keys[index], keys[index] >> 4);
+  }
+  timings.erase_ns = benchmark::NowNs() - start;
+
+  timings.checksum = sum + map->size();
+  return timings;
+}
+
+void Report(logging::Logger* log, const char* name, const Timings& timings) {
+  log->LogInfo(name, ":");
+  benchmark::Report(log, "  find present key", kOperations, timings.hit_ns);
+  benchmark::Report(log, "  find absent key", kOperations, timings.miss_ns);
+  benchmark::Report(log, "  erase and insert", kOperations,
+                    timings.erase_ns);
+}
+}  // anonymous namespace
+
+int main_entry(const entry::entry_data* data) {
+  containers::Allocator* allocator = data->root_allocator;
+  std::minstd_rand random(1);
+
+  for (uint32_t size : kMapSizes) {
+    // Heap pointers and most handles are at least 16 byte aligned, and are
+    // spread over a few gigabytes. Multiplying by an odd number modulo 2^31
+    // scatters the keys without repeating any.
+    containers::vector<uint64_t> keys(allocator);
+    keys.reserve(size * 2);
+    for (uint32_t i = 0; i < size * 2; ++i) {
+      const uint64_t scattered = (i * uint64_t(0x9E3779B1)) & 0x7FFFFFFF;
+      keys.push_back((uint64_t(0x7F00) << 32) | (scattered << 4));
+    }
+    containers::vector<uint32_t> lookups(allocator);
+    lookups.reserve(kOperations);
+    for (uint32_t i = 0; i < kOperations; ++i) {
+      lookups.push_back(random() % size);
+    }
+
+    containers::unordered_map<uint64_t, uint64_t> unordered(allocator);
+    const Timings unordered_timings = Run(&unordered, keys, size, lookups);
+    containers::flat_hash_map<uint64_t, uint64_t> flat(allocator);
+    const Timings flat_timings = Run(&flat, keys, size, lookups);
+
+    data->log->LogInfo(size, " keys:");
+    benchmark::Report(data->log.get(), "unordered_map insert", size,
+                      unordered_timings.insert_ns);
+    benchmark::Report(data->log.get(), "flat_hash_map insert", size,
+                      flat_timings.insert_ns);
+    Report(data->log.get(), "unordered_map", unordered_timings);
+    Report(data->log.get(), "flat_hash_map", flat_timings);
+    data->log->LogInfo("Checksums: ", unordered_timings.checksum, " ",
+                       flat_timings.checksum);
+  }
+  return 0;
+}
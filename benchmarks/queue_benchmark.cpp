@@ -0,0 +1,177 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times passing values between threads through containers::SpscQueue,
+// containers::MpmcQueue and containers::TripleBuffer, and through a
+// containers::deque behind a std::mutex for comparison.
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "benchmarks/benchmark.h"
+#include "support/containers/deque.h"
+#include "support/containers/mpmc_queue.h"
+#include "support/containers/spsc_queue.h"
+#include "support/containers/triple_buffer.h"
+#include "support/containers/vector.h"
+#include "support/entry/entry.h"
+
+namespace {
+const uint32_t kValuesPerProducer = 1000000;
+const size_t kCapacity = 1024;
+
+// A bounded queue that takes a lock for every push and pop, with the same
+// interface as SpscQueue and MpmcQueue.
+class LockedQueue {
+ public:
+  LockedQueue(containers::Allocator* allocator, size_t capacity)
+      : capacity_(capacity), values_(allocator) {}
+
+  bool TryPush(uint32_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (values_.size() == capacity_) {
+      return false;
+    }
+    values_.push_back(value);
+    return true;
+  }
+
+  bool TryPop(uint32_t* value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (values_.empty()) {
+      return false;
+    }
+    *value = values_.front();
+    values_.pop_front();
+    return true;
+  }
+
+ private:
+  const size_t capacity_;
+  std::mutex mutex_;
+  containers::deque<uint32_t> values_;
+};
+
+// Pushes kValuesPerProducer values onto queue.
+template <typename Queue>
+void Produce(Queue* queue) {
+  for (uint32_t i = 0; i < kValuesPerProducer; ++i) {
+    while (!queue->TryPush(i)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+// Pops values from queue until *remaining values have been popped by all
+// of the consumers together, and adds them to *sum.
+template <typename Queue>
+void Consume(Queue* queue, std::atomic<uint64_t>* remaining,
+             std::atomic<uint64_t>* sum) {
+  uint64_t local_sum = 0;
+  uint32_t value;
+  while (remaining->load(std::memory_order_relaxed) > 0) {
+    if (queue->TryPop(&value)) {
+      local_sum += value;
+      remaining->fetch_sub(1, std::memory_order_relaxed);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  *sum += local_sum;
+}
+
+// Passes kValuesPerProducer values from each of producer_count threads to
+// consumer_count threads through queue, and logs how long each transfer
+// took. The sums of the values must match between queues.
+template <typename Queue>
+void Transfer(containers::Allocator* allocator, logging::Logger* log,
+              const char* name, Queue* queue, uint32_t producer_count,
+              uint32_t consumer_count) {
+  const uint64_t count = uint64_t(producer_count) * kValuesPerProducer;
+  std::atomic<uint64_t> remaining(count);
+  std::atomic<uint64_t> sum(0);
+  containers::vector<std::thread> threads(allocator);
+  threads.reserve(producer_count + consumer_count);
+  const uint64_t start = benchmark::NowNs();
+  for (uint32_t i = 0; i < consumer_count; ++i) {
+    threads.push_back(std::thread(Consume<Queue>, queue, &remaining, &sum));
+  }
+  for (uint32_t i = 0; i < producer_count; ++i) {
+    threads.push_back(std::thread(Produce<Queue>, queue));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const uint64_t elapsed = benchmark::NowNs() - start;
+  log->LogInfo(name, ", ", producer_count, " to ", consumer_count,
+               " threads (sum ", sum.load(), "):");
+  benchmark::Report(log, "  transfer", count, elapsed);
+}
+
+// Publishes kValuesPerProducer values through a TripleBuffer while another
+// thread keeps reading the latest one, and logs how long each publish took
+// and how many of the values the reader saw.
+void Publish(logging::Logger* log) {
+  containers::TripleBuffer<uint32_t> buffer;
+  std::atomic<bool> done(false);
+  uint32_t seen = 0;
+  std::thread reader([&buffer, &done, &seen]() {
+    for (;;) {
+      const bool finished = done.load(std::memory_order_acquire);
+      if (buffer.Update()) {
+        ++seen;
+      } else if (finished) {
+        return;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  const uint64_t start = benchmark::NowNs();
+  for (uint32_t i = 0; i < kValuesPerProducer; ++i) {
+    buffer.write_buffer() = i;
+    buffer.Publish();
+  }
+  const uint64_t elapsed = benchmark::NowNs() - start;
+  done.store(true, std::memory_order_release);
+  reader.join();
+  log->LogInfo("TripleBuffer, 1 to 1 threads (last value ",
+               buffer.read_buffer(), ", ", seen, " values seen):");
+  benchmark::Report(log, "  publish", kValuesPerProducer, elapsed);
+}
+}  // anonymous namespace
+
+int main_entry(const entry::entry_data* data) {
+  containers::Allocator* allocator = data->root_allocator;
+  logging::Logger* log = data->log.get();
+
+  {
+    containers::SpscQueue<uint32_t> queue(allocator, kCapacity);
+    Transfer(allocator, log, "SpscQueue", &queue, 1, 1);
+  }
+  for (uint32_t threads = 1; threads <= 4; threads *= 2) {
+    {
+      LockedQueue queue(allocator, kCapacity);
+      Transfer(allocator, log, "Locked deque", &queue, threads, threads);
+    }
+    {
+      containers::MpmcQueue<uint32_t> queue(allocator, kCapacity);
+      Transfer(allocator, log, "MpmcQueue", &queue, threads, threads);
+    }
+  }
+  Publish(log);
+  return 0;
+}
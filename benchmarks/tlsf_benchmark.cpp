@@ -0,0 +1,220 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times random allocate/free pairs on vulkan::TLSFAllocator, and on the
+// size-ordered multimap free-list that VulkanArena used before it.
+
+#include <random>
+
+#include "benchmarks/benchmark.h"
+#include "support/containers/allocator.h"
+#include "support/containers/ordered_multimap.h"
+#include "support/containers/vector.h"
+#include "support/entry/entry.h"
+#include "vulkan_helpers/tlsf_allocator.h"
+
+namespace {
+const ::VkDeviceSize kHeapSize = 256 * 1024 * 1024;
+const uint32_t kLiveSlots = 1024;
+const uint32_t kOperations = 1000000;
+
+// The free-list that VulkanArena used to have: free blocks are kept in a
+// multimap ordered by size, and every allocation constructs a new token.
+class MultimapFreeList {
+ public:
+  struct Token {
+    Token* next;
+    Token* prev;
+    ::VkDeviceSize allocationSize;
+    ::VkDeviceSize offset;
+    containers::ordered_multimap<::VkDeviceSize, Token*>::iterator
+        map_location;
+    bool in_use;
+  };
+
+  MultimapFreeList(containers::Allocator* allocator, ::VkDeviceSize size)
+      : allocator_(allocator), freeblocks_(allocator) {
+    first_block_ = allocator_->construct<Token>(
+        Token{nullptr, nullptr, size, 0, freeblocks_.end(), false});
+    first_block_->map_location =
+        freeblocks_.insert(std::make_pair(size, first_block_));
+  }
+
+  ~MultimapFreeList() {
+    while (first_block_) {
+      Token* next = first_block_->next;
+      allocator_->destroy(first_block_);
+      first_block_ = next;
+    }
+  }
+
+  Token* Allocate(::VkDeviceSize size, ::VkDeviceSize alignment) {
+    const ::VkDeviceSize align_m_1 = alignment - 1;
+    ::VkDeviceSize to_allocate = size + align_m_1;
+    auto it = freeblocks_.lower_bound(to_allocate);
+    if (it == freeblocks_.end()) {
+      return nullptr;
+    }
+    Token* token = it->second;
+    freeblocks_.erase(it);
+
+    ::VkDeviceSize total_offset = (token->offset + align_m_1) & ~align_m_1;
+    ::VkDeviceSize offset_from_start = total_offset - token->offset;
+    ::VkDeviceSize total_allocated =
+        to_allocate - (align_m_1 - offset_from_start);
+
+    token->allocationSize -= total_allocated;
+    token->offset += total_allocated;
+
+    Token* new_token = allocator_->construct<Token>(
+        Token{nullptr, token->prev, total_allocated, total_offset,
+              freeblocks_.end(), true});
+    if (token->allocationSize > 0) {
+      token->map_location =
+          freeblocks_.insert(std::make_pair(token->allocationSize, token));
+      new_token->next = token;
+      if (token->prev) {
+        token->prev->next = new_token;
+      } else {
+        first_block_ = new_token;
+      }
+      token->prev = new_token;
+    } else {
+      new_token->next = token->next;
+      if (token->next) {
+        token->next->prev = new_token;
+      }
+      if (token->prev) {
+        token->prev->next = new_token;
+      } else {
+        first_block_ = new_token;
+      }
+      allocator_->destroy(token);
+    }
+    return new_token;
+  }
+
+  void Free(Token* token) {
+    while (token->prev && !token->prev->in_use) {
+      Token* prev_token = token->prev;
+      prev_token->allocationSize += token->allocationSize;
+      prev_token->next = token->next;
+      if (token->next) {
+        token->next->prev = prev_token;
+      }
+      freeblocks_.erase(prev_token->map_location);
+      allocator_->destroy(token);
+      token = prev_token;
+    }
+    while (token->next && !token->next->in_use) {
+      Token* next_token = token->next;
+      token->allocationSize += next_token->allocationSize;
+      token->next = next_token->next;
+      if (token->next) {
+        token->next->prev = token;
+      }
+      freeblocks_.erase(next_token->map_location);
+      allocator_->destroy(next_token);
+    }
+    token->in_use = false;
+    token->map_location =
+        freeblocks_.insert(std::make_pair(token->allocationSize, token));
+  }
+
+ private:
+  containers::Allocator* allocator_;
+  containers::ordered_multimap<::VkDeviceSize, Token*> freeblocks_;
+  Token* first_block_;
+};
+
+// One step of the pattern. If the slot is in use, it is freed, otherwise
+// size bytes with the given alignment are allocated into it.
+struct Operation {
+  uint32_t slot;
+  ::VkDeviceSize size;
+  ::VkDeviceSize alignment;
+};
+
+// Runs operations against heap, and returns how long they took in
+// nanoseconds. *checksum is set to the sum of every allocated offset.
+template <typename Heap, typename Token>
+uint64_t Run(Heap* heap, const containers::vector<Operation>& operations,
+             containers::vector<Token*>* slots, uint64_t* checksum) {
+  uint64_t sum = 0;
+  uint64_t start = benchmark::NowNs();
+  for (const Operation& op : operations) {
+    Token*& slot = (*slots)[op.slot];
+    if (slot) {
+      heap->Free(slot);
+      slot = nullptr;
+    } else {
+      slot = heap->Allocate(op.size, op.alignment);
+      sum += slot ? slot->offset : 0;
+    }
+  }
+  uint64_t elapsed = benchmark::NowNs() - start;
+  for (Token*& slot : *slots) {
+    if (slot) {
+      heap->Free(slot);
+      slot = nullptr;
+    }
+  }
+  *checksum = sum;
+  return elapsed;
+}
+}  // anonymous namespace
+
+int main_entry(const entry::entry_data* data) {
+  containers::Allocator* allocator = data->root_allocator;
+
+  // Sizes and alignments roughly follow what buffers and images ask for.
+  std::minstd_rand random(1);
+  std::uniform_int_distribution<uint32_t> slot_distribution(0, kLiveSlots - 1);
+  std::uniform_int_distribution<uint32_t> size_distribution(1, 64 * 1024);
+  const ::VkDeviceSize alignments[] = {16, 256, 1024, 4096};
+  containers::vector<Operation> operations(allocator);
+  operations.reserve(kOperations);
+  for (uint32_t i = 0; i < kOperations; ++i) {
+    operations.push_back(Operation{slot_distribution(random),
+                                   size_distribution(random),
+                                   alignments[random() % 4]});
+  }
+
+  uint64_t multimap_checksum = 0;
+  uint64_t multimap_ns = 0;
+  {
+    MultimapFreeList heap(allocator, kHeapSize);
+    containers::vector<MultimapFreeList::Token*> slots(kLiveSlots, nullptr,
+                                                       allocator);
+    multimap_ns = Run(&heap, operations, &slots, &multimap_checksum);
+  }
+
+  uint64_t tlsf_checksum = 0;
+  uint64_t tlsf_ns = 0;
+  {
+    vulkan::TLSFAllocator heap(allocator, kHeapSize);
+    containers::vector<vulkan::AllocationToken*> slots(kLiveSlots, nullptr,
+                                                       allocator);
+    tlsf_ns = Run(&heap, operations, &slots, &tlsf_checksum);
+  }
+
+  benchmark::Report(data->log.get(), "multimap", kOperations, multimap_ns);
+  benchmark::Report(data->log.get(), "tlsf", kOperations, tlsf_ns);
+  // The offsets differ between the two, printing them keeps the allocations
+  // from being optimized away.
+  data->log->LogInfo("Offset checksums: ", multimap_checksum, " ",
+                     tlsf_checksum);
+  return 0;
+}
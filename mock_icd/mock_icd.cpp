@@ -0,0 +1,1309 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mock_icd/mock_icd.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "mock_icd/objects.h"
+#include "mock_icd/physical_device.h"
+#include "support/containers/allocator.h"
+
+#if defined(_WIN32)
+#define MOCK_ICD_EXPORT extern "C" __declspec(dllexport)
+#else
+#define MOCK_ICD_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace mock_icd {
+
+containers::Allocator* GetAllocator() {
+  static containers::LeakCheckAllocator allocator;
+  return &allocator;
+}
+
+uint64_t Now() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+namespace {
+// How often a wait looks again at fences that have not been submitted yet,
+// in case another thread submits them.
+const uint64_t kPollNanoseconds = 100 * 1000;
+
+// The index of every entry point in kEntryPoints. The functions that
+// function_list.h leaves out, because nothing can resolve them through an
+// instance or a device, come first.
+enum EntryPointIndex : uint32_t {
+  vkCreateInstanceIndex,
+  vkEnumerateInstanceExtensionPropertiesIndex,
+  vkEnumerateInstanceLayerPropertiesIndex,
+  vkGetInstanceProcAddrIndex,
+  vkGetDeviceProcAddrIndex,
+#define VULKAN_INSTANCE_FUNCTION(function) function##Index,
+#define VULKAN_DEVICE_FUNCTION(function) function##Index,
+#define VULKAN_QUEUE_FUNCTION(function) function##Index,
+#define VULKAN_COMMAND_BUFFER_FUNCTION(function) function##Index,
+#include "vulkan_wrapper/function_list.h"
+  kEntryPointCount
+};
+
+// Everything that the entry points share.
+struct State {
+  State();
+  // What each entry point does once it has been counted. This starts as the
+  // default implementation in kEntryPoints, or as the one in
+  // kImplementations if there is one.
+  PFN_vkVoidFunction implementations[kEntryPointCount];
+  std::atomic<uint64_t> calls[kEntryPointCount];
+  std::atomic<uint64_t> costs[kEntryPointCount];
+  std::atomic<uint64_t> submit_latency;
+};
+
+State& GetState() {
+  static State state;
+  return state;
+}
+
+// Counts a call to an entry point, and makes it take as long as its cost.
+class ScopedCall {
+ public:
+  ScopedCall(State* state, uint32_t index)
+      : cost_(state->costs[index].load(std::memory_order_relaxed)),
+        start_(cost_ ? Now() : 0) {
+    state->calls[index].fetch_add(1, std::memory_order_relaxed);
+  }
+  ~ScopedCall() {
+    // This spins rather than sleeps, since sleeps are far coarser than the
+    // cost of most calls to a real driver.
+    if (cost_) {
+      while (Now() - start_ < cost_) {
+      }
+    }
+  }
+
+ private:
+  const uint64_t cost_;
+  const uint64_t start_;
+};
+
+// What every entry point that is not implemented below returns.
+template <typename R>
+struct DefaultResult {
+  static R Get() { return R(); }
+};
+template <>
+struct DefaultResult<void> {
+  static void Get() {}
+};
+template <>
+struct DefaultResult<VkResult> {
+  static VkResult Get() { return VK_SUCCESS; }
+};
+// The only commands that return a VkBool32 ask whether a queue family can
+// present.
+template <>
+struct DefaultResult<VkBool32> {
+  static VkBool32 Get() { return VK_TRUE; }
+};
+
+// The function that the application calls for the entry point at Index.
+template <uint32_t Index, typename F>
+struct EntryPoint;
+template <uint32_t Index, typename R, typename... P>
+struct EntryPoint<Index, R(VKAPI_PTR*)(P...)> {
+  static R VKAPI_CALL Call(P... parameters) {
+    State& state = GetState();
+    ScopedCall call(&state, Index);
+    return reinterpret_cast<R(VKAPI_PTR*)(P...)>(
+        state.implementations[Index])(parameters...);
+  }
+};
+
+// The default implementation of entry points other than commands.
+template <typename F>
+struct Default;
+template <typename R, typename... P>
+struct Default<R(VKAPI_PTR*)(P...)> {
+  static R VKAPI_CALL Call(P...) { return DefaultResult<R>::Get(); }
+};
+
+// The default implementation of commands, which records them into the
+// command buffer.
+template <uint32_t Index, typename F>
+struct RecordCommand;
+template <uint32_t Index, typename R, typename... P>
+struct RecordCommand<Index, R(VKAPI_PTR*)(VkCommandBuffer, P...)> {
+  static R VKAPI_CALL Call(VkCommandBuffer command_buffer, P... parameters) {
+    FromHandle<CommandBuffer>(command_buffer)->Record(Index, parameters...);
+    return DefaultResult<R>::Get();
+  }
+};
+
+// Which vkGet*ProcAddr can resolve an entry point.
+enum Scope : uint8_t { kGlobalScope, kInstanceScope, kDeviceScope };
+
+struct EntryPointInfo {
+  const char* name;
+  Scope scope;
+  PFN_vkVoidFunction entry_point;
+  PFN_vkVoidFunction default_implementation;
+};
+
+#define ENTRY_POINT(function, scope)                                    \
+  {#function, scope,                                                    \
+   reinterpret_cast<PFN_vkVoidFunction>(                                \
+       &EntryPoint<function##Index, PFN_##function>::Call),             \
+   reinterpret_cast<PFN_vkVoidFunction>(&Default<PFN_##function>::Call)},
+#define COMMAND_ENTRY_POINT(function)                        \
+  {#function, kDeviceScope,                                  \
+   reinterpret_cast<PFN_vkVoidFunction>(                     \
+       &EntryPoint<function##Index, PFN_##function>::Call),  \
+   reinterpret_cast<PFN_vkVoidFunction>(                     \
+       &RecordCommand<function##Index, PFN_##function>::Call)},
+
+// In the order of EntryPointIndex.
+const EntryPointInfo kEntryPoints[] = {
+    ENTRY_POINT(vkCreateInstance, kGlobalScope)
+    ENTRY_POINT(vkEnumerateInstanceExtensionProperties, kGlobalScope)
+    ENTRY_POINT(vkEnumerateInstanceLayerProperties, kGlobalScope)
+    ENTRY_POINT(vkGetInstanceProcAddr, kGlobalScope)
+    ENTRY_POINT(vkGetDeviceProcAddr, kInstanceScope)
+#define VULKAN_INSTANCE_FUNCTION(function) \
+  ENTRY_POINT(function, kInstanceScope)
+#define VULKAN_DEVICE_FUNCTION(function) ENTRY_POINT(function, kDeviceScope)
+#define VULKAN_QUEUE_FUNCTION(function) ENTRY_POINT(function, kDeviceScope)
+#define VULKAN_COMMAND_BUFFER_FUNCTION(function) COMMAND_ENTRY_POINT(function)
+#include "vulkan_wrapper/function_list.h"
+};
+#undef ENTRY_POINT
+#undef COMMAND_ENTRY_POINT
+static_assert(sizeof(kEntryPoints) / sizeof(kEntryPoints[0]) ==
+                  kEntryPointCount,
+              "Every entry point needs an index");
+
+// Returns the entry point called name, if its scope is between min_scope
+// and max_scope.
+PFN_vkVoidFunction FindEntryPoint(const char* name, Scope min_scope,
+                                  Scope max_scope) {
+  for (const EntryPointInfo& entry_point : kEntryPoints) {
+    if (strcmp(entry_point.name, name) == 0) {
+      return entry_point.scope >= min_scope && entry_point.scope <= max_scope
+                 ? entry_point.entry_point
+                 : nullptr;
+    }
+  }
+  return nullptr;
+}
+
+// Copies source_count elements to destination, in the usual way of Vulkan
+// enumerations.
+template <typename T>
+VkResult Enumerate(const T* source, uint32_t source_count, uint32_t* count,
+                   T* destination) {
+  if (!destination) {
+    *count = source_count;
+    return VK_SUCCESS;
+  }
+  const uint32_t copied = std::min(*count, source_count);
+  std::copy(source, source + copied, destination);
+  *count = copied;
+  return copied < source_count ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+// Enumerations of things that the mock ICD has none of.
+template <typename R, typename T>
+VKAPI_ATTR R VKAPI_CALL EnumerateNothing(uint32_t* count, T*) {
+  *count = 0;
+  return DefaultResult<R>::Get();
+}
+template <typename R, typename A, typename T>
+VKAPI_ATTR R VKAPI_CALL EnumerateNothing(A, uint32_t* count, T*) {
+  *count = 0;
+  return DefaultResult<R>::Get();
+}
+template <typename R, typename A, typename B, typename T>
+VKAPI_ATTR R VKAPI_CALL EnumerateNothing(A, B, uint32_t* count, T*) {
+  *count = 0;
+  return DefaultResult<R>::Get();
+}
+
+// Makes an object that holds no state.
+template <typename D, typename I, typename H>
+VKAPI_ATTR VkResult VKAPI_CALL CreateObject(
+    D, const I*, const VkAllocationCallbacks* allocator, H* handle) {
+  Object* object = New<Object>(allocator);
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *handle = ToHandle<H>(object);
+  return VK_SUCCESS;
+}
+
+template <typename T, typename D, typename H>
+VKAPI_ATTR void VKAPI_CALL DestroyObject(
+    D, H handle, const VkAllocationCallbacks* allocator) {
+  Delete(allocator, FromHandle<T>(handle));
+}
+
+const VkExtensionProperties kInstanceExtensions[] = {
+    {VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_SURFACE_SPEC_VERSION},
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+    {VK_KHR_XCB_SURFACE_EXTENSION_NAME, VK_KHR_XCB_SURFACE_SPEC_VERSION},
+#endif
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    {VK_KHR_ANDROID_SURFACE_EXTENSION_NAME,
+     VK_KHR_ANDROID_SURFACE_SPEC_VERSION},
+#endif
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {VK_KHR_WIN32_SURFACE_EXTENSION_NAME, VK_KHR_WIN32_SURFACE_SPEC_VERSION},
+#endif
+};
+
+const VkExtensionProperties kDeviceExtensions[] = {
+    {VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_SWAPCHAIN_SPEC_VERSION},
+    {VK_NV_DEDICATED_ALLOCATION_EXTENSION_NAME,
+     VK_NV_DEDICATED_ALLOCATION_SPEC_VERSION},
+};
+
+// Returns true if every one of names is in extensions.
+template <size_t N>
+bool SupportsExtensions(const VkExtensionProperties (&extensions)[N],
+                        const char* const* names, uint32_t count) {
+  for (uint32_t i = 0; i < count; ++i) {
+    const VkExtensionProperties* end = extensions + N;
+    if (std::find_if(extensions, end,
+                     [&](const VkExtensionProperties& extension) {
+                       return strcmp(extension.extensionName, names[i]) == 0;
+                     }) == end) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns the layout of mip_level in the first array layer of image, and
+// the size of each array layer. Each layer holds all of its mip levels, one
+// after the other.
+VkDeviceSize GetLayerLayout(const Image& image, uint32_t mip_level,
+                            VkSubresourceLayout* layout) {
+  FormatBlock block = GetFormatBlock(image.format);
+  if (block.size == 0) {
+    // Formats that this does not know take as much as the largest texel.
+    block = {16, 1, 1};
+  }
+  VkDeviceSize layer_size = 0;
+  for (uint32_t level = 0; level < image.mip_levels; ++level) {
+    const uint32_t width = std::max(image.extent.width >> level, 1u);
+    const uint32_t height = std::max(image.extent.height >> level, 1u);
+    const uint32_t depth = std::max(image.extent.depth >> level, 1u);
+    const VkDeviceSize row_pitch =
+        VkDeviceSize((width + block.width - 1) / block.width) * block.size;
+    const VkDeviceSize depth_pitch =
+        row_pitch * ((height + block.height - 1) / block.height);
+    const VkDeviceSize size = depth_pitch * depth * image.samples;
+    if (level == mip_level) {
+      layout->offset = layer_size;
+      layout->size = size;
+      layout->rowPitch = row_pitch;
+      layout->depthPitch = depth_pitch;
+    }
+    layer_size += size;
+  }
+  layout->arrayPitch = layer_size;
+  return layer_size;
+}
+
+// Makes the work submitted to queue complete after the submit latency, and
+// signals fence then.
+void Submit(VkQueue queue, VkFence fence) {
+  const uint64_t latency =
+      GetState().submit_latency.load(std::memory_order_relaxed);
+  // Without a latency, everything is complete as soon as it is submitted,
+  // and there is no need to look at the clock.
+  const uint64_t completion = latency ? Now() + latency : 0;
+  std::atomic<uint64_t>& idle_time = FromHandle<Queue>(queue)->idle_time;
+  uint64_t previous = idle_time.load();
+  while (previous < completion &&
+         !idle_time.compare_exchange_weak(previous, completion)) {
+  }
+  if (fence != VK_NULL_HANDLE) {
+    FromHandle<Fence>(fence)->signal_time.store(completion);
+  }
+}
+
+void WaitUntil(uint64_t time) {
+  const uint64_t now = Now();
+  if (time > now) {
+    std::this_thread::sleep_for(std::chrono::nanoseconds(time - now));
+  }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateInstance(const VkInstanceCreateInfo* create_info,
+               const VkAllocationCallbacks* allocator, VkInstance* instance) {
+  if (!SupportsExtensions(kInstanceExtensions,
+                          create_info->ppEnabledExtensionNames,
+                          create_info->enabledExtensionCount)) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+  Instance* object = New<Instance>(allocator);
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *instance = ToHandle<VkInstance>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+EnumerateInstanceExtensionProperties(const char* layer_name, uint32_t* count,
+                                     VkExtensionProperties* properties) {
+  if (layer_name) {
+    return VK_ERROR_LAYER_NOT_PRESENT;
+  }
+  return Enumerate(kInstanceExtensions,
+                   sizeof(kInstanceExtensions) / sizeof(kInstanceExtensions[0]),
+                   count, properties);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL
+GetInstanceProcAddr(VkInstance instance, const char* name) {
+  return FindEntryPoint(name, kGlobalScope,
+                        instance ? kDeviceScope : kGlobalScope);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice,
+                                                           const char* name) {
+  return FindEntryPoint(name, kDeviceScope, kDeviceScope);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyInstance(
+    VkInstance instance, const VkAllocationCallbacks* allocator) {
+  Delete(allocator, FromHandle<Instance>(instance));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(
+    VkInstance instance, uint32_t* count, VkPhysicalDevice* physical_devices) {
+  const VkPhysicalDevice physical_device = ToHandle<VkPhysicalDevice>(
+      &FromHandle<Instance>(instance)->physical_device);
+  return Enumerate(&physical_device, 1, count, physical_devices);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFeatures(
+    VkPhysicalDevice, VkPhysicalDeviceFeatures* features) {
+  DescribeFeatures(features);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceFormatProperties(
+    VkPhysicalDevice, VkFormat format, VkFormatProperties* properties) {
+  DescribeFormat(format, properties);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties(
+    VkPhysicalDevice, VkFormat format, VkImageType type, VkImageTiling,
+    VkImageUsageFlags, VkImageCreateFlags,
+    VkImageFormatProperties* properties) {
+  return DescribeImageFormat(format, type, properties);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceProperties(
+    VkPhysicalDevice, VkPhysicalDeviceProperties* properties) {
+  DescribePhysicalDevice(properties);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyProperties(
+    VkPhysicalDevice, uint32_t* count, VkQueueFamilyProperties* properties) {
+  VkQueueFamilyProperties families[kQueueFamilyCount];
+  for (uint32_t i = 0; i < kQueueFamilyCount; ++i) {
+    DescribeQueueFamily(i, &families[i]);
+  }
+  Enumerate(families, kQueueFamilyCount, count, properties);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(
+    VkPhysicalDevice, VkPhysicalDeviceMemoryProperties* properties) {
+  DescribeMemory(properties);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(
+    VkPhysicalDevice, VkFormat, VkImageType, VkSampleCountFlagBits,
+    VkImageUsageFlags, VkImageTiling, uint32_t* count,
+    VkSparseImageFormatProperties*) {
+  *count = 0;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateDevice(VkPhysicalDevice, const VkDeviceCreateInfo* create_info,
+             const VkAllocationCallbacks* allocator, VkDevice* device) {
+  if (!SupportsExtensions(kDeviceExtensions,
+                          create_info->ppEnabledExtensionNames,
+                          create_info->enabledExtensionCount)) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+  Device* object = New<Device>(allocator, GetAllocator());
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  for (uint32_t i = 0; i < create_info->queueCreateInfoCount; ++i) {
+    const VkDeviceQueueCreateInfo& queue_info =
+        create_info->pQueueCreateInfos[i];
+    for (uint32_t j = 0; j < queue_info.queueCount; ++j) {
+      object->queues.push_back(containers::make_unique<Queue>(
+          GetAllocator(), queue_info.queueFamilyIndex, j));
+    }
+  }
+  *device = ToHandle<VkDevice>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDevice(
+    VkDevice device, const VkAllocationCallbacks* allocator) {
+  Delete(allocator, FromHandle<Device>(device));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(
+    VkPhysicalDevice, const char* layer_name, uint32_t* count,
+    VkExtensionProperties* properties) {
+  if (layer_name) {
+    return VK_ERROR_LAYER_NOT_PRESENT;
+  }
+  return Enumerate(kDeviceExtensions,
+                   sizeof(kDeviceExtensions) / sizeof(kDeviceExtensions[0]),
+                   count, properties);
+}
+
+VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device,
+                                          uint32_t family_index,
+                                          uint32_t index, VkQueue* queue) {
+  *queue = VK_NULL_HANDLE;
+  for (auto& candidate : FromHandle<Device>(device)->queues) {
+    if (candidate->family_index == family_index && candidate->index == index) {
+      *queue = ToHandle<VkQueue>(candidate.get());
+    }
+  }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t,
+                                           const VkSubmitInfo*,
+                                           VkFence fence) {
+  Submit(queue, fence);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t,
+                                               const VkBindSparseInfo*,
+                                               VkFence fence) {
+  Submit(queue, fence);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
+  WaitUntil(FromHandle<Queue>(queue)->idle_time.load());
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
+  uint64_t idle_time = 0;
+  for (auto& queue : FromHandle<Device>(device)->queues) {
+    idle_time = std::max(idle_time, queue->idle_time.load());
+  }
+  WaitUntil(idle_time);
+  return VK_SUCCESS;
+}
+
+// Device memory is plain host memory. It is not cleared, just like the
+// memory of a real device.
+VKAPI_ATTR VkResult VKAPI_CALL
+AllocateMemory(VkDevice, const VkMemoryAllocateInfo* allocate_info,
+               const VkAllocationCallbacks* allocator, VkDeviceMemory* memory) {
+  const VkDeviceSize size = allocate_info->allocationSize;
+  if (size > SIZE_MAX) {
+    return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+  }
+  void* data = GetAllocator()->malloc(static_cast<size_t>(size));
+  if (!data) {
+    return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+  }
+  DeviceMemory* object =
+      New<DeviceMemory>(allocator, DeviceMemory{static_cast<uint8_t*>(data),
+                                                size});
+  if (!object) {
+    GetAllocator()->free(data, static_cast<size_t>(size));
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *memory = ToHandle<VkDeviceMemory>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice, VkDeviceMemory memory,
+                                      const VkAllocationCallbacks* allocator) {
+  DeviceMemory* object = FromHandle<DeviceMemory>(memory);
+  if (object) {
+    GetAllocator()->free(object->data, static_cast<size_t>(object->size));
+  }
+  Delete(allocator, object);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice, VkDeviceMemory memory,
+                                         VkDeviceSize offset, VkDeviceSize,
+                                         VkMemoryMapFlags, void** data) {
+  *data = FromHandle<DeviceMemory>(memory)->data + offset;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(VkDevice,
+                                                     VkDeviceMemory memory,
+                                                     VkDeviceSize* bytes) {
+  *bytes = FromHandle<DeviceMemory>(memory)->size;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateBuffer(VkDevice, const VkBufferCreateInfo* create_info,
+             const VkAllocationCallbacks* allocator, VkBuffer* buffer) {
+  Buffer* object = New<Buffer>(allocator, Buffer{create_info->size});
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *buffer = ToHandle<VkBuffer>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(
+    VkDevice, VkBuffer buffer, VkMemoryRequirements* requirements) {
+  requirements->size =
+      RoundUp(FromHandle<Buffer>(buffer)->size, kResourceAlignment);
+  requirements->alignment = kResourceAlignment;
+  requirements->memoryTypeBits = kAllMemoryTypeBits;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateImage(VkDevice, const VkImageCreateInfo* create_info,
+            const VkAllocationCallbacks* allocator, VkImage* image) {
+  Image* object = New<Image>(
+      allocator, Image{create_info->imageType, create_info->format,
+                       create_info->extent, create_info->mipLevels,
+                       create_info->arrayLayers, create_info->samples});
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *image = ToHandle<VkImage>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(
+    VkDevice, VkImage image, VkMemoryRequirements* requirements) {
+  const Image& object = *FromHandle<Image>(image);
+  VkSubresourceLayout layout;
+  const VkDeviceSize size =
+      GetLayerLayout(object, 0, &layout) * object.array_layers;
+  requirements->size = RoundUp(size, kResourceAlignment);
+  requirements->alignment = kResourceAlignment;
+  requirements->memoryTypeBits = kAllMemoryTypeBits;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
+    VkDevice, VkImage image, const VkImageSubresource* subresource,
+    VkSubresourceLayout* layout) {
+  const VkDeviceSize layer_size = GetLayerLayout(
+      *FromHandle<Image>(image), subresource->mipLevel, layout);
+  layout->offset += layer_size * subresource->arrayLayer;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateFence(VkDevice, const VkFenceCreateInfo* create_info,
+            const VkAllocationCallbacks* allocator, VkFence* fence) {
+  Fence* object = New<Fence>(
+      allocator,
+      (create_info->flags & VK_FENCE_CREATE_SIGNALED_BIT) ? 0 : kNever);
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *fence = ToHandle<VkFence>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice, uint32_t count,
+                                           const VkFence* fences) {
+  for (uint32_t i = 0; i < count; ++i) {
+    FromHandle<Fence>(fences[i])->signal_time.store(kNever);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice, VkFence fence) {
+  return FromHandle<Fence>(fence)->signal_time.load() <= Now() ? VK_SUCCESS
+                                                                : VK_NOT_READY;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice, uint32_t count,
+                                             const VkFence* fences,
+                                             VkBool32 wait_all,
+                                             uint64_t timeout) {
+  uint64_t now = Now();
+  const uint64_t deadline = timeout > kNever - now ? kNever : now + timeout;
+  for (;;) {
+    // When the fences that are waited for are all, or any, signaled.
+    uint64_t signal_time = wait_all ? 0 : kNever;
+    for (uint32_t i = 0; i < count; ++i) {
+      const uint64_t time = FromHandle<Fence>(fences[i])->signal_time.load();
+      signal_time = wait_all ? std::max(signal_time, time)
+                             : std::min(signal_time, time);
+    }
+    if (signal_time <= now) {
+      return VK_SUCCESS;
+    }
+    if (now >= deadline) {
+      return VK_TIMEOUT;
+    }
+    WaitUntil(std::min(std::min(signal_time, deadline),
+                       now + kPollNanoseconds));
+    now = Now();
+  }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateEvent(VkDevice, const VkEventCreateInfo*,
+            const VkAllocationCallbacks* allocator, VkEvent* event) {
+  Event* object = New<Event>(allocator, false);
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *event = ToHandle<VkEvent>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(VkDevice, VkEvent event) {
+  return FromHandle<Event>(event)->signaled.load() ? VK_EVENT_SET
+                                                   : VK_EVENT_RESET;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice, VkEvent event) {
+  FromHandle<Event>(event)->signaled.store(true);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice, VkEvent event) {
+  FromHandle<Event>(event)->signaled.store(false);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateQueryPool(VkDevice, const VkQueryPoolCreateInfo* create_info,
+                const VkAllocationCallbacks* allocator, VkQueryPool* pool) {
+  QueryPool* object = New<QueryPool>(
+      allocator, QueryPool{create_info->queryType, create_info->queryCount,
+                           create_info->pipelineStatistics});
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *pool = ToHandle<VkQueryPool>(object);
+  return VK_SUCCESS;
+}
+
+// Nothing is ever drawn, so every query is available and counted nothing.
+VKAPI_ATTR VkResult VKAPI_CALL
+GetQueryPoolResults(VkDevice, VkQueryPool pool, uint32_t, uint32_t count,
+                    size_t data_size, void* data, VkDeviceSize stride,
+                    VkQueryResultFlags flags) {
+  const QueryPool& object = *FromHandle<QueryPool>(pool);
+  uint32_t values = 1;
+  if (object.type == VK_QUERY_TYPE_PIPELINE_STATISTICS) {
+    values = 0;
+    for (uint32_t bits = object.pipeline_statistics; bits; bits &= bits - 1) {
+      ++values;
+    }
+  }
+  const bool availability =
+      (flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT) != 0;
+  const size_t value_size =
+      (flags & VK_QUERY_RESULT_64_BIT) ? sizeof(uint64_t) : sizeof(uint32_t);
+  const size_t result_size = (values + (availability ? 1 : 0)) * value_size;
+  const uint64_t available = 1;
+  uint8_t* result = static_cast<uint8_t*>(data);
+  for (uint32_t i = 0; i < count; ++i, result += stride) {
+    if (i * stride + result_size > data_size) {
+      break;
+    }
+    memset(result, 0, result_size);
+    if (availability) {
+      // The value is little-endian, so its first bytes are the same whether
+      // the results are 32 or 64 bits.
+      memcpy(result + values * value_size, &available, value_size);
+    }
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice,
+                                                    VkPipelineCache,
+                                                    size_t* size, void* data) {
+  // The cache holds nothing but the header that every cache starts with.
+  const size_t kHeaderSize = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+  if (!data) {
+    *size = kHeaderSize;
+    return VK_SUCCESS;
+  }
+  if (*size < kHeaderSize) {
+    *size = 0;
+    return VK_INCOMPLETE;
+  }
+  VkPhysicalDeviceProperties properties;
+  DescribePhysicalDevice(&properties);
+  const uint32_t header[] = {static_cast<uint32_t>(kHeaderSize),
+                             VK_PIPELINE_CACHE_HEADER_VERSION_ONE,
+                             properties.vendorID, properties.deviceID};
+  memcpy(data, header, sizeof(header));
+  memcpy(static_cast<uint8_t*>(data) + sizeof(header),
+         properties.pipelineCacheUUID, VK_UUID_SIZE);
+  *size = kHeaderSize;
+  return VK_SUCCESS;
+}
+
+template <typename I>
+VKAPI_ATTR VkResult VKAPI_CALL
+CreatePipelines(VkDevice, VkPipelineCache, uint32_t count, const I*,
+                const VkAllocationCallbacks* allocator, VkPipeline* pipelines) {
+  for (uint32_t i = 0; i < count; ++i) {
+    Object* object = New<Object>(allocator);
+    if (!object) {
+      for (uint32_t j = 0; j < i; ++j) {
+        Delete(allocator, FromHandle<Object>(pipelines[j]));
+      }
+      std::fill(pipelines, pipelines + count, VkPipeline(VK_NULL_HANDLE));
+      return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    pipelines[i] = ToHandle<VkPipeline>(object);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateDescriptorPool(VkDevice, const VkDescriptorPoolCreateInfo*,
+                     const VkAllocationCallbacks* allocator,
+                     VkDescriptorPool* pool) {
+  DescriptorPool* object = New<DescriptorPool>(allocator, GetAllocator());
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *pool = ToHandle<VkDescriptorPool>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice,
+                                                   VkDescriptorPool pool,
+                                                   VkDescriptorPoolResetFlags) {
+  DescriptorPool* object = FromHandle<DescriptorPool>(pool);
+  for (Object* set : object->sets) {
+    Delete(nullptr, set);
+  }
+  object->sets.clear();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(
+    VkDevice device, VkDescriptorPool pool,
+    const VkAllocationCallbacks* allocator) {
+  if (pool == VK_NULL_HANDLE) {
+    return;
+  }
+  ResetDescriptorPool(device, pool, 0);
+  Delete(allocator, FromHandle<DescriptorPool>(pool));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+AllocateDescriptorSets(VkDevice, const VkDescriptorSetAllocateInfo* info,
+                       VkDescriptorSet* sets) {
+  DescriptorPool* pool = FromHandle<DescriptorPool>(info->descriptorPool);
+  for (uint32_t i = 0; i < info->descriptorSetCount; ++i) {
+    Object* set = New<Object>(nullptr);
+    pool->sets.insert(set);
+    sets[i] = ToHandle<VkDescriptorSet>(set);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(VkDevice,
+                                                  VkDescriptorPool pool,
+                                                  uint32_t count,
+                                                  const VkDescriptorSet* sets) {
+  DescriptorPool* object = FromHandle<DescriptorPool>(pool);
+  for (uint32_t i = 0; i < count; ++i) {
+    Object* set = FromHandle<Object>(sets[i]);
+    if (set) {
+      object->sets.erase(set);
+      Delete(nullptr, set);
+    }
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice, VkRenderPass,
+                                                    VkExtent2D* granularity) {
+  *granularity = {1, 1};
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateCommandPool(VkDevice, const VkCommandPoolCreateInfo*,
+                  const VkAllocationCallbacks* allocator,
+                  VkCommandPool* pool) {
+  CommandPool* object = New<CommandPool>(allocator, GetAllocator());
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *pool = ToHandle<VkCommandPool>(object);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(
+    VkDevice, VkCommandPool pool, const VkAllocationCallbacks* allocator) {
+  CommandPool* object = FromHandle<CommandPool>(pool);
+  if (!object) {
+    return;
+  }
+  for (CommandBuffer* command_buffer : object->command_buffers) {
+    Delete(nullptr, command_buffer);
+  }
+  Delete(allocator, object);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice, VkCommandPool pool,
+                                                VkCommandPoolResetFlags) {
+  for (CommandBuffer* command_buffer :
+       FromHandle<CommandPool>(pool)->command_buffers) {
+    command_buffer->Reset();
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+AllocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo* info,
+                       VkCommandBuffer* command_buffers) {
+  CommandPool* pool = FromHandle<CommandPool>(info->commandPool);
+  for (uint32_t i = 0; i < info->commandBufferCount; ++i) {
+    CommandBuffer* command_buffer =
+        New<CommandBuffer>(nullptr, GetAllocator(), pool);
+    pool->command_buffers.insert(command_buffer);
+    command_buffers[i] = ToHandle<VkCommandBuffer>(command_buffer);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(
+    VkDevice, VkCommandPool pool, uint32_t count,
+    const VkCommandBuffer* command_buffers) {
+  CommandPool* object = FromHandle<CommandPool>(pool);
+  for (uint32_t i = 0; i < count; ++i) {
+    CommandBuffer* command_buffer =
+        FromHandle<CommandBuffer>(command_buffers[i]);
+    if (command_buffer) {
+      object->command_buffers.erase(command_buffer);
+      Delete(nullptr, command_buffer);
+    }
+  }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+BeginCommandBuffer(VkCommandBuffer command_buffer,
+                   const VkCommandBufferBeginInfo*) {
+  FromHandle<CommandBuffer>(command_buffer)->Reset();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(
+    VkCommandBuffer command_buffer, VkCommandBufferResetFlags) {
+  FromHandle<CommandBuffer>(command_buffer)->Reset();
+  return VK_SUCCESS;
+}
+
+// Every queue family can present to any surface.
+VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(
+    VkPhysicalDevice, uint32_t, VkSurfaceKHR, VkBool32* supported) {
+  *supported = VK_TRUE;
+  return VK_SUCCESS;
+}
+
+// Any surface can show any size of image, which the application picks.
+VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilitiesKHR(
+    VkPhysicalDevice, VkSurfaceKHR, VkSurfaceCapabilitiesKHR* capabilities) {
+  capabilities->minImageCount = 2;
+  capabilities->maxImageCount = 8;
+  capabilities->currentExtent = {0xFFFFFFFF, 0xFFFFFFFF};
+  capabilities->minImageExtent = {1, 1};
+  capabilities->maxImageExtent = {16384, 16384};
+  capabilities->maxImageArrayLayers = 1;
+  capabilities->supportedTransforms = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+  capabilities->currentTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+  capabilities->supportedCompositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+  capabilities->supportedUsageFlags =
+      VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+      VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+      VK_IMAGE_USAGE_STORAGE_BIT;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormatsKHR(
+    VkPhysicalDevice, VkSurfaceKHR, uint32_t* count,
+    VkSurfaceFormatKHR* formats) {
+  const VkSurfaceFormatKHR kFormats[] = {
+      {VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR},
+      {VK_FORMAT_R8G8B8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR}};
+  return Enumerate(kFormats, 2, count, formats);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(
+    VkPhysicalDevice, VkSurfaceKHR, uint32_t* count,
+    VkPresentModeKHR* present_modes) {
+  const VkPresentModeKHR kPresentModes[] = {VK_PRESENT_MODE_FIFO_KHR,
+                                            VK_PRESENT_MODE_MAILBOX_KHR,
+                                            VK_PRESENT_MODE_IMMEDIATE_KHR};
+  return Enumerate(kPresentModes, 3, count, present_modes);
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(
+    VkDevice, VkSwapchainKHR swapchain,
+    const VkAllocationCallbacks* allocator) {
+  Swapchain* object = FromHandle<Swapchain>(swapchain);
+  if (!object) {
+    return;
+  }
+  for (Image* image : object->images) {
+    Delete(nullptr, image);
+  }
+  Delete(allocator, object);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL
+CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* create_info,
+                   const VkAllocationCallbacks* allocator,
+                   VkSwapchainKHR* swapchain) {
+  Swapchain* object = New<Swapchain>(allocator, GetAllocator());
+  if (!object) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  const Image image = {VK_IMAGE_TYPE_2D,
+                       create_info->imageFormat,
+                       {create_info->imageExtent.width,
+                        create_info->imageExtent.height, 1},
+                       1,
+                       create_info->imageArrayLayers,
+                       VK_SAMPLE_COUNT_1_BIT};
+  const uint32_t image_count = std::max(create_info->minImageCount, 1u);
+  for (uint32_t i = 0; i < image_count; ++i) {
+    object->images.push_back(New<Image>(nullptr, image));
+  }
+  *swapchain = ToHandle<VkSwapchainKHR>(object);
+  if (create_info->oldSwapchain != VK_NULL_HANDLE) {
+    DestroySwapchainKHR(device, create_info->oldSwapchain, allocator);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice,
+                                                     VkSwapchainKHR swapchain,
+                                                     uint32_t* count,
+                                                     VkImage* images) {
+  const Swapchain& object = *FromHandle<Swapchain>(swapchain);
+  const uint32_t image_count = static_cast<uint32_t>(object.images.size());
+  if (!images) {
+    *count = image_count;
+    return VK_SUCCESS;
+  }
+  const uint32_t copied = std::min(*count, image_count);
+  for (uint32_t i = 0; i < copied; ++i) {
+    images[i] = ToHandle<VkImage>(object.images[i]);
+  }
+  *count = copied;
+  return copied < image_count ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+// Images are acquired in turn, and are ready as soon as they are acquired.
+VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice,
+                                                   VkSwapchainKHR swapchain,
+                                                   uint64_t, VkSemaphore,
+                                                   VkFence fence,
+                                                   uint32_t* image_index) {
+  Swapchain* object = FromHandle<Swapchain>(swapchain);
+  *image_index = object->next_image;
+  object->next_image = static_cast<uint32_t>(
+      (object->next_image + 1) % object->images.size());
+  if (fence != VK_NULL_HANDLE) {
+    FromHandle<Fence>(fence)->signal_time.store(0);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
+    VkQueue, const VkPresentInfoKHR* present_info) {
+  if (present_info->pResults) {
+    std::fill(present_info->pResults,
+              present_info->pResults + present_info->swapchainCount,
+              VK_SUCCESS);
+  }
+  return VK_SUCCESS;
+}
+
+// The entry points that do something other than their default, in no
+// particular order.
+struct Implementation {
+  uint32_t index;
+  PFN_vkVoidFunction function;
+};
+
+#define IMPLEMENTATION(function, implementation) \
+  {function##Index,                              \
+   reinterpret_cast<PFN_vkVoidFunction>(         \
+       static_cast<PFN_##function>(&implementation))},
+
+const Implementation kImplementations[] = {
+    IMPLEMENTATION(vkCreateInstance, CreateInstance)
+    IMPLEMENTATION(vkEnumerateInstanceExtensionProperties,
+                   EnumerateInstanceExtensionProperties)
+    IMPLEMENTATION(vkEnumerateInstanceLayerProperties, EnumerateNothing)
+    IMPLEMENTATION(vkGetInstanceProcAddr, GetInstanceProcAddr)
+    IMPLEMENTATION(vkGetDeviceProcAddr, GetDeviceProcAddr)
+    IMPLEMENTATION(vkDestroyInstance, DestroyInstance)
+    IMPLEMENTATION(vkEnumeratePhysicalDevices, EnumeratePhysicalDevices)
+    IMPLEMENTATION(vkGetPhysicalDeviceFeatures, GetPhysicalDeviceFeatures)
+    IMPLEMENTATION(vkGetPhysicalDeviceFormatProperties,
+                   GetPhysicalDeviceFormatProperties)
+    IMPLEMENTATION(vkGetPhysicalDeviceImageFormatProperties,
+                   GetPhysicalDeviceImageFormatProperties)
+    IMPLEMENTATION(vkGetPhysicalDeviceProperties, GetPhysicalDeviceProperties)
+    IMPLEMENTATION(vkGetPhysicalDeviceQueueFamilyProperties,
+                   GetPhysicalDeviceQueueFamilyProperties)
+    IMPLEMENTATION(vkGetPhysicalDeviceMemoryProperties,
+                   GetPhysicalDeviceMemoryProperties)
+    IMPLEMENTATION(vkGetPhysicalDeviceSparseImageFormatProperties,
+                   GetPhysicalDeviceSparseImageFormatProperties)
+    IMPLEMENTATION(vkCreateDevice, CreateDevice)
+    IMPLEMENTATION(vkDestroyDevice, DestroyDevice)
+    IMPLEMENTATION(vkEnumerateDeviceExtensionProperties,
+                   EnumerateDeviceExtensionProperties)
+    IMPLEMENTATION(vkEnumerateDeviceLayerProperties, EnumerateNothing)
+    IMPLEMENTATION(vkGetDeviceQueue, GetDeviceQueue)
+    IMPLEMENTATION(vkQueueSubmit, QueueSubmit)
+    IMPLEMENTATION(vkQueueBindSparse, QueueBindSparse)
+    IMPLEMENTATION(vkQueueWaitIdle, QueueWaitIdle)
+    IMPLEMENTATION(vkDeviceWaitIdle, DeviceWaitIdle)
+    IMPLEMENTATION(vkAllocateMemory, AllocateMemory)
+    IMPLEMENTATION(vkFreeMemory, FreeMemory)
+    IMPLEMENTATION(vkMapMemory, MapMemory)
+    IMPLEMENTATION(vkGetDeviceMemoryCommitment, GetDeviceMemoryCommitment)
+    IMPLEMENTATION(vkCreateBuffer, CreateBuffer)
+    IMPLEMENTATION(vkDestroyBuffer, DestroyObject<Buffer>)
+    IMPLEMENTATION(vkGetBufferMemoryRequirements, GetBufferMemoryRequirements)
+    IMPLEMENTATION(vkCreateBufferView, CreateObject)
+    IMPLEMENTATION(vkDestroyBufferView, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreateImage, CreateImage)
+    IMPLEMENTATION(vkDestroyImage, DestroyObject<Image>)
+    IMPLEMENTATION(vkGetImageMemoryRequirements, GetImageMemoryRequirements)
+    IMPLEMENTATION(vkGetImageSparseMemoryRequirements, EnumerateNothing)
+    IMPLEMENTATION(vkGetImageSubresourceLayout, GetImageSubresourceLayout)
+    IMPLEMENTATION(vkCreateImageView, CreateObject)
+    IMPLEMENTATION(vkDestroyImageView, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreateFence, CreateFence)
+    IMPLEMENTATION(vkDestroyFence, DestroyObject<Fence>)
+    IMPLEMENTATION(vkResetFences, ResetFences)
+    IMPLEMENTATION(vkGetFenceStatus, GetFenceStatus)
+    IMPLEMENTATION(vkWaitForFences, WaitForFences)
+    IMPLEMENTATION(vkCreateSemaphore, CreateObject)
+    IMPLEMENTATION(vkDestroySemaphore, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreateEvent, CreateEvent)
+    IMPLEMENTATION(vkDestroyEvent, DestroyObject<Event>)
+    IMPLEMENTATION(vkGetEventStatus, GetEventStatus)
+    IMPLEMENTATION(vkSetEvent, SetEvent)
+    IMPLEMENTATION(vkResetEvent, ResetEvent)
+    IMPLEMENTATION(vkCreateQueryPool, CreateQueryPool)
+    IMPLEMENTATION(vkDestroyQueryPool, DestroyObject<QueryPool>)
+    IMPLEMENTATION(vkGetQueryPoolResults, GetQueryPoolResults)
+    IMPLEMENTATION(vkCreateShaderModule, CreateObject)
+    IMPLEMENTATION(vkDestroyShaderModule, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreatePipelineCache, CreateObject)
+    IMPLEMENTATION(vkDestroyPipelineCache, DestroyObject<Object>)
+    IMPLEMENTATION(vkGetPipelineCacheData, GetPipelineCacheData)
+    IMPLEMENTATION(vkCreateGraphicsPipelines, CreatePipelines)
+    IMPLEMENTATION(vkCreateComputePipelines, CreatePipelines)
+    IMPLEMENTATION(vkDestroyPipeline, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreatePipelineLayout, CreateObject)
+    IMPLEMENTATION(vkDestroyPipelineLayout, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreateSampler, CreateObject)
+    IMPLEMENTATION(vkDestroySampler, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreateDescriptorSetLayout, CreateObject)
+    IMPLEMENTATION(vkDestroyDescriptorSetLayout, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreateDescriptorPool, CreateDescriptorPool)
+    IMPLEMENTATION(vkDestroyDescriptorPool, DestroyDescriptorPool)
+    IMPLEMENTATION(vkResetDescriptorPool, ResetDescriptorPool)
+    IMPLEMENTATION(vkAllocateDescriptorSets, AllocateDescriptorSets)
+    IMPLEMENTATION(vkFreeDescriptorSets, FreeDescriptorSets)
+    IMPLEMENTATION(vkCreateFramebuffer, CreateObject)
+    IMPLEMENTATION(vkDestroyFramebuffer, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreateRenderPass, CreateObject)
+    IMPLEMENTATION(vkDestroyRenderPass, DestroyObject<Object>)
+    IMPLEMENTATION(vkGetRenderAreaGranularity, GetRenderAreaGranularity)
+    IMPLEMENTATION(vkCreateCommandPool, CreateCommandPool)
+    IMPLEMENTATION(vkDestroyCommandPool, DestroyCommandPool)
+    IMPLEMENTATION(vkResetCommandPool, ResetCommandPool)
+    IMPLEMENTATION(vkAllocateCommandBuffers, AllocateCommandBuffers)
+    IMPLEMENTATION(vkFreeCommandBuffers, FreeCommandBuffers)
+    IMPLEMENTATION(vkBeginCommandBuffer, BeginCommandBuffer)
+    IMPLEMENTATION(vkEndCommandBuffer, EndCommandBuffer)
+    IMPLEMENTATION(vkResetCommandBuffer, ResetCommandBuffer)
+    IMPLEMENTATION(vkGetPhysicalDeviceSurfaceSupportKHR,
+                   GetPhysicalDeviceSurfaceSupportKHR)
+    IMPLEMENTATION(vkGetPhysicalDeviceSurfaceCapabilitiesKHR,
+                   GetPhysicalDeviceSurfaceCapabilitiesKHR)
+    IMPLEMENTATION(vkGetPhysicalDeviceSurfaceFormatsKHR,
+                   GetPhysicalDeviceSurfaceFormatsKHR)
+    IMPLEMENTATION(vkGetPhysicalDeviceSurfacePresentModesKHR,
+                   GetPhysicalDeviceSurfacePresentModesKHR)
+    IMPLEMENTATION(vkCreateSwapchainKHR, CreateSwapchainKHR)
+    IMPLEMENTATION(vkDestroySwapchainKHR, DestroySwapchainKHR)
+    IMPLEMENTATION(vkGetSwapchainImagesKHR, GetSwapchainImagesKHR)
+    IMPLEMENTATION(vkAcquireNextImageKHR, AcquireNextImageKHR)
+    IMPLEMENTATION(vkQueuePresentKHR, QueuePresentKHR)
+    IMPLEMENTATION(vkGetPhysicalDeviceDisplayPropertiesKHR, EnumerateNothing)
+    IMPLEMENTATION(vkGetPhysicalDeviceDisplayPlanePropertiesKHR,
+                   EnumerateNothing)
+    IMPLEMENTATION(vkGetDisplayPlaneSupportedDisplaysKHR, EnumerateNothing)
+    IMPLEMENTATION(vkGetDisplayModePropertiesKHR, EnumerateNothing)
+    IMPLEMENTATION(vkCreateDescriptorUpdateTemplateKHR, CreateObject)
+    IMPLEMENTATION(vkDestroyDescriptorUpdateTemplateKHR, DestroyObject<Object>)
+    IMPLEMENTATION(vkCreateDebugReportCallbackEXT, CreateObject)
+    IMPLEMENTATION(vkDestroyDebugReportCallbackEXT, DestroyObject<Object>)
+};
+#undef IMPLEMENTATION
+
+// Returns the number in the environment variable called name, or 0.
+uint64_t GetEnvironmentNumber(const char* name) {
+  const char* value = getenv(name);
+  return value ? strtoull(value, nullptr, 10) : 0;
+}
+
+State::State()
+    : submit_latency(GetEnvironmentNumber("MOCK_ICD_SUBMIT_LATENCY_NS")) {
+  const uint64_t cost = GetEnvironmentNumber("MOCK_ICD_CALL_COST_NS");
+  for (uint32_t i = 0; i < kEntryPointCount; ++i) {
+    implementations[i] = kEntryPoints[i].default_implementation;
+    calls[i].store(0);
+    costs[i].store(cost);
+  }
+  for (const Implementation& implementation : kImplementations) {
+    implementations[implementation.index] = implementation.function;
+  }
+}
+}  // anonymous namespace
+
+// The loader negotiates the version of its interface with the ICD. From
+// version 2 on, it makes surfaces itself, so the mock ICD needs no window
+// system.
+MOCK_ICD_EXPORT VKAPI_ATTR VkResult VKAPI_CALL
+vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t* version) {
+  *version = std::min(*version, 2u);
+  return VK_SUCCESS;
+}
+
+MOCK_ICD_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL
+vk_icdGetInstanceProcAddr(VkInstance instance, const char* name) {
+  return GetInstanceProcAddr(instance, name);
+}
+
+MOCK_ICD_EXPORT VKAPI_ATTR VkResult VKAPI_CALL MockIcdGetCommands(
+    VkCommandBuffer command_buffer, uint32_t* count, MockIcdCommand* commands) {
+  const CommandBuffer& object = *FromHandle<CommandBuffer>(command_buffer);
+  const uint32_t command_count = static_cast<uint32_t>(object.commands.size());
+  if (!commands) {
+    *count = command_count;
+    return VK_SUCCESS;
+  }
+  const uint32_t copied = std::min(*count, command_count);
+  for (uint32_t i = 0; i < copied; ++i) {
+    const RecordedCommand& command = object.commands[i];
+    commands[i] = {kEntryPoints[command.function].name,
+                   object.parameters.data() + command.offset, command.size};
+  }
+  *count = copied;
+  return copied < command_count ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+MOCK_ICD_EXPORT VKAPI_ATTR VkResult VKAPI_CALL MockIcdGetCallStatistics(
+    uint32_t* count, MockIcdCallStatistics* statistics) {
+  if (!statistics) {
+    *count = kEntryPointCount;
+    return VK_SUCCESS;
+  }
+  const State& state = GetState();
+  const uint32_t copied = std::min<uint32_t>(*count, kEntryPointCount);
+  for (uint32_t i = 0; i < copied; ++i) {
+    statistics[i] = {kEntryPoints[i].name,
+                     state.calls[i].load(std::memory_order_relaxed),
+                     state.costs[i].load(std::memory_order_relaxed)};
+  }
+  *count = copied;
+  return copied < kEntryPointCount ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+MOCK_ICD_EXPORT VKAPI_ATTR void VKAPI_CALL MockIcdResetCallStatistics() {
+  State& state = GetState();
+  for (uint32_t i = 0; i < kEntryPointCount; ++i) {
+    state.calls[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+MOCK_ICD_EXPORT VKAPI_ATTR VkResult VKAPI_CALL
+MockIcdSetCallCost(const char* name, uint64_t nanoseconds) {
+  State& state = GetState();
+  VkResult result = VK_ERROR_FEATURE_NOT_PRESENT;
+  for (uint32_t i = 0; i < kEntryPointCount; ++i) {
+    if (!name || strcmp(kEntryPoints[i].name, name) == 0) {
+      state.costs[i].store(nanoseconds, std::memory_order_relaxed);
+      result = VK_SUCCESS;
+    }
+  }
+  return result;
+}
+
+MOCK_ICD_EXPORT VKAPI_ATTR void VKAPI_CALL
+MockIcdSetSubmitLatency(uint64_t nanoseconds) {
+  GetState().submit_latency.store(nanoseconds, std::memory_order_relaxed);
+}
+
+static_assert(std::is_same<decltype(&MockIcdGetCommands),
+                           PFN_MockIcdGetCommands>::value,
+              "MockIcdGetCommands does not match mock_icd.h");
+static_assert(std::is_same<decltype(&MockIcdGetCallStatistics),
+                           PFN_MockIcdGetCallStatistics>::value,
+              "MockIcdGetCallStatistics does not match mock_icd.h");
+static_assert(std::is_same<decltype(&MockIcdResetCallStatistics),
+                           PFN_MockIcdResetCallStatistics>::value,
+              "MockIcdResetCallStatistics does not match mock_icd.h");
+static_assert(std::is_same<decltype(&MockIcdSetCallCost),
+                           PFN_MockIcdSetCallCost>::value,
+              "MockIcdSetCallCost does not match mock_icd.h");
+static_assert(std::is_same<decltype(&MockIcdSetSubmitLatency),
+                           PFN_MockIcdSetSubmitLatency>::value,
+              "MockIcdSetSubmitLatency does not match mock_icd.h");
+
+}  // namespace mock_icd
@@ -0,0 +1,73 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MOCK_ICD_MOCK_ICD_H_
+#define MOCK_ICD_MOCK_ICD_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+
+// Besides the functions that the loader uses, the mock ICD exports the
+// functions below. A test or a benchmark can open the library with
+// dynamic_loader::OpenLibrary(allocator, "mock_icd"), and Resolve them by
+// name to inspect what the application did, or to change how much each
+// call costs.
+
+// A command recorded into a command buffer. parameters holds the
+// parameters of the command after its VkCommandBuffer, laid out as they
+// would be in a struct. Pointers among them are copied as they were, and
+// what they point to may be gone.
+struct MockIcdCommand {
+  const char* name;
+  const void* parameters;
+  size_t size;
+};
+
+// How many times an entry point was called, and how long it was made to
+// take on top of what it actually does.
+struct MockIcdCallStatistics {
+  const char* name;
+  uint64_t calls;
+  uint64_t cost_nanoseconds;
+};
+
+// Returns the commands recorded into command_buffer, in the usual way of
+// Vulkan enumerations. They stay valid until the command buffer is begun or
+// reset again, or freed. This only works if no layer wraps command buffers.
+typedef VkResult(VKAPI_PTR* PFN_MockIcdGetCommands)(
+    VkCommandBuffer command_buffer, uint32_t* count, MockIcdCommand* commands);
+
+// Returns the statistics of every entry point, in the usual way of Vulkan
+// enumerations.
+typedef VkResult(VKAPI_PTR* PFN_MockIcdGetCallStatistics)(
+    uint32_t* count, MockIcdCallStatistics* statistics);
+typedef void(VKAPI_PTR* PFN_MockIcdResetCallStatistics)();
+
+// Makes every call to the named entry point, or to every entry point if
+// name is nullptr, take at least nanoseconds. Returns
+// VK_ERROR_FEATURE_NOT_PRESENT if there is no such entry point. The
+// MOCK_ICD_CALL_COST_NS environment variable sets this for every entry
+// point when the library is loaded.
+typedef VkResult(VKAPI_PTR* PFN_MockIcdSetCallCost)(const char* name,
+                                                    uint64_t nanoseconds);
+
+// Makes the work submitted to a queue complete nanoseconds after it is
+// submitted, rather than straight away. The MOCK_ICD_SUBMIT_LATENCY_NS
+// environment variable sets this when the library is loaded.
+typedef void(VKAPI_PTR* PFN_MockIcdSetSubmitLatency)(uint64_t nanoseconds);
+
+#endif  // MOCK_ICD_MOCK_ICD_H_
@@ -0,0 +1,232 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MOCK_ICD_OBJECTS_H_
+#define MOCK_ICD_OBJECTS_H_
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "support/containers/allocator.h"
+#include "support/containers/flat_hash_set.h"
+#include "support/containers/unique_ptr.h"
+#include "support/containers/vector.h"
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+
+// Every Vulkan handle that the mock ICD returns points to one of these.
+namespace mock_icd {
+
+// The allocator behind every object that the application does not give
+// VkAllocationCallbacks for, and behind all device memory.
+containers::Allocator* GetAllocator();
+
+// A time in nanoseconds, from a steady clock.
+uint64_t Now();
+// The time of something that will never happen.
+const uint64_t kNever = UINT64_MAX;
+
+inline size_t RoundUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+// Constructs a T with the allocation callbacks, or with GetAllocator() if
+// there are none. Returns nullptr if it could not be allocated.
+template <typename T, typename... Args>
+T* New(const VkAllocationCallbacks* callbacks, Args&&... args) {
+  void* memory =
+      callbacks
+          ? callbacks->pfnAllocation(callbacks->pUserData, sizeof(T),
+                                     alignof(T),
+                                     VK_SYSTEM_ALLOCATION_SCOPE_OBJECT)
+          : GetAllocator()->malloc(sizeof(T));
+  return memory ? ::new (memory) T(std::forward<Args>(args)...) : nullptr;
+}
+
+// Destroys an object made by New with the same callbacks.
+template <typename T>
+void Delete(const VkAllocationCallbacks* callbacks, T* object) {
+  if (!object) {
+    return;
+  }
+  object->~T();
+  if (callbacks) {
+    callbacks->pfnFree(callbacks->pUserData, object);
+  } else {
+    GetAllocator()->free(object, sizeof(T));
+  }
+}
+
+// Non-dispatchable handles are pointers on 64-bit platforms, and uint64_t
+// everywhere else. These convert between them and the objects behind them.
+template <typename T, typename H>
+typename std::enable_if<std::is_pointer<H>::value, T*>::type FromHandle(
+    H handle) {
+  return reinterpret_cast<T*>(handle);
+}
+template <typename T>
+T* FromHandle(uint64_t handle) {
+  return reinterpret_cast<T*>(static_cast<uintptr_t>(handle));
+}
+template <typename H>
+typename std::enable_if<std::is_pointer<H>::value, H>::type ToHandle(
+    void* object) {
+  return reinterpret_cast<H>(object);
+}
+template <typename H>
+typename std::enable_if<!std::is_pointer<H>::value, H>::type ToHandle(
+    void* object) {
+  return static_cast<H>(reinterpret_cast<uintptr_t>(object));
+}
+
+// The loader replaces the first pointer of every dispatchable object with
+// its dispatch table, and checks that it held this value before it did.
+const uintptr_t kLoaderMagic = 0x01CDC0DE;
+
+struct DispatchableObject {
+  DispatchableObject() : loader_data(kLoaderMagic) {}
+  uintptr_t loader_data;
+};
+
+struct PhysicalDevice : DispatchableObject {};
+
+struct Instance : DispatchableObject {
+  PhysicalDevice physical_device;
+};
+
+struct Queue : DispatchableObject {
+  Queue(uint32_t family_index, uint32_t index)
+      : family_index(family_index), index(index), idle_time(0) {}
+  uint32_t family_index;
+  uint32_t index;
+  // When everything that was submitted to this queue completes.
+  std::atomic<uint64_t> idle_time;
+};
+
+struct Device : DispatchableObject {
+  explicit Device(containers::Allocator* allocator) : queues(allocator) {}
+  containers::vector<containers::unique_ptr<Queue>> queues;
+};
+
+// A command that was recorded into a command buffer. Its parameters, after
+// the VkCommandBuffer, are at offset in CommandBuffer::parameters, laid out
+// as they would be in a struct.
+struct RecordedCommand {
+  uint32_t function;
+  size_t offset;
+  size_t size;
+};
+
+struct CommandPool;
+
+struct CommandBuffer : DispatchableObject {
+  // Every command starts at a multiple of this, so that its parameters are
+  // aligned the same way that they would be in a struct.
+  static const size_t kCommandAlignment = 8;
+
+  CommandBuffer(containers::Allocator* allocator, CommandPool* pool)
+      : pool(pool), commands(allocator), parameters(allocator) {}
+
+  template <typename... P>
+  void Record(uint32_t function, const P&... values) {
+    const size_t offset = RoundUp(parameters.size(), kCommandAlignment);
+    parameters.resize(offset);
+    Append(values...);
+    commands.push_back({function, offset, parameters.size() - offset});
+  }
+
+  // Forgets every command, but keeps the memory for the next ones.
+  void Reset() {
+    commands.clear();
+    parameters.clear();
+  }
+
+  CommandPool* pool;
+  containers::vector<RecordedCommand> commands;
+  containers::vector<uint8_t> parameters;
+
+ private:
+  void Append() {}
+  template <typename T, typename... Rest>
+  void Append(const T& value, const Rest&... rest) {
+    const size_t offset = RoundUp(parameters.size(), alignof(T));
+    parameters.resize(offset + sizeof(T));
+    memcpy(parameters.data() + offset, &value, sizeof(T));
+    Append(rest...);
+  }
+};
+
+// Any object that holds no state of its own.
+struct Object {};
+
+struct CommandPool {
+  explicit CommandPool(containers::Allocator* allocator)
+      : command_buffers(allocator) {}
+  containers::flat_hash_set<CommandBuffer*> command_buffers;
+};
+
+struct DescriptorPool {
+  explicit DescriptorPool(containers::Allocator* allocator) : sets(allocator) {}
+  containers::flat_hash_set<Object*> sets;
+};
+
+struct DeviceMemory {
+  uint8_t* data;
+  VkDeviceSize size;
+};
+
+struct Buffer {
+  VkDeviceSize size;
+};
+
+struct Image {
+  VkImageType type;
+  VkFormat format;
+  VkExtent3D extent;
+  uint32_t mip_levels;
+  uint32_t array_layers;
+  VkSampleCountFlagBits samples;
+};
+
+struct Swapchain {
+  explicit Swapchain(containers::Allocator* allocator)
+      : images(allocator), next_image(0) {}
+  containers::vector<Image*> images;
+  uint32_t next_image;
+};
+
+struct Fence {
+  explicit Fence(uint64_t signal_time) : signal_time(signal_time) {}
+  // When the fence is signaled, or kNever if it is not.
+  std::atomic<uint64_t> signal_time;
+};
+
+struct Event {
+  explicit Event(bool signaled) : signaled(signaled) {}
+  std::atomic<bool> signaled;
+};
+
+struct QueryPool {
+  VkQueryType type;
+  uint32_t query_count;
+  VkQueryPipelineStatisticFlags pipeline_statistics;
+};
+
+}  // namespace mock_icd
+
+#endif  // MOCK_ICD_OBJECTS_H_
@@ -0,0 +1,344 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mock_icd/physical_device.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace mock_icd {
+
+namespace {
+const VkDeviceSize kGigabyte = 1024ull * 1024ull * 1024ull;
+const VkSampleCountFlags kSampleCounts =
+    VK_SAMPLE_COUNT_1_BIT | VK_SAMPLE_COUNT_2_BIT | VK_SAMPLE_COUNT_4_BIT |
+    VK_SAMPLE_COUNT_8_BIT;
+const uint32_t kPerStageDescriptors = 1024 * 1024;
+const uint32_t kPerSetDescriptors = 1024 * 1024;
+
+const VkPhysicalDeviceLimits kLimits = {
+    16384,                    // maxImageDimension1D
+    16384,                    // maxImageDimension2D
+    2048,                     // maxImageDimension3D
+    16384,                    // maxImageDimensionCube
+    2048,                     // maxImageArrayLayers
+    128 * 1024 * 1024,        // maxTexelBufferElements
+    65536,                    // maxUniformBufferRange
+    0xFFFFFFFF,               // maxStorageBufferRange
+    256,                      // maxPushConstantsSize
+    4096,                     // maxMemoryAllocationCount
+    4000,                     // maxSamplerAllocationCount
+    1,                        // bufferImageGranularity
+    0,                        // sparseAddressSpaceSize
+    8,                        // maxBoundDescriptorSets
+    kPerStageDescriptors,     // maxPerStageDescriptorSamplers
+    kPerStageDescriptors,     // maxPerStageDescriptorUniformBuffers
+    kPerStageDescriptors,     // maxPerStageDescriptorStorageBuffers
+    kPerStageDescriptors,     // maxPerStageDescriptorSampledImages
+    kPerStageDescriptors,     // maxPerStageDescriptorStorageImages
+    kPerStageDescriptors,     // maxPerStageDescriptorInputAttachments
+    kPerStageDescriptors,     // maxPerStageResources
+    kPerSetDescriptors,       // maxDescriptorSetSamplers
+    kPerSetDescriptors,       // maxDescriptorSetUniformBuffers
+    16,                       // maxDescriptorSetUniformBuffersDynamic
+    kPerSetDescriptors,       // maxDescriptorSetStorageBuffers
+    16,                       // maxDescriptorSetStorageBuffersDynamic
+    kPerSetDescriptors,       // maxDescriptorSetSampledImages
+    kPerSetDescriptors,       // maxDescriptorSetStorageImages
+    kPerSetDescriptors,       // maxDescriptorSetInputAttachments
+    32,                       // maxVertexInputAttributes
+    32,                       // maxVertexInputBindings
+    2047,                     // maxVertexInputAttributeOffset
+    2048,                     // maxVertexInputBindingStride
+    128,                      // maxVertexOutputComponents
+    64,                       // maxTessellationGenerationLevel
+    32,                       // maxTessellationPatchSize
+    128,                      // maxTessellationControlPerVertexInputComponents
+    128,                      // maxTessellationControlPerVertexOutputComponents
+    120,                      // maxTessellationControlPerPatchOutputComponents
+    4216,                     // maxTessellationControlTotalOutputComponents
+    128,                      // maxTessellationEvaluationInputComponents
+    128,                      // maxTessellationEvaluationOutputComponents
+    32,                       // maxGeometryShaderInvocations
+    128,                      // maxGeometryInputComponents
+    128,                      // maxGeometryOutputComponents
+    1024,                     // maxGeometryOutputVertices
+    1024,                     // maxGeometryTotalOutputComponents
+    128,                      // maxFragmentInputComponents
+    8,                        // maxFragmentOutputAttachments
+    1,                        // maxFragmentDualSrcAttachments
+    kPerStageDescriptors,     // maxFragmentCombinedOutputResources
+    32768,                    // maxComputeSharedMemorySize
+    {65535, 65535, 65535},    // maxComputeWorkGroupCount
+    1024,                     // maxComputeWorkGroupInvocations
+    {1024, 1024, 64},         // maxComputeWorkGroupSize
+    8,                        // subPixelPrecisionBits
+    8,                        // subTexelPrecisionBits
+    8,                        // mipmapPrecisionBits
+    0xFFFFFFFF,               // maxDrawIndexedIndexValue
+    0xFFFFFFFF,               // maxDrawIndirectCount
+    16.0f,                    // maxSamplerLodBias
+    16.0f,                    // maxSamplerAnisotropy
+    16,                       // maxViewports
+    {16384, 16384},           // maxViewportDimensions
+    {-32768.0f, 32767.0f},    // viewportBoundsRange
+    8,                        // viewportSubPixelBits
+    64,                       // minMemoryMapAlignment
+    16,                       // minTexelBufferOffsetAlignment
+    kResourceAlignment,       // minUniformBufferOffsetAlignment
+    kResourceAlignment,       // minStorageBufferOffsetAlignment
+    -8,                       // minTexelOffset
+    7,                        // maxTexelOffset
+    -32,                      // minTexelGatherOffset
+    31,                       // maxTexelGatherOffset
+    -0.5f,                    // minInterpolationOffset
+    0.4375f,                  // maxInterpolationOffset
+    4,                        // subPixelInterpolationOffsetBits
+    16384,                    // maxFramebufferWidth
+    16384,                    // maxFramebufferHeight
+    2048,                     // maxFramebufferLayers
+    kSampleCounts,            // framebufferColorSampleCounts
+    kSampleCounts,            // framebufferDepthSampleCounts
+    kSampleCounts,            // framebufferStencilSampleCounts
+    kSampleCounts,            // framebufferNoAttachmentsSampleCounts
+    8,                        // maxColorAttachments
+    kSampleCounts,            // sampledImageColorSampleCounts
+    kSampleCounts,            // sampledImageIntegerSampleCounts
+    kSampleCounts,            // sampledImageDepthSampleCounts
+    kSampleCounts,            // sampledImageStencilSampleCounts
+    kSampleCounts,            // storageImageSampleCounts
+    1,                        // maxSampleMaskWords
+    VK_TRUE,                  // timestampComputeAndGraphics
+    1.0f,                     // timestampPeriod
+    8,                        // maxClipDistances
+    8,                        // maxCullDistances
+    8,                        // maxCombinedClipAndCullDistances
+    2,                        // discreteQueuePriorities
+    {1.0f, 64.0f},            // pointSizeRange
+    {1.0f, 8.0f},             // lineWidthRange
+    0.125f,                   // pointSizeGranularity
+    0.125f,                   // lineWidthGranularity
+    VK_FALSE,                 // strictLines
+    VK_TRUE,                  // standardSampleLocations
+    1,                        // optimalBufferCopyOffsetAlignment
+    1,                        // optimalBufferCopyRowPitchAlignment
+    64                        // nonCoherentAtomSize
+};
+
+const VkFormatFeatureFlags kBufferFeatures =
+    VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT |
+    VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT |
+    VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT |
+    VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT;
+const VkFormatFeatureFlags kImageFeatures =
+    VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT |
+    VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT |
+    VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+    VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+const VkFormatFeatureFlags kColorFeatures =
+    VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT |
+    VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT;
+
+// Formats up to and including last have blocks of this size. The table is
+// in the order of VkFormat.
+struct FormatRange {
+  VkFormat last;
+  FormatBlock block;
+};
+const FormatRange kFormatRanges[] = {
+    {VK_FORMAT_UNDEFINED, {0, 0, 0}},
+    {VK_FORMAT_R4G4_UNORM_PACK8, {1, 1, 1}},
+    {VK_FORMAT_A1R5G5B5_UNORM_PACK16, {2, 1, 1}},
+    {VK_FORMAT_R8_SRGB, {1, 1, 1}},
+    {VK_FORMAT_R8G8_SRGB, {2, 1, 1}},
+    {VK_FORMAT_B8G8R8_SRGB, {3, 1, 1}},
+    {VK_FORMAT_A2B10G10R10_SINT_PACK32, {4, 1, 1}},
+    {VK_FORMAT_R16_SFLOAT, {2, 1, 1}},
+    {VK_FORMAT_R16G16_SFLOAT, {4, 1, 1}},
+    {VK_FORMAT_R16G16B16_SFLOAT, {6, 1, 1}},
+    {VK_FORMAT_R16G16B16A16_SFLOAT, {8, 1, 1}},
+    {VK_FORMAT_R32_SFLOAT, {4, 1, 1}},
+    {VK_FORMAT_R32G32_SFLOAT, {8, 1, 1}},
+    {VK_FORMAT_R32G32B32_SFLOAT, {12, 1, 1}},
+    {VK_FORMAT_R32G32B32A32_SFLOAT, {16, 1, 1}},
+    {VK_FORMAT_R64_SFLOAT, {8, 1, 1}},
+    {VK_FORMAT_R64G64_SFLOAT, {16, 1, 1}},
+    {VK_FORMAT_R64G64B64_SFLOAT, {24, 1, 1}},
+    {VK_FORMAT_R64G64B64A64_SFLOAT, {32, 1, 1}},
+    {VK_FORMAT_E5B9G9R9_UFLOAT_PACK32, {4, 1, 1}},
+    {VK_FORMAT_D16_UNORM, {2, 1, 1}},
+    {VK_FORMAT_D32_SFLOAT, {4, 1, 1}},
+    {VK_FORMAT_S8_UINT, {1, 1, 1}},
+    {VK_FORMAT_D16_UNORM_S8_UINT, {3, 1, 1}},
+    {VK_FORMAT_D24_UNORM_S8_UINT, {4, 1, 1}},
+    {VK_FORMAT_D32_SFLOAT_S8_UINT, {5, 1, 1}},
+    {VK_FORMAT_BC1_RGBA_SRGB_BLOCK, {8, 4, 4}},
+    {VK_FORMAT_BC3_SRGB_BLOCK, {16, 4, 4}},
+    {VK_FORMAT_BC4_SNORM_BLOCK, {8, 4, 4}},
+    {VK_FORMAT_BC7_SRGB_BLOCK, {16, 4, 4}},
+    {VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK, {8, 4, 4}},
+    {VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK, {16, 4, 4}},
+    {VK_FORMAT_EAC_R11_SNORM_BLOCK, {8, 4, 4}},
+    {VK_FORMAT_EAC_R11G11_SNORM_BLOCK, {16, 4, 4}},
+    {VK_FORMAT_ASTC_4x4_SRGB_BLOCK, {16, 4, 4}},
+    {VK_FORMAT_ASTC_5x4_SRGB_BLOCK, {16, 5, 4}},
+    {VK_FORMAT_ASTC_5x5_SRGB_BLOCK, {16, 5, 5}},
+    {VK_FORMAT_ASTC_6x5_SRGB_BLOCK, {16, 6, 5}},
+    {VK_FORMAT_ASTC_6x6_SRGB_BLOCK, {16, 6, 6}},
+    {VK_FORMAT_ASTC_8x5_SRGB_BLOCK, {16, 8, 5}},
+    {VK_FORMAT_ASTC_8x6_SRGB_BLOCK, {16, 8, 6}},
+    {VK_FORMAT_ASTC_8x8_SRGB_BLOCK, {16, 8, 8}},
+    {VK_FORMAT_ASTC_10x5_SRGB_BLOCK, {16, 10, 5}},
+    {VK_FORMAT_ASTC_10x6_SRGB_BLOCK, {16, 10, 6}},
+    {VK_FORMAT_ASTC_10x8_SRGB_BLOCK, {16, 10, 8}},
+    {VK_FORMAT_ASTC_10x10_SRGB_BLOCK, {16, 10, 10}},
+    {VK_FORMAT_ASTC_12x10_SRGB_BLOCK, {16, 12, 10}},
+    {VK_FORMAT_ASTC_12x12_SRGB_BLOCK, {16, 12, 12}}};
+
+bool IsDepthOrStencil(VkFormat format) {
+  return format >= VK_FORMAT_D16_UNORM &&
+         format <= VK_FORMAT_D32_SFLOAT_S8_UINT;
+}
+}  // anonymous namespace
+
+void DescribePhysicalDevice(VkPhysicalDeviceProperties* properties) {
+  memset(properties, 0, sizeof(*properties));
+  properties->apiVersion = VK_MAKE_VERSION(1, 0, VK_HEADER_VERSION);
+  properties->driverVersion = 1;
+  properties->deviceType = VK_PHYSICAL_DEVICE_TYPE_CPU;
+  strncpy(properties->deviceName, "Mock device",
+          VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+  memcpy(properties->pipelineCacheUUID, "mock_icd pipeline", VK_UUID_SIZE);
+  properties->limits = kLimits;
+}
+
+void DescribeFeatures(VkPhysicalDeviceFeatures* features) {
+  // VkPhysicalDeviceFeatures is nothing but VkBool32s.
+  VkBool32* members = reinterpret_cast<VkBool32*>(features);
+  std::fill(members, members + sizeof(*features) / sizeof(VkBool32), VK_TRUE);
+  // Nothing sparse is supported, since no queue can bind sparse memory.
+  features->sparseBinding = VK_FALSE;
+  features->sparseResidencyBuffer = VK_FALSE;
+  features->sparseResidencyImage2D = VK_FALSE;
+  features->sparseResidencyImage3D = VK_FALSE;
+  features->sparseResidency2Samples = VK_FALSE;
+  features->sparseResidency4Samples = VK_FALSE;
+  features->sparseResidency8Samples = VK_FALSE;
+  features->sparseResidency16Samples = VK_FALSE;
+  features->sparseResidencyAliased = VK_FALSE;
+}
+
+void DescribeMemory(VkPhysicalDeviceMemoryProperties* properties) {
+  memset(properties, 0, sizeof(*properties));
+  properties->memoryTypeCount = kMemoryTypeCount;
+  properties->memoryTypes[0] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0};
+  properties->memoryTypes[1] = {VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+                                    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                    VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                0};
+  properties->memoryTypes[2] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                    VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                1};
+  properties->memoryTypes[3] = {VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                    VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+                                    VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+                                1};
+  properties->memoryHeapCount = 2;
+  properties->memoryHeaps[0] = {4 * kGigabyte, VK_MEMORY_HEAP_DEVICE_LOCAL_BIT};
+  properties->memoryHeaps[1] = {8 * kGigabyte, 0};
+}
+
+void DescribeQueueFamily(uint32_t family, VkQueueFamilyProperties* properties) {
+  properties->queueFlags = VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+  properties->queueCount = 1;
+  if (family == 0) {
+    properties->queueFlags |= VK_QUEUE_GRAPHICS_BIT;
+    properties->queueCount = 2;
+  }
+  properties->timestampValidBits = 64;
+  properties->minImageTransferGranularity = {1, 1, 1};
+}
+
+void DescribeFormat(VkFormat format, VkFormatProperties* properties) {
+  if (format == VK_FORMAT_UNDEFINED) {
+    *properties = {0, 0, 0};
+    return;
+  }
+  VkFormatFeatureFlags image_features = kImageFeatures;
+  if (IsDepthOrStencil(format)) {
+    image_features |= VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
+  } else {
+    image_features |= kColorFeatures;
+  }
+  properties->linearTilingFeatures = image_features;
+  properties->optimalTilingFeatures = image_features;
+  properties->bufferFeatures = IsDepthOrStencil(format) ? 0 : kBufferFeatures;
+}
+
+VkResult DescribeImageFormat(VkFormat format, VkImageType type,
+                             VkImageFormatProperties* properties) {
+  if (format == VK_FORMAT_UNDEFINED || GetFormatBlock(format).size == 0) {
+    return VK_ERROR_FORMAT_NOT_SUPPORTED;
+  }
+  switch (type) {
+    case VK_IMAGE_TYPE_1D:
+      properties->maxExtent = {kLimits.maxImageDimension1D, 1, 1};
+      break;
+    case VK_IMAGE_TYPE_3D:
+      properties->maxExtent = {kLimits.maxImageDimension3D,
+                               kLimits.maxImageDimension3D,
+                               kLimits.maxImageDimension3D};
+      break;
+    default:
+      properties->maxExtent = {kLimits.maxImageDimension2D,
+                               kLimits.maxImageDimension2D, 1};
+      break;
+  }
+  uint32_t mip_levels = 1;
+  while ((properties->maxExtent.width >> mip_levels) != 0) {
+    ++mip_levels;
+  }
+  properties->maxMipLevels = mip_levels;
+  const bool is_3d = type == VK_IMAGE_TYPE_3D;
+  properties->maxArrayLayers = is_3d ? 1 : kLimits.maxImageArrayLayers;
+  properties->sampleCounts =
+      is_3d ? VkSampleCountFlags(VK_SAMPLE_COUNT_1_BIT) : kSampleCounts;
+  properties->maxResourceSize = 4 * kGigabyte;
+  return VK_SUCCESS;
+}
+
+FormatBlock GetFormatBlock(VkFormat format) {
+  for (const FormatRange& range : kFormatRanges) {
+    if (format <= range.last) {
+      return range.block;
+    }
+  }
+  switch (format) {
+    case VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG:
+    case VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG:
+    case VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG:
+    case VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG:
+      return {8, 8, 4};
+    case VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG:
+    case VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG:
+    case VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG:
+    case VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG:
+      return {8, 4, 4};
+    default:
+      return {0, 0, 0};
+  }
+}
+
+}  // namespace mock_icd
@@ -0,0 +1,62 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MOCK_ICD_PHYSICAL_DEVICE_H_
+#define MOCK_ICD_PHYSICAL_DEVICE_H_
+
+#include <cstdint>
+
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+
+// These describe the one physical device of the mock ICD. It looks like a
+// discrete GPU with a large host-visible heap, supports every feature and
+// format, and has generous limits, so that any application in this
+// repository can run on it.
+namespace mock_icd {
+
+// The memory types, in the order of VkPhysicalDeviceMemoryProperties:
+// device-local, device-local and host-visible, host-visible, and
+// host-visible and cached. All of them are backed by host memory.
+const uint32_t kMemoryTypeCount = 4;
+// Every buffer and image can be bound to memory of any type.
+const uint32_t kAllMemoryTypeBits = (1u << kMemoryTypeCount) - 1;
+// The alignment of every buffer and image in memory.
+const VkDeviceSize kResourceAlignment = 256;
+
+// The first family can do everything, and has two queues so that an
+// application can use one of them for asynchronous compute. The second
+// family only does compute and transfers.
+const uint32_t kQueueFamilyCount = 2;
+
+void DescribePhysicalDevice(VkPhysicalDeviceProperties* properties);
+void DescribeFeatures(VkPhysicalDeviceFeatures* features);
+void DescribeMemory(VkPhysicalDeviceMemoryProperties* properties);
+void DescribeQueueFamily(uint32_t family, VkQueueFamilyProperties* properties);
+void DescribeFormat(VkFormat format, VkFormatProperties* properties);
+VkResult DescribeImageFormat(VkFormat format, VkImageType type,
+                             VkImageFormatProperties* properties);
+
+// The size in bytes of each block of texels in format, and the width and
+// height of the blocks. Uncompressed formats have blocks of one texel.
+struct FormatBlock {
+  uint32_t size;
+  uint32_t width;
+  uint32_t height;
+};
+FormatBlock GetFormatBlock(VkFormat format);
+
+}  // namespace mock_icd
+
+#endif  // MOCK_ICD_PHYSICAL_DEVICE_H_
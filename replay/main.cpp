@@ -0,0 +1,43 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "support/entry/entry.h"
+#include "support/log/log.h"
+#include "vulkan_wrapper/replay.h"
+
+// Replays the file given with -capture= once, and reports how long it took.
+// Nothing is drawn to the window.
+int main_entry(const entry::entry_data* data) {
+  const char* file_name = data->options.capture_file;
+  if (!file_name || file_name[0] == '\0') {
+    data->log->LogError("Give the file to replay with -capture=");
+    return -1;
+  }
+  vulkan::Replayer replayer(data->root_allocator, data->log.get());
+  if (!replayer.Load(file_name)) {
+    return -1;
+  }
+  vulkan::ReplayStatistics statistics;
+  if (!replayer.Replay(&statistics)) {
+    data->log->LogError(file_name, " is malformed");
+    return -1;
+  }
+  data->log->LogInfo("Replayed ", statistics.calls, " calls and ",
+                     statistics.frames, " frames in ",
+                     statistics.nanoseconds / 1000000, " ms, ",
+                     statistics.call_nanoseconds / 1000000,
+                     " ms of them in the driver");
+  return 0;
+}
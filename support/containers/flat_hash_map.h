@@ -0,0 +1,76 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_FLAT_HASH_MAP_H_
+#define SUPPORT_CONTAINERS_FLAT_HASH_MAP_H_
+
+#include <functional>
+#include <tuple>
+
+#include "support/containers/flat_hash_table.h"
+
+namespace containers {
+
+namespace internal {
+template <typename Key, typename T>
+struct PairKeyOf {
+  const Key& operator()(const std::pair<const Key, T>& value) const {
+    return value.first;
+  }
+};
+}  // namespace internal
+
+// flat_hash_map is an open-addressing hash map. Unlike
+// containers::unordered_map it makes no allocation per element: the
+// elements live in a single array that is only reallocated as the map
+// grows. Lookups probe 16 slots at a time.
+//
+// Inserting or erasing invalidates every iterator and reference into the
+// map, and T must be move-constructible.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class flat_hash_map
+    : public internal::flat_hash_table<Key, std::pair<const Key, T>,
+                                       internal::PairKeyOf<Key, T>, Hash,
+                                       KeyEqual> {
+ private:
+  using table_type =
+      internal::flat_hash_table<Key, std::pair<const Key, T>,
+                                internal::PairKeyOf<Key, T>, Hash, KeyEqual>;
+
+ public:
+  typedef T mapped_type;
+  using typename table_type::iterator;
+  using typename table_type::value_type;
+
+  explicit flat_hash_map(Allocator* allocator) : table_type(allocator) {}
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return this->try_emplace(value.first, value);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(const Key& key, Args&&... args) {
+    return this->try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  T& operator[](const Key& key) { return emplace(key).first->second; }
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_FLAT_HASH_MAP_H_
@@ -0,0 +1,55 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_FLAT_HASH_SET_H_
+#define SUPPORT_CONTAINERS_FLAT_HASH_SET_H_
+
+#include <functional>
+
+#include "support/containers/flat_hash_table.h"
+
+namespace containers {
+
+namespace internal {
+template <typename T>
+struct IdentityKeyOf {
+  const T& operator()(const T& value) const { return value; }
+};
+}  // namespace internal
+
+// flat_hash_set is the set counterpart of flat_hash_map, with the same
+// storage and the same iterator invalidation rules.
+template <typename T, typename Hash = std::hash<T>,
+          typename KeyEqual = std::equal_to<T>>
+class flat_hash_set
+    : public internal::flat_hash_table<T, T, internal::IdentityKeyOf<T>, Hash,
+                                       KeyEqual> {
+ private:
+  using table_type = internal::flat_hash_table<T, T, internal::IdentityKeyOf<T>,
+                                               Hash, KeyEqual>;
+
+ public:
+  using typename table_type::iterator;
+
+  explicit flat_hash_set(Allocator* allocator) : table_type(allocator) {}
+
+  std::pair<iterator, bool> insert(const T& value) {
+    return this->try_emplace(value, value);
+  }
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_FLAT_HASH_SET_H_
@@ -0,0 +1,456 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_FLAT_HASH_TABLE_H_
+#define SUPPORT_CONTAINERS_FLAT_HASH_TABLE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CONTAINERS_FLAT_HASH_TABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "support/containers/allocator.h"
+
+namespace containers {
+namespace internal {
+
+// The control byte of every slot in a flat_hash_table. A full slot stores
+// the low 7 bits of the hash of its key, so the high bit is only set for
+// empty and deleted slots.
+enum : int8_t {
+  kCtrlEmpty = -128,
+  kCtrlDeleted = -2,
+};
+
+// A group of control bytes that are probed at once. With SSE2 this is a
+// single compare and movemask; otherwise the bytes are checked one by one.
+// Each Match* function returns a mask with bit i set if byte i matches.
+class CtrlGroup {
+ public:
+  static const size_t kWidth = 16;
+
+  explicit CtrlGroup(const int8_t* ctrl) {
+#if defined(CONTAINERS_FLAT_HASH_TABLE_SSE2)
+    ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+    memcpy(ctrl_, ctrl, kWidth);
+#endif
+  }
+
+  uint32_t Match(int8_t h2) const {
+#if defined(CONTAINERS_FLAT_HASH_TABLE_SSE2)
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kWidth; ++i) {
+      mask |= uint32_t(ctrl_[i] == h2) << i;
+    }
+    return mask;
+#endif
+  }
+
+  uint32_t MatchEmpty() const { return Match(kCtrlEmpty); }
+
+  uint32_t MatchEmptyOrDeleted() const {
+#if defined(CONTAINERS_FLAT_HASH_TABLE_SSE2)
+    return _mm_movemask_epi8(ctrl_);
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kWidth; ++i) {
+      mask |= uint32_t(ctrl_[i] < 0) << i;
+    }
+    return mask;
+#endif
+  }
+
+  // Returns the index of the lowest set bit in mask. mask must not be 0.
+  static uint32_t LowestSetBit(uint32_t mask) {
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    uint32_t index = 0;
+    while (!(mask & 1)) {
+      mask >>= 1;
+      ++index;
+    }
+    return index;
+#endif
+  }
+
+ private:
+#if defined(CONTAINERS_FLAT_HASH_TABLE_SSE2)
+  __m128i ctrl_;
+#else
+  int8_t ctrl_[kWidth];
+#endif
+};
+
+// flat_hash_table is the open-addressing hash table behind flat_hash_map
+// and flat_hash_set. Values are stored inline in one array, next to an
+// array of one control byte per slot, and a lookup probes the control bytes
+// a CtrlGroup at a time before it touches any value.
+//
+// The capacity is always a power of two, and at least one group wide. The
+// control array has an extra group at the end that mirrors the first, so
+// that a group can be loaded from any slot without wrapping around.
+//
+// KeyOf is a functor that returns the key of a stored value.
+template <typename Key, typename Value, typename KeyOf, typename Hash,
+          typename KeyEqual>
+class flat_hash_table {
+  template <typename V>
+  class Iterator {
+   public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename std::remove_const<V>::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef V* pointer;
+    typedef V& reference;
+
+    Iterator() : ctrl_(nullptr), slot_(nullptr), end_(nullptr) {}
+    // Allows an iterator to be converted to a const_iterator.
+    template <typename U>
+    Iterator(const Iterator<U>& other)
+        : ctrl_(other.ctrl_), slot_(other.slot_), end_(other.end_) {}
+
+    V& operator*() const { return *slot_; }
+    V* operator->() const { return slot_; }
+
+    Iterator& operator++() {
+      ++ctrl_;
+      ++slot_;
+      SkipEmpty();
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator it = *this;
+      ++*this;
+      return it;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return ctrl_ == other.ctrl_;
+    }
+    bool operator!=(const Iterator& other) const {
+      return ctrl_ != other.ctrl_;
+    }
+
+   private:
+    friend class flat_hash_table;
+    template <typename U>
+    friend class Iterator;
+
+    Iterator(const int8_t* ctrl, V* slot, const int8_t* end)
+        : ctrl_(ctrl), slot_(slot), end_(end) {}
+
+    void SkipEmpty() {
+      while (ctrl_ != end_ && *ctrl_ < 0) {
+        ++ctrl_;
+        ++slot_;
+      }
+    }
+
+    const int8_t* ctrl_;
+    V* slot_;
+    const int8_t* end_;
+  };
+
+ public:
+  typedef Key key_type;
+  typedef Value value_type;
+  typedef Iterator<Value> iterator;
+  typedef Iterator<const Value> const_iterator;
+
+  explicit flat_hash_table(Allocator* allocator)
+      : allocator_(allocator),
+        ctrl_(nullptr),
+        slots_(nullptr),
+        capacity_(0),
+        size_(0),
+        growth_left_(0) {}
+
+  flat_hash_table(const flat_hash_table& other)
+      : flat_hash_table(other.allocator_) {
+    reserve(other.size_);
+    for (const Value& value : other) {
+      const size_t i = PrepareInsert(HashOf(KeyOf()(value)));
+      ::new (static_cast<void*>(slots_ + i)) Value(value);
+    }
+  }
+
+  flat_hash_table(flat_hash_table&& other)
+      : flat_hash_table(other.allocator_) {
+    swap(other);
+  }
+
+  ~flat_hash_table() {
+    clear();
+    Deallocate();
+  }
+
+  flat_hash_table& operator=(const flat_hash_table& other) {
+    if (this != &other) {
+      flat_hash_table copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  flat_hash_table& operator=(flat_hash_table&& other) {
+    swap(other);
+    return *this;
+  }
+
+  void swap(flat_hash_table& other) {
+    std::swap(allocator_, other.allocator_);
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+  }
+
+  iterator begin() {
+    iterator it(ctrl_, slots_, ctrl_ + capacity_);
+    it.SkipEmpty();
+    return it;
+  }
+  iterator end() {
+    return iterator(ctrl_ + capacity_, slots_ + capacity_, ctrl_ + capacity_);
+  }
+  const_iterator begin() const {
+    return const_cast<flat_hash_table*>(this)->begin();
+  }
+  const_iterator end() const {
+    return const_cast<flat_hash_table*>(this)->end();
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_t capacity() const { return capacity_; }
+
+  // Makes room for count values without rehashing.
+  void reserve(size_t count) {
+    if (count <= size_ + growth_left_) {
+      return;
+    }
+    size_t capacity = CtrlGroup::kWidth;
+    while (MaxLoad(capacity) < count) {
+      capacity *= 2;
+    }
+    Resize(capacity);
+  }
+
+  // Destroys every value, but keeps the memory.
+  void clear() {
+    for (size_t i = 0; i < capacity_; ++i) {
+      if (ctrl_[i] >= 0) {
+        slots_[i].~Value();
+      }
+    }
+    if (capacity_) {
+      memset(ctrl_, kCtrlEmpty, capacity_ + CtrlGroup::kWidth);
+    }
+    size_ = 0;
+    growth_left_ = MaxLoad(capacity_);
+  }
+
+  iterator find(const Key& key) {
+    const size_t i = Find(key, HashOf(key));
+    return i == capacity_ ? end() : IteratorAt(i);
+  }
+  const_iterator find(const Key& key) const {
+    return const_cast<flat_hash_table*>(this)->find(key);
+  }
+
+  size_t count(const Key& key) const { return find(key) == end() ? 0 : 1; }
+
+  // If there is no value with the given key, constructs one from args.
+  // Returns an iterator to the value with the key, and whether it was
+  // inserted.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    const size_t hash = HashOf(key);
+    size_t i = Find(key, hash);
+    if (i != capacity_) {
+      return std::make_pair(IteratorAt(i), false);
+    }
+    i = PrepareInsert(hash);
+    ::new (static_cast<void*>(slots_ + i)) Value(std::forward<Args>(args)...);
+    return std::make_pair(IteratorAt(i), true);
+  }
+
+  iterator erase(const_iterator position) {
+    const size_t i = position.ctrl_ - ctrl_;
+    slots_[i].~Value();
+    SetCtrl(i, kCtrlDeleted);
+    --size_;
+    iterator it = IteratorAt(i);
+    it.SkipEmpty();
+    return it;
+  }
+
+  size_t erase(const Key& key) {
+    const size_t i = Find(key, HashOf(key));
+    if (i == capacity_) {
+      return 0;
+    }
+    erase(IteratorAt(i));
+    return 1;
+  }
+
+ private:
+  // The table is rehashed once it is 7/8 full, counting deleted slots.
+  static size_t MaxLoad(size_t capacity) { return capacity - capacity / 8; }
+
+  // Mixes the bits of the user's hash, since std::hash is often the
+  // identity function, and both the high and the low bits are used.
+  static size_t HashOf(const Key& key) {
+    const uint64_t hash =
+        static_cast<uint64_t>(Hash()(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash ^ (hash >> 32));
+  }
+  static size_t H1(size_t hash) { return hash >> 7; }
+  static int8_t H2(size_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+  iterator IteratorAt(size_t i) {
+    return iterator(ctrl_ + i, slots_ + i, ctrl_ + capacity_);
+  }
+
+  // Sets the control byte for slot i, and its mirror if it has one.
+  void SetCtrl(size_t i, int8_t ctrl) {
+    ctrl_[i] = ctrl;
+    if (i < CtrlGroup::kWidth) {
+      ctrl_[capacity_ + i] = ctrl;
+    }
+  }
+
+  // Returns the slot that holds key, or capacity_ if there is none.
+  size_t Find(const Key& key, size_t hash) const {
+    if (!capacity_) {
+      return capacity_;
+    }
+    const size_t mask = capacity_ - 1;
+    size_t offset = H1(hash) & mask;
+    // Groups are probed quadratically, which visits every group when the
+    // capacity is a power of two.
+    for (size_t step = CtrlGroup::kWidth;; step += CtrlGroup::kWidth) {
+      CtrlGroup group(ctrl_ + offset);
+      for (uint32_t match = group.Match(H2(hash)); match;
+           match &= match - 1) {
+        const size_t i = (offset + CtrlGroup::LowestSetBit(match)) & mask;
+        if (KeyEqual()(KeyOf()(slots_[i]), key)) {
+          return i;
+        }
+      }
+      if (group.MatchEmpty()) {
+        return capacity_;
+      }
+      offset = (offset + step) & mask;
+    }
+  }
+
+  // Claims a slot for a value with the given hash, which must not already
+  // be in the table, and returns its index.
+  size_t PrepareInsert(size_t hash) {
+    if (!growth_left_) {
+      // If much of the table is deleted slots, rehashing at the same size
+      // is enough to clear them out.
+      Resize(size_ < MaxLoad(capacity_) / 2 ? capacity_
+                                            : capacity_ ? capacity_ * 2
+                                                        : CtrlGroup::kWidth);
+    }
+    const size_t mask = capacity_ - 1;
+    size_t offset = H1(hash) & mask;
+    for (size_t step = CtrlGroup::kWidth;; step += CtrlGroup::kWidth) {
+      const uint32_t match = CtrlGroup(ctrl_ + offset).MatchEmptyOrDeleted();
+      if (match) {
+        const size_t i = (offset + CtrlGroup::LowestSetBit(match)) & mask;
+        if (ctrl_[i] == kCtrlEmpty) {
+          --growth_left_;
+        }
+        SetCtrl(i, H2(hash));
+        ++size_;
+        return i;
+      }
+      offset = (offset + step) & mask;
+    }
+  }
+
+  // Moves every value into a new table of the given capacity.
+  void Resize(size_t capacity) {
+    int8_t* old_ctrl = ctrl_;
+    Value* old_slots = slots_;
+    const size_t old_capacity = capacity_;
+
+    slots_ = static_cast<Value*>(allocator_->malloc(AllocationSize(capacity)));
+    ctrl_ = reinterpret_cast<int8_t*>(slots_ + capacity);
+    capacity_ = capacity;
+    size_ = 0;
+    growth_left_ = MaxLoad(capacity);
+    memset(ctrl_, kCtrlEmpty, capacity + CtrlGroup::kWidth);
+
+    for (size_t i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] >= 0) {
+        const size_t j = PrepareInsert(HashOf(KeyOf()(old_slots[i])));
+        ::new (static_cast<void*>(slots_ + j)) Value(std::move(old_slots[i]));
+        old_slots[i].~Value();
+      }
+    }
+    if (old_capacity) {
+      allocator_->free(old_slots, AllocationSize(old_capacity));
+    }
+  }
+
+  void Deallocate() {
+    if (capacity_) {
+      allocator_->free(slots_, AllocationSize(capacity_));
+    }
+  }
+
+  // The slots and the control bytes share a single allocation.
+  static size_t AllocationSize(size_t capacity) {
+    return capacity * sizeof(Value) + capacity + CtrlGroup::kWidth;
+  }
+
+  Allocator* allocator_;
+  int8_t* ctrl_;
+  Value* slots_;
+  size_t capacity_;
+  size_t size_;
+  // The number of empty slots that may still be filled before a rehash.
+  size_t growth_left_;
+};
+
+}  // namespace internal
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_FLAT_HASH_TABLE_H_
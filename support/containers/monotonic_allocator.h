@@ -0,0 +1,188 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_MONOTONIC_ALLOCATOR_H_
+#define SUPPORT_CONTAINERS_MONOTONIC_ALLOCATOR_H_
+
+#include <cstdint>
+
+#include "support/containers/allocator.h"
+
+namespace containers {
+
+// MonotonicAllocator hands out memory by bumping a pointer through a chain
+// of blocks. free() does nothing; all of the memory is reclaimed at once by
+// Reset(), or when the allocator is destroyed. This makes it a good fit for
+// the temporary containers that are built and thrown away in a single
+// function.
+//
+// It may be given an initial buffer, typically on the stack, which is used
+// before any block is requested from the parent allocator. If the
+// temporaries fit in that buffer, they never allocate at all.
+//
+// A MonotonicAllocator is not thread-safe.
+class MonotonicAllocator : public Allocator {
+ public:
+  // Blocks of at least block_size bytes are allocated from parent as
+  // needed.
+  MonotonicAllocator(Allocator* parent, size_t block_size = 4096)
+      : MonotonicAllocator(parent, nullptr, 0, block_size) {}
+
+  // The size bytes at buffer are used before any block is allocated from
+  // parent. buffer must outlive this allocator.
+  MonotonicAllocator(Allocator* parent, void* buffer, size_t size,
+                     size_t block_size = 4096)
+      : parent_(parent),
+        block_size_(block_size),
+        initial_begin_(static_cast<char*>(buffer)),
+        initial_end_(static_cast<char*>(buffer) + size),
+        first_block_(nullptr),
+        current_block_(nullptr),
+        current_(initial_begin_),
+        end_(initial_end_),
+        used_size_(0) {}
+
+  MonotonicAllocator(const MonotonicAllocator&) = delete;
+  MonotonicAllocator& operator=(const MonotonicAllocator&) = delete;
+
+  ~MonotonicAllocator() { Release(); }
+
+  void* malloc(size_t size) override {
+    // We assume that the maximum natural alignment for anything is 16 bytes,
+    // as Allocator::construct does.
+    const size_t aligned_size = (size + kAlignment - 1) & ~(kAlignment - 1);
+    char* begin = Align(current_);
+    if (!begin || begin + aligned_size > end_) {
+      begin = NextBlock(aligned_size);
+    }
+    current_ = begin + aligned_size;
+    used_size_ += aligned_size;
+    return begin;
+  }
+
+  // Memory is only reclaimed by Reset.
+  void free(void*, size_t) override {}
+
+  // Makes all of the memory available again. The blocks that have been
+  // allocated are kept, and reused before any new ones are allocated.
+  // Anything allocated before this must no longer be used.
+  void Reset() {
+    current_block_ = nullptr;
+    current_ = initial_begin_;
+    end_ = initial_end_;
+    used_size_ = 0;
+  }
+
+  // Like Reset, but also returns every block to the parent allocator.
+  void Release() {
+    while (first_block_) {
+      Block* next = first_block_->next;
+      parent_->free(first_block_, sizeof(Block) + first_block_->size);
+      first_block_ = next;
+    }
+    Reset();
+  }
+
+  // Returns the number of bytes handed out since the last Reset.
+  size_t used_size() const { return used_size_; }
+
+ protected:
+  // A block is this header, followed by size bytes of memory.
+  struct Block {
+    Block* next;
+    size_t size;
+  };
+  static const size_t kAlignment = 16;
+
+  static char* Align(char* address) {
+    return reinterpret_cast<char*>(
+        (reinterpret_cast<uintptr_t>(address) + kAlignment - 1) &
+        ~uintptr_t(kAlignment - 1));
+  }
+
+  static char* BlockBegin(Block* block) {
+    return reinterpret_cast<char*>(block + 1);
+  }
+
+  // Moves on to the next block that has at least size bytes, reusing the
+  // blocks kept by Reset where possible. Returns the start of the block.
+  char* NextBlock(size_t size) {
+    Block** link = current_block_ ? &current_block_->next : &first_block_;
+    // Blocks that are too small for this allocation are skipped, and remain
+    // available after the next Reset.
+    while (*link && (*link)->size < size + kAlignment) {
+      link = &(*link)->next;
+    }
+    if (!*link) {
+      const size_t block_size =
+          size + kAlignment > block_size_ ? size + kAlignment : block_size_;
+      Block* block = static_cast<Block*>(
+          parent_->malloc(sizeof(Block) + block_size));
+      block->next = nullptr;
+      block->size = block_size;
+      *link = block;
+    }
+    current_block_ = *link;
+    end_ = BlockBegin(current_block_) + current_block_->size;
+    return Align(BlockBegin(current_block_));
+  }
+
+  Allocator* parent_;
+  size_t block_size_;
+  char* initial_begin_;
+  char* initial_end_;
+  Block* first_block_;
+  Block* current_block_;
+  char* current_;
+  char* end_;
+  size_t used_size_;
+};
+
+// FrameAllocator is a MonotonicAllocator for memory that only lives for a
+// single frame. EndFrame must be called once every frame, after which none
+// of the memory from that frame may be used.
+//
+// If a frame needed more than one block, the blocks are replaced by a single
+// block that is large enough for the whole frame. After the first few
+// frames, a frame allocates nothing from the parent allocator at all.
+class FrameAllocator : public MonotonicAllocator {
+ public:
+  FrameAllocator(Allocator* parent, size_t block_size = 64 * 1024)
+      : MonotonicAllocator(parent, block_size), peak_frame_size_(0) {}
+
+  void EndFrame() {
+    const size_t frame_size = used_size();
+    if (frame_size > peak_frame_size_) {
+      peak_frame_size_ = frame_size;
+    }
+    if (current_block_ && current_block_ != first_block_) {
+      Release();
+      if (peak_frame_size_ + kAlignment > block_size_) {
+        block_size_ = peak_frame_size_ + kAlignment;
+      }
+    }
+    Reset();
+  }
+
+  // Returns the most memory that any one frame has used.
+  size_t peak_frame_size() const { return peak_frame_size_; }
+
+ private:
+  size_t peak_frame_size_;
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_MONOTONIC_ALLOCATOR_H_
@@ -0,0 +1,149 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_MPMC_QUEUE_H_
+#define SUPPORT_CONTAINERS_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "support/containers/allocator.h"
+#include "support/containers/spsc_queue.h"
+
+namespace containers {
+
+// MpmcQueue is a bounded, lock-free FIFO queue that any number of threads
+// may push to and pop from at once.
+//
+// Every slot has a sequence number that says whose turn it is: a producer
+// may fill the slot for position pos once the sequence is pos, and a
+// consumer may empty it once the sequence is pos + 1. Claiming a position
+// is a single compare-and-swap on the shared index.
+template <typename T>
+class MpmcQueue {
+ public:
+  // The capacity is rounded up to a power of two, and must be at least 2.
+  MpmcQueue(Allocator* allocator, size_t capacity)
+      : allocator_(allocator),
+        capacity_(RoundUpToPowerOfTwo(capacity)),
+        cells_(static_cast<Cell*>(
+            allocator_->malloc(sizeof(Cell) * capacity_))),
+        enqueue_position_(0),
+        dequeue_position_(0) {
+    for (size_t i = 0; i < capacity_; ++i) {
+      ::new (static_cast<void*>(&cells_[i].sequence)) std::atomic<size_t>(i);
+    }
+  }
+
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+  ~MpmcQueue() {
+    const size_t end = enqueue_position_.load();
+    for (size_t i = dequeue_position_.load(); i != end; ++i) {
+      cells_[i & (capacity_ - 1)].value()->~T();
+    }
+    allocator_->free(cells_, sizeof(Cell) * capacity_);
+  }
+
+  // Returns false if the queue is full.
+  bool TryPush(T value) {
+    size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+      cell = &cells_[position & (capacity_ - 1)];
+      const intptr_t difference =
+          static_cast<intptr_t>(
+              cell->sequence.load(std::memory_order_acquire)) -
+          static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (enqueue_position_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    ::new (static_cast<void*>(&cell->storage)) T(std::move(value));
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Moves the oldest element into *value, and returns false if the queue
+  // is empty.
+  bool TryPop(T* value) {
+    size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+      cell = &cells_[position & (capacity_ - 1)];
+      const intptr_t difference =
+          static_cast<intptr_t>(
+              cell->sequence.load(std::memory_order_acquire)) -
+          static_cast<intptr_t>(position + 1);
+      if (difference == 0) {
+        if (dequeue_position_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = dequeue_position_.load(std::memory_order_relaxed);
+      }
+    }
+    *value = std::move(*cell->value());
+    cell->value()->~T();
+    cell->sequence.store(position + capacity_, std::memory_order_release);
+    return true;
+  }
+
+  size_t capacity() const { return capacity_; }
+
+ private:
+  struct Cell {
+    T* value() { return reinterpret_cast<T*>(&storage); }
+
+    std::atomic<size_t> sequence;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+  };
+
+  static size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t result = 2;
+    while (result < value) {
+      result *= 2;
+    }
+    return result;
+  }
+
+  Allocator* allocator_;
+  const size_t capacity_;
+  Cell* cells_;
+
+  char pad0_[kCacheLineSize];
+  std::atomic<size_t> enqueue_position_;
+  char pad1_[kCacheLineSize];
+  std::atomic<size_t> dequeue_position_;
+  char pad2_[kCacheLineSize];
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_MPMC_QUEUE_H_
@@ -0,0 +1,209 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_OBJECT_POOL_H_
+#define SUPPORT_CONTAINERS_OBJECT_POOL_H_
+
+#include <mutex>
+#include <utility>
+
+#include "support/containers/allocator.h"
+
+namespace containers {
+
+// FixedSizePool hands out blocks of a single size. Blocks are carved out of
+// slabs that hold many of them, and freed blocks are kept on an intrusive
+// free-list, so there is no per-block header and almost no calls to the
+// parent allocator once the pool has warmed up.
+//
+// The slabs are only returned to the parent allocator when the pool is
+// destroyed, at which point every block must have been freed.
+// A FixedSizePool is not thread-safe.
+class FixedSizePool {
+ public:
+  FixedSizePool(Allocator* parent, size_t block_size,
+                size_t blocks_per_slab = 64)
+      : parent_(parent),
+        block_size_(RoundUp(block_size < sizeof(FreeBlock) ? sizeof(FreeBlock)
+                                                            : block_size)),
+        blocks_per_slab_(blocks_per_slab),
+        free_blocks_(nullptr),
+        slabs_(nullptr) {}
+
+  FixedSizePool(const FixedSizePool&) = delete;
+  FixedSizePool& operator=(const FixedSizePool&) = delete;
+
+  ~FixedSizePool() {
+    while (slabs_) {
+      Slab* next = slabs_->next;
+      parent_->free(slabs_, slab_size());
+      slabs_ = next;
+    }
+  }
+
+  void* Allocate() {
+    if (!free_blocks_) {
+      AddSlab();
+    }
+    FreeBlock* block = free_blocks_;
+    free_blocks_ = block->next;
+    return block;
+  }
+
+  void Free(void* memory) {
+    FreeBlock* block = static_cast<FreeBlock*>(memory);
+    block->next = free_blocks_;
+    free_blocks_ = block;
+  }
+
+  size_t block_size() const { return block_size_; }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+  // A slab is this header followed by blocks_per_slab_ blocks.
+  struct Slab {
+    Slab* next;
+  };
+  // Blocks are aligned to this, as Allocator::construct assumes is enough
+  // for anything.
+  static const size_t kAlignment = 16;
+
+  static size_t RoundUp(size_t size) {
+    return (size + kAlignment - 1) & ~(kAlignment - 1);
+  }
+
+  size_t slab_size() const {
+    return RoundUp(sizeof(Slab)) + block_size_ * blocks_per_slab_;
+  }
+
+  void AddSlab() {
+    Slab* slab = static_cast<Slab*>(parent_->malloc(slab_size()));
+    slab->next = slabs_;
+    slabs_ = slab;
+    char* blocks = reinterpret_cast<char*>(slab) + RoundUp(sizeof(Slab));
+    // Push them in reverse, so that they are handed out in address order.
+    for (size_t i = blocks_per_slab_; i > 0; --i) {
+      Free(blocks + (i - 1) * block_size_);
+    }
+  }
+
+  Allocator* parent_;
+  size_t block_size_;
+  size_t blocks_per_slab_;
+  FreeBlock* free_blocks_;
+  Slab* slabs_;
+};
+
+// ObjectPool is a typed FixedSizePool. New constructs a T in a block from
+// the pool, and Delete destroys it and returns the block.
+template <typename T>
+class ObjectPool {
+ public:
+  ObjectPool(Allocator* parent, size_t objects_per_slab = 64)
+      : pool_(parent, sizeof(T), objects_per_slab) {}
+
+  template <typename... Args>
+  T* New(Args&&... args) {
+    return ::new (pool_.Allocate()) T(std::forward<Args>(args)...);
+  }
+
+  void Delete(T* t) {
+    t->~T();
+    pool_.Free(t);
+  }
+
+ private:
+  FixedSizePool pool_;
+};
+
+// SizeClassAllocator is an Allocator that serves small allocations from one
+// FixedSizePool per size class, and passes larger ones to its parent.
+// Allocator::free is given the size of the allocation, so the size class
+// can be found without a header.
+//
+// It is meant for the many small, long-lived objects that are created
+// through containers::make_unique. It must outlive everything allocated
+// from it.
+class SizeClassAllocator : public Allocator {
+ public:
+  // The largest allocation that is served from a pool.
+  static const size_t kMaxPooledSize = 256;
+
+  // If thread_safe is true, the allocator may be used from any thread.
+  SizeClassAllocator(Allocator* parent, bool thread_safe = false)
+      : parent_(parent), thread_safe_(thread_safe) {
+    for (size_t i = 0; i < kClassCount; ++i) {
+      pools_[i] = nullptr;
+    }
+  }
+
+  ~SizeClassAllocator() {
+    for (size_t i = 0; i < kClassCount; ++i) {
+      if (pools_[i]) {
+        pools_[i]->~FixedSizePool();
+        parent_->free(pools_[i], sizeof(FixedSizePool));
+      }
+    }
+  }
+
+  void* malloc(size_t size) override {
+    if (size == 0 || size > kMaxPooledSize) {
+      return parent_->malloc(size);
+    }
+    auto lock = Lock();
+    return Pool(size)->Allocate();
+  }
+
+  void free(void* memory, size_t size) override {
+    if (size == 0 || size > kMaxPooledSize) {
+      parent_->free(memory, size);
+      return;
+    }
+    auto lock = Lock();
+    Pool(size)->Free(memory);
+  }
+
+ private:
+  static const size_t kClassGranularity = 16;
+  static const size_t kClassCount = kMaxPooledSize / kClassGranularity;
+
+  // Returns the pool for the size class of size, creating it if needed.
+  FixedSizePool* Pool(size_t size) {
+    const size_t index = (size - 1) / kClassGranularity;
+    if (!pools_[index]) {
+      pools_[index] = ::new (parent_->malloc(sizeof(FixedSizePool)))
+          FixedSizePool(parent_, (index + 1) * kClassGranularity);
+    }
+    return pools_[index];
+  }
+
+  // Returns a lock on mutex_ if the allocator is thread safe, or an empty
+  // lock otherwise.
+  std::unique_lock<std::mutex> Lock() {
+    return thread_safe_ ? std::unique_lock<std::mutex>(mutex_)
+                        : std::unique_lock<std::mutex>();
+  }
+
+  Allocator* parent_;
+  bool thread_safe_;
+  std::mutex mutex_;
+  FixedSizePool* pools_[kClassCount];
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_OBJECT_POOL_H_
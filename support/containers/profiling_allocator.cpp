@@ -0,0 +1,325 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "support/containers/profiling_allocator.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#include <unwind.h>
+#endif
+
+namespace containers {
+
+namespace {
+// Every allocation has a header this large in front of it, which holds the
+// index of its tag. This keeps the allocation 16 byte aligned.
+const size_t kHeaderSize = 16;
+// The frames of the profiler itself, which are dropped from every sample.
+const uint32_t kSkippedFrames = 2;
+// The number of call stacks that are written to the report.
+const size_t kReportedStacks = 20;
+
+struct ThreadState {
+  // The innermost ScopedAllocationTag on this thread.
+  const char* tag;
+  // The rest is only valid for the allocator with this id.
+  uint64_t allocator_id;
+  void* buffer;
+  bool has_cached_tag;
+  const char* cached_tag;
+  uint32_t cached_tag_index;
+  uint32_t allocations_until_sample;
+};
+
+thread_local ThreadState thread_state;
+std::atomic<uint64_t> next_allocator_id(1);
+
+#if !defined(_WIN32)
+struct UnwindState {
+  void** frames;
+  uint32_t depth;
+  uint32_t skip;
+};
+
+_Unwind_Reason_Code UnwindCallback(_Unwind_Context* context, void* data) {
+  UnwindState* state = static_cast<UnwindState*>(data);
+  if (state->skip) {
+    --state->skip;
+    return _URC_NO_REASON;
+  }
+  if (state->depth == ProfilingAllocator::kMaxStackDepth) {
+    return _URC_END_OF_STACK;
+  }
+  state->frames[state->depth++] =
+      reinterpret_cast<void*>(_Unwind_GetIP(context));
+  return _URC_NO_REASON;
+}
+#endif
+
+// Fills frames with the return addresses of the calling stack, and returns
+// how many there are.
+uint32_t CaptureStack(void** frames) {
+#if defined(_WIN32)
+  return CaptureStackBackTrace(kSkippedFrames + 1,
+                               ProfilingAllocator::kMaxStackDepth, frames,
+                               nullptr);
+#else
+  UnwindState state = {frames, 0, kSkippedFrames + 1};
+  _Unwind_Backtrace(&UnwindCallback, &state);
+  return state.depth;
+#endif
+}
+
+void WriteFrame(std::ostream& stream, void* frame) {
+  stream << frame;
+#if !defined(_WIN32)
+  Dl_info info;
+  if (dladdr(frame, &info) && info.dli_fname) {
+    const char* name = strrchr(info.dli_fname, '/');
+    stream << " " << (name ? name + 1 : info.dli_fname) << "+0x" << std::hex
+           << (static_cast<char*>(frame) - static_cast<char*>(info.dli_fbase))
+           << std::dec;
+    if (info.dli_sname) {
+      stream << " (" << info.dli_sname << ")";
+    }
+  }
+#endif
+}
+}  // anonymous namespace
+
+ScopedAllocationTag::ScopedAllocationTag(const char* tag)
+    : previous_(thread_state.tag) {
+  thread_state.tag = tag;
+}
+
+ScopedAllocationTag::~ScopedAllocationTag() { thread_state.tag = previous_; }
+
+const char* ScopedAllocationTag::current() { return thread_state.tag; }
+
+ProfilingAllocator::ProfilingAllocator(Allocator* parent,
+                                       uint32_t sample_interval)
+    : parent_(parent),
+      sample_interval_(sample_interval),
+      id_(next_allocator_id++),
+      thread_buffers_(nullptr) {
+  for (auto& tag : tags_) {
+    tag.name.store(nullptr);
+    tag.allocation_count.store(0);
+    tag.allocated_bytes.store(0);
+    tag.live_bytes.store(0);
+    tag.peak_live_bytes.store(0);
+    for (auto& bucket : tag.size_histogram) {
+      bucket.store(0);
+    }
+  }
+}
+
+ProfilingAllocator::~ProfilingAllocator() {
+  ThreadBuffer* buffer = thread_buffers_.load();
+  while (buffer) {
+    ThreadBuffer* next = buffer->next;
+    buffer->~ThreadBuffer();
+    ::free(buffer);
+    buffer = next;
+  }
+}
+
+void* ProfilingAllocator::malloc(size_t size) {
+  ThreadState& state = thread_state;
+  if (state.allocator_id != id_) {
+    state.allocator_id = id_;
+    state.buffer = nullptr;
+    state.has_cached_tag = false;
+    state.allocations_until_sample = sample_interval_;
+  }
+  if (!state.has_cached_tag || state.cached_tag != state.tag) {
+    state.cached_tag = state.tag;
+    state.cached_tag_index = FindTag(state.tag);
+    state.has_cached_tag = true;
+  }
+  const uint32_t tag_index = state.cached_tag_index;
+
+  Tag& tag = tags_[tag_index];
+  tag.allocation_count.fetch_add(1, std::memory_order_relaxed);
+  tag.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  const size_t live =
+      tag.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  size_t peak = tag.peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak &&
+         !tag.peak_live_bytes.compare_exchange_weak(peak, live)) {
+  }
+  size_t bucket = 0;
+  for (size_t limit = 16; size > limit && bucket + 1 < kSizeBuckets;
+       limit *= 2) {
+    ++bucket;
+  }
+  tag.size_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+  if (sample_interval_ && --state.allocations_until_sample == 0) {
+    state.allocations_until_sample = sample_interval_;
+    RecordSample(tag_index, size);
+  }
+
+  char* base = static_cast<char*>(parent_->malloc(size + kHeaderSize));
+  *reinterpret_cast<uint32_t*>(base) = tag_index;
+  return base + kHeaderSize;
+}
+
+void ProfilingAllocator::free(void* memory, size_t size) {
+  char* base = static_cast<char*>(memory) - kHeaderSize;
+  const uint32_t tag_index = *reinterpret_cast<uint32_t*>(base);
+  tags_[tag_index].live_bytes.fetch_sub(size, std::memory_order_relaxed);
+  parent_->free(base, size + kHeaderSize);
+}
+
+uint32_t ProfilingAllocator::FindTag(const char* name) {
+  // Tag 0 is for untagged allocations.
+  if (!name) {
+    return 0;
+  }
+  for (uint32_t i = 1; i < kMaxTags; ++i) {
+    const char* existing = tags_[i].name.load();
+    if (!existing && tags_[i].name.compare_exchange_strong(existing, name)) {
+      return i;
+    }
+    // The same tag may be a different string in another library.
+    if (existing == name || strcmp(existing, name) == 0) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+ProfilingAllocator::ThreadBuffer* ProfilingAllocator::GetThreadBuffer() {
+  ThreadState& state = thread_state;
+  if (!state.buffer) {
+    ThreadBuffer* buffer =
+        ::new (::malloc(sizeof(ThreadBuffer))) ThreadBuffer();
+    buffer->sample_count.store(0);
+    buffer->next = thread_buffers_.load();
+    while (!thread_buffers_.compare_exchange_weak(buffer->next, buffer)) {
+    }
+    state.buffer = buffer;
+  }
+  return static_cast<ThreadBuffer*>(state.buffer);
+}
+
+void ProfilingAllocator::RecordSample(uint32_t tag, size_t size) {
+  ThreadBuffer* buffer = GetThreadBuffer();
+  const size_t count = buffer->sample_count.load(std::memory_order_relaxed);
+  if (count == kSamplesPerThread) {
+    return;
+  }
+  Sample& sample = buffer->samples[count];
+  sample.tag = tag;
+  sample.size = size;
+  sample.depth = CaptureStack(sample.frames);
+  buffer->sample_count.store(count + 1, std::memory_order_release);
+}
+
+void ProfilingAllocator::WriteReport(std::ostream& stream) const {
+  stream << "Allocations by tag:\n";
+  for (uint32_t i = 0; i < kMaxTags; ++i) {
+    const Tag& tag = tags_[i];
+    if (!tag.allocation_count.load()) {
+      continue;
+    }
+    const char* name = tag.name.load();
+    stream << (name ? name : "(untagged)") << ": "
+           << tag.allocation_count.load() << " allocations, "
+           << tag.allocated_bytes.load() << " bytes, "
+           << tag.live_bytes.load() << " bytes live, "
+           << tag.peak_live_bytes.load() << " bytes peak\n";
+    stream << "  sizes:";
+    size_t limit = 16;
+    for (size_t bucket = 0; bucket < kSizeBuckets; ++bucket, limit *= 2) {
+      const uint64_t count = tag.size_histogram[bucket].load();
+      if (!count) {
+        continue;
+      }
+      if (bucket + 1 < kSizeBuckets) {
+        stream << " <=" << limit << ":" << count;
+      } else {
+        stream << " >" << limit / 2 << ":" << count;
+      }
+    }
+    stream << "\n";
+  }
+
+  // Group the samples that have the same tag and call stack.
+  std::vector<const Sample*> samples;
+  bool truncated = false;
+  for (const ThreadBuffer* buffer = thread_buffers_.load(); buffer;
+       buffer = buffer->next) {
+    const size_t count = buffer->sample_count.load(std::memory_order_acquire);
+    truncated |= count == kSamplesPerThread;
+    for (size_t i = 0; i < count; ++i) {
+      samples.push_back(&buffer->samples[i]);
+    }
+  }
+  auto less = [](const Sample* a, const Sample* b) {
+    if (a->tag != b->tag) {
+      return a->tag < b->tag;
+    }
+    return std::lexicographical_compare(a->frames, a->frames + a->depth,
+                                        b->frames, b->frames + b->depth);
+  };
+  std::sort(samples.begin(), samples.end(), less);
+
+  struct Stack {
+    const Sample* sample;
+    size_t count;
+    uint64_t bytes;
+  };
+  std::vector<Stack> stacks;
+  for (const Sample* sample : samples) {
+    if (stacks.empty() || less(stacks.back().sample, sample)) {
+      stacks.push_back({sample, 0, 0});
+    }
+    stacks.back().count += 1;
+    stacks.back().bytes += sample->size;
+  }
+  std::sort(stacks.begin(), stacks.end(), [](const Stack& a, const Stack& b) {
+    return a.bytes > b.bytes;
+  });
+
+  stream << "\nSampled call stacks (1 in " << sample_interval_
+         << " allocations per thread):\n";
+  if (truncated) {
+    stream << "Some threads stopped sampling after " << kSamplesPerThread
+           << " samples.\n";
+  }
+  for (size_t i = 0; i < stacks.size() && i < kReportedStacks; ++i) {
+    const Stack& stack = stacks[i];
+    const char* name = tags_[stack.sample->tag].name.load();
+    stream << stack.count << " samples, " << stack.bytes << " bytes, "
+           << (name ? name : "(untagged)") << "\n";
+    for (uint32_t j = 0; j < stack.sample->depth; ++j) {
+      stream << "  #" << j << " ";
+      WriteFrame(stream, stack.sample->frames[j]);
+      stream << "\n";
+    }
+  }
+}
+
+}  // namespace containers
@@ -0,0 +1,126 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_PROFILING_ALLOCATOR_H_
+#define SUPPORT_CONTAINERS_PROFILING_ALLOCATOR_H_
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+#include "support/containers/allocator.h"
+
+namespace containers {
+
+// While a ScopedAllocationTag is alive, every allocation that its thread
+// makes through a ProfilingAllocator is attributed to its tag. Tags nest,
+// and cost a thread-local store when no ProfilingAllocator is in use.
+//
+// tag must be a string that outlives every ProfilingAllocator, typically a
+// literal.
+class ScopedAllocationTag {
+ public:
+  explicit ScopedAllocationTag(const char* tag);
+  ~ScopedAllocationTag();
+
+  ScopedAllocationTag(const ScopedAllocationTag&) = delete;
+  ScopedAllocationTag& operator=(const ScopedAllocationTag&) = delete;
+
+  // Returns the innermost tag on this thread, or nullptr if there is none.
+  static const char* current();
+
+ private:
+  const char* previous_;
+};
+
+// ProfilingAllocator wraps another Allocator, and records who allocates
+// from it. For every tag it counts the allocations, the bytes that are live
+// and the most that have ever been live, and keeps a histogram of the
+// allocation sizes. These counters are updated for every allocation, with
+// no locks.
+//
+// One in every sample_interval allocations on each thread also records the
+// call stack that it came from. Each thread writes its samples to its own
+// buffer, so that recording them needs no synchronization either.
+//
+// The profiler's own bookkeeping is not allocated from the parent, so the
+// parent only sees the application's allocations, each with a 16 byte
+// header in front.
+class ProfilingAllocator : public Allocator {
+ public:
+  // Tags beyond this many are counted as untagged.
+  static const size_t kMaxTags = 64;
+  // Allocations are bucketed by the next power of two of their size. The
+  // last bucket holds everything larger.
+  static const size_t kSizeBuckets = 24;
+  static const size_t kMaxStackDepth = 16;
+  // Once a thread has recorded this many samples, it stops sampling.
+  static const size_t kSamplesPerThread = 1024;
+
+  explicit ProfilingAllocator(Allocator* parent, uint32_t sample_interval = 64);
+  ~ProfilingAllocator();
+
+  ProfilingAllocator(const ProfilingAllocator&) = delete;
+  ProfilingAllocator& operator=(const ProfilingAllocator&) = delete;
+
+  void* malloc(size_t size) override;
+  void free(void* memory, size_t size) override;
+
+  // Writes a human-readable report of the counters for each tag, and of the
+  // call stacks that were sampled most often, to stream. This must not be
+  // called while another thread is allocating.
+  void WriteReport(std::ostream& stream) const;
+
+ private:
+  struct Tag {
+    std::atomic<const char*> name;
+    std::atomic<uint64_t> allocation_count;
+    std::atomic<uint64_t> allocated_bytes;
+    std::atomic<size_t> live_bytes;
+    std::atomic<size_t> peak_live_bytes;
+    std::atomic<uint64_t> size_histogram[kSizeBuckets];
+  };
+
+  struct Sample {
+    uint32_t tag;
+    uint32_t depth;
+    size_t size;
+    void* frames[kMaxStackDepth];
+  };
+
+  // The samples of one thread. Only that thread writes to it.
+  struct ThreadBuffer {
+    ThreadBuffer* next;
+    std::atomic<size_t> sample_count;
+    Sample samples[kSamplesPerThread];
+  };
+
+  // Returns the index of the tag with the given name, adding it if needed.
+  uint32_t FindTag(const char* name);
+  // Returns the buffer of the calling thread, creating it if needed.
+  ThreadBuffer* GetThreadBuffer();
+  void RecordSample(uint32_t tag, size_t size);
+
+  Allocator* parent_;
+  uint32_t sample_interval_;
+  // Identifies this allocator to the thread-local state, which outlives it.
+  uint64_t id_;
+  Tag tags_[kMaxTags];
+  std::atomic<ThreadBuffer*> thread_buffers_;
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_PROFILING_ALLOCATOR_H_
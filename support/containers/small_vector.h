@@ -0,0 +1,252 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_SMALL_VECTOR_H_
+#define SUPPORT_CONTAINERS_SMALL_VECTOR_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "support/containers/allocator.h"
+
+namespace containers {
+
+// small_vector is a vector that keeps up to N elements inline, and only
+// allocates from its Allocator once it grows beyond that. It has the same
+// interface as containers::vector for the operations that it supports, so
+// that short-lived vectors of a handful of elements cost no allocations.
+//
+// Unlike containers::vector, moving a small_vector whose elements are
+// inline moves each element, and so invalidates iterators into the source.
+template <typename T, size_t N>
+class small_vector {
+ public:
+  typedef T value_type;
+  typedef T* iterator;
+  typedef const T* const_iterator;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+
+  // Any memory beyond the inline storage comes from allocator, which must
+  // outlive this small_vector.
+  explicit small_vector(Allocator* allocator)
+      : allocator_(allocator), data_(inline_data()), size_(0), capacity_(N) {}
+
+  small_vector(size_t count, const T& value, Allocator* allocator)
+      : small_vector(allocator) {
+    resize(count, value);
+  }
+
+  small_vector(std::initializer_list<T> values, Allocator* allocator)
+      : small_vector(allocator) {
+    insert(end(), values.begin(), values.end());
+  }
+
+  small_vector(const small_vector& other) : small_vector(other.allocator_) {
+    insert(end(), other.begin(), other.end());
+  }
+
+  small_vector(small_vector&& other) : small_vector(other.allocator_) {
+    *this = std::move(other);
+  }
+
+  ~small_vector() {
+    clear();
+    ReleaseHeapStorage();
+  }
+
+  small_vector& operator=(const small_vector& other) {
+    if (this != &other) {
+      clear();
+      insert(end(), other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  small_vector& operator=(small_vector&& other) {
+    if (this == &other) {
+      return *this;
+    }
+    clear();
+    if (!other.is_inline() && other.allocator_ == allocator_) {
+      // Take the other vector's heap storage outright.
+      ReleaseHeapStorage();
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inline_data();
+      other.size_ = 0;
+      other.capacity_ = N;
+      return *this;
+    }
+    reserve(other.size_);
+    for (size_t i = 0; i < other.size_; ++i) {
+      ::new (static_cast<void*>(data_ + i)) T(std::move(other.data_[i]));
+    }
+    size_ = other.size_;
+    other.clear();
+    return *this;
+  }
+
+  iterator begin() { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator begin() const { return data_; }
+  const_iterator end() const { return data_ + size_; }
+
+  T* data() { return data_; }
+  const T* data() const { return data_; }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_t capacity() const { return capacity_; }
+
+  // Returns true if the elements are stored inline.
+  bool is_inline() const { return data_ == inline_data(); }
+
+  T& operator[](size_t i) { return data_[i]; }
+  const T& operator[](size_t i) const { return data_[i]; }
+  T& front() { return data_[0]; }
+  const T& front() const { return data_[0]; }
+  T& back() { return data_[size_ - 1]; }
+  const T& back() const { return data_[size_ - 1]; }
+
+  void reserve(size_t capacity) {
+    if (capacity <= capacity_) {
+      return;
+    }
+    T* data = static_cast<T*>(allocator_->malloc(sizeof(T) * capacity));
+    for (size_t i = 0; i < size_; ++i) {
+      ::new (static_cast<void*>(data + i)) T(std::move(data_[i]));
+      data_[i].~T();
+    }
+    ReleaseHeapStorage();
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  void resize(size_t size) {
+    Shrink(size);
+    Grow(size);
+    for (; size_ < size; ++size_) {
+      ::new (static_cast<void*>(data_ + size_)) T();
+    }
+  }
+
+  void resize(size_t size, const T& value) {
+    Shrink(size);
+    Grow(size);
+    for (; size_ < size; ++size_) {
+      ::new (static_cast<void*>(data_ + size_)) T(value);
+    }
+  }
+
+  void clear() { Shrink(0); }
+
+  void push_back(const T& value) { emplace_back(value); }
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  void emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+      // value may refer to an element of this vector, so construct it
+      // before the elements move.
+      T value(std::forward<Args>(args)...);
+      Grow(size_ + 1);
+      ::new (static_cast<void*>(data_ + size_)) T(std::move(value));
+    } else {
+      ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+    }
+    ++size_;
+  }
+
+  void pop_back() { data_[--size_].~T(); }
+
+  // Inserts [first, last) before position. first and last must not point
+  // into this vector.
+  template <typename InputIt>
+  iterator insert(const_iterator position, InputIt first, InputIt last) {
+    const size_t index = position - data_;
+    const size_t count = std::distance(first, last);
+    Grow(size_ + count);
+    // Move the tail up by count, starting from the end.
+    for (size_t i = size_; i > index; --i) {
+      ::new (static_cast<void*>(data_ + i - 1 + count))
+          T(std::move(data_[i - 1]));
+      data_[i - 1].~T();
+    }
+    for (size_t i = 0; i < count; ++i, ++first) {
+      ::new (static_cast<void*>(data_ + index + i)) T(*first);
+    }
+    size_ += count;
+    return data_ + index;
+  }
+
+  iterator insert(const_iterator position, const T& value) {
+    return insert(position, &value, &value + 1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    const size_t index = first - data_;
+    const size_t count = last - first;
+    for (size_t i = index; i + count < size_; ++i) {
+      data_[i] = std::move(data_[i + count]);
+    }
+    Shrink(size_ - count);
+    return data_ + index;
+  }
+
+  iterator erase(const_iterator position) {
+    return erase(position, position + 1);
+  }
+
+ private:
+  T* inline_data() { return reinterpret_cast<T*>(inline_); }
+  const T* inline_data() const { return reinterpret_cast<const T*>(inline_); }
+
+  // Makes room for at least size elements, growing geometrically.
+  void Grow(size_t size) {
+    if (size > capacity_) {
+      reserve(size > capacity_ * 2 ? size : capacity_ * 2);
+    }
+  }
+
+  // Destroys the elements past size.
+  void Shrink(size_t size) {
+    while (size_ > size) {
+      data_[--size_].~T();
+    }
+  }
+
+  void ReleaseHeapStorage() {
+    if (!is_inline()) {
+      allocator_->free(data_, sizeof(T) * capacity_);
+    }
+  }
+
+  Allocator* allocator_;
+  T* data_;
+  size_t size_;
+  size_t capacity_;
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type inline_[N];
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_SMALL_VECTOR_H_
@@ -0,0 +1,144 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_SPSC_QUEUE_H_
+#define SUPPORT_CONTAINERS_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "support/containers/allocator.h"
+
+namespace containers {
+
+// The size that is assumed for a cache line. The indices of the concurrent
+// queues are kept this far apart, so that the producers and the consumers
+// do not contend for the same line.
+const size_t kCacheLineSize = 64;
+
+// SpscQueue is a bounded, lock-free FIFO queue for exactly one producer
+// thread and one consumer thread. Neither side ever blocks: TryPush fails
+// if the queue is full, and TryPop fails if it is empty.
+//
+// Each side keeps a cached copy of the other side's index, so that it only
+// reads the shared index when the cached one says the queue is full or
+// empty.
+template <typename T>
+class SpscQueue {
+ public:
+  // The capacity is rounded up to a power of two.
+  SpscQueue(Allocator* allocator, size_t capacity)
+      : allocator_(allocator),
+        capacity_(RoundUpToPowerOfTwo(capacity)),
+        slots_(static_cast<Slot*>(
+            allocator_->malloc(sizeof(Slot) * capacity_))),
+        tail_(0),
+        cached_head_(0),
+        head_(0),
+        cached_tail_(0) {}
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  ~SpscQueue() {
+    while (Front()) {
+      Pop();
+    }
+    allocator_->free(slots_, sizeof(Slot) * capacity_);
+  }
+
+  // Producer only. Returns false if the queue is full.
+  bool TryPush(T value) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == capacity_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ == capacity_) {
+        return false;
+      }
+    }
+    ::new (static_cast<void*>(&slots_[tail & (capacity_ - 1)]))
+        T(std::move(value));
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer only. Returns the oldest element, or nullptr if the queue is
+  // empty. The element stays in the queue until Pop is called.
+  T* Front() {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) {
+        return nullptr;
+      }
+    }
+    return reinterpret_cast<T*>(&slots_[head & (capacity_ - 1)]);
+  }
+
+  // Consumer only. Removes the element returned by Front, which must not
+  // have returned nullptr.
+  void Pop() {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    reinterpret_cast<T*>(&slots_[head & (capacity_ - 1)])->~T();
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  // Consumer only. Moves the oldest element into *value, and returns false
+  // if the queue is empty.
+  bool TryPop(T* value) {
+    T* front = Front();
+    if (!front) {
+      return false;
+    }
+    *value = std::move(*front);
+    Pop();
+    return true;
+  }
+
+  size_t capacity() const { return capacity_; }
+
+ private:
+  typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+  static size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+      result *= 2;
+    }
+    return result;
+  }
+
+  Allocator* allocator_;
+  const size_t capacity_;
+  Slot* slots_;
+
+  char pad0_[kCacheLineSize];
+  // Written by the producer.
+  std::atomic<size_t> tail_;
+  size_t cached_head_;
+
+  char pad1_[kCacheLineSize];
+  // Written by the consumer.
+  std::atomic<size_t> head_;
+  size_t cached_tail_;
+
+  char pad2_[kCacheLineSize];
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_SPSC_QUEUE_H_
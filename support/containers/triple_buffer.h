@@ -0,0 +1,81 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_CONTAINERS_TRIPLE_BUFFER_H_
+#define SUPPORT_CONTAINERS_TRIPLE_BUFFER_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace containers {
+
+// TripleBuffer passes the latest value of a T from one writer thread to one
+// reader thread, without either of them ever waiting. The writer fills
+// write_buffer() and publishes it; the reader calls Update to pick up the
+// most recently published value, if there is a new one, and then reads
+// read_buffer(). A value that is published but never picked up is handed
+// back to the writer by the next Publish, so a writer that passes out
+// resources, rather than plain values, can reclaim it.
+//
+// There are three copies of T: one owned by each thread, and one in the
+// middle that they swap their own copy with.
+template <typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() : write_index_(0), read_index_(2), middle_(1) {}
+
+  // Writer only.
+  T& write_buffer() { return buffers_[write_index_]; }
+
+  // Writer only. Makes the contents of write_buffer() available to the
+  // reader. write_buffer() then refers to a different copy. Returns true
+  // if that copy holds the previously published value, which the reader
+  // never picked up; otherwise its contents are stale.
+  bool Publish() {
+    const uint8_t previous =
+        middle_.exchange(write_index_ | kNewData, std::memory_order_acq_rel);
+    write_index_ = previous & kIndexMask;
+    return (previous & kNewData) != 0;
+  }
+
+  // Reader only. Returns true if a new value has been published since the
+  // last Update, in which case it is now in read_buffer().
+  bool Update() {
+    if (!(middle_.load(std::memory_order_relaxed) & kNewData)) {
+      return false;
+    }
+    read_index_ =
+        middle_.exchange(read_index_, std::memory_order_acq_rel) & kIndexMask;
+    return true;
+  }
+
+  // Reader only.
+  const T& read_buffer() const { return buffers_[read_index_]; }
+
+ private:
+  // The middle copy has this bit set if the writer has published it, and
+  // the reader has not yet taken it.
+  static const uint8_t kNewData = 4;
+  static const uint8_t kIndexMask = 3;
+
+  T buffers_[3];
+  uint8_t write_index_;
+  uint8_t read_index_;
+  std::atomic<uint8_t> middle_;
+};
+
+}  // namespace containers
+
+#endif  // SUPPORT_CONTAINERS_TRIPLE_BUFFER_H_
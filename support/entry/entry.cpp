@@ -19,11 +19,13 @@
 #include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <mutex>
 #include <thread>
 
 #include "entry_config.h"
+#include "support/containers/profiling_allocator.h"
 #include "support/log/log.h"
 
 namespace entry {
@@ -32,14 +34,58 @@ void dummy_function() {}
 }  // namespace internal
 }  // namespace entry
 
+// The allocators behind entry_data::root_allocator. Every allocation is
+// checked for leaks, and if an allocation profile was requested, it also
+// goes through the profiler.
+struct RootAllocators {
+  explicit RootAllocators(const char* allocation_profile_file)
+      : profiling_allocator(&leak_check_allocator),
+        allocation_profile_file(allocation_profile_file) {}
+
+  containers::Allocator* root() {
+    if (allocation_profile_file[0] == '\0') {
+      return &leak_check_allocator;
+    }
+    return &profiling_allocator;
+  }
+
+  // Writes the allocation profile, if one was requested.
+  void write_allocation_profile() {
+    if (allocation_profile_file[0] != '\0') {
+      std::ofstream stream(allocation_profile_file);
+      profiling_allocator.WriteReport(stream);
+    }
+  }
+
+  containers::LeakCheckAllocator leak_check_allocator;
+  containers::ProfilingAllocator profiling_allocator;
+  const char* allocation_profile_file;
+};
+
+// Returns the logger for entry_data::log. An empty binary_log_file means
+// that messages are logged as text.
+containers::unique_ptr<logging::Logger> CreateLogger(
+    containers::Allocator* allocator, bool async_log,
+    const char* binary_log_file) {
+  return logging::GetLogger(
+      allocator, async_log,
+      binary_log_file[0] == '\0' ? nullptr : binary_log_file);
+}
+
 #if defined __linux__ || defined _WIN32
 struct CommandLineArgs {
   uint32_t window_width;
   uint32_t window_height;
   bool fixed_timestep;
   bool prefer_separate_present;
+  bool async_log;
   int32_t output_frame;
   const char* output_file;
+  const char* memory_stats_file;
+  const char* call_statistics_file;
+  const char* capture_file;
+  const char* allocation_profile_file;
+  const char* binary_log_file;
 };
 
 void parse_args(CommandLineArgs* args, int argc, const char** argv) {
@@ -47,8 +93,14 @@ void parse_args(CommandLineArgs* args, int argc, const char** argv) {
   args->window_height = DEFAULT_WINDOW_HEIGHT;
   args->fixed_timestep = FIXED_TIMESTEP;
   args->prefer_separate_present = PREFER_SEPARATE_PRESENT;
+  args->async_log = ASYNC_LOG;
   args->output_frame = OUTPUT_FRAME;
   args->output_file = OUTPUT_FILE;
+  args->memory_stats_file = MEMORY_STATS_FILE;
+  args->call_statistics_file = CALL_STATISTICS_FILE;
+  args->capture_file = CAPTURE_FILE;
+  args->allocation_profile_file = ALLOCATION_PROFILE_FILE;
+  args->binary_log_file = BINARY_LOG_FILE;
 
   for (int i = 0; i < argc; ++i) {
     if (strncmp(argv[i], "-w=", 3) == 0) {
@@ -63,12 +115,30 @@ void parse_args(CommandLineArgs* args, int argc, const char** argv) {
     if (strncmp(argv[i], "-separate-present", 17) == 0) {
       args->prefer_separate_present = true;
     }
+    if (strncmp(argv[i], "-async-log", 10) == 0) {
+      args->async_log = true;
+    }
+    if (strncmp(argv[i], "-binary-log=", 12) == 0) {
+      args->binary_log_file = argv[i] + 12;
+    }
     if (strncmp(argv[i], "-output-frame=", 14) == 0) {
       args->output_frame = atoi(argv[i] + 14);
     }
     if (strncmp(argv[i], "-output-file=", 13) == 0) {
       args->output_file = argv[i] + 13;
     }
+    if (strncmp(argv[i], "-memory-stats=", 14) == 0) {
+      args->memory_stats_file = argv[i] + 14;
+    }
+    if (strncmp(argv[i], "-call-statistics=", 17) == 0) {
+      args->call_statistics_file = argv[i] + 17;
+    }
+    if (strncmp(argv[i], "-capture=", 9) == 0) {
+      args->capture_file = argv[i] + 9;
+    }
+    if (strncmp(argv[i], "-allocation-profile=", 20) == 0) {
+      args->allocation_profile_file = argv[i] + 20;
+    }
   }
 }
 #endif
@@ -129,21 +199,25 @@ void android_main(android_app* app) {
     int32_t height = output_frame >= 0 ? DEFAULT_WINDOW_HEIGHT
                                        : ANativeWindow_getHeight(app->window);
 
-    containers::LeakCheckAllocator root_allocator;
+    RootAllocators allocators(ALLOCATION_PROFILE_FILE);
+    containers::Allocator* root_allocator = allocators.root();
     {
       entry::entry_data data{
           app->window,
           os_version_length != 0 ? os_version_c_str : "",
-          logging::GetLogger(&root_allocator),
-          &root_allocator,
+          CreateLogger(root_allocator, ASYNC_LOG, BINARY_LOG_FILE),
+          root_allocator,
           static_cast<uint32_t>(width),
           static_cast<uint32_t>(height),
-          {FIXED_TIMESTEP, PREFER_SEPARATE_PRESENT, output_file, output_frame}};
+          {FIXED_TIMESTEP, PREFER_SEPARATE_PRESENT, output_file, output_frame,
+           MEMORY_STATS_FILE, CALL_STATISTICS_FILE, CAPTURE_FILE}};
       int return_value = main_entry(&data);
       // Do not modify this line, scripts may look for it in the output.
       data.log->LogInfo("RETURN: ", return_value);
     }
-    assert(root_allocator.currently_allocated_bytes_.load() == 0);
+    allocators.write_allocation_profile();
+    assert(allocators.leak_check_allocator.currently_allocated_bytes_.load() ==
+           0);
   });
 
   app->userData = &data;
@@ -199,11 +273,22 @@ int main(int argc, const char** argv) {
   CommandLineArgs args;
   parse_args(&args, argc, argv);
 
-  containers::LeakCheckAllocator root_allocator;
-  xcb_connection_t* connection;
-  xcb_window_t window;
+  RootAllocators allocators(args.allocation_profile_file);
+  containers::Allocator* root_allocator = allocators.root();
+  xcb_connection_t* connection = nullptr;
+  xcb_window_t window = 0;
   if (args.output_frame == -1) {
     connection = xcb_connect(NULL, NULL);
+  }
+  if (connection && xcb_connection_has_error(connection)) {
+    // Without a display the application still runs, but only a driver that
+    // never looks at the window, such as mock_icd, can present from it.
+    std::cerr << "Could not connect to an X server, running without a window"
+              << std::endl;
+    xcb_disconnect(connection);
+    connection = nullptr;
+  }
+  if (connection) {
     const xcb_setup_t* setup = xcb_get_setup(connection);
     xcb_screen_iterator_t iter = xcb_setup_roots_iterator(setup);
     xcb_screen_t* screen = iter.data;
@@ -223,18 +308,25 @@ int main(int argc, const char** argv) {
   std::thread main_thread([&]() {
     entry::entry_data data{window,
                            connection,
-                           logging::GetLogger(&root_allocator),
-                           &root_allocator,
+                           CreateLogger(root_allocator, args.async_log,
+                                        args.binary_log_file),
+                           root_allocator,
                            args.window_width,
                            args.window_height,
                            {args.fixed_timestep, args.prefer_separate_present,
-                            args.output_file, args.output_frame}};
+                            args.output_file, args.output_frame,
+                            args.memory_stats_file,
+                            args.call_statistics_file, args.capture_file}};
     return_value = main_entry(&data);
   });
   main_thread.join();
   // TODO(awoloszyn): Handle other events here.
-  xcb_disconnect(connection);
-  assert(root_allocator.currently_allocated_bytes_.load() == 0);
+  if (connection) {
+    xcb_disconnect(connection);
+  }
+  allocators.write_allocation_profile();
+  assert(allocators.leak_check_allocator.currently_allocated_bytes_.load() ==
+         0);
   return return_value;
 }
 #elif defined _WIN32
@@ -251,7 +343,8 @@ int main(int argc, const char** argv) {
   CommandLineArgs args;
   parse_args(&args, argc, argv);
 
-  containers::LeakCheckAllocator root_allocator;
+  RootAllocators allocators(args.allocation_profile_file);
+  containers::Allocator* root_allocator = allocators.root();
   HINSTANCE instance = 0;
   HWND window_handle = 0;
   HANDLE out_handle = GetStdHandle(STD_OUTPUT_HANDLE);
@@ -327,12 +420,15 @@ int main(int argc, const char** argv) {
   std::thread main_thread([&]() {
     entry::entry_data data{instance,
                            window_handle,
-                           logging::GetLogger(&root_allocator),
-                           &root_allocator,
+                           CreateLogger(root_allocator, args.async_log,
+                                        args.binary_log_file),
+                           root_allocator,
                            args.window_width,
                            args.window_height,
                            {args.fixed_timestep, args.prefer_separate_present,
-                            args.output_file, args.output_frame}};
+                            args.output_file, args.output_frame,
+                            args.memory_stats_file,
+                            args.call_statistics_file, args.capture_file}};
     return_value = main_entry(&data);
   });
 
@@ -345,6 +441,7 @@ int main(int argc, const char** argv) {
   if (window_handle) {
     DestroyWindow(window_handle);
   }
+  allocators.write_allocation_profile();
   return return_value;
 }
 #else
@@ -51,11 +51,19 @@ static internal::dummy __attribute__((used)) test_dummy;
 
 // If output_frame is > -1, then the given image frame will be written
 // to output_file, otherwise the application will render to the screen.
+// If memory_stats_file is not empty, then memory statistics will be written
+// to it when the application exits. The same goes for call_statistics_file
+// and the counts of Vulkan calls, in builds that collect them. If
+// capture_file is not empty, every Vulkan call is captured to it, in builds
+// that can capture them.
 struct application_options {
   bool fixed_timestep;
   bool prefer_separate_present;
   const char* output_file;
   int32_t output_frame;
+  const char* memory_stats_file;
+  const char* call_statistics_file;
+  const char* capture_file;
 };
 
 struct entry_data {
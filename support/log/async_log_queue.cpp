@@ -0,0 +1,246 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "support/log/async_log_queue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+#include "support/containers/vector.h"
+#include "support/log/log.h"
+
+namespace logging {
+
+namespace {
+// Every record in a ring starts with its size, which has this value if the
+// rest of the ring is unused and the next record is at the start.
+const uint32_t kWrapMarker = 0xFFFFFFFF;
+// Records are padded to this, so that their sizes can be read directly.
+const size_t kRecordAlignment = 8;
+// How long the background thread waits when there is nothing to write.
+const auto kIdleWait = std::chrono::milliseconds(1);
+
+struct RecordHeader {
+  // The size of the record after the header.
+  uint32_t size;
+  MessageLevel level;
+  const CallSite* site;
+  uint64_t sequence;
+};
+
+size_t RecordSize(size_t payload_size) {
+  return (sizeof(RecordHeader) + payload_size + kRecordAlignment - 1) &
+         ~(kRecordAlignment - 1);
+}
+
+struct ThreadState {
+  uint64_t queue_id;
+  void* ring;
+};
+
+thread_local ThreadState thread_state;
+std::atomic<uint64_t> next_queue_id(1);
+}  // anonymous namespace
+
+// A single-producer, single-consumer ring of variable-sized records. The
+// head and tail are byte offsets that only ever increase.
+struct AsyncLogQueue::ThreadRing {
+  ThreadRing* next;
+  char* data;
+  size_t size;
+  std::atomic<size_t> head;
+  std::atomic<size_t> tail;
+  // The number of messages that did not fit, since the last drain.
+  std::atomic<uint64_t> dropped;
+};
+
+AsyncLogQueue::AsyncLogQueue(containers::Allocator* allocator, Writer* writer,
+                             size_t ring_size)
+    : allocator_(allocator),
+      writer_(writer),
+      ring_size_(kRecordAlignment),
+      id_(next_queue_id++),
+      next_sequence_(0),
+      rings_(nullptr),
+      exit_(false) {
+  while (ring_size_ < ring_size) {
+    ring_size_ *= 2;
+  }
+  thread_ = std::thread(&AsyncLogQueue::BackgroundThread, this);
+}
+
+AsyncLogQueue::~AsyncLogQueue() {
+  exit_.store(true);
+  thread_.join();
+  Drain();
+  ThreadRing* ring = rings_.load();
+  while (ring) {
+    ThreadRing* next = ring->next;
+    allocator_->free(ring->data, ring->size);
+    ring->~ThreadRing();
+    allocator_->free(ring, sizeof(ThreadRing));
+    ring = next;
+  }
+}
+
+void AsyncLogQueue::Flush() { Drain(); }
+
+void AsyncLogQueue::Push(MessageLevel level, const CallSite* site,
+                         const MessageEncoder& encoder) {
+  ThreadRing* ring = GetThreadRing();
+  const size_t record_size = RecordSize(encoder.size());
+  const size_t tail = ring->tail.load(std::memory_order_relaxed);
+  const size_t head = ring->head.load(std::memory_order_acquire);
+  size_t offset = tail & (ring->size - 1);
+  // Records are never split, so if this one does not fit before the end of
+  // the ring, the rest of the ring is skipped.
+  const size_t skipped = record_size > ring->size - offset
+                             ? ring->size - offset
+                             : 0;
+  if (skipped + record_size > ring->size - (tail - head)) {
+    ring->dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  if (skipped) {
+    memcpy(ring->data + offset, &kWrapMarker, sizeof(kWrapMarker));
+    offset = 0;
+  }
+  RecordHeader header;
+  header.size = static_cast<uint32_t>(encoder.size());
+  header.level = level;
+  header.site = site;
+  header.sequence = next_sequence_.fetch_add(1, std::memory_order_relaxed);
+  memcpy(ring->data + offset, &header, sizeof(header));
+  memcpy(ring->data + offset + sizeof(header), encoder.data(), encoder.size());
+  ring->tail.store(tail + skipped + record_size, std::memory_order_release);
+}
+
+AsyncLogQueue::ThreadRing* AsyncLogQueue::GetThreadRing() {
+  ThreadState& state = thread_state;
+  if (state.queue_id != id_) {
+    ThreadRing* ring = ::new (allocator_->malloc(sizeof(ThreadRing)))
+        ThreadRing();
+    ring->data = static_cast<char*>(allocator_->malloc(ring_size_));
+    ring->size = ring_size_;
+    ring->head.store(0);
+    ring->tail.store(0);
+    ring->dropped.store(0);
+    ring->next = rings_.load();
+    while (!rings_.compare_exchange_weak(ring->next, ring)) {
+    }
+    state.queue_id = id_;
+    state.ring = ring;
+  }
+  return static_cast<ThreadRing*>(state.ring);
+}
+
+bool AsyncLogQueue::Drain() {
+  // The background thread calls this every kIdleWait while idle, so check
+  // for work before taking the lock or allocating anything. head only
+  // changes under drain_mutex_, so a stale value just means that the rings
+  // are read below anyway.
+  bool pending = false;
+  for (ThreadRing* ring = rings_.load(); ring && !pending; ring = ring->next) {
+    pending = ring->head.load(std::memory_order_relaxed) !=
+                  ring->tail.load(std::memory_order_acquire) ||
+              ring->dropped.load(std::memory_order_relaxed) != 0;
+  }
+  if (!pending) {
+    return false;
+  }
+
+  // The records are written straight out of the rings, which are only
+  // released once every record has been written.
+  struct Message {
+    RecordHeader header;
+    const char* data;
+  };
+  struct Consumed {
+    ThreadRing* ring;
+    size_t head;
+    uint64_t dropped;
+  };
+  containers::vector<Message> messages(allocator_);
+  containers::vector<Consumed> consumed(allocator_);
+
+  std::lock_guard<std::mutex> lock(drain_mutex_);
+  for (ThreadRing* ring = rings_.load(); ring; ring = ring->next) {
+    size_t head = ring->head.load(std::memory_order_relaxed);
+    const size_t tail = ring->tail.load(std::memory_order_acquire);
+    while (head != tail) {
+      const size_t offset = head & (ring->size - 1);
+      Message message;
+      memcpy(&message.header.size, ring->data + offset,
+             sizeof(message.header.size));
+      if (message.header.size == kWrapMarker) {
+        head += ring->size - offset;
+        continue;
+      }
+      memcpy(&message.header, ring->data + offset, sizeof(message.header));
+      message.data = ring->data + offset + sizeof(message.header);
+      messages.push_back(message);
+      head += RecordSize(message.header.size);
+    }
+    consumed.push_back({ring, head, ring->dropped.exchange(0)});
+  }
+
+  std::sort(messages.begin(), messages.end(),
+            [](const Message& a, const Message& b) {
+              return a.header.sequence < b.header.sequence;
+            });
+  for (const auto& message : messages) {
+    writer_->Write(message.header.level, message.header.site, message.data,
+                   message.header.size);
+  }
+
+  bool wrote = !messages.empty();
+  for (const auto& ring : consumed) {
+    ring.ring->head.store(ring.head, std::memory_order_release);
+    if (ring.dropped) {
+      // This comes after everything that has been logged so far.
+      MessageEncoder encoder(allocator_);
+      encoder.EncodeAll(ring.dropped, " log messages were dropped");
+      writer_->Write(kErrorMessage, nullptr, encoder.data(), encoder.size());
+      wrote = true;
+    }
+  }
+  if (wrote) {
+    writer_->Flush();
+  }
+  return wrote;
+}
+
+void AsyncLogQueue::BackgroundThread() {
+  while (!exit_.load()) {
+    if (!Drain()) {
+      std::this_thread::sleep_for(kIdleWait);
+    }
+  }
+}
+
+void TextLogWriter::Write(MessageLevel level, const CallSite*,
+                          const char* data, size_t size) {
+  std::ostringstream stream;
+  MessageEncoder::Decode(&stream, data, size);
+  if (level == kErrorMessage) {
+    sink_->LogError(stream.str());
+  } else {
+    sink_->LogInfo(stream.str());
+  }
+}
+
+}  // namespace logging
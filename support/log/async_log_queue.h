@@ -0,0 +1,118 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_LOG_ASYNC_LOG_QUEUE_H_
+#define SUPPORT_LOG_ASYNC_LOG_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "support/containers/allocator.h"
+#include "support/log/message.h"
+
+namespace logging {
+class Logger;
+
+// AsyncLogQueue moves the formatting and writing of log messages off the
+// threads that log them. Each thread that logs captures its arguments into
+// a ring buffer of its own, without taking any locks, and a background
+// thread passes the messages on to a Writer.
+//
+// If a thread logs faster than the background thread can keep up, and its
+// ring buffer fills up, its messages are dropped until there is room, and
+// the number that were dropped is logged in their place.
+//
+// Messages from different threads are written in the order that they were
+// logged, as long as they reach the background thread at the same time.
+class AsyncLogQueue {
+ public:
+  // Receives every message from the queue, one at a time, on either the
+  // background thread or a thread that calls Flush.
+  class Writer {
+   public:
+    virtual ~Writer() {}
+    // site is nullptr if the message was not logged through one of the LOG_*
+    // macros. data holds the arguments, as encoded by MessageEncoder.
+    virtual void Write(MessageLevel level, const CallSite* site,
+                       const char* data, size_t size) = 0;
+    // Called after each batch of messages has been written.
+    virtual void Flush() {}
+  };
+
+  // Messages are passed to writer, which must outlive this queue. Each
+  // thread's ring buffer is ring_size bytes, rounded up to a power of two.
+  AsyncLogQueue(containers::Allocator* allocator, Writer* writer,
+                size_t ring_size = 64 * 1024);
+  // Writes every queued message before returning.
+  ~AsyncLogQueue();
+
+  AsyncLogQueue(const AsyncLogQueue&) = delete;
+  AsyncLogQueue& operator=(const AsyncLogQueue&) = delete;
+
+  template <typename... Args>
+  void Push(MessageLevel level, const CallSite* site, const Args&... args) {
+    MessageEncoder encoder(allocator_);
+    encoder.EncodeAll(args...);
+    Push(level, site, encoder);
+  }
+  void Push(MessageLevel level, const CallSite* site,
+            const MessageEncoder& encoder);
+
+  // Writes every message that has been queued so far, on the calling
+  // thread. This is safe to call from any thread, and is called before the
+  // program is deliberately crashed, so that the reason is not lost.
+  void Flush();
+
+ private:
+  struct ThreadRing;
+
+  // Returns the ring buffer of the calling thread, creating it if needed.
+  ThreadRing* GetThreadRing();
+  // Writes every queued message. Returns false if there were none.
+  bool Drain();
+  void BackgroundThread();
+
+  containers::Allocator* allocator_;
+  Writer* writer_;
+  size_t ring_size_;
+  // Identifies this queue to the thread-local state, which outlives it.
+  uint64_t id_;
+  // Orders the messages from different threads.
+  std::atomic<uint64_t> next_sequence_;
+  std::atomic<ThreadRing*> rings_;
+  // Only one thread may read from the rings at a time.
+  std::mutex drain_mutex_;
+  std::atomic<bool> exit_;
+  std::thread thread_;
+};
+
+// Formats messages as text, and writes them to a Logger.
+class TextLogWriter : public AsyncLogQueue::Writer {
+ public:
+  // sink must outlive this writer.
+  explicit TextLogWriter(Logger* sink) : sink_(sink) {}
+
+  void Write(MessageLevel level, const CallSite* site, const char* data,
+             size_t size) override;
+
+ private:
+  Logger* sink_;
+};
+
+}  // namespace logging
+
+#endif  // SUPPORT_LOG_ASYNC_LOG_QUEUE_H_
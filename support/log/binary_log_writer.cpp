@@ -0,0 +1,79 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "support/log/binary_log_writer.h"
+
+#include <cstring>
+
+namespace logging {
+
+namespace {
+const char kMagic[8] = {'V', 'T', 'A', 'B', 'L', 'O', 'G', '\0'};
+const uint32_t kByteOrderMark = 0x01020304;
+}  // anonymous namespace
+
+const uint32_t BinaryLogWriter::kVersion;
+
+BinaryLogWriter::BinaryLogWriter(containers::Allocator* allocator,
+                                 const char* path, Logger* error_log)
+    : file_(path, std::ios::out | std::ios::binary | std::ios::trunc),
+      error_writer_(error_log),
+      call_site_ids_(allocator) {
+  if (!file_.is_open()) {
+    return;
+  }
+  file_.write(kMagic, sizeof(kMagic));
+  WriteValue(kVersion);
+  WriteValue(kByteOrderMark);
+}
+
+void BinaryLogWriter::Write(MessageLevel level, const CallSite* site,
+                            const char* data, size_t size) {
+  if (level == kErrorMessage) {
+    error_writer_.Write(level, site, data, size);
+  }
+  const uint32_t site_id = GetCallSiteId(site);
+  WriteValue(kMessageRecord);
+  WriteValue(level);
+  WriteValue(site_id);
+  WriteValue(static_cast<uint32_t>(size));
+  file_.write(data, size);
+}
+
+void BinaryLogWriter::Flush() { file_.flush(); }
+
+void BinaryLogWriter::WriteString(const char* value) {
+  const uint32_t length = static_cast<uint32_t>(strlen(value));
+  WriteValue(length);
+  file_.write(value, length);
+}
+
+uint32_t BinaryLogWriter::GetCallSiteId(const CallSite* site) {
+  if (!site) {
+    return 0;
+  }
+  const uint32_t next_id = static_cast<uint32_t>(call_site_ids_.size()) + 1;
+  auto inserted = call_site_ids_.emplace(site, next_id);
+  if (inserted.second) {
+    WriteValue(kCallSiteRecord);
+    WriteValue(next_id);
+    WriteValue(static_cast<int32_t>(site->line));
+    WriteString(site->file);
+    WriteString(site->text);
+  }
+  return inserted.first->second;
+}
+
+}  // namespace logging
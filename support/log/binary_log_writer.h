@@ -0,0 +1,75 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_LOG_BINARY_LOG_WRITER_H_
+#define SUPPORT_LOG_BINARY_LOG_WRITER_H_
+
+#include <cstdint>
+#include <fstream>
+
+#include "support/containers/allocator.h"
+#include "support/containers/flat_hash_map.h"
+#include "support/log/async_log_queue.h"
+
+namespace logging {
+
+// BinaryLogWriter writes messages to a file without formatting them, so
+// that logging costs little more than copying the arguments. The file is
+// turned back into text by tools/decode_binary_log.py.
+//
+// The file starts with the 8 bytes "VTABLOG\0", a uint32_t version and the
+// uint32_t 0x01020304, which tells the decoder the byte order of every
+// number that follows. Then there is a sequence of records, each starting
+// with a uint8_t RecordType:
+//   kCallSiteRecord: uint32_t id, int32_t line, then the file and the text
+//     of the CallSite, each as a uint32_t length followed by its bytes.
+//     This comes before the first message from that site.
+//   kMessageRecord: uint8_t MessageLevel, uint32_t call site id, or 0 if
+//     there is none, then the arguments as a uint32_t size followed by the
+//     bytes from MessageEncoder.
+class BinaryLogWriter : public AsyncLogQueue::Writer {
+ public:
+  static const uint32_t kVersion = 1;
+  enum RecordType : uint8_t { kCallSiteRecord = 1, kMessageRecord = 2 };
+
+  // Replaces the file at path. Errors are also written as text to
+  // error_log, which must outlive this writer.
+  BinaryLogWriter(containers::Allocator* allocator, const char* path,
+                  Logger* error_log);
+
+  // Returns false if the file could not be opened.
+  bool is_open() const { return file_.is_open(); }
+
+  void Write(MessageLevel level, const CallSite* site, const char* data,
+             size_t size) override;
+  void Flush() override;
+
+ private:
+  template <typename T>
+  void WriteValue(const T& value) {
+    file_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  void WriteString(const char* value);
+  // Returns the id of site in this file, writing its record if it is new.
+  uint32_t GetCallSiteId(const CallSite* site);
+
+  std::ofstream file_;
+  TextLogWriter error_writer_;
+  containers::flat_hash_map<const CallSite*, uint32_t> call_site_ids_;
+};
+
+}  // namespace logging
+
+#endif  // SUPPORT_LOG_BINARY_LOG_WRITER_H_
@@ -15,6 +15,8 @@
 
 #include "support/log/log.h"
 
+#include "support/log/binary_log_writer.h"
+
 namespace logging {
 #if defined __ANDROID__
 #include <android/log.h>
@@ -66,7 +68,53 @@ class InternalLogger : public Logger {
 };
 #endif
 
-containers::unique_ptr<Logger> GetLogger(containers::Allocator* allocator) {
+// Passes messages through an AsyncLogQueue to an InternalLogger, or to a
+// binary log file.
+class AsyncLogger : public Logger {
+ public:
+  AsyncLogger(containers::Allocator* allocator, const char* binary_log_file)
+      : text_writer_(&sink_),
+        binary_writer_(
+            binary_log_file
+                ? containers::make_unique<BinaryLogWriter>(
+                      allocator, allocator, binary_log_file, &sink_)
+                : containers::unique_ptr<BinaryLogWriter>()),
+        queue_(allocator, GetWriter(binary_log_file)) {
+    async_queue_ = &queue_;
+  }
+
+  // These are only used if messages are logged to this directly, which the
+  // queue never does.
+  void LogErrorString(const char* str) override { sink_.LogErrorString(str); }
+  void LogInfoString(const char* str) override { sink_.LogInfoString(str); }
+
+ private:
+  AsyncLogQueue::Writer* GetWriter(const char* binary_log_file) {
+    if (!binary_writer_) {
+      return &text_writer_;
+    }
+    if (!binary_writer_->is_open()) {
+      sink_.LogError("Could not open ", binary_log_file,
+                     ", logging as text instead");
+      return &text_writer_;
+    }
+    return binary_writer_.get();
+  }
+
+  // The queue is destroyed first, and writes its last messages to the sink.
+  InternalLogger sink_;
+  TextLogWriter text_writer_;
+  containers::unique_ptr<BinaryLogWriter> binary_writer_;
+  AsyncLogQueue queue_;
+};
+
+containers::unique_ptr<Logger> GetLogger(containers::Allocator* allocator,
+                                         bool asynchronous,
+                                         const char* binary_log_file) {
+  if (asynchronous || binary_log_file) {
+    return containers::make_unique<AsyncLogger>(allocator, allocator,
+                                                binary_log_file);
+  }
   return containers::make_unique<InternalLogger>(allocator);
 }
 }
\ No newline at end of file
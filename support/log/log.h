@@ -21,40 +21,66 @@
 #include <string>
 
 #include "support/containers/unique_ptr.h"
+#include "support/log/async_log_queue.h"
 
 namespace logging {
 
+// Declares the static CallSite of a message, which describes it in
+// structured logs.
+#define LOG_CALL_SITE(name, text) \
+  static const logging::CallSite name = {__FILE__, __LINE__, text}
+
+// Logs a set of values to the info stream of the given log, in the same way
+// as LogInfo. In structured logs, the message records where it came from.
+#define LOG_INFO(log, ...)                         \
+  do {                                             \
+    LOG_CALL_SITE(log_call_site, #__VA_ARGS__);    \
+    (log)->LogInfoAt(&log_call_site, __VA_ARGS__); \
+  } while (0);
+
+// The same as LOG_INFO, but for the error stream.
+#define LOG_ERROR(log, ...)                         \
+  do {                                              \
+    LOG_CALL_SITE(log_call_site, #__VA_ARGS__);     \
+    (log)->LogErrorAt(&log_call_site, __VA_ARGS__); \
+  } while (0);
+
 // Tests the result of "res op exp" and if the result is not "true"
 // then logs an error to LogError of the given log.
-#define LOG_EXPECT(op, log, res, exp)                                          \
-  do {                                                                         \
-    auto x = exp;                                                              \
-    auto r = res;                                                              \
-    if (!(r op x)) {                                                           \
-      (log)->LogError(__FILE__, ":", __LINE__,                                 \
-                      "\n  Expected " #res " " #op " " #exp "\n  but got ", r, \
-                      " " #op " ", x);                                         \
-    }                                                                          \
+#define LOG_EXPECT(op, log, res, exp)                            \
+  do {                                                           \
+    auto x = exp;                                                \
+    auto r = res;                                                \
+    if (!(r op x)) {                                             \
+      LOG_CALL_SITE(log_call_site, #res " " #op " " #exp);       \
+      (log)->LogErrorAt(&log_call_site, __FILE__, ":", __LINE__, \
+                        "\n  Expected " #res " " #op " " #exp    \
+                        "\n  but got ", r, " " #op " ", x);      \
+    }                                                            \
   } while (0);
 
 // The same as LOG_EXPECT but triggers a crash if it did not succeed.
-#define LOG_ASSERT(op, log, res, exp)                                          \
-  do {                                                                         \
-    auto x = exp;                                                              \
-    auto r = res;                                                              \
-    if (!(r op x)) {                                                           \
-      (log)->LogError(__FILE__, ":", __LINE__,                                 \
-                      "\n  Expected " #res " " #op " " #exp "\n  but got ", r, \
-                      " " #op " ", x);                                         \
-      *reinterpret_cast<volatile int*>(size_t(0)) = 4;                         \
-    }                                                                          \
+#define LOG_ASSERT(op, log, res, exp)                            \
+  do {                                                           \
+    auto x = exp;                                                \
+    auto r = res;                                                \
+    if (!(r op x)) {                                             \
+      LOG_CALL_SITE(log_call_site, #res " " #op " " #exp);       \
+      (log)->LogErrorAt(&log_call_site, __FILE__, ":", __LINE__, \
+                        "\n  Expected " #res " " #op " " #exp    \
+                        "\n  but got ", r, " " #op " ", x);      \
+      (log)->Flush();                                            \
+      *reinterpret_cast<volatile int*>(size_t(0)) = 4;           \
+    }                                                            \
   } while (0);
 
 // Logs a message and then forces the program to crash.
-#define LOG_CRASH(log, message)                        \
-  do {                                                 \
-    (log)->LogError(__FILE__, ":", __LINE__, message); \
-    *reinterpret_cast<volatile int*>(intptr_t(0)) = 4; \
+#define LOG_CRASH(log, message)                                          \
+  do {                                                                   \
+    LOG_CALL_SITE(log_call_site, #message);                              \
+    (log)->LogErrorAt(&log_call_site, __FILE__, ":", __LINE__, message); \
+    (log)->Flush();                                                      \
+    *reinterpret_cast<volatile int*>(intptr_t(0)) = 4;                   \
   } while (0);
 
 // Logging class base. It provides the functionality to
@@ -70,6 +96,17 @@ class Logger {
   // Logs a set of values to the error stream of the logger.
   template <typename... Args>
   void LogError(Args... args) {
+    LogErrorAt(nullptr, args...);
+  }
+
+  // The same as LogError, but structured logs also record that the message
+  // came from site, which may be nullptr.
+  template <typename... Args>
+  void LogErrorAt(const CallSite* site, Args... args) {
+    if (async_queue_) {
+      async_queue_->Push(kErrorMessage, site, args...);
+      return;
+    }
     std::ostringstream str;
     LogHelper(&str, args...);
     str << "\n";
@@ -79,12 +116,38 @@ class Logger {
   // Logs a set of values to the info stream of the logger.
   template <typename... Args>
   void LogInfo(Args... args) {
+    LogInfoAt(nullptr, args...);
+  }
+
+  // The same as LogInfo, but structured logs also record that the message
+  // came from site, which may be nullptr.
+  template <typename... Args>
+  void LogInfoAt(const CallSite* site, Args... args) {
+    if (async_queue_) {
+      async_queue_->Push(kInfoMessage, site, args...);
+      return;
+    }
     std::ostringstream str;
     LogHelper(&str, args...);
     str << "\n";
     LogInfoString(str.str().c_str());
   }
 
+  // Writes any messages that have been queued but not yet written. This is
+  // called before the program is deliberately crashed.
+  void Flush() {
+    if (async_queue_) {
+      async_queue_->Flush();
+    }
+  }
+
+ protected:
+  Logger() : async_queue_(nullptr) {}
+
+  // If this is set, messages are passed to it to be formatted and written
+  // on another thread, instead of being formatted here.
+  AsyncLogQueue* async_queue_;
+
  private:
   // Helper function, the recursive base of LogHelper.
   template <typename T>
@@ -110,8 +173,16 @@ class Logger {
   virtual void LogInfoString(const char* str) = 0;
 };
 
-// Returns a platform-specific logger.
-containers::unique_ptr<Logger> GetLogger(containers::Allocator* allocator);
+// Returns a platform-specific logger. If asynchronous is true, messages are
+// formatted and written on a background thread.
+//
+// If binary_log_file is not nullptr, messages are instead written to that
+// file, unformatted, in the format that tools/decode_binary_log.py reads.
+// Errors are also written as text to the platform's log. This implies
+// asynchronous.
+containers::unique_ptr<Logger> GetLogger(containers::Allocator* allocator,
+                                         bool asynchronous = false,
+                                         const char* binary_log_file = nullptr);
 }
 
 #endif  // SUPPORT_LOG_LOG_H_
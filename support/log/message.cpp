@@ -0,0 +1,67 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "support/log/message.h"
+
+namespace logging {
+
+namespace {
+template <typename T>
+T Read(const char** data) {
+  T value;
+  memcpy(&value, *data, sizeof(T));
+  *data += sizeof(T);
+  return value;
+}
+}  // anonymous namespace
+
+void MessageEncoder::Decode(std::ostream* stream, const char* data,
+                            size_t size) {
+  const char* end = data + size;
+  while (data < end) {
+    switch (static_cast<ArgumentType>(Read<uint8_t>(&data))) {
+      case kBoolArgument:
+        *stream << (Read<uint8_t>(&data) != 0);
+        break;
+      case kCharArgument:
+        *stream << Read<char>(&data);
+        break;
+      case kSignedArgument:
+        *stream << Read<int64_t>(&data);
+        break;
+      case kUnsignedArgument:
+        *stream << Read<uint64_t>(&data);
+        break;
+      case kFloatArgument:
+        *stream << Read<double>(&data);
+        break;
+      case kPointerArgument:
+        *stream << reinterpret_cast<void*>(
+            static_cast<uintptr_t>(Read<uint64_t>(&data)));
+        break;
+      case kStringArgument: {
+        const uint32_t length = Read<uint32_t>(&data);
+        stream->write(data, length);
+        data += length;
+        break;
+      }
+      default:
+        // Nothing after an unknown argument can be read.
+        return;
+    }
+  }
+}
+
+}  // namespace logging
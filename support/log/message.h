@@ -0,0 +1,187 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SUPPORT_LOG_MESSAGE_H_
+#define SUPPORT_LOG_MESSAGE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include "support/containers/allocator.h"
+#include "support/containers/small_vector.h"
+
+namespace logging {
+
+enum MessageLevel : uint8_t { kInfoMessage, kErrorMessage };
+
+// Describes the place in the source that a message is logged from. The
+// LOG_* macros declare one of these statically for every call site, so that
+// structured logs only have to record it once.
+struct CallSite {
+  const char* file;
+  int line;
+  // The source text of the arguments, or of the expectation that failed.
+  const char* text;
+};
+
+// The type of each argument in an encoded message. This is also the format
+// of the arguments in binary logs, so the values must not change.
+enum ArgumentType : uint8_t {
+  // 1 byte, 0 or 1.
+  kBoolArgument = 0,
+  // 1 byte.
+  kCharArgument = 1,
+  // 8 bytes.
+  kSignedArgument = 2,
+  kUnsignedArgument = 3,
+  kFloatArgument = 4,
+  kPointerArgument = 5,
+  // A 4 byte length, followed by that many bytes.
+  kStringArgument = 6,
+};
+
+// MessageEncoder captures the arguments of a log message as raw bytes, so
+// that they can be formatted later, on another thread or by another
+// program. Each argument is stored as an ArgumentType, followed by its
+// value in native byte order.
+//
+// Numbers are widened to 8 bytes, and strings are copied. Types that are
+// none of these are formatted immediately, and stored as strings.
+class MessageEncoder {
+ public:
+  explicit MessageEncoder(containers::Allocator* allocator)
+      : data_(allocator) {}
+
+  void EncodeAll() {}
+  template <typename T, typename... Args>
+  void EncodeAll(const T& value, const Args&... args) {
+    Encode(value);
+    EncodeAll(args...);
+  }
+
+  template <typename T>
+  void Encode(const T& value) {
+    Encode(value, std::integral_constant<int, CategoryOf<T>::value>());
+  }
+
+  void Encode(bool value) {
+    const uint8_t byte = value ? 1 : 0;
+    Append(kBoolArgument, &byte, sizeof(byte));
+  }
+  void Encode(char value) { Append(kCharArgument, &value, sizeof(value)); }
+  void Encode(signed char value) { Encode(static_cast<char>(value)); }
+  void Encode(unsigned char value) { Encode(static_cast<char>(value)); }
+
+  void Encode(const char* value) {
+    if (!value) {
+      value = "(null)";
+    }
+    AppendString(value, strlen(value));
+  }
+  void Encode(char* value) { Encode(static_cast<const char*>(value)); }
+  void Encode(const std::string& value) {
+    AppendString(value.data(), value.size());
+  }
+
+  const char* data() const { return data_.data(); }
+  size_t size() const { return data_.size(); }
+
+  // Formats the arguments that were encoded as size bytes at data.
+  static void Decode(std::ostream* stream, const char* data, size_t size);
+
+ private:
+  enum {
+    kOtherCategory,
+    kSignedCategory,
+    kUnsignedCategory,
+    kFloatCategory,
+    kEnumCategory,
+    kPointerCategory,
+  };
+
+  // Pointers to signed and unsigned chars are formatted as strings, so they
+  // are not treated as pointers.
+  template <typename T>
+  struct CategoryOf {
+    typedef typename std::remove_cv<typename std::remove_pointer<T>::type>::type
+        pointee;
+    static const int value =
+        std::is_enum<T>::value
+            ? kEnumCategory
+            : std::is_floating_point<T>::value
+                  ? kFloatCategory
+                  : std::is_integral<T>::value
+                        ? (std::is_signed<T>::value ? kSignedCategory
+                                                    : kUnsignedCategory)
+                        : (std::is_pointer<T>::value &&
+                           !std::is_same<pointee, signed char>::value &&
+                           !std::is_same<pointee, unsigned char>::value)
+                              ? kPointerCategory
+                              : kOtherCategory;
+  };
+
+  template <typename T>
+  void Encode(const T& value, std::integral_constant<int, kSignedCategory>) {
+    const int64_t wide = value;
+    Append(kSignedArgument, &wide, sizeof(wide));
+  }
+  template <typename T>
+  void Encode(const T& value, std::integral_constant<int, kUnsignedCategory>) {
+    const uint64_t wide = value;
+    Append(kUnsignedArgument, &wide, sizeof(wide));
+  }
+  template <typename T>
+  void Encode(const T& value, std::integral_constant<int, kFloatCategory>) {
+    const double wide = static_cast<double>(value);
+    Append(kFloatArgument, &wide, sizeof(wide));
+  }
+  template <typename T>
+  void Encode(const T& value, std::integral_constant<int, kEnumCategory>) {
+    Encode(static_cast<typename std::underlying_type<T>::type>(value));
+  }
+  template <typename T>
+  void Encode(const T& value, std::integral_constant<int, kPointerCategory>) {
+    const uint64_t address = reinterpret_cast<uintptr_t>(value);
+    Append(kPointerArgument, &address, sizeof(address));
+  }
+  template <typename T>
+  void Encode(const T& value, std::integral_constant<int, kOtherCategory>) {
+    std::ostringstream stream;
+    stream << value;
+    Encode(stream.str());
+  }
+
+  void Append(ArgumentType type, const void* value, size_t size) {
+    const char* bytes = static_cast<const char*>(value);
+    data_.push_back(static_cast<char>(type));
+    data_.insert(data_.end(), bytes, bytes + size);
+  }
+
+  void AppendString(const char* value, size_t size) {
+    const uint32_t length = static_cast<uint32_t>(size);
+    Append(kStringArgument, &length, sizeof(length));
+    data_.insert(data_.end(), value, value + size);
+  }
+
+  containers::small_vector<char, 512> data_;
+};
+
+}  // namespace logging
+
+#endif  // SUPPORT_LOG_MESSAGE_H_
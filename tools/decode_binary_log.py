@@ -0,0 +1,176 @@
+#!/usr/bin/python
+# Copyright 2017 Google Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+'''This decodes a binary log written by an application in this repository.
+
+Applications write binary logs when they are run with -binary-log=file. The
+format is described in support/log/binary_log_writer.h. By default the
+messages are written as the text that the application would have logged
+itself. With --json they are written as a list of objects that also hold the
+call site and the individual arguments of each message.
+'''
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b'VTABLOG\0'
+VERSION = 1
+BYTE_ORDER_MARK = 0x01020304
+
+CALL_SITE_RECORD = 1
+MESSAGE_RECORD = 2
+
+ERROR_LEVEL = 1
+
+BOOL_ARGUMENT = 0
+CHAR_ARGUMENT = 1
+SIGNED_ARGUMENT = 2
+UNSIGNED_ARGUMENT = 3
+FLOAT_ARGUMENT = 4
+POINTER_ARGUMENT = 5
+STRING_ARGUMENT = 6
+
+
+class Reader(object):
+    """Reads numbers and strings from a buffer in a given byte order."""
+
+    def __init__(self, data, byte_order):
+        self.data = data
+        self.offset = 0
+        self.byte_order = byte_order
+
+    def done(self):
+        return self.offset >= len(self.data)
+
+    def read(self, format):
+        format = self.byte_order + format
+        value = struct.unpack_from(format, self.data, self.offset)[0]
+        self.offset += struct.calcsize(format)
+        return value
+
+    def read_bytes(self, length):
+        value = self.data[self.offset:self.offset + length]
+        if len(value) != length:
+            raise ValueError('The log ends in the middle of a record')
+        self.offset += length
+        return value
+
+    def read_string(self):
+        return self.read_bytes(self.read('I')).decode('utf-8', 'replace')
+
+
+def decode_arguments(data, byte_order):
+    """Returns the arguments that MessageEncoder encoded as data."""
+    reader = Reader(data, byte_order)
+    arguments = []
+    while not reader.done():
+        argument_type = reader.read('B')
+        if argument_type == BOOL_ARGUMENT:
+            arguments.append(reader.read('B') != 0)
+        elif argument_type == CHAR_ARGUMENT:
+            arguments.append(reader.read_bytes(1).decode('latin-1'))
+        elif argument_type == SIGNED_ARGUMENT:
+            arguments.append(reader.read('q'))
+        elif argument_type == UNSIGNED_ARGUMENT:
+            arguments.append(reader.read('Q'))
+        elif argument_type == FLOAT_ARGUMENT:
+            arguments.append(reader.read('d'))
+        elif argument_type == POINTER_ARGUMENT:
+            arguments.append({'pointer': reader.read('Q')})
+        elif argument_type == STRING_ARGUMENT:
+            arguments.append(reader.read_string())
+        else:
+            raise ValueError('Unknown argument type %d' % argument_type)
+    return arguments
+
+
+def format_argument(argument):
+    """Formats an argument the same way that a std::ostream would."""
+    if isinstance(argument, bool):
+        return '1' if argument else '0'
+    if isinstance(argument, float):
+        return '%g' % argument
+    if isinstance(argument, dict):
+        return '0x%x' % argument['pointer'] if argument['pointer'] else '0'
+    return '%s' % argument
+
+
+def read_messages(data):
+    """Returns every message in a binary log, as a dictionary."""
+    if data[:len(MAGIC)] != MAGIC:
+        raise ValueError('This is not a binary log')
+    # The version is followed by the byte order mark.
+    mark = data[len(MAGIC) + 4:len(MAGIC) + 8]
+    byte_order = '<' if mark == struct.pack('<I', BYTE_ORDER_MARK) else '>'
+    reader = Reader(data, byte_order)
+    reader.read_bytes(len(MAGIC))
+    version = reader.read('I')
+    if version != VERSION:
+        raise ValueError('Unsupported binary log version %d' % version)
+    reader.read('I')
+
+    call_sites = {}
+    messages = []
+    while not reader.done():
+        record_type = reader.read('B')
+        if record_type == CALL_SITE_RECORD:
+            site_id = reader.read('I')
+            line = reader.read('i')
+            call_sites[site_id] = {
+                'file': reader.read_string(),
+                'line': line,
+                'text': reader.read_string(),
+            }
+        elif record_type == MESSAGE_RECORD:
+            level = reader.read('B')
+            site_id = reader.read('I')
+            arguments = decode_arguments(
+                reader.read_bytes(reader.read('I')), byte_order)
+            message = {
+                'level': 'error' if level == ERROR_LEVEL else 'info',
+                'arguments': arguments,
+                'text': ''.join(format_argument(a) for a in arguments),
+            }
+            if site_id:
+                message['call_site'] = call_sites[site_id]
+            messages.append(message)
+        else:
+            raise ValueError('Unknown record type %d' % record_type)
+    return messages
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decode a binary log file to text or JSON')
+    parser.add_argument('log', help='binary log to decode')
+    parser.add_argument(
+        '--json', action='store_true', help='write the messages as JSON')
+    args = parser.parse_args()
+
+    with open(args.log, 'rb') as log:
+        messages = read_messages(log.read())
+    if args.json:
+        json.dump(messages, sys.stdout, indent=2)
+        sys.stdout.write('\n')
+        return
+    for message in messages:
+        if message['level'] == 'error':
+            sys.stdout.write('error: ')
+        sys.stdout.write(message['text'] + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,704 @@
+#!/usr/bin/env python
+# Copyright 2017 Google Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+'''This generates vulkan_wrapper/capture_tables.cpp from vulkan.h.
+
+The tables describe, for vulkan::Capture and vulkan::Replayer, everything
+about the parameters of each Vulkan command and the members of each struct
+that cannot be copied as plain bytes: handles, pointers and their lengths,
+strings and pNext chains. See vulkan_wrapper/capture_tables.h.
+
+vulkan.h does not say how long the array behind a pointer is, so that is
+worked out from the names of the other members: pFoos is counted by
+fooCount, and pData is dataSize bytes long. The exceptions are listed in
+COUNTS below. Commands that cannot be described are marked unsupported.
+
+Run this again whenever third_party/vulkan/vulkan.h is updated.
+'''
+
+import argparse
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+HEADER = '''/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// This file is generated by tools/generate_capture_tables.py from
+// third_party/vulkan/vulkan.h. Do not edit it by hand.
+
+#include "vulkan_wrapper/capture_tables.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace vulkan {
+namespace capture {
+namespace {
+'''
+
+FOOTER = '''
+}  // namespace capture
+}  // namespace vulkan
+'''
+
+# These are resolved by LibraryWrapper and VkDevice themselves, and are
+# never called through a LazyFunction.
+EXCLUDED = set([
+    'vkGetInstanceProcAddr',
+    'vkGetDeviceProcAddr',
+])
+
+# The number of elements behind the pointers that cannot be counted from
+# their names. In structs, s is the struct. In commands, each parameter is
+# a local variable with its own name. A tuple of descriptor types and a
+# count means that the pointer is only read for those descriptor types.
+DESCRIPTOR_IMAGE_TYPES = (
+    'VK_DESCRIPTOR_TYPE_SAMPLER',
+    'VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER',
+    'VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE',
+    'VK_DESCRIPTOR_TYPE_STORAGE_IMAGE',
+    'VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT',
+)
+DESCRIPTOR_BUFFER_TYPES = (
+    'VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER',
+    'VK_DESCRIPTOR_TYPE_STORAGE_BUFFER',
+    'VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC',
+    'VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC',
+)
+DESCRIPTOR_TEXEL_BUFFER_TYPES = (
+    'VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER',
+    'VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER',
+)
+DESCRIPTOR_SAMPLER_TYPES = (
+    'VK_DESCRIPTOR_TYPE_SAMPLER',
+    'VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER',
+)
+
+COUNTS = {
+    ('VkWriteDescriptorSet', 'pImageInfo'):
+        (DESCRIPTOR_IMAGE_TYPES, 's->descriptorCount'),
+    ('VkWriteDescriptorSet', 'pBufferInfo'):
+        (DESCRIPTOR_BUFFER_TYPES, 's->descriptorCount'),
+    ('VkWriteDescriptorSet', 'pTexelBufferView'):
+        (DESCRIPTOR_TEXEL_BUFFER_TYPES, 's->descriptorCount'),
+    ('VkDescriptorSetLayoutBinding', 'pImmutableSamplers'):
+        (DESCRIPTOR_SAMPLER_TYPES, 's->descriptorCount'),
+    ('VkPipelineMultisampleStateCreateInfo', 'pSampleMask'):
+        '(s->rasterizationSamples + 31) / 32',
+    ('VkSubpassDescription', 'pResolveAttachments'): 's->colorAttachmentCount',
+    ('VkDeviceQueueCreateInfo', 'pQueuePriorities'): 's->queueCount',
+    ('VkSubmitInfo', 'pWaitDstStageMask'): 's->waitSemaphoreCount',
+    ('VkDescriptorSetAllocateInfo', 'pSetLayouts'): 's->descriptorSetCount',
+    ('VkPresentInfoKHR', 'pImageIndices'): 's->swapchainCount',
+    ('VkPresentInfoKHR', 'pResults'): 's->swapchainCount',
+    ('VkPresentRegionsKHR', 'pRegions'): 's->swapchainCount',
+    ('VkPresentTimesInfoGOOGLE', 'pTimes'): 's->swapchainCount',
+    ('VkDeviceGroupPresentInfoKHX', 'pDeviceMasks'): 's->swapchainCount',
+    ('VkDeviceGroupSubmitInfoKHX', 'pWaitSemaphoreDeviceIndices'):
+        's->waitSemaphoreCount',
+    ('VkDeviceGroupSubmitInfoKHX', 'pCommandBufferDeviceMasks'):
+        's->commandBufferCount',
+    ('VkDeviceGroupSubmitInfoKHX', 'pSignalSemaphoreDeviceIndices'):
+        's->signalSemaphoreCount',
+    ('VkRenderPassMultiviewCreateInfoKHX', 'pViewMasks'): 's->subpassCount',
+    ('VkRenderPassMultiviewCreateInfoKHX', 'pViewOffsets'):
+        's->dependencyCount',
+    ('VkBindImageMemoryInfoKHX', 'pSFRRects'): 's->SFRRectCount',
+    ('VkPipelineViewportWScalingStateCreateInfoNV', 'pViewportWScalings'):
+        's->viewportCount',
+    ('VkPipelineViewportSwizzleStateCreateInfoNV', 'pViewportSwizzles'):
+        's->viewportCount',
+    ('VkObjectTableCreateInfoNVX', 'pObjectEntryTypes'): 's->objectCount',
+    ('VkObjectTableCreateInfoNVX', 'pObjectEntryCounts'): 's->objectCount',
+    ('VkObjectTableCreateInfoNVX', 'pObjectEntryUsageFlags'):
+        's->objectCount',
+    ('vkCmdPushConstants', 'pValues'): 'size',
+    ('vkCmdBindVertexBuffers', 'pBuffers'): 'bindingCount',
+    ('vkCmdBindVertexBuffers', 'pOffsets'): 'bindingCount',
+    ('vkCmdSetViewportWScalingNV', 'pViewportWScalings'): 'viewportCount',
+    ('vkCreateGraphicsPipelines', 'pPipelines'): 'createInfoCount',
+    ('vkCreateComputePipelines', 'pPipelines'): 'createInfoCount',
+    ('vkCreateSharedSwapchainsKHR', 'pCreateInfos'): 'swapchainCount',
+    ('vkAllocateCommandBuffers', 'pCommandBuffers'):
+        'pAllocateInfo->commandBufferCount',
+    ('vkAllocateDescriptorSets', 'pDescriptorSets'):
+        'pAllocateInfo->descriptorSetCount',
+    ('vkEnumeratePhysicalDeviceGroupsKHX', 'pPhysicalDeviceGroupProperties'):
+        '*pPhysicalDeviceGroupCount',
+    ('vkUnregisterObjectsNVX', 'pObjectEntryTypes'): 'objectCount',
+    ('vkUnregisterObjectsNVX', 'pObjectIndices'): 'objectCount',
+}
+for keyed_mutex in ('VkWin32KeyedMutexAcquireReleaseInfoNV',
+                    'VkWin32KeyedMutexAcquireReleaseInfoKHR',
+                    'VkWin32KeyedMutexAcquireReleaseInfoKHX'):
+    for name in ('pAcquireSyncs', 'pAcquireKeys', 'pAcquireTimeouts',
+                 'pAcquireTimeoutMilliseconds'):
+        COUNTS[(keyed_mutex, name)] = 's->acquireCount'
+    for name in ('pReleaseSyncs', 'pReleaseKeys'):
+        COUNTS[(keyed_mutex, name)] = 's->releaseCount'
+
+# Pointers that are read as a single element, even though their names
+# look like arrays. Anything else that looks like an array, but has no
+# count, is an error.
+SINGLE = set([
+    'pEnabledFeatures', 'pFeatures', 'pProperties', 'pFormatProperties',
+    'pImageFormatProperties', 'pMemoryProperties', 'pMemoryRequirements',
+    'pSurfaceCapabilities', 'pExternalImageFormatProperties',
+    'pExternalBufferProperties', 'pExternalSemaphoreProperties',
+    'pCapabilities', 'pLimits', 'pDisplayTimingProperties',
+    'pQueueFamilyProperties', 'pSparseMemoryRequirements',
+    'pMemoryWin32HandleProperties', 'pMemoryFdProperties',
+    'pPresentationTimings', 'pColorAttachments', 'pInputAttachments',
+    'pPreserveAttachments', 'pRectangles', 'pTimes', 'pDeviceMasks',
+    'pRegions', 'pDeviceGroupPresentCapabilities', 'pModes', 'pRects',
+    'pCommittedMemoryInBytes', 'pRenderPass', 'pPeerMemoryFeatures',
+])
+
+# Structs that are only ever written by commands, and so are never read.
+OUTPUT_ONLY = set([
+    'VkPhysicalDeviceGroupPropertiesKHX',
+])
+
+# Commands that only make sense in the process that called them, or that
+# take arguments that cannot be described, are recorded without their
+# arguments and are not replayed.
+UNSUPPORTED = set([
+    'vkRegisterObjectsNVX',
+    'vkUpdateDescriptorSetWithTemplateKHR',
+    'vkCmdPushDescriptorSetWithTemplateKHR',
+])
+
+ENUM_RE = re.compile(r'\s+(VK_STRUCTURE_TYPE_\w+) = ')
+HANDLE_RE = re.compile(r'VK_DEFINE_(NON_DISPATCHABLE_)?HANDLE\((\w+)\)$')
+STRUCT_RE = re.compile(r'typedef (struct|union) (\w+) {')
+END_STRUCT_RE = re.compile(r'} (\w+);')
+MEMBER_RE = re.compile(r'\s*(.*?)\s*(\w+)\s*(\[(\w+)\])?;')
+PROTOTYPE_RE = re.compile(r'VKAPI_ATTR (.*?) VKAPI_CALL (vk\w+)\(')
+PARAMETER_RE = re.compile(r'\s*(.*?)\s*(\w+)\s*(\[(\w+)\])?[,)]')
+PLATFORM_RE = re.compile(r'#ifdef (VK_USE_PLATFORM_\w+)')
+
+# This must match kMaxParameters in vulkan_wrapper/capture_tables.h.
+MAX_PARAMETERS = 16
+
+# Integer types that a member or parameter can be counted by.
+COUNT_TYPES = set(['uint32_t', 'size_t', 'VkDeviceSize'])
+
+# Plain types that pointers are followed to.
+PLAIN_TYPES = set(['void', 'char', 'float', 'int', 'int32_t', 'uint8_t',
+                   'uint16_t', 'uint64_t'])
+
+# Window system types that are only ever pointed to, and are never complete.
+OPAQUE_TYPES = set(['Display', 'xcb_connection_t', 'wl_display',
+                    'wl_surface', 'MirConnection', 'MirSurface',
+                    'ANativeWindow'])
+
+
+class Member(object):
+    '''A member of a struct or a parameter of a command.'''
+
+    def __init__(self, type_text, name, array):
+        self.name = name
+        self.array = array
+        self.const = type_text.startswith('const ')
+        self.pointers = type_text.count('*')
+        self.base = re.sub(r'\b(const|struct)\b|\*', '', type_text).strip()
+        # Arrays that are parameters are really pointers.
+        self.type_text = type_text + ('*' if array else '')
+
+
+class Struct(object):
+
+    def __init__(self, name, platform):
+        self.name = name
+        self.platform = platform
+        self.members = []
+        self.s_type = None
+        self.fields = []
+
+
+class Function(object):
+
+    def __init__(self, name, result, platform):
+        self.name = name
+        self.result = result
+        self.platform = platform
+        self.parameters = []
+        self.fields = []
+        self.supported = name not in UNSUPPORTED
+
+
+def parse(vulkan_h):
+    '''Returns the handles, structs and functions in vulkan_h.'''
+    handles = []
+    structs = []
+    functions = []
+    s_types = set()
+    # The platform #ifdef that each open #if belongs to, or None.
+    conditions = []
+    lines = iter(vulkan_h.splitlines())
+    for line in lines:
+        platforms = [c for c in conditions if c]
+        platform = platforms[-1] if platforms else None
+        if line.startswith('#if'):
+            match = PLATFORM_RE.match(line)
+            conditions.append(match.group(1) if match else None)
+            continue
+        if line.startswith('#endif'):
+            conditions.pop()
+            continue
+        match = ENUM_RE.match(line)
+        if match:
+            s_types.add(match.group(1))
+            continue
+        match = HANDLE_RE.match(line)
+        if match:
+            handles.append(match.group(2))
+            continue
+        match = STRUCT_RE.match(line)
+        if match:
+            struct = Struct(match.group(2), platform)
+            for line in lines:
+                if END_STRUCT_RE.match(line):
+                    break
+                member = MEMBER_RE.match(line)
+                struct.members.append(
+                    Member(member.group(1), member.group(2),
+                           member.group(4)))
+            structs.append(struct)
+            continue
+        match = PROTOTYPE_RE.match(line)
+        if match:
+            function = Function(match.group(2), match.group(1), platform)
+            for line in lines:
+                parameter = PARAMETER_RE.match(line)
+                function.parameters.append(
+                    Member(parameter.group(1), parameter.group(2),
+                           parameter.group(4)))
+                if line.endswith(');'):
+                    break
+            if function.name not in EXCLUDED:
+                functions.append(function)
+    return handles, structs, functions, s_types
+
+
+def s_type_key(name):
+    return name.replace('_', '').lower()
+
+
+def singulars(name):
+    if name.endswith('ies'):
+        return [name[:-3] + 'y']
+    if name.endswith('ices'):
+        return [name[:-4] + 'ex', name[:-1]]
+    if name.endswith('es'):
+        return [name[:-2], name[:-1]]
+    if name.endswith('s'):
+        return [name[:-1]]
+    return []
+
+
+def count_names(name):
+    '''Returns the names of the members that might count the pointer name,
+    and whether they count bytes.'''
+    base = name.lstrip('p')
+    base = base[0].lower() + base[1:]
+    names = [(base + 'Count', False)]
+    names += [(name + 'Count', False) for name in singulars(base)]
+    if base.endswith('Names'):
+        names.append((base[:-len('Names')] + 'Count', False))
+    names.append((base + 'Size', True))
+    return names
+
+
+def wrap(first, items, last, indent):
+    '''Returns items separated by commas, after first and before last, in
+    lines of at most 80 characters.'''
+    lines = [first]
+    for index, item in enumerate(items):
+        item += last if index == len(items) - 1 else ','
+        if len(lines[-1]) + len(item) + 1 > 80 and lines[-1].strip():
+            lines.append(' ' * indent + item)
+        elif lines[-1].endswith(('{', '(')) or not lines[-1].strip():
+            lines[-1] += item
+        else:
+            lines[-1] += ' ' + item
+    return '\n'.join(lines) + '\n'
+
+
+def assign(declaration, value):
+    '''Returns the statement declaration = value, in lines of at most 80
+    characters.'''
+    text = '  %s = %s;\n' % (declaration, value)
+    if len(text) <= 81:
+        return text
+    return '  %s =\n      %s;\n' % (declaration, value)
+
+
+class Generator(object):
+
+    def __init__(self, handles, structs, functions, s_types):
+        self.handle_index = dict((h, i) for i, h in enumerate(handles))
+        self.handles = handles
+        self.structs = dict((s.name, s) for s in structs)
+        self.struct_list = structs
+        self.functions = functions
+        self.s_types = dict((s_type_key(s[len('VK_STRUCTURE_TYPE_'):]), s)
+                            for s in s_types)
+        # (name, body, platform) for each count function.
+        self.count_functions = []
+        self.errors = []
+        for struct in structs:
+            if struct.members and struct.members[0].name == 'sType':
+                struct.s_type = self.s_types.get(s_type_key(struct.name[2:]))
+
+    def element_type(self, base):
+        '''Returns the StructType for base, or None if it is plain data.'''
+        struct = self.structs.get(base)
+        if struct and struct.fields:
+            return '&k%sType' % struct.name
+        return None
+
+    def output_type(self, base):
+        '''Outputs only need a StructType to set their sType.'''
+        struct = self.structs.get(base)
+        if struct and struct.s_type:
+            return '&k%sType' % struct.name
+        return None
+
+    def element_size(self, member):
+        if member.base == 'void':
+            return '1'
+        return 'sizeof(%s)' % member.base
+
+    def count(self, owner, member, siblings, is_function):
+        '''Returns what counts the elements behind member, or None if there
+        is a single element.'''
+        key = (owner, member.name)
+        if key in COUNTS:
+            return COUNTS[key]
+        if member.array:
+            return member.array
+        names = dict((s.name, s) for s in siblings)
+        for name, is_bytes in count_names(member.name):
+            candidates = [(name, '')]
+            if is_function:
+                candidates.append(('p' + name[0].upper() + name[1:], '*'))
+            for candidate, dereference in candidates:
+                sibling = names.get(candidate)
+                if not sibling or sibling.base not in COUNT_TYPES:
+                    continue
+                value = dereference + ('' if is_function else 's->') + \
+                    candidate
+                if is_bytes and member.base != 'void':
+                    value = '%s / %s' % (value, self.element_size(member))
+                return value
+        if member.name.endswith('s') and member.name not in SINGLE:
+            self.errors.append('%s.%s has no count' % (owner, member.name))
+        return None
+
+    def is_in_out_count(self, function, parameter):
+        '''Returns true if parameter points to the number of elements that
+        another parameter points to.'''
+        name = parameter.name[1].lower() + parameter.name[2:]
+        for other in function.parameters:
+            count = COUNTS.get((function.name, other.name))
+            if count == '*' + parameter.name:
+                return True
+            if other.pointers and any(n == name
+                                      for n, _ in count_names(other.name)):
+                return True
+        return False
+
+    def field(self, owner, member, siblings, is_function):
+        '''Returns (kind, element size, element type, handle type, count),
+        or None if member is plain data.'''
+        base = member.base
+        pointers = member.pointers + (1 if member.array and is_function
+                                      else 0)
+        if pointers == 0:
+            if (member.array and base in self.handle_index and
+                    owner not in OUTPUT_ONLY):
+                self.errors.append('%s.%s is an array of handles' %
+                                   (owner, member.name))
+            if base in self.handle_index:
+                return ('kHandleField', 'sizeof(%s)' % base, None,
+                        self.handle_index[base], None)
+            element_type = self.element_type(base)
+            if element_type and not member.array:
+                return ('kStructField', 'sizeof(%s)' % base, element_type,
+                        0, None)
+            if is_function:
+                return ('kValueField', 'sizeof(%s)' % base, None, 0, None)
+            return None
+        if member.name == 'pNext':
+            return ('kNextField', 'sizeof(void*)', None, 0, None)
+        if base == 'VkAllocationCallbacks':
+            return ('kIgnoredField', 'sizeof(void*)', None, 0, None)
+        known = (base in self.handle_index or base in self.structs or
+                 base in COUNT_TYPES or base in PLAIN_TYPES or
+                 base.startswith('Vk'))
+        if not known or member.name == 'pUserData' or (
+                not is_function and not member.const and base == 'void'):
+            if is_function and not member.const and base not in OPAQUE_TYPES:
+                # Platform types that the command writes to.
+                return ('kOutputField', 'sizeof(%s)' % base, None, 0, None)
+            # Platform objects, and anything else that is only meaningful
+            # in the calling process, are kept as they are.
+            if is_function:
+                return ('kValueField', 'sizeof(%s)' % member.type_text,
+                        None, 0, None)
+            return None
+        if pointers == 2:
+            if member.const and base == 'char':
+                return ('kStringArrayField', 'sizeof(char*)', None, 0,
+                        self.count(owner, member, siblings, is_function))
+            if base == 'void' and not member.const:
+                return ('kOutputField', 'sizeof(void*)', None, 0, None)
+            self.errors.append('%s.%s cannot be described' %
+                               (owner, member.name))
+            return None
+        if member.const or (member.array and is_function):
+            if base == 'char' and not member.array:
+                return ('kStringField', '1', None, 0, None)
+            count = self.count(owner, member, siblings, is_function)
+            if base in self.handle_index:
+                return ('kHandlePointerField', 'sizeof(%s)' % base, None,
+                        self.handle_index[base], count)
+            return ('kPointerField', self.element_size(member),
+                    self.element_type(base), 0, count)
+        if (is_function and base in COUNT_TYPES and
+                self.is_in_out_count(self.function_named(owner), member)):
+            return ('kInOutCountField', 'sizeof(%s)' % base, None, 0, None)
+        count = self.count(owner, member, siblings, is_function)
+        if base in self.handle_index:
+            return ('kOutputHandleField', 'sizeof(%s)' % base, None,
+                    self.handle_index[base], count)
+        return ('kOutputField', self.element_size(member),
+                self.output_type(base), 0, count)
+
+    def function_named(self, name):
+        return [f for f in self.functions if f.name == name][0]
+
+    def describe(self):
+        for struct in self.struct_list:
+            for member in struct.members:
+                field = self.field(struct.name, member, struct.members, False)
+                if field:
+                    struct.fields.append((member, field))
+            if struct.s_type and not struct.fields:
+                self.errors.append('%s has an sType and no pNext' %
+                                   struct.name)
+        for function in self.functions:
+            if not function.supported:
+                continue
+            for parameter in function.parameters:
+                field = self.field(function.name, parameter,
+                                   function.parameters, True)
+                function.fields.append((parameter, field))
+            in_out = [f for f in function.fields
+                      if f[1][0] == 'kInOutCountField']
+            if len(in_out) > 1:
+                self.errors.append('%s has more than one in/out count' %
+                                   function.name)
+            if len(function.fields) > MAX_PARAMETERS:
+                self.errors.append('%s has too many parameters' %
+                                   function.name)
+
+    def count_function(self, owner, member, count, function, platform):
+        '''Adds a function that returns count, and returns its name.'''
+        name = 'Count%d' % len(self.count_functions)
+        constant = not isinstance(count, tuple) and count.isdigit()
+        body = '// %s::%s\nuint64_t %s(const void*%s) {\n' % (
+            owner, member.name, name, '' if constant else ' owner')
+        if constant:
+            pass
+        elif function:
+            body += assign('const void* const* parameters',
+                           'static_cast<const void* const*>(owner)')
+            for index, parameter in enumerate(function.parameters):
+                if re.search(r'\b%s\b' % parameter.name, count):
+                    body += assign(
+                        '%s %s' % (parameter.type_text, parameter.name),
+                        'Parameter<%s>(parameters, %d)' %
+                        (parameter.type_text, index))
+        else:
+            body += assign('const %s* s' % owner,
+                           'static_cast<const %s*>(owner)' % owner)
+        if isinstance(count, tuple):
+            body += '  switch (s->descriptorType) {\n'
+            for descriptor_type in count[0]:
+                body += '    case %s:\n' % descriptor_type
+            body += ('      return %s;\n    default:\n      return 0;\n'
+                     '  }\n' % count[1])
+        else:
+            body += '  return %s;\n' % count
+        body += '}\n'
+        self.count_functions.append((name, body, platform))
+        return name
+
+    def fields_text(self, table, owner, fields, function, platform):
+        text = 'const Field %s[] = {\n' % table
+        for index, (member, field) in enumerate(fields):
+            kind, size, element_type, handle_type, count = field
+            if count and count != '1':
+                count = '&' + self.count_function(owner, member, count,
+                                                  function, platform)
+            else:
+                count = 'nullptr'
+            offset = (str(index) if function else
+                      'offsetof(%s, %s)' % (owner, member.name))
+            text += wrap('    {', ['"%s"' % member.name, kind, offset, size,
+                                   element_type or 'nullptr',
+                                   str(handle_type), count], '},', 5)
+        return text + '};\n'
+
+    def write(self, output):
+        # The tables are built first, since that adds the count functions
+        # that they refer to.
+        tables = []
+        for struct in self.struct_list:
+            if not struct.fields:
+                continue
+            text = self.fields_text('k%sFields' % struct.name, struct.name,
+                                    struct.fields, None, struct.platform)
+            text += 'const StructType k%sType = {\n' % struct.name
+            text += wrap('    ', [
+                '"%s"' % struct.name, 'sizeof(%s)' % struct.name,
+                'true' if struct.s_type else 'false',
+                struct.s_type or 'VkStructureType(0)',
+                'k%sFields' % struct.name, str(len(struct.fields))], '};', 4)
+            tables.append((text, struct.platform))
+        for function in self.functions:
+            if function.fields:
+                tables.append((self.fields_text(
+                    parameter_table(function), function.name,
+                    function.fields, function, function.platform),
+                               function.platform))
+
+        output.write(HEADER)
+        for _, body, platform in self.count_functions:
+            write_guarded(output, platform, body)
+        for text, platform in tables:
+            write_guarded(output, platform, text)
+
+        output.write('\n// These are sorted by name, for FindFunctionType.\n'
+                     'const FunctionType kFunctionTypes[] = {\n')
+        for function in sorted(self.functions, key=lambda f: f.name):
+            if function.fields:
+                parameters = [parameter_table(function),
+                              str(len(function.fields))]
+            else:
+                parameters = ['nullptr', '0']
+            result = ('0' if function.result == 'void' else
+                      'sizeof(%s)' % function.result)
+            write_guarded(output, function.platform, wrap(
+                '    {', ['"%s"' % function.name] + parameters +
+                [result, 'true' if function.supported else 'false'], '},', 5),
+                          blank=False)
+        output.write('};\n\n}  // anonymous namespace\n')
+
+        output.write('\nconst char* const kHandleTypeNames[] = {\n')
+        for handle in self.handles:
+            output.write('    "%s",\n' % handle)
+        output.write('};\nconst uint32_t kHandleTypeCount =\n'
+                     '    sizeof(kHandleTypeNames) / '
+                     'sizeof(kHandleTypeNames[0]);\n')
+
+        output.write(FIND_FUNCTION_TYPE)
+        output.write('\nconst StructType* FindStructType(VkStructureType '
+                     's_type) {\n  switch (s_type) {\n')
+        for struct in self.struct_list:
+            if struct.s_type:
+                write_guarded(output, struct.platform,
+                              '    case %s:\n      return &k%sType;\n' %
+                              (struct.s_type, struct.name), blank=False)
+        output.write('    default:\n      return nullptr;\n  }\n}\n')
+        output.write(FOOTER)
+
+
+def parameter_table(function):
+    return 'k%s%sParameters' % (function.name[0].upper(), function.name[1:])
+
+
+FIND_FUNCTION_TYPE = """
+const FunctionType* FindFunctionType(const char* name) {
+  const FunctionType* begin = kFunctionTypes;
+  const FunctionType* end =
+      kFunctionTypes + sizeof(kFunctionTypes) / sizeof(kFunctionTypes[0]);
+  while (begin != end) {
+    const FunctionType* middle = begin + (end - begin) / 2;
+    const int order = strcmp(middle->name, name);
+    if (order == 0) {
+      return middle;
+    }
+    if (order < 0) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return nullptr;
+}
+"""
+
+
+def write_guarded(output, platform, text, blank=True):
+    if blank:
+        output.write('\n')
+    if platform:
+        output.write('#if defined(%s)\n' % platform)
+    output.write(text)
+    if platform:
+        output.write('#endif  // %s\n' % platform)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate the capture tables for the wrapper')
+    parser.add_argument(
+        '--vulkan-h',
+        default=os.path.join(ROOT, 'third_party', 'vulkan', 'vulkan.h'),
+        help='vulkan.h to read the types from')
+    parser.add_argument(
+        '--output',
+        default=os.path.join(ROOT, 'vulkan_wrapper', 'capture_tables.cpp'),
+        help='file to write the tables to')
+    args = parser.parse_args()
+
+    with open(args.vulkan_h) as vulkan_h:
+        generator = Generator(*parse(vulkan_h.read()))
+    generator.describe()
+    if generator.errors:
+        raise SystemExit('\n'.join(generator.errors))
+    with open(args.output, 'w') as output:
+        generator.write(output)
+
+
+if __name__ == '__main__':
+    main()
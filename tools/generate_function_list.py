@@ -0,0 +1,162 @@
+#!/usr/bin/python
+# Copyright 2017 Google Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+'''This generates vulkan_wrapper/function_list.h from vulkan.h.
+
+Every Vulkan command that has a PFN_ typedef in vulkan.h is listed, grouped
+by the handle that it is dispatched through: the instance (for VkInstance
+and VkPhysicalDevice), the device, a queue or a command buffer. Commands
+that are only available on some platforms keep the #ifdef that guards them
+in vulkan.h. Global commands, and vkGetDeviceProcAddr, are resolved by
+LibraryWrapper and VkDevice themselves, so they are left out.
+
+Run this again whenever third_party/vulkan/vulkan.h is updated.
+'''
+
+import argparse
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+HEADER = '''/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// This file is generated by tools/generate_function_list.py from
+// third_party/vulkan/vulkan.h. Do not edit it by hand.
+//
+// It has no include guard, because it is meant to be included several
+// times. Before each inclusion, define the macros below for the kinds of
+// functions that you want to expand; the others expand to nothing. They are
+// all undefined again at the end.
+
+#ifndef VULKAN_INSTANCE_FUNCTION
+#define VULKAN_INSTANCE_FUNCTION(function)
+#endif
+#ifndef VULKAN_DEVICE_FUNCTION
+#define VULKAN_DEVICE_FUNCTION(function)
+#endif
+#ifndef VULKAN_QUEUE_FUNCTION
+#define VULKAN_QUEUE_FUNCTION(function)
+#endif
+#ifndef VULKAN_COMMAND_BUFFER_FUNCTION
+#define VULKAN_COMMAND_BUFFER_FUNCTION(function)
+#endif
+'''
+
+FOOTER = '''
+#undef VULKAN_INSTANCE_FUNCTION
+#undef VULKAN_DEVICE_FUNCTION
+#undef VULKAN_QUEUE_FUNCTION
+#undef VULKAN_COMMAND_BUFFER_FUNCTION
+'''
+
+# The macro for the functions that take each handle as their first argument.
+MACROS = {
+    'VkInstance': 'VULKAN_INSTANCE_FUNCTION',
+    'VkPhysicalDevice': 'VULKAN_INSTANCE_FUNCTION',
+    'VkDevice': 'VULKAN_DEVICE_FUNCTION',
+    'VkQueue': 'VULKAN_QUEUE_FUNCTION',
+    'VkCommandBuffer': 'VULKAN_COMMAND_BUFFER_FUNCTION',
+}
+
+EXCLUDED = set([
+    'vkGetInstanceProcAddr',
+    'vkGetDeviceProcAddr',
+])
+
+PFN_RE = re.compile(r'typedef\s[^;]*?\(VKAPI_PTR \*PFN_(vk\w+)\)\(\s*'
+                    r'(?:const\s+)?(\w+)')
+PLATFORM_RE = re.compile(r'#ifdef (VK_USE_PLATFORM_\w+)')
+
+
+def read_functions(vulkan_h):
+    """Returns a (name, macro, platform) tuple for every function."""
+    functions = []
+    # The platform #ifdef that each open #if belongs to, or None.
+    conditions = []
+    lines = iter(vulkan_h.splitlines())
+    for line in lines:
+        if line.startswith('#if'):
+            match = PLATFORM_RE.match(line)
+            conditions.append(match.group(1) if match else None)
+        elif line.startswith('#endif'):
+            conditions.pop()
+        elif line.startswith('typedef') and 'PFN_vk' in line:
+            # The first parameter is on the next line.
+            text = line
+            while ';' not in text:
+                text += next(lines)
+            match = PFN_RE.match(text)
+            if not match:
+                continue
+            name, first_type = match.groups()
+            if name in EXCLUDED or first_type not in MACROS:
+                continue
+            platforms = [c for c in conditions if c]
+            functions.append((name, MACROS[first_type],
+                              platforms[-1] if platforms else None))
+    return functions
+
+
+def write_function_list(functions, output):
+    output.write(HEADER)
+    platform = None
+    for name, macro, function_platform in functions:
+        if function_platform != platform:
+            if platform:
+                output.write('#endif  // %s\n' % platform)
+            output.write('\n')
+            if function_platform:
+                output.write('#if defined(%s)\n' % function_platform)
+            platform = function_platform
+        output.write('%s(%s)\n' % (macro, name))
+    if platform:
+        output.write('#endif  // %s\n' % platform)
+    output.write(FOOTER)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate the list of Vulkan functions for the wrapper')
+    parser.add_argument(
+        '--vulkan-h',
+        default=os.path.join(ROOT, 'third_party', 'vulkan', 'vulkan.h'),
+        help='vulkan.h to read the functions from')
+    parser.add_argument(
+        '--output',
+        default=os.path.join(ROOT, 'vulkan_wrapper', 'function_list.h'),
+        help='file to write the list to')
+    args = parser.parse_args()
+
+    with open(args.vulkan_h) as vulkan_h:
+        functions = read_functions(vulkan_h.read())
+    with open(args.output, 'w') as output:
+        write_function_list(functions, output)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,421 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_helpers/arena_defragmenter.h"
+
+#include <algorithm>
+
+#include "vulkan_helpers/helper_functions.h"
+
+namespace vulkan {
+
+ArenaDefragmenter::ArenaDefragmenter(containers::Allocator* allocator,
+                                     VulkanApplication* application,
+                                     ::VkDeviceSize bytes_per_step)
+    : allocator_(allocator),
+      application_(application),
+      bytes_per_step_(bytes_per_step),
+      registrations_(allocator),
+      moves_(allocator),
+      graveyard_(allocator),
+      command_buffer_(application->GetCommandBuffer()),
+      copy_fence_(CreateFence(&application->device())),
+      retire_fence_(CreateFence(&application->device())) {}
+
+ArenaDefragmenter::~ArenaDefragmenter() {
+  VkDevice& device = application_->device();
+  if (!moves_.empty()) {
+    // The resources never got updated, so all we have to do is throw away
+    // the copies.
+    device->vkWaitForFences(device, 1, &copy_fence_.get_raw_object(), VK_TRUE,
+                            0xFFFFFFFFFFFFFFFF);
+    containers::vector<Placement> destinations(allocator_);
+    for (auto& move : moves_) {
+      destinations.push_back(std::move(move.destination));
+    }
+    moves_.clear();
+    ReleasePlacements(&destinations);
+  }
+  if (!graveyard_.empty()) {
+    device->vkWaitForFences(device, 1, &retire_fence_.get_raw_object(),
+                            VK_TRUE, 0xFFFFFFFFFFFFFFFF);
+    ReleasePlacements(&graveyard_);
+  }
+}
+
+void ArenaDefragmenter::RegisterBuffer(VulkanApplication::Buffer* buffer,
+                                       const VkBufferCreateInfo& create_info,
+                                       RelocationCallback callback,
+                                       void* user_data) {
+  logging::Logger* log = application_->GetLogger();
+  LOG_ASSERT(==, log, true, FindRegistration(buffer) == nullptr);
+  // The create info is kept around, so it cannot point to anything.
+  LOG_ASSERT(==, log, true, create_info.pNext == nullptr);
+  LOG_ASSERT(==, log, VK_SHARING_MODE_EXCLUSIVE, create_info.sharingMode);
+  const VkBufferUsageFlags transfer_usage =
+      VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+  LOG_ASSERT(==, log, transfer_usage, create_info.usage & transfer_usage);
+  Registration registration;
+  MemoryClear(&registration);
+  registration.buffer = buffer;
+  registration.buffer_info = create_info;
+  registration.callback = callback;
+  registration.user_data = user_data;
+  registrations_.emplace(buffer, registration);
+}
+
+void ArenaDefragmenter::RegisterImage(VulkanApplication::Image* image,
+                                      const VkImageCreateInfo& create_info,
+                                      VkImageLayout layout,
+                                      VkImageAspectFlags aspect,
+                                      RelocationCallback callback,
+                                      void* user_data) {
+  logging::Logger* log = application_->GetLogger();
+  LOG_ASSERT(==, log, true, FindRegistration(image) == nullptr);
+  // The create info is kept around, so it cannot point to anything.
+  LOG_ASSERT(==, log, true, create_info.pNext == nullptr);
+  LOG_ASSERT(==, log, VK_SHARING_MODE_EXCLUSIVE, create_info.sharingMode);
+  const VkImageUsageFlags transfer_usage =
+      VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+  LOG_ASSERT(==, log, transfer_usage, create_info.usage & transfer_usage);
+  Registration registration;
+  MemoryClear(&registration);
+  registration.image = image;
+  registration.image_info = create_info;
+  // The new image is transitioned out of UNDEFINED before it is written.
+  registration.image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+  registration.layout = layout;
+  registration.aspect = aspect;
+  registration.callback = callback;
+  registration.user_data = user_data;
+  registrations_.emplace(image, registration);
+}
+
+void ArenaDefragmenter::UnregisterBuffer(VulkanApplication::Buffer* buffer) {
+  Unregister(buffer);
+}
+
+void ArenaDefragmenter::UnregisterImage(VulkanApplication::Image* image) {
+  Unregister(image);
+}
+
+ArenaDefragmenter::Registration* ArenaDefragmenter::FindRegistration(
+    const void* resource) {
+  auto it = registrations_.find(resource);
+  return it == registrations_.end() ? nullptr : &it->second;
+}
+
+void ArenaDefragmenter::Unregister(const void* resource) {
+  LOG_ASSERT(==, application_->GetLogger(), 1u,
+             registrations_.erase(resource));
+
+  for (size_t i = 0; i < moves_.size(); ++i) {
+    if (moves_[i].resource != resource) {
+      continue;
+    }
+    // The owner is about to destroy the resource, so the copy out of it
+    // has to finish first. After that, the copy is of no use.
+    VkDevice& device = application_->device();
+    device->vkWaitForFences(device, 1, &copy_fence_.get_raw_object(), VK_TRUE,
+                            0xFFFFFFFFFFFFFFFF);
+    containers::vector<Placement> destination(allocator_);
+    destination.push_back(std::move(moves_[i].destination));
+    ReleasePlacements(&destination);
+    moves_.erase(moves_.begin() + i);
+    if (moves_.empty()) {
+      LOG_ASSERT(==, application_->GetLogger(), VK_SUCCESS,
+                 device->vkResetFences(device, 1,
+                                       &copy_fence_.get_raw_object()));
+    }
+    break;
+  }
+}
+
+void ArenaDefragmenter::Step(VkQueue* queue) {
+  VkDevice& device = application_->device();
+  logging::Logger* log = application_->GetLogger();
+  if (!graveyard_.empty()) {
+    if (device->vkGetFenceStatus(device, retire_fence_) != VK_SUCCESS) {
+      return;
+    }
+    LOG_ASSERT(==, log, VK_SUCCESS,
+               device->vkResetFences(device, 1,
+                                     &retire_fence_.get_raw_object()));
+    ReleasePlacements(&graveyard_);
+  }
+  if (!moves_.empty()) {
+    if (device->vkGetFenceStatus(device, copy_fence_) != VK_SUCCESS) {
+      return;
+    }
+    LOG_ASSERT(==, log, VK_SUCCESS,
+               device->vkResetFences(device, 1, &copy_fence_.get_raw_object()));
+    FinishMoves(queue);
+    return;
+  }
+  StartMoves(queue);
+}
+
+void ArenaDefragmenter::StartMoves(VkQueue* queue) {
+  struct Candidate {
+    Registration* registration;
+    size_t chunk_index;
+    ::VkDeviceSize offset;
+    ::VkDeviceSize size;
+  };
+  containers::vector<Candidate> candidates(allocator_);
+  candidates.reserve(registrations_.size());
+  for (auto& entry : registrations_) {
+    Registration& registration = entry.second;
+    VulkanArena* heap = registration.buffer ? registration.buffer->heap_
+                                            : registration.image->heap_;
+    AllocationToken* token = registration.buffer ? registration.buffer->token_
+                                                 : registration.image->token_;
+    if (!token) {
+      // Buffers in slab pools share their allocation, so cannot be moved.
+      continue;
+    }
+    candidates.push_back({&registration, heap->chunk_index(token),
+                          token->offset, token->allocationSize});
+  }
+  // Move whatever is furthest back first, since that is what is keeping the
+  // later chunks alive.
+  std::sort(candidates.begin(), candidates.end(),
+            [](const Candidate& a, const Candidate& b) {
+              return a.chunk_index != b.chunk_index
+                         ? a.chunk_index > b.chunk_index
+                         : a.offset > b.offset;
+            });
+
+  ::VkDeviceSize bytes = 0;
+  for (auto& candidate : candidates) {
+    if (!moves_.empty() && bytes + candidate.size > bytes_per_step_) {
+      continue;
+    }
+    Placement placement(&application_->device());
+    if (!PlaceLower(*candidate.registration, &placement)) {
+      continue;
+    }
+    const void* resource =
+        candidate.registration->buffer
+            ? static_cast<const void*>(candidate.registration->buffer)
+            : static_cast<const void*>(candidate.registration->image);
+    moves_.push_back(Move{resource, std::move(placement)});
+    bytes += candidate.size;
+  }
+  if (moves_.empty()) {
+    return;
+  }
+
+  RecordCopies();
+  ::VkCommandBuffer raw_cmd_buf = command_buffer_.get_command_buffer();
+  VkSubmitInfo submit_info{
+      VK_STRUCTURE_TYPE_SUBMIT_INFO,  // sType
+      nullptr,                        // pNext
+      0,                              // waitSemaphoreCount
+      nullptr,                        // pWaitSemaphores
+      nullptr,                        // pWaitDstStageMask,
+      1,                              // commandBufferCount
+      &raw_cmd_buf,                   // pCommandBuffers
+      0,                              // signalSemaphoreCount
+      nullptr                         // pSignalSemaphores
+  };
+  LOG_ASSERT(==, application_->GetLogger(), VK_SUCCESS,
+             (*queue)->vkQueueSubmit(*queue, 1, &submit_info, copy_fence_));
+}
+
+bool ArenaDefragmenter::PlaceLower(const Registration& registration,
+                                   Placement* placement) {
+  VkDevice& device = application_->device();
+  logging::Logger* log = application_->GetLogger();
+  // A new resource created with the same create info has the same
+  // requirements, so there is no need to create it until there is space.
+  VkMemoryRequirements requirements;
+  AllocationToken* current_token;
+  if (registration.buffer) {
+    device->vkGetBufferMemoryRequirements(
+        device, registration.buffer->buffer_, &requirements);
+    placement->heap = registration.buffer->heap_;
+    current_token = registration.buffer->token_;
+  } else {
+    device->vkGetImageMemoryRequirements(device, registration.image->image_,
+                                         &requirements);
+    placement->heap = registration.image->heap_;
+    current_token = registration.image->token_;
+  }
+  placement->token = placement->heap->AllocateBelow(
+      current_token, requirements.size, requirements.alignment,
+      &placement->memory, &placement->offset, &placement->base_address);
+  if (!placement->token) {
+    return false;
+  }
+
+  if (registration.buffer) {
+    ::VkBuffer buffer;
+    LOG_ASSERT(==, log, VK_SUCCESS,
+               device->vkCreateBuffer(device, &registration.buffer_info,
+                                      device.allocation_callbacks(), &buffer));
+    placement->buffer.initialize(buffer);
+    LOG_ASSERT(==, log, VK_SUCCESS,
+               device->vkBindBufferMemory(device, buffer, placement->memory,
+                                          placement->offset));
+  } else {
+    ::VkImage image;
+    LOG_ASSERT(==, log, VK_SUCCESS,
+               device->vkCreateImage(device, &registration.image_info,
+                                     device.allocation_callbacks(), &image));
+    placement->image.initialize(image);
+    LOG_ASSERT(==, log, VK_SUCCESS,
+               device->vkBindImageMemory(device, image, placement->memory,
+                                         placement->offset));
+  }
+  return true;
+}
+
+void ArenaDefragmenter::RecordCopies() {
+  VkCommandBufferBeginInfo begin_info{
+      VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO, nullptr,
+      VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, nullptr};
+  command_buffer_->vkResetCommandBuffer(command_buffer_, 0);
+  command_buffer_->vkBeginCommandBuffer(command_buffer_, &begin_info);
+
+  // The image barriers that go before the copies, and those that go after.
+  containers::vector<VkImageMemoryBarrier> before(allocator_);
+  containers::vector<VkImageMemoryBarrier> after(allocator_);
+  for (auto& move : moves_) {
+    const Registration* registration = FindRegistration(move.resource);
+    if (!registration->image) {
+      continue;
+    }
+    const VkImageSubresourceRange range = {
+        registration->aspect, 0, registration->image_info.mipLevels, 0,
+        registration->image_info.arrayLayers};
+    const ::VkImage old_image = registration->image->image_;
+    const ::VkImage new_image = move.destination.image;
+    before.push_back({VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+                      VulkanApplication::kAllWriteBits,
+                      VK_ACCESS_TRANSFER_READ_BIT, registration->layout,
+                      VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                      VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+                      old_image, range});
+    before.push_back({VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr, 0,
+                      VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                      VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED,
+                      new_image, range});
+    // The old image may still be used until the move is finished, so it
+    // has to go back into its layout as well.
+    after.push_back({VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+                     VK_ACCESS_TRANSFER_READ_BIT,
+                     VulkanApplication::kAllReadBits,
+                     VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                     registration->layout, VK_QUEUE_FAMILY_IGNORED,
+                     VK_QUEUE_FAMILY_IGNORED, old_image, range});
+    after.push_back(
+        {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, nullptr,
+         VK_ACCESS_TRANSFER_WRITE_BIT,
+         VulkanApplication::kAllReadBits | VulkanApplication::kAllWriteBits,
+         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, registration->layout,
+         VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED, new_image, range});
+  }
+
+  // Make sure that anything that was written to the resources before this
+  // point is what gets copied.
+  VkMemoryBarrier before_barrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER, nullptr,
+                                 VulkanApplication::kAllWriteBits,
+                                 VK_ACCESS_TRANSFER_READ_BIT};
+  command_buffer_->vkCmdPipelineBarrier(
+      command_buffer_, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+      VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &before_barrier, 0, nullptr,
+      uint32_t(before.size()), before.empty() ? nullptr : before.data());
+
+  containers::vector<VkImageCopy> regions(allocator_);
+  for (auto& move : moves_) {
+    const Registration* registration = FindRegistration(move.resource);
+    if (registration->buffer) {
+      VkBufferCopy region{0, 0, registration->buffer_info.size};
+      command_buffer_->vkCmdCopyBuffer(command_buffer_,
+                                       registration->buffer->buffer_,
+                                       move.destination.buffer, 1, &region);
+      continue;
+    }
+    // Copy every mip level, and every array layer of the image.
+    const VkImageCreateInfo& info = registration->image_info;
+    regions.clear();
+    for (uint32_t mip = 0; mip < info.mipLevels; ++mip) {
+      const VkImageSubresourceLayers layers{registration->aspect, mip, 0,
+                                            info.arrayLayers};
+      const VkExtent3D extent{std::max(info.extent.width >> mip, 1u),
+                              std::max(info.extent.height >> mip, 1u),
+                              std::max(info.extent.depth >> mip, 1u)};
+      regions.push_back({layers, {0, 0, 0}, layers, {0, 0, 0}, extent});
+    }
+    command_buffer_->vkCmdCopyImage(
+        command_buffer_, registration->image->image_,
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, move.destination.image,
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, uint32_t(regions.size()),
+        regions.data());
+  }
+
+  // Make the copied data available to everything that comes after.
+  VkMemoryBarrier after_barrier{
+      VK_STRUCTURE_TYPE_MEMORY_BARRIER, nullptr, VK_ACCESS_TRANSFER_WRITE_BIT,
+      VulkanApplication::kAllReadBits | VulkanApplication::kAllWriteBits};
+  command_buffer_->vkCmdPipelineBarrier(
+      command_buffer_, VK_PIPELINE_STAGE_TRANSFER_BIT,
+      VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &after_barrier, 0, nullptr,
+      uint32_t(after.size()), after.empty() ? nullptr : after.data());
+
+  command_buffer_->vkEndCommandBuffer(command_buffer_);
+}
+
+void ArenaDefragmenter::FinishMoves(VkQueue* queue) {
+  for (auto& move : moves_) {
+    Registration* registration = FindRegistration(move.resource);
+    Placement& placement = move.destination;
+    // After swapping, placement holds the old resource and memory.
+    if (registration->buffer) {
+      VulkanApplication::Buffer* buffer = registration->buffer;
+      std::swap(buffer->buffer_, placement.buffer);
+      std::swap(buffer->token_, placement.token);
+      std::swap(buffer->memory_, placement.memory);
+      std::swap(buffer->offset_, placement.offset);
+      std::swap(buffer->base_address_, placement.base_address);
+    } else {
+      VulkanApplication::Image* image = registration->image;
+      std::swap(image->image_, placement.image);
+      std::swap(image->token_, placement.token);
+    }
+    graveyard_.push_back(std::move(placement));
+    if (registration->callback) {
+      registration->callback(registration->user_data);
+    }
+  }
+  moves_.clear();
+  // Anything submitted after this point uses the new resources, so
+  // once this fence has signaled the old ones can be destroyed.
+  LOG_ASSERT(==, application_->GetLogger(), VK_SUCCESS,
+             (*queue)->vkQueueSubmit(*queue, 0, nullptr, retire_fence_));
+}
+
+void ArenaDefragmenter::ReleasePlacements(
+    containers::vector<Placement>* placements) {
+  for (auto& placement : *placements) {
+    placement.heap->FreeMemory(placement.token);
+  }
+  // This destroys the buffers and images.
+  placements->clear();
+}
+
+}  // namespace vulkan
@@ -0,0 +1,160 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_HELPERS_ARENA_DEFRAGMENTER_H_
+#define VULKAN_HELPERS_ARENA_DEFRAGMENTER_H_
+
+#include "support/containers/allocator.h"
+#include "support/containers/flat_hash_map.h"
+#include "support/containers/vector.h"
+#include "vulkan_helpers/tlsf_allocator.h"
+#include "vulkan_helpers/vulkan_application.h"
+#include "vulkan_wrapper/command_buffer_wrapper.h"
+#include "vulkan_wrapper/queue_wrapper.h"
+#include "vulkan_wrapper/sub_objects.h"
+
+namespace vulkan {
+
+// ArenaDefragmenter compacts the memory behind registered Buffers and Images,
+// a little at a time. Each batch picks the allocations that are furthest
+// back in their arena, creates a new resource in free space nearer the
+// front, and copies the contents across on the device. Once the copy has
+// completed, the Buffer or Image is updated in place to use the new
+// resource, and its owner is told through the RelocationCallback. The old
+// resource and its memory are released once all of the work that was
+// submitted before the update has completed. Chunks that end up empty are
+// returned to the device by VulkanApplication::ReleaseIdleMemory.
+//
+// A resource must not be written, by the host or the device, from the Step
+// that starts moving it until its callback has run, since those writes would
+// not be copied. The buffer's base_address() changes with the move.
+// In the callback, the owner must recreate anything that refers to the old
+// handle, such as views, descriptor sets and recorded command buffers.
+class ArenaDefragmenter {
+ public:
+  typedef void (*RelocationCallback)(void* user_data);
+
+  // Each batch copies at most bytes_per_step bytes, unless a single
+  // allocation is larger than that, in which case it is moved on its own.
+  ArenaDefragmenter(containers::Allocator* allocator,
+                    VulkanApplication* application,
+                    ::VkDeviceSize bytes_per_step);
+  ~ArenaDefragmenter();
+
+  // Allows buffer to be moved. create_info must be the one that buffer was
+  // created with, and must allow the buffer to be used as both a transfer
+  // source and a transfer destination. Buffers that were allocated from a
+  // SlabPool are never moved.
+  void RegisterBuffer(VulkanApplication::Buffer* buffer,
+                      const VkBufferCreateInfo& create_info,
+                      RelocationCallback callback, void* user_data);
+  // Allows image to be moved. create_info must be the one that image was
+  // created with, and must allow the image to be used as both a transfer
+  // source and a transfer destination. The image must be in layout
+  // whenever Step is called, and will be left in that layout.
+  void RegisterImage(VulkanApplication::Image* image,
+                     const VkImageCreateInfo& create_info, VkImageLayout layout,
+                     VkImageAspectFlags aspect, RelocationCallback callback,
+                     void* user_data);
+
+  // These must be called before a registered resource is destroyed. If the
+  // resource is being moved, they wait for the copy to complete.
+  void UnregisterBuffer(VulkanApplication::Buffer* buffer);
+  void UnregisterImage(VulkanApplication::Image* image);
+
+  // Makes progress on defragmentation. Any copies are submitted to queue,
+  // which should be the queue that the registered resources are used on.
+  // This is expected to be called once per frame, after the work for
+  // the frame has been submitted.
+  void Step(VkQueue* queue);
+
+  // Returns true if there are no moves in flight.
+  bool idle() const { return moves_.empty() && graveyard_.empty(); }
+
+ private:
+  struct Registration {
+    // Exactly one of buffer and image is set.
+    VulkanApplication::Buffer* buffer;
+    VulkanApplication::Image* image;
+    VkBufferCreateInfo buffer_info;
+    VkImageCreateInfo image_info;
+    VkImageLayout layout;
+    VkImageAspectFlags aspect;
+    RelocationCallback callback;
+    void* user_data;
+  };
+
+  // A resource, and the memory that it is bound to.
+  struct Placement {
+    explicit Placement(VkDevice* device)
+        : buffer(VK_NULL_HANDLE, device->allocation_callbacks(), device),
+          image(VK_NULL_HANDLE, device->allocation_callbacks(), device),
+          heap(nullptr),
+          token(nullptr),
+          memory(VK_NULL_HANDLE),
+          offset(0),
+          base_address(nullptr) {}
+    VkBuffer buffer;
+    VkImage image;
+    VulkanArena* heap;
+    AllocationToken* token;
+    ::VkDeviceMemory memory;
+    ::VkDeviceSize offset;
+    char* base_address;
+  };
+
+  struct Move {
+    // The Buffer or Image being moved.
+    const void* resource;
+    // Where it is being moved to.
+    Placement destination;
+  };
+
+  // Returns the registration for the given Buffer or Image, or nullptr.
+  Registration* FindRegistration(const void* resource);
+  void Unregister(const void* resource);
+
+  // Picks the allocations to move, and submits the copies to queue.
+  void StartMoves(VkQueue* queue);
+  // Creates a resource for registration lower in its arena, and fills
+  // *placement with it. Returns false if there is no space.
+  bool PlaceLower(const Registration& registration, Placement* placement);
+  // Records the copies for moves_ into command_buffer_.
+  void RecordCopies();
+  // Updates every moved resource to use its new placement, and moves the
+  // old placements into the graveyard.
+  void FinishMoves(VkQueue* queue);
+
+  // Frees the memory for the placements, and destroys their resources.
+  void ReleasePlacements(containers::vector<Placement>* placements);
+
+  containers::Allocator* allocator_;
+  VulkanApplication* application_;
+  ::VkDeviceSize bytes_per_step_;
+  // The registrations, keyed by their Buffer or Image.
+  containers::flat_hash_map<const void*, Registration> registrations_;
+  // The moves whose copies are in flight. These are waiting on copy_fence_.
+  containers::vector<Move> moves_;
+  // Old placements that may still be in use by previously submitted work.
+  // These are waiting on retire_fence_.
+  containers::vector<Placement> graveyard_;
+  VkCommandBuffer command_buffer_;
+  VkFence copy_fence_;
+  VkFence retire_fence_;
+};
+
+}  // namespace vulkan
+
+#endif  // VULKAN_HELPERS_ARENA_DEFRAGMENTER_H_
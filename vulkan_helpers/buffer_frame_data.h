@@ -39,10 +39,9 @@ class BufferFrameData {
  public:
   // |buffered_data_count| is the number of buffered frames the uniform data
   // should produce. Typcially this is one per swapchain image. |usage| is the
-  // VkBufferUsageFlags used for the underlying VkBuffer(s) that stores the
-  // uniform data. Note that VK_BUFFER_USAGE_TRANSFER_DST_BIT will be added
-  // along with |usage| to guarantee data can be copied to the underlying
-  // VkBuffer(s).
+  // VkBufferUsageFlags that the uniform data will be used with. The data is
+  // stored in a slice of the application's shared device buffers, which
+  // must support |usage|.
   BufferFrameData(VulkanApplication* application, size_t buffered_data_count,
                   VkBufferUsageFlags usage)
       : application_(application),
@@ -52,19 +51,15 @@ class BufferFrameData {
     const size_t aligned_data_size =
         RoundUp(sizeof(set_value_), kMaxOffsetAlignment);
 
-    VkBufferCreateInfo create_info = {
-        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,      // sType
-        nullptr,                                   // pNext
-        0,                                         // flags
-        aligned_data_size * buffered_data_count,   // size
-        VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage,  // usage
-        VK_SHARING_MODE_EXCLUSIVE,
-        0,
-        nullptr};
-    buffer_ = application_->CreateAndBindDeviceBuffer(&create_info);
-
-    create_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    host_buffer_ = application_->CreateAndBindHostBuffer(&create_info);
+    buffer_ = application_->CreateDeviceBufferSlice(
+        aligned_data_size * buffered_data_count,
+        usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    // The staging copy is rewritten whenever the data changes, and is
+    // copied by its own submit, so it lives in host-coherent memory rather
+    // than needing a flush before every one of those submits.
+    host_buffer_ = application_->CreateCoherentBufferSlice(
+        aligned_data_size * buffered_data_count,
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
 
     VkCommandBufferBeginInfo begin_info = {
         VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,  // sType
@@ -85,18 +80,20 @@ class BufferFrameData {
           VK_ACCESS_TRANSFER_READ_BIT,              // dstAccessMask
           VK_QUEUE_FAMILY_IGNORED,                  // srcQueueFamilyIndex
           VK_QUEUE_FAMILY_IGNORED,                  // dstQueueFamilyIndex
-          *host_buffer_,
-          aligned_data_size * i,
+          host_buffer_->buffer(),
+          host_buffer_->offset() + aligned_data_size * i,
           size()};
 
       update_commands_.back()->vkCmdPipelineBarrier(
           update_commands_.back(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
           VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &barrier, 0,
           nullptr);
-      VkBufferCopy region{aligned_data_size * i, aligned_data_size * i, size()};
+      VkBufferCopy region{host_buffer_->offset() + aligned_data_size * i,
+                          buffer_->offset() + aligned_data_size * i, size()};
 
-      update_commands_.back()->vkCmdCopyBuffer(
-          update_commands_.back(), *host_buffer_, *buffer_, 1, &region);
+      update_commands_.back()->vkCmdCopyBuffer(update_commands_.back(),
+                                               host_buffer_->buffer(),
+                                               buffer_->buffer(), 1, &region);
 
       barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
       barrier.dstAccessMask = VK_ACCESS_UNIFORM_READ_BIT;
@@ -114,7 +111,7 @@ class BufferFrameData {
   // Enqueues an update operation on the queue if needed, to ensure
   // that the buffer is correct for the given index.
   void UpdateBuffer(VkQueue* update_queue, size_t buffer_index) {
-    const size_t offset = get_offset_for_frame(buffer_index);
+    const size_t offset = aligned_data_size() * buffer_index;
     bool equal =
         memcmp(&set_value_, host_buffer_->base_address() + offset, size()) == 0;
     if (!equal || uninitialized_[buffer_index]) {
@@ -122,7 +119,6 @@ class BufferFrameData {
       // the buffer, then copy the data into the buffer and update it.
       uninitialized_[buffer_index] = false;
       memcpy(host_buffer_->base_address() + offset, &set_value_, size());
-      host_buffer_->flush(offset, aligned_data_size());
       VkSubmitInfo init_submit_info{
           VK_STRUCTURE_TYPE_SUBMIT_INFO,  // sType
           nullptr,                        // pNext
@@ -140,10 +136,10 @@ class BufferFrameData {
   }
 
   // Returns the Uniform buffer backing the uniform data.
-  ::VkBuffer get_buffer() const { return *buffer_; }
+  ::VkBuffer get_buffer() const { return buffer_->buffer(); }
   // Returns the offset in the buffer for each frame.
   size_t get_offset_for_frame(size_t buffer_index) const {
-    return aligned_data_size() * buffer_index;
+    return buffer_->offset() + aligned_data_size() * buffer_index;
   }
   // Returns the size of the data used for each frame.
   size_t size() const { return sizeof(set_value_); }
@@ -159,10 +155,10 @@ class BufferFrameData {
   // This is the actual host piece of data that can be updated by the user.
   T set_value_;
   // This is the gpu-side buffer that contains the uniforms.
-  containers::unique_ptr<VulkanApplication::Buffer> buffer_;
+  BufferSlicePointer buffer_;
   // This is the host-side buffer that contains the data that can be copied to
   // the uniforms.
-  containers::unique_ptr<VulkanApplication::Buffer> host_buffer_;
+  BufferSlicePointer host_buffer_;
   // These command-buffers contain the command needed to update the
   // device-buffer from the host buffer.
   containers::vector<VkCommandBuffer> update_commands_;
@@ -96,9 +96,9 @@ VkInstance CreateDefaultInstance(containers::Allocator* allocator,
   return vulkan::VkInstance(allocator, raw_instance, nullptr, wrapper);
 }
 
-VkInstance CreateInstanceForApplication(containers::Allocator* allocator,
-                                        LibraryWrapper* wrapper,
-                                        const entry::entry_data* data) {
+VkInstance CreateInstanceForApplication(
+    containers::Allocator* allocator, LibraryWrapper* wrapper,
+    const entry::entry_data* data, VkAllocationCallbacks* callbacks) {
   // Similar to CreateDefaultInstance, but turns on the virtual swapchain
   // if the requested by entry_data.
 
@@ -141,10 +141,10 @@ VkInstance CreateInstanceForApplication(containers::Allocator* allocator,
 
   ::VkInstance raw_instance;
   LOG_ASSERT(==, wrapper->GetLogger(),
-             wrapper->vkCreateInstance(&info, nullptr, &raw_instance),
+             wrapper->vkCreateInstance(&info, callbacks, &raw_instance),
              VK_SUCCESS);
   // vulkan::VkInstance will handle destroying the instance
-  return vulkan::VkInstance(allocator, raw_instance, nullptr, wrapper);
+  return vulkan::VkInstance(allocator, raw_instance, callbacks, wrapper);
 }
 
 containers::vector<VkPhysicalDevice> GetPhysicalDevices(
@@ -366,7 +366,7 @@ VkDevice CreateDeviceForSwapchain(
     const std::initializer_list<const char*> extensions,
     const VkPhysicalDeviceFeatures& features,
     bool try_to_find_separate_present_queue,
-    uint32_t* async_compute_queue_index) {
+    uint32_t* async_compute_queue_index, VkAllocationCallbacks* callbacks) {
   containers::vector<VkPhysicalDevice> physical_devices =
       GetPhysicalDevices(allocator, *instance);
   float priority = 1.f;
@@ -505,7 +505,7 @@ VkDevice CreateDeviceForSwapchain(
 
     ::VkDevice raw_device;
     LOG_ASSERT(==, instance->GetLogger(),
-               (*instance)->vkCreateDevice(physical_device, &info, nullptr,
+               (*instance)->vkCreateDevice(physical_device, &info, callbacks,
                                            &raw_device),
                VK_SUCCESS);
 
@@ -516,7 +516,7 @@ VkDevice CreateDeviceForSwapchain(
 
     *present_queue_index = present_queue_family_index;
     *graphics_queue_index = graphics_queue_family_index;
-    return vulkan::VkDevice(allocator, raw_device, nullptr, instance,
+    return vulkan::VkDevice(allocator, raw_device, callbacks, instance,
                             &physical_device_properties, physical_device);
   }
   instance->GetLogger()->LogError(
@@ -538,42 +538,44 @@ VkCommandPool CreateDefaultCommandPool(containers::Allocator* allocator,
   };
 
   ::VkCommandPool raw_command_pool = VK_NULL_HANDLE;
+  VkAllocationCallbacks* callbacks = device.allocation_callbacks();
   if (device.is_valid()) {
-    LOG_ASSERT(
-        ==, device.GetLogger(),
-        device->vkCreateCommandPool(device, &info, nullptr, &raw_command_pool),
-        VK_SUCCESS);
+    LOG_ASSERT(==, device.GetLogger(),
+               device->vkCreateCommandPool(device, &info, callbacks,
+                                           &raw_command_pool),
+               VK_SUCCESS);
   }
-  return vulkan::VkCommandPool(raw_command_pool, nullptr, &device);
+  return vulkan::VkCommandPool(raw_command_pool, callbacks, &device);
 }
 
 VkSurfaceKHR CreateDefaultSurface(VkInstance* instance,
                                   const entry::entry_data* data) {
   ::VkSurfaceKHR surface;
+  VkAllocationCallbacks* callbacks = instance->allocation_callbacks();
 #if defined __ANDROID__
   VkAndroidSurfaceCreateInfoKHR create_info{
       VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR, 0, 0,
       data->native_window_handle};
 
-  (*instance)->vkCreateAndroidSurfaceKHR(*instance, &create_info, nullptr,
+  (*instance)->vkCreateAndroidSurfaceKHR(*instance, &create_info, callbacks,
                                          &surface);
 #elif defined __linux__
   VkXcbSurfaceCreateInfoKHR create_info{
       VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR, 0, 0,
       data->native_connection, data->native_window_handle};
 
-  (*instance)->vkCreateXcbSurfaceKHR(*instance, &create_info, nullptr,
+  (*instance)->vkCreateXcbSurfaceKHR(*instance, &create_info, callbacks,
                                      &surface);
 #elif defined _WIN32
   VkWin32SurfaceCreateInfoKHR create_info{
       VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR, 0, 0,
       data->native_hinstance, data->native_window_handle};
 
-  (*instance)->vkCreateWin32SurfaceKHR(*instance, &create_info, nullptr,
+  (*instance)->vkCreateWin32SurfaceKHR(*instance, &create_info, callbacks,
                                        &surface);
 #endif
 
-  return VkSurfaceKHR(surface, nullptr, instance);
+  return VkSurfaceKHR(surface, callbacks, instance);
 }
 
 VkCommandBuffer CreateDefaultCommandBuffer(VkCommandPool* pool,
@@ -692,12 +694,14 @@ VkSwapchainKHR CreateDefaultSwapchain(VkInstance* instance, VkDevice* device,
 
     LOG_ASSERT(==, instance->GetLogger(),
                (*device)->vkCreateSwapchainKHR(*device, &swapchainCreateInfo,
-                                               nullptr, &swapchain),
+                                               device->allocation_callbacks(),
+                                               &swapchain),
                VK_SUCCESS);
   }
 
-  return VkSwapchainKHR(swapchain, nullptr, device, image_extent.width,
-                        image_extent.height, 1u, surface_formats[0].format);
+  return VkSwapchainKHR(swapchain, device->allocation_callbacks(), device,
+                        image_extent.width, image_extent.height, 1u,
+                        surface_formats[0].format);
 }
 
 VkImage CreateDefault2DColorImage(VkDevice* device, uint32_t width,
@@ -725,10 +729,11 @@ VkImage CreateDefault2DColorImage(VkDevice* device, uint32_t width,
       /* initialLayout = */ VK_IMAGE_LAYOUT_UNDEFINED,
   };
   ::VkImage raw_image;
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(==, device->GetLogger(),
-             (*device)->vkCreateImage(*device, &info, nullptr, &raw_image),
+             (*device)->vkCreateImage(*device, &info, callbacks, &raw_image),
              VK_SUCCESS);
-  return vulkan::VkImage(raw_image, nullptr, device);
+  return vulkan::VkImage(raw_image, callbacks, device);
 }
 
 VkSampler CreateDefaultSampler(VkDevice* device) {
@@ -753,10 +758,12 @@ VkSampler CreateDefaultSampler(VkDevice* device) {
       /* unnormalizedCoordinates = */ false,
   };
   ::VkSampler raw_sampler;
-  LOG_ASSERT(==, device->GetLogger(),
-             (*device)->vkCreateSampler(*device, &info, nullptr, &raw_sampler),
-             VK_SUCCESS);
-  return vulkan::VkSampler(raw_sampler, nullptr, device);
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
+  LOG_ASSERT(
+      ==, device->GetLogger(),
+      (*device)->vkCreateSampler(*device, &info, callbacks, &raw_sampler),
+      VK_SUCCESS);
+  return vulkan::VkSampler(raw_sampler, callbacks, device);
 }
 
 VkSampler CreateSampler(VkDevice* device, VkFilter minFilter,
@@ -782,10 +789,12 @@ VkSampler CreateSampler(VkDevice* device, VkFilter minFilter,
       /* unnormalizedCoordinates = */ false,
   };
   ::VkSampler raw_sampler;
-  LOG_ASSERT(==, device->GetLogger(),
-             (*device)->vkCreateSampler(*device, &info, nullptr, &raw_sampler),
-             VK_SUCCESS);
-  return vulkan::VkSampler(raw_sampler, nullptr, device);
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
+  LOG_ASSERT(
+      ==, device->GetLogger(),
+      (*device)->vkCreateSampler(*device, &info, callbacks, &raw_sampler),
+      VK_SUCCESS);
+  return vulkan::VkSampler(raw_sampler, callbacks, device);
 }
 
 VkDescriptorSetLayout CreateDescriptorSetLayout(
@@ -805,11 +814,12 @@ VkDescriptorSetLayout CreateDescriptorSetLayout(
       contiguous_bindings.data()};
 
   ::VkDescriptorSetLayout layout;
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(
       ==, device->GetLogger(), VK_SUCCESS,
       (*device)->vkCreateDescriptorSetLayout(
-          *device, &descriptor_set_layout_create_info, nullptr, &layout));
-  return VkDescriptorSetLayout(layout, nullptr, device);
+          *device, &descriptor_set_layout_create_info, callbacks, &layout));
+  return VkDescriptorSetLayout(layout, callbacks, device);
 }
 
 // Creates a default pipeline cache, it does not load anything from disk.
@@ -823,23 +833,25 @@ VkPipelineCache CreateDefaultPipelineCache(VkDevice* device) {
       0,                                             // initialDataSize
       nullptr                                        // pInitialData
   };
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   if (device->is_valid()) {
     LOG_ASSERT(==, device->GetLogger(), VK_SUCCESS,
-               (*device)->vkCreatePipelineCache(*device, &create_info, nullptr,
-                                                &cache));
+               (*device)->vkCreatePipelineCache(*device, &create_info,
+                                                callbacks, &cache));
   }
-  return VkPipelineCache(cache, nullptr, device);
+  return VkPipelineCache(cache, callbacks, device);
 }
 
 VkQueryPool CreateQueryPool(VkDevice* device,
                             const VkQueryPoolCreateInfo& create_info) {
   ::VkQueryPool query_pool = VK_NULL_HANDLE;
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   if (device->is_valid()) {
     LOG_ASSERT(==, device->GetLogger(), VK_SUCCESS,
-               (*device)->vkCreateQueryPool(*device, &create_info, nullptr,
+               (*device)->vkCreateQueryPool(*device, &create_info, callbacks,
                                             &query_pool));
   }
-  return VkQueryPool(query_pool, nullptr, device);
+  return VkQueryPool(query_pool, callbacks, device);
 }
 
 VkDescriptorPool CreateDescriptorPool(VkDevice* device, uint32_t num_pool_size,
@@ -854,11 +866,12 @@ VkDescriptorPool CreateDescriptorPool(VkDevice* device, uint32_t num_pool_size,
       /* pPoolSizes = */ pool_sizes};
 
   ::VkDescriptorPool raw_pool;
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(
       ==, device->GetLogger(),
-      (*device)->vkCreateDescriptorPool(*device, &info, nullptr, &raw_pool),
+      (*device)->vkCreateDescriptorPool(*device, &info, callbacks, &raw_pool),
       VK_SUCCESS);
-  return vulkan::VkDescriptorPool(raw_pool, nullptr, device);
+  return vulkan::VkDescriptorPool(raw_pool, callbacks, device);
 }
 
 VkDescriptorSetLayout CreateDescriptorSetLayout(VkDevice* device,
@@ -880,11 +893,12 @@ VkDescriptorSetLayout CreateDescriptorSetLayout(VkDevice* device,
   };
 
   ::VkDescriptorSetLayout raw_layout;
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(==, device->GetLogger(),
-             (*device)->vkCreateDescriptorSetLayout(*device, &info, nullptr,
+             (*device)->vkCreateDescriptorSetLayout(*device, &info, callbacks,
                                                     &raw_layout),
              VK_SUCCESS);
-  return vulkan::VkDescriptorSetLayout(raw_layout, nullptr, device);
+  return vulkan::VkDescriptorSetLayout(raw_layout, callbacks, device);
 }
 
 VkDescriptorSet AllocateDescriptorSet(VkDevice* device, ::VkDescriptorPool pool,
@@ -914,11 +928,123 @@ VkDeviceMemory AllocateDeviceMemory(VkDevice* device,
       /* memoryTypeIndex = */ memory_type_index,
   };
   ::VkDeviceMemory raw_memory;
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(
       ==, device->GetLogger(),
-      (*device)->vkAllocateMemory(*device, &alloc_info, nullptr, &raw_memory),
+      (*device)->vkAllocateMemory(*device, &alloc_info, callbacks, &raw_memory),
       VK_SUCCESS);
-  return vulkan::VkDeviceMemory(raw_memory, nullptr, device);
+  return vulkan::VkDeviceMemory(raw_memory, callbacks, device);
+}
+
+namespace {
+// Returns the number of flags that are set in both a and b.
+uint32_t CountCommonFlags(VkMemoryPropertyFlags a, VkMemoryPropertyFlags b) {
+  uint32_t count = 0;
+  for (VkMemoryPropertyFlags common = a & b; common; common &= common - 1) {
+    ++count;
+  }
+  return count;
+}
+
+// Without VK_EXT_memory_budget there is no way to know how much of a heap
+// is actually available to us, so a single allocation is only considered
+// to fit in a heap if it takes at most this fraction of it.
+const ::VkDeviceSize kHeapBudgetDivisor = 4;
+}  // namespace
+
+uint32_t GetMemoryIndexForUsage(VkDevice* device, logging::Logger* log,
+                                uint32_t required_index_bits,
+                                MemoryUsage usage,
+                                ::VkDeviceSize allocation_size,
+                                VkMemoryPropertyFlags required_property_flags) {
+  const VkPhysicalDeviceMemoryProperties& properties =
+      device->physical_device_memory_properties();
+  LOG_ASSERT(<=, log, properties.memoryTypeCount, uint32_t(32));
+
+  VkMemoryPropertyFlags required = required_property_flags;
+  // Flags in primary matter more than flags in secondary.
+  VkMemoryPropertyFlags primary = 0;
+  VkMemoryPropertyFlags secondary = 0;
+  // Lazily allocated memory is only useful for transient attachments.
+  VkMemoryPropertyFlags avoided = VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+  switch (usage) {
+    case MemoryUsage::kGpuOnly:
+      primary = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+      // Leave host-visible memory for the resources that need it.
+      avoided |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+      break;
+    case MemoryUsage::kUpload:
+      required |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+      secondary = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+      // Uncached memory is write-combined, which is what we want for data
+      // that the host never reads. Device-local host-visible memory is
+      // usually small, so it is left for kDynamic.
+      avoided |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT |
+                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+      break;
+    case MemoryUsage::kReadback:
+      required |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+      // Host reads from uncached memory are very slow.
+      primary = VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+      secondary = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+      break;
+    case MemoryUsage::kDynamic:
+      required |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+      // The device reads this memory every frame, so it should not have to
+      // go across the bus to do so.
+      primary = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+      secondary = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+      avoided |= VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+      break;
+    case MemoryUsage::kTransientAttachment:
+      // If there is no lazily allocated memory, this is the same as
+      // kGpuOnly.
+      primary = VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT |
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+      avoided = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+      break;
+  }
+
+  uint32_t best_index = properties.memoryTypeCount;
+  bool best_fits = false;
+  int32_t best_score = 0;
+  ::VkDeviceSize best_heap_size = 0;
+  for (uint32_t i = 0; i < properties.memoryTypeCount; ++i) {
+    if (!(required_index_bits & (1 << i))) {
+      continue;
+    }
+    const VkMemoryPropertyFlags flags = properties.memoryTypes[i].propertyFlags;
+    if ((flags & required) != required) {
+      continue;
+    }
+    const ::VkDeviceSize heap_size =
+        properties.memoryHeaps[properties.memoryTypes[i].heapIndex].size;
+    const bool fits = allocation_size <= heap_size / kHeapBudgetDivisor;
+    const int32_t score =
+        4 * int32_t(CountCommonFlags(flags, primary)) +
+        int32_t(CountCommonFlags(flags, secondary)) -
+        2 * int32_t(CountCommonFlags(flags, avoided));
+    // Ties go to the lowest index, which is what GetMemoryIndex would pick.
+    if (best_index != properties.memoryTypeCount) {
+      if (fits != best_fits) {
+        if (!fits) {
+          continue;
+        }
+      } else if (score != best_score) {
+        if (score < best_score) {
+          continue;
+        }
+      } else if (heap_size <= best_heap_size) {
+        continue;
+      }
+    }
+    best_index = i;
+    best_fits = fits;
+    best_score = score;
+    best_heap_size = heap_size;
+  }
+  LOG_ASSERT(!=, log, best_index, properties.memoryTypeCount);
+  return best_index;
 }
 
 void RecordImageLayoutTransition(
@@ -986,6 +1112,9 @@ std::tuple<uint32_t, uint32_t, uint32_t> GetElementAndTexelBlockSize(
       return std::make_tuple(16, 4, 4);
     case VK_FORMAT_R16G16B16A16_SFLOAT:
       return std::make_tuple(8, 1, 1);
+    case VK_FORMAT_R32G32B32_SFLOAT:
+    case VK_FORMAT_R32G32B32_UINT:
+      return std::make_tuple(12, 1, 1);
     case VK_FORMAT_R32G32B32A32_SFLOAT:
     case VK_FORMAT_R32G32B32A32_UINT:
       return std::make_tuple(16, 1, 1);
@@ -1007,4 +1136,17 @@ size_t GetImageExtentSizeInBytes(const VkExtent3D& extent, VkFormat format) {
   size_t h = size_t(RoundUpTo(extent.height, tb_height_size));
   return w * h * element_size;
 }
+
+::VkDeviceSize GetBufferImageCopyOffsetAlignment(VkFormat format) {
+  const ::VkDeviceSize element_size =
+      std::get<0>(GetElementAndTexelBlockSize(format));
+  if (element_size == 0) {
+    return 4;
+  }
+  ::VkDeviceSize alignment = element_size;
+  while (alignment % 4 != 0) {
+    alignment += element_size;
+  }
+  return alignment;
+}
 }  // namespace vulkan
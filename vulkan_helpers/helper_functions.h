@@ -16,9 +16,14 @@
 #ifndef VULKAN_HELPERS_HELPER_FUNCTIONS_H_
 #define VULKAN_HELPERS_HELPER_FUNCTIONS_H_
 
+#include <cstdint>
 #include <cstring>
 #include <tuple>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 #include "support/containers/vector.h"
 #include "support/entry/entry.h"
 #include "vulkan_wrapper/command_buffer_wrapper.h"
@@ -38,6 +43,41 @@ void MemoryClear(T* val) {
   ::memset(val, 0x00, sizeof(T));
 }
 
+// Returns the index of the highest set bit in value. value must not be 0.
+inline uint32_t HighestSetBit(uint64_t value) {
+#if defined(__GNUC__)
+  return 63 - __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+  unsigned long index;
+  _BitScanReverse64(&index, value);
+  return index;
+#else
+  uint32_t index = 0;
+  while (value >>= 1) {
+    ++index;
+  }
+  return index;
+#endif
+}
+
+// Returns the index of the lowest set bit in value. value must not be 0.
+inline uint32_t LowestSetBit(uint64_t value) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+  unsigned long index;
+  _BitScanForward64(&index, value);
+  return index;
+#else
+  uint32_t index = 0;
+  while (!(value & 1)) {
+    value >>= 1;
+    ++index;
+  }
+  return index;
+#endif
+}
+
 // Create an empty instance. Vulkan functions that are resolved by the created
 // instance will be stored in the space allocated by the given |allocator|. The
 // |allocator| must continue to exist until the instance is destroied.
@@ -53,10 +93,11 @@ VkInstance CreateDefaultInstance(containers::Allocator* allocator,
 
 // Creates an instance with either a real or virtual swapchain based on
 // whether or not data requests an external swapchain. Otherwise
-// identical to CreateDefaultInstance.
-VkInstance CreateInstanceForApplication(containers::Allocator* allocator,
-                                        LibraryWrapper* wrapper,
-                                        const entry::entry_data* data);
+// identical to CreateDefaultInstance. If callbacks is not nullptr, the
+// instance is created with them.
+VkInstance CreateInstanceForApplication(
+    containers::Allocator* allocator, LibraryWrapper* wrapper,
+    const entry::entry_data* data, VkAllocationCallbacks* callbacks = nullptr);
 
 containers::vector<VkPhysicalDevice> GetPhysicalDevices(
     containers::Allocator* allocator, VkInstance& instance);
@@ -112,6 +153,8 @@ VkSurfaceKHR CreateDefaultSurface(VkInstance* instance,
 // async_compute_queue_index with the queue family of the compute queue.
 // If no async compute queue could be created, *async_compute_queue_index
 // will be 0xFFFFFFFF
+// If callbacks is not nullptr, the device is created with them, and objects
+// created from the device by these helpers will use them too.
 // Note: They may be the same or different.
 VkDevice CreateDeviceForSwapchain(
     containers::Allocator* allocator, VkInstance* instance,
@@ -120,7 +163,8 @@ VkDevice CreateDeviceForSwapchain(
     const std::initializer_list<const char*> extensions = {},
     const VkPhysicalDeviceFeatures& features = {0},
     bool try_to_find_separate_present_queue = false,
-    uint32_t* aync_compute_queue_index = nullptr);
+    uint32_t* aync_compute_queue_index = nullptr,
+    VkAllocationCallbacks* callbacks = nullptr);
 
 // Creates a primary level default command buffer from the given command pool
 // and the device.
@@ -205,10 +249,11 @@ VkShaderModule CreateShaderModule(VkDevice* device,
       /* pCode = */ words,
   };
   ::VkShaderModule raw_shader_module;
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(==, device->GetLogger(), VK_SUCCESS,
-             (*device)->vkCreateShaderModule(*device, &create_info, nullptr,
+             (*device)->vkCreateShaderModule(*device, &create_info, callbacks,
                                              &raw_shader_module));
-  return VkShaderModule(raw_shader_module, nullptr, device);
+  return VkShaderModule(raw_shader_module, callbacks, device);
 }
 
 // Returns the "index" queue from the given queue_family.
@@ -254,6 +299,34 @@ uint32_t inline GetMemoryIndex(VkDevice* device, logging::Logger* log,
   return memory_index;
 }
 
+// How the host and the device are going to access a piece of memory.
+enum class MemoryUsage {
+  // Only ever accessed by the device.
+  kGpuOnly,
+  // Written by the host, and read by the device once or a few times,
+  // such as staging data for transfers.
+  kUpload,
+  // Written by the device, and read by the host.
+  kReadback,
+  // Rewritten by the host every frame, and read by the device in place.
+  kDynamic,
+  // Only ever accessed by the device, inside a render pass, so it may never
+  // need to be backed by real memory.
+  kTransientAttachment,
+};
+
+// Given a bitmask of required_index_bits, returns the memory index from the
+// given device that is best suited to usage, among the ones that support
+// required_property_flags. Memory types whose heap cannot comfortably hold
+// allocations of allocation_size are only picked if there is nothing else.
+// Otherwise memory types are ranked by how well their property flags suit
+// usage, and then by the size of their heap.
+// Will assert if no memory type can be used.
+uint32_t GetMemoryIndexForUsage(
+    VkDevice* device, logging::Logger* log, uint32_t required_index_bits,
+    MemoryUsage usage, ::VkDeviceSize allocation_size,
+    VkMemoryPropertyFlags required_property_flags = 0);
+
 // Records a pipeline barrier to the given command buffer |cmd_buf| to change
 // the layout of the given |image| with the specified |subresource_range| from
 // |old_layout| with access mask |src_access_mask| to |new_layout| with access
@@ -277,10 +350,11 @@ inline VkFence CreateFence(VkDevice* device, bool signaled = false) {
       nullptr,                                                         // pNext
       signaled ? VkFenceCreateFlags(VK_FENCE_CREATE_SIGNALED_BIT) : 0  // flags
   };
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(
       ==, device->GetLogger(), VK_SUCCESS,
-      (*device)->vkCreateFence(*device, &create_info, nullptr, &raw_fence));
-  return VkFence(raw_fence, nullptr, device);
+      (*device)->vkCreateFence(*device, &create_info, callbacks, &raw_fence));
+  return VkFence(raw_fence, callbacks, device);
 }
 
 inline VkSemaphore CreateSemaphore(VkDevice* device) {
@@ -290,10 +364,11 @@ inline VkSemaphore CreateSemaphore(VkDevice* device) {
       nullptr,                                  // pNext
       0,                                        // flags
   };
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(==, device->GetLogger(), VK_SUCCESS,
-             (*device)->vkCreateSemaphore(*device, &create_info, nullptr,
+             (*device)->vkCreateSemaphore(*device, &create_info, callbacks,
                                           &raw_semaphore));
-  return VkSemaphore(raw_semaphore, nullptr, device);
+  return VkSemaphore(raw_semaphore, callbacks, device);
 }
 
 inline VkEvent CreateEvent(VkDevice* device) {
@@ -303,10 +378,11 @@ inline VkEvent CreateEvent(VkDevice* device) {
       nullptr,                              // pNext
       0,                                    // flags
   };
+  VkAllocationCallbacks* callbacks = device->allocation_callbacks();
   LOG_ASSERT(
       ==, device->GetLogger(), VK_SUCCESS,
-      (*device)->vkCreateEvent(*device, &create_info, nullptr, &raw_event));
-  return VkEvent(raw_event, nullptr, device);
+      (*device)->vkCreateEvent(*device, &create_info, callbacks, &raw_event));
+  return VkEvent(raw_event, callbacks, device);
 }
 
 // Returns the size of the given image extent specified through width, height,
@@ -314,6 +390,11 @@ inline VkEvent CreateEvent(VkDevice* device) {
 // format is not recognized.
 size_t GetImageExtentSizeInBytes(const VkExtent3D& extent, VkFormat format);
 
+// Returns the alignment that the bufferOffset of a VkBufferImageCopy must
+// have for an image of the given format, which is the smallest multiple of
+// both the element size and 4. Returns 4 if the format is not recognized.
+::VkDeviceSize GetBufferImageCopyOffsetAlignment(VkFormat format);
+
 // Returns true if all the request features are supported by the given physical
 // device, otherwise returns false. The supported features are returned from
 // Vulkan command vkGetPhysicalDeviceFeatures, the command is resolved by the
@@ -0,0 +1,154 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_helpers/host_allocation_callbacks.h"
+
+#include <cstring>
+
+namespace vulkan {
+
+namespace {
+// Every allocation is at least this aligned, which also keeps the header in
+// front of it aligned.
+const size_t kMinimumAlignment = 16;
+}  // anonymous namespace
+
+HostAllocationCallbacks::HostAllocationCallbacks(
+    containers::Allocator* allocator) {
+  callbacks_.pUserData = this;
+  callbacks_.pfnAllocation = &AllocateCallback;
+  callbacks_.pfnReallocation = &ReallocateCallback;
+  callbacks_.pfnFree = &FreeCallback;
+  callbacks_.pfnInternalAllocation = &InternalAllocationCallback;
+  callbacks_.pfnInternalFree = &InternalFreeCallback;
+  for (auto& scope : scopes_) {
+    scope.allocator = allocator;
+    scope.allocated_size.store(0);
+    scope.peak_allocated_size.store(0);
+    scope.allocation_count.store(0);
+    scope.internal_size.store(0);
+  }
+}
+
+void HostAllocationCallbacks::GetStatistics(
+    VkSystemAllocationScope scope, ScopeStatistics* statistics) const {
+  const Scope& s = scopes_[scope];
+  statistics->allocated_size = s.allocated_size.load();
+  statistics->peak_allocated_size = s.peak_allocated_size.load();
+  statistics->allocation_count = s.allocation_count.load();
+  statistics->internal_size = s.internal_size.load();
+}
+
+size_t HostAllocationCallbacks::allocated_size() const {
+  size_t total = 0;
+  for (const auto& scope : scopes_) {
+    total += scope.allocated_size.load();
+  }
+  return total;
+}
+
+void* HostAllocationCallbacks::Allocate(size_t size, size_t alignment,
+                                        VkSystemAllocationScope scope) {
+  if (size == 0) {
+    return nullptr;
+  }
+  if (alignment < kMinimumAlignment) {
+    alignment = kMinimumAlignment;
+  }
+  Scope& s = scopes_[scope];
+  const size_t base_size = size + sizeof(Header) + alignment - 1;
+  void* base = s.allocator->malloc(base_size);
+  if (!base) {
+    return nullptr;
+  }
+  const uintptr_t address =
+      (reinterpret_cast<uintptr_t>(base) + sizeof(Header) + alignment - 1) &
+      ~uintptr_t(alignment - 1);
+  Header* header = reinterpret_cast<Header*>(address) - 1;
+  header->allocator = s.allocator;
+  header->base = base;
+  header->base_size = base_size;
+  header->size = size;
+  header->scope = scope;
+
+  const size_t allocated_size = (s.allocated_size += size);
+  size_t peak = s.peak_allocated_size.load();
+  while (allocated_size > peak &&
+         !s.peak_allocated_size.compare_exchange_weak(peak, allocated_size)) {
+  }
+  s.allocation_count += 1;
+  return reinterpret_cast<void*>(address);
+}
+
+void HostAllocationCallbacks::Free(void* memory) {
+  if (!memory) {
+    return;
+  }
+  Header* header = reinterpret_cast<Header*>(memory) - 1;
+  scopes_[header->scope].allocated_size -= header->size;
+  header->allocator->free(header->base, header->base_size);
+}
+
+void* HostAllocationCallbacks::AllocateCallback(
+    void* user_data, size_t size, size_t alignment,
+    VkSystemAllocationScope scope) {
+  return static_cast<HostAllocationCallbacks*>(user_data)->Allocate(
+      size, alignment, scope);
+}
+
+void* HostAllocationCallbacks::ReallocateCallback(
+    void* user_data, void* original, size_t size, size_t alignment,
+    VkSystemAllocationScope scope) {
+  HostAllocationCallbacks* self =
+      static_cast<HostAllocationCallbacks*>(user_data);
+  if (!original) {
+    return self->Allocate(size, alignment, scope);
+  }
+  if (size == 0) {
+    self->Free(original);
+    return nullptr;
+  }
+  // If the new allocation fails, the original must be left untouched.
+  void* memory = self->Allocate(size, alignment, scope);
+  if (!memory) {
+    return nullptr;
+  }
+  const Header* header = reinterpret_cast<const Header*>(original) - 1;
+  memcpy(memory, original, header->size < size ? header->size : size);
+  self->Free(original);
+  return memory;
+}
+
+void HostAllocationCallbacks::FreeCallback(void* user_data, void* memory) {
+  static_cast<HostAllocationCallbacks*>(user_data)->Free(memory);
+}
+
+void HostAllocationCallbacks::InternalAllocationCallback(
+    void* user_data, size_t size, VkInternalAllocationType,
+    VkSystemAllocationScope scope) {
+  static_cast<HostAllocationCallbacks*>(user_data)
+      ->scopes_[scope]
+      .internal_size += size;
+}
+
+void HostAllocationCallbacks::InternalFreeCallback(
+    void* user_data, size_t size, VkInternalAllocationType,
+    VkSystemAllocationScope scope) {
+  static_cast<HostAllocationCallbacks*>(user_data)
+      ->scopes_[scope]
+      .internal_size -= size;
+}
+
+}  // namespace vulkan
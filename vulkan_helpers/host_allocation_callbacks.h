@@ -0,0 +1,116 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_HELPERS_HOST_ALLOCATION_CALLBACKS_H_
+#define VULKAN_HELPERS_HOST_ALLOCATION_CALLBACKS_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "support/containers/allocator.h"
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+
+namespace vulkan {
+
+// HostAllocationCallbacks implements VkAllocationCallbacks on top of a
+// containers::Allocator, so that the host memory that the driver allocates
+// is visible to the same allocator as the rest of the application.
+//
+// The bytes allocated are counted separately for each
+// VkSystemAllocationScope, as are the internal allocations the driver
+// reports through pfnInternalAllocation. Each scope may be given its own
+// allocator, for example a pool for command-scope allocations.
+//
+// This object must outlive every Vulkan object created with its callbacks.
+// The callbacks may be called from any thread.
+class HostAllocationCallbacks {
+ public:
+  struct ScopeStatistics {
+    // The number of bytes currently allocated in this scope.
+    size_t allocated_size;
+    // The largest that allocated_size has been.
+    size_t peak_allocated_size;
+    // The number of allocations ever made in this scope, including
+    // reallocations.
+    uint64_t allocation_count;
+    // The number of bytes the driver has allocated itself in this scope.
+    size_t internal_size;
+  };
+
+  explicit HostAllocationCallbacks(containers::Allocator* allocator);
+
+  // Allocations in the given scope will come from allocator. This must be
+  // called before the callbacks are used.
+  void SetScopeAllocator(VkSystemAllocationScope scope,
+                         containers::Allocator* allocator) {
+    scopes_[scope].allocator = allocator;
+  }
+
+  // Returns the callbacks to pass to Vulkan. The pointer remains valid for
+  // the lifetime of this object.
+  VkAllocationCallbacks* callbacks() { return &callbacks_; }
+
+  // Fills *statistics with the current counters for the given scope.
+  void GetStatistics(VkSystemAllocationScope scope,
+                     ScopeStatistics* statistics) const;
+
+  // Returns the number of bytes currently allocated across every scope,
+  // not including internal allocations.
+  size_t allocated_size() const;
+
+ private:
+  // Stored immediately before every allocation that is returned.
+  struct Header {
+    containers::Allocator* allocator;
+    void* base;
+    size_t base_size;
+    size_t size;
+    VkSystemAllocationScope scope;
+  };
+
+  struct Scope {
+    containers::Allocator* allocator;
+    std::atomic<size_t> allocated_size;
+    std::atomic<size_t> peak_allocated_size;
+    std::atomic<uint64_t> allocation_count;
+    std::atomic<size_t> internal_size;
+  };
+
+  void* Allocate(size_t size, size_t alignment,
+                 VkSystemAllocationScope scope);
+  void Free(void* memory);
+
+  static VKAPI_ATTR void* VKAPI_CALL AllocateCallback(
+      void* user_data, size_t size, size_t alignment,
+      VkSystemAllocationScope scope);
+  static VKAPI_ATTR void* VKAPI_CALL ReallocateCallback(
+      void* user_data, void* original, size_t size, size_t alignment,
+      VkSystemAllocationScope scope);
+  static VKAPI_ATTR void VKAPI_CALL FreeCallback(void* user_data,
+                                                 void* memory);
+  static VKAPI_ATTR void VKAPI_CALL InternalAllocationCallback(
+      void* user_data, size_t size, VkInternalAllocationType type,
+      VkSystemAllocationScope scope);
+  static VKAPI_ATTR void VKAPI_CALL InternalFreeCallback(
+      void* user_data, size_t size, VkInternalAllocationType type,
+      VkSystemAllocationScope scope);
+
+  VkAllocationCallbacks callbacks_;
+  Scope scopes_[VK_SYSTEM_ALLOCATION_SCOPE_RANGE_SIZE];
+};
+
+}  // namespace vulkan
+
+#endif  // VULKAN_HELPERS_HOST_ALLOCATION_CALLBACKS_H_
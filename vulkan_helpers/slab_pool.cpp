@@ -0,0 +1,286 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_helpers/slab_pool.h"
+
+#include <functional>
+#include <new>
+#include <thread>
+
+#include "vulkan_helpers/helper_functions.h"
+#include "vulkan_helpers/vulkan_application.h"
+
+namespace vulkan {
+
+struct SlabPool::Slab {
+  SlabPool* pool;
+  uint32_t size_class;
+  ::VkDeviceSize slot_size;
+  // Bit i is set if slot i is free.
+  uint64_t free_slots;
+  // The value of free_slots when every slot is free.
+  uint64_t all_slots;
+  AllocationToken* token;
+  ::VkDeviceMemory memory;
+  ::VkDeviceSize offset;
+  char* base_address;
+  // Links for partial_slabs_.
+  Slab* next;
+  Slab* prev;
+};
+
+SlabPool::SlabPool(containers::Allocator* allocator, logging::Logger* log,
+                   VulkanArena* arena, bool thread_safe)
+    : allocator_(allocator), log_(log), arena_(arena), stripes_(nullptr) {
+  for (uint32_t i = 0; i < kSizeClassCount; ++i) {
+    partial_slabs_[i] = nullptr;
+    empty_slabs_[i] = nullptr;
+    empty_slab_idle_frames_[i] = 0;
+  }
+  if (thread_safe) {
+    stripes_ = static_cast<Stripe*>(
+        allocator_->malloc(sizeof(Stripe) * kStripeCount));
+    for (uint32_t i = 0; i < kStripeCount; ++i) {
+      new (&stripes_[i]) Stripe();
+      for (uint32_t j = 0; j < kSizeClassCount; ++j) {
+        stripes_[i].magazines[j].count = 0;
+        stripes_[i].magazines[j].idle_frames = 0;
+      }
+    }
+  }
+}
+
+SlabPool::~SlabPool() {
+  if (stripes_) {
+    // Slots in magazines are free, they just have not been returned to
+    // their slabs yet.
+    for (uint32_t i = 0; i < kStripeCount; ++i) {
+      for (uint32_t j = 0; j < kSizeClassCount; ++j) {
+        Magazine& magazine = stripes_[i].magazines[j];
+        while (magazine.count) {
+          const CachedSlot& cached = magazine.slots[--magazine.count];
+          ReturnSlot(cached.slab, cached.slot);
+        }
+      }
+      stripes_[i].~Stripe();
+    }
+    allocator_->free(stripes_, sizeof(Stripe) * kStripeCount);
+  }
+  for (uint32_t i = 0; i < kSizeClassCount; ++i) {
+    // This will trigger if a slot has not been freed before the pool has
+    // been destroyed.
+    LOG_ASSERT(==, log_, true, partial_slabs_[i] == nullptr);
+    if (empty_slabs_[i]) {
+      ReleaseSlab(empty_slabs_[i]);
+    }
+  }
+}
+
+uint32_t SlabPool::MagazineCapacity(uint32_t size_class) {
+  const ::VkDeviceSize capacity =
+      kMaxMagazineSize / (kMinSlotSize << size_class);
+  return capacity < kMaxMagazineSlots ? static_cast<uint32_t>(capacity)
+                                      : kMaxMagazineSlots;
+}
+
+SlabPool::Stripe* SlabPool::CurrentStripe() {
+  return &stripes_[std::hash<std::thread::id>()(std::this_thread::get_id()) %
+                   kStripeCount];
+}
+
+bool SlabPool::Allocate(::VkDeviceSize size, ::VkDeviceSize alignment,
+                        Allocation* allocation) {
+  // Slabs are aligned to their slot size, so every slot is aligned to any
+  // alignment up to the slot size.
+  if (alignment > size) {
+    size = alignment;
+  }
+  if (size > kMaxSlotSize) {
+    return false;
+  }
+  const uint32_t size_class =
+      size <= kMinSlotSize ? 0 : HighestSetBit(size - 1) + 1 - kMinSlotSizeLog2;
+
+  CachedSlot cached;
+  if (stripes_) {
+    Stripe* stripe = CurrentStripe();
+    std::lock_guard<std::mutex> stripe_lock(stripe->mutex);
+    Magazine& magazine = stripe->magazines[size_class];
+    magazine.idle_frames = 0;
+    if (!magazine.count) {
+      // Fill half of the magazine at once, so that the size class lock
+      // is taken as rarely as possible.
+      std::lock_guard<std::mutex> lock(size_class_mutexes_[size_class]);
+      const uint32_t refill = (MagazineCapacity(size_class) + 1) / 2;
+      while (magazine.count < refill) {
+        magazine.slots[magazine.count++] = TakeSlot(size_class);
+      }
+    }
+    cached = magazine.slots[--magazine.count];
+  } else {
+    cached = TakeSlot(size_class);
+  }
+
+  const ::VkDeviceSize slot_offset = cached.slot * cached.slab->slot_size;
+  allocation->slab = cached.slab;
+  allocation->slot = cached.slot;
+  allocation->memory = cached.slab->memory;
+  allocation->offset = cached.slab->offset + slot_offset;
+  allocation->base_address =
+      cached.slab->base_address ? cached.slab->base_address + slot_offset
+                                : nullptr;
+  return true;
+}
+
+SlabPool::CachedSlot SlabPool::TakeSlot(uint32_t size_class) {
+  Slab* slab = partial_slabs_[size_class];
+  if (!slab) {
+    slab = empty_slabs_[size_class];
+    empty_slabs_[size_class] = nullptr;
+    if (!slab) {
+      const ::VkDeviceSize slot_size = kMinSlotSize << size_class;
+      ::VkDeviceSize slot_count = kMaxSlabSize / slot_size;
+      if (slot_count > 64) {
+        slot_count = 64;
+      } else if (slot_count == 0) {
+        slot_count = 1;
+      }
+      slab = static_cast<Slab*>(allocator_->malloc(sizeof(Slab)));
+      slab->pool = this;
+      slab->size_class = size_class;
+      slab->slot_size = slot_size;
+      slab->all_slots =
+          slot_count == 64 ? ~uint64_t(0) : (uint64_t(1) << slot_count) - 1;
+      slab->free_slots = slab->all_slots;
+      slab->token =
+          arena_->AllocateMemory(slot_size * slot_count, slot_size,
+                                 &slab->memory, &slab->offset,
+                                 &slab->base_address);
+      slab->next = nullptr;
+      slab->prev = nullptr;
+    }
+    LinkSlab(slab);
+  }
+
+  const uint32_t slot = LowestSetBit(slab->free_slots);
+  slab->free_slots &= ~(uint64_t(1) << slot);
+  if (!slab->free_slots) {
+    UnlinkSlab(slab);
+  }
+  return CachedSlot{slab, slot};
+}
+
+void SlabPool::Free(Slab* slab, uint32_t slot) {
+  SlabPool* pool = slab->pool;
+  if (!pool->stripes_) {
+    pool->ReturnSlot(slab, slot);
+    return;
+  }
+  Stripe* stripe = pool->CurrentStripe();
+  std::lock_guard<std::mutex> stripe_lock(stripe->mutex);
+  Magazine& magazine = stripe->magazines[slab->size_class];
+  magazine.idle_frames = 0;
+  const uint32_t capacity = MagazineCapacity(slab->size_class);
+  if (magazine.count == capacity) {
+    // Return half of the magazine at once, so that the size class lock
+    // is taken as rarely as possible.
+    std::lock_guard<std::mutex> lock(
+        pool->size_class_mutexes_[slab->size_class]);
+    while (magazine.count > capacity / 2) {
+      const CachedSlot& cached = magazine.slots[--magazine.count];
+      pool->ReturnSlot(cached.slab, cached.slot);
+    }
+  }
+  magazine.slots[magazine.count++] = CachedSlot{slab, slot};
+}
+
+void SlabPool::ReturnSlot(Slab* slab, uint32_t slot) {
+  if (!slab->free_slots) {
+    // The slab was full, so it can be used for allocations again.
+    LinkSlab(slab);
+  }
+  slab->free_slots |= uint64_t(1) << slot;
+  if (slab->free_slots != slab->all_slots) {
+    return;
+  }
+  UnlinkSlab(slab);
+  if (empty_slabs_[slab->size_class]) {
+    ReleaseSlab(slab);
+  } else {
+    empty_slabs_[slab->size_class] = slab;
+    empty_slab_idle_frames_[slab->size_class] = 0;
+  }
+}
+
+void SlabPool::ReleaseIdleSlabs(uint32_t idle_frames_before_release) {
+  if (stripes_) {
+    for (uint32_t i = 0; i < kStripeCount; ++i) {
+      std::lock_guard<std::mutex> stripe_lock(stripes_[i].mutex);
+      for (uint32_t j = 0; j < kSizeClassCount; ++j) {
+        Magazine& magazine = stripes_[i].magazines[j];
+        if (!magazine.count ||
+            ++magazine.idle_frames <= idle_frames_before_release) {
+          continue;
+        }
+        std::lock_guard<std::mutex> lock(size_class_mutexes_[j]);
+        while (magazine.count) {
+          const CachedSlot& cached = magazine.slots[--magazine.count];
+          ReturnSlot(cached.slab, cached.slot);
+        }
+      }
+    }
+  }
+  for (uint32_t i = 0; i < kSizeClassCount; ++i) {
+    std::unique_lock<std::mutex> lock;
+    if (stripes_) {
+      lock = std::unique_lock<std::mutex>(size_class_mutexes_[i]);
+    }
+    if (empty_slabs_[i] &&
+        ++empty_slab_idle_frames_[i] > idle_frames_before_release) {
+      ReleaseSlab(empty_slabs_[i]);
+      empty_slabs_[i] = nullptr;
+    }
+  }
+}
+
+void SlabPool::ReleaseSlab(Slab* slab) {
+  arena_->FreeMemory(slab->token);
+  allocator_->free(slab, sizeof(Slab));
+}
+
+void SlabPool::LinkSlab(Slab* slab) {
+  Slab*& head = partial_slabs_[slab->size_class];
+  slab->prev = nullptr;
+  slab->next = head;
+  if (head) {
+    head->prev = slab;
+  }
+  head = slab;
+}
+
+void SlabPool::UnlinkSlab(Slab* slab) {
+  if (slab->next) {
+    slab->next->prev = slab->prev;
+  }
+  if (slab->prev) {
+    slab->prev->next = slab->next;
+  } else {
+    partial_slabs_[slab->size_class] = slab->next;
+  }
+  slab->next = nullptr;
+  slab->prev = nullptr;
+}
+
+}  // namespace vulkan
@@ -0,0 +1,152 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_HELPERS_SLAB_POOL_H_
+#define VULKAN_HELPERS_SLAB_POOL_H_
+
+#include <cstdint>
+#include <mutex>
+
+#include "support/containers/allocator.h"
+#include "support/log/log.h"
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+
+namespace vulkan {
+
+class VulkanArena;
+
+// SlabPool hands out small blocks of memory from a VulkanArena, without
+// giving each block an AllocationToken of its own.
+// Sizes are rounded up to a power-of-two size class, from kMinSlotSize to
+// kMaxSlotSize. A slab is a single allocation from the arena that is split
+// into up to 64 slots of one size class, with a bitmap of which slots are
+// free, so allocating and freeing a slot are both constant time.
+//
+// If the pool is thread safe, each size class has its own lock, and
+// threads additionally keep small magazines of free slots, so that most
+// allocations and frees do not touch the shared slabs at all. Magazines
+// live in a fixed set of stripes that threads are hashed into, rather than
+// in thread-local storage, so that nothing has to be cleaned up when a
+// thread exits.
+class SlabPool {
+ public:
+  struct Slab;
+
+  // Every slot is at least the maximum nonCoherentAtomSize, so that slots
+  // in mapped memory can be flushed and invalidated independently.
+  static const ::VkDeviceSize kMinSlotSize = 256;
+  static const ::VkDeviceSize kMaxSlotSize = 16 * 1024;
+
+  struct Allocation {
+    Slab* slab;
+    uint32_t slot;
+    ::VkDeviceMemory memory;
+    ::VkDeviceSize offset;
+    // The host-visible address of the slot, or nullptr if the arena
+    // is not mapped.
+    char* base_address;
+  };
+
+  // If thread_safe is true, the pool can be used from multiple threads at
+  // once, in which case arena must be thread safe as well.
+  SlabPool(containers::Allocator* allocator, logging::Logger* log,
+           VulkanArena* arena, bool thread_safe);
+  ~SlabPool();
+
+  // Fills *allocation with a slot of at least size bytes, whose offset is a
+  // multiple of alignment. Returns false if size or alignment are larger
+  // than kMaxSlotSize, in which case the caller should allocate from the
+  // arena directly.
+  bool Allocate(::VkDeviceSize size, ::VkDeviceSize alignment,
+                Allocation* allocation);
+
+  // Returns the given slot to the pool that it was allocated from.
+  static void Free(Slab* slab, uint32_t slot);
+
+  // Returns slabs to the arena that have had every slot free for more than
+  // idle_frames_before_release calls, so that the arena can release their
+  // chunks. Slots that have sat in a thread's magazine for as long are
+  // returned to their slabs first.
+  // This is expected to be called once per frame.
+  void ReleaseIdleSlabs(uint32_t idle_frames_before_release);
+
+ private:
+  static const uint32_t kMinSlotSizeLog2 = 8;
+  static const uint32_t kSizeClassCount = 7;
+  // Slabs hold at most this many bytes, unless that would be less than
+  // one slot.
+  static const ::VkDeviceSize kMaxSlabSize = 64 * 1024;
+
+  static const uint32_t kStripeCount = 8;
+  static const uint32_t kMaxMagazineSlots = 16;
+  // A magazine holds at most this many bytes of slots.
+  static const ::VkDeviceSize kMaxMagazineSize = 16 * 1024;
+
+  struct CachedSlot {
+    Slab* slab;
+    uint32_t slot;
+  };
+
+  struct Magazine {
+    uint32_t count;
+    // The number of calls to ReleaseIdleSlabs since this was last used.
+    uint32_t idle_frames;
+    CachedSlot slots[kMaxMagazineSlots];
+  };
+
+  struct Stripe {
+    std::mutex mutex;
+    Magazine magazines[kSizeClassCount];
+  };
+
+  // Returns the number of slots that a magazine holds for size_class.
+  static uint32_t MagazineCapacity(uint32_t size_class);
+  // Returns the stripe for the calling thread.
+  Stripe* CurrentStripe();
+
+  // Takes a free slot of the given size class from the slabs.
+  // If the pool is thread safe, the lock for size_class must be held.
+  CachedSlot TakeSlot(uint32_t size_class);
+  // Returns a slot to its slab.
+  // If the pool is thread safe, the lock for the size class must be held.
+  void ReturnSlot(Slab* slab, uint32_t slot);
+  // Returns the slab to the arena.
+  void ReleaseSlab(Slab* slab);
+  // Adds slab to, or removes slab from partial_slabs_.
+  void LinkSlab(Slab* slab);
+  void UnlinkSlab(Slab* slab);
+
+  containers::Allocator* allocator_;
+  logging::Logger* log_;
+  VulkanArena* arena_;
+  // The slabs for each size class that have at least one free slot, and at
+  // least one slot in use.
+  Slab* partial_slabs_[kSizeClassCount];
+  // At most one slab for each size class with every slot free. This is
+  // kept so that repeatedly allocating and freeing a single slot does not
+  // go to the arena every time.
+  Slab* empty_slabs_[kSizeClassCount];
+  // The number of calls to ReleaseIdleSlabs since each of empty_slabs_
+  // became empty.
+  uint32_t empty_slab_idle_frames_[kSizeClassCount];
+  // These are only used if the pool is thread safe, in which case
+  // stripes_ points to kStripeCount stripes.
+  std::mutex size_class_mutexes_[kSizeClassCount];
+  Stripe* stripes_;
+};
+
+}  // namespace vulkan
+
+#endif  // VULKAN_HELPERS_SLAB_POOL_H_
@@ -0,0 +1,295 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_helpers/tlsf_allocator.h"
+
+#include "vulkan_helpers/helper_functions.h"
+
+namespace vulkan {
+
+TLSFAllocator::TLSFAllocator(containers::Allocator* allocator,
+                             ::VkDeviceSize size)
+    : size_(size),
+      first_block_(nullptr),
+      first_level_bitmap_(0),
+      tokens_(allocator) {
+  for (uint32_t i = 0; i < kFirstLevelCount; ++i) {
+    second_level_bitmap_[i] = 0;
+    for (uint32_t j = 0; j < kSecondLevelCount; ++j) {
+      free_lists_[i][j] = nullptr;
+    }
+  }
+  // The first block contains all of the memory in the allocator.
+  first_block_ = NewToken();
+  first_block_->next = nullptr;
+  first_block_->prev = nullptr;
+  first_block_->allocationSize = size;
+  first_block_->offset = 0;
+  first_block_->in_use = false;
+  first_block_->owner = this;
+  InsertFreeBlock(first_block_);
+}
+
+void TLSFAllocator::Reset(::VkDeviceSize size) {
+  // With no outstanding allocations, the first block is the only block.
+  RemoveFreeBlock(first_block_);
+  size_ = size;
+  first_block_->allocationSize = size;
+  InsertFreeBlock(first_block_);
+}
+
+void TLSFAllocator::Mapping(::VkDeviceSize size, uint32_t* first_level,
+                            uint32_t* second_level) {
+  if (size < kSecondLevelCount) {
+    // Small blocks all live in the first first-level list, one size
+    // per second-level list.
+    *first_level = 0;
+    *second_level = static_cast<uint32_t>(size);
+    return;
+  }
+  const uint32_t high_bit = HighestSetBit(size);
+  *first_level = high_bit - kSecondLevelLog2 + 1;
+  *second_level = static_cast<uint32_t>(
+      (size >> (high_bit - kSecondLevelLog2)) ^ kSecondLevelCount);
+}
+
+::VkDeviceSize TLSFAllocator::RoundUpSearchSize(::VkDeviceSize size) {
+  // Round the size up to the next second-level boundary, so that any block
+  // in the list we start searching from is large enough.
+  if (size >= kSecondLevelCount) {
+    const ::VkDeviceSize round =
+        (::VkDeviceSize(1) << (HighestSetBit(size) - kSecondLevelLog2)) - 1;
+    if (size + round < size) {
+      return 0;
+    }
+    size += round;
+  }
+  return size;
+}
+
+::VkDeviceSize TLSFAllocator::MinimumSize(::VkDeviceSize size,
+                                          ::VkDeviceSize alignment) {
+  if (size == 0) {
+    size = 1;
+  }
+  return RoundUpSearchSize(size + alignment - 1);
+}
+
+AllocationToken* TLSFAllocator::FindFreeBlock(::VkDeviceSize size) {
+  size = RoundUpSearchSize(size);
+  if (size == 0) {
+    return nullptr;
+  }
+  uint32_t first_level;
+  uint32_t second_level;
+  Mapping(size, &first_level, &second_level);
+  if (first_level >= kFirstLevelCount) {
+    return nullptr;
+  }
+
+  // First look for a big enough list in the same power of 2.
+  uint32_t second_level_map =
+      second_level_bitmap_[first_level] & (~0u << second_level);
+  if (!second_level_map) {
+    // Otherwise take the smallest list from any larger power of 2.
+    if (first_level + 1 >= kFirstLevelCount) {
+      return nullptr;
+    }
+    const uint64_t first_level_map =
+        first_level_bitmap_ & (~uint64_t(0) << (first_level + 1));
+    if (!first_level_map) {
+      return nullptr;
+    }
+    first_level = LowestSetBit(first_level_map);
+    second_level_map = second_level_bitmap_[first_level];
+  }
+  second_level = LowestSetBit(second_level_map);
+  return free_lists_[first_level][second_level];
+}
+
+void TLSFAllocator::InsertFreeBlock(AllocationToken* token) {
+  uint32_t first_level;
+  uint32_t second_level;
+  Mapping(token->allocationSize, &first_level, &second_level);
+  AllocationToken*& head = free_lists_[first_level][second_level];
+  token->prev_free = nullptr;
+  token->next_free = head;
+  if (head) {
+    head->prev_free = token;
+  }
+  head = token;
+  first_level_bitmap_ |= uint64_t(1) << first_level;
+  second_level_bitmap_[first_level] |= 1u << second_level;
+}
+
+void TLSFAllocator::RemoveFreeBlock(AllocationToken* token) {
+  uint32_t first_level;
+  uint32_t second_level;
+  Mapping(token->allocationSize, &first_level, &second_level);
+  if (token->next_free) {
+    token->next_free->prev_free = token->prev_free;
+  }
+  if (token->prev_free) {
+    token->prev_free->next_free = token->next_free;
+  } else {
+    AllocationToken*& head = free_lists_[first_level][second_level];
+    head = token->next_free;
+    if (!head) {
+      second_level_bitmap_[first_level] &= ~(1u << second_level);
+      if (!second_level_bitmap_[first_level]) {
+        first_level_bitmap_ &= ~(uint64_t(1) << first_level);
+      }
+    }
+  }
+  token->next_free = nullptr;
+  token->prev_free = nullptr;
+}
+
+void TLSFAllocator::SplitFreeTail(AllocationToken* token, ::VkDeviceSize size) {
+  AllocationToken* tail = NewToken();
+  tail->allocationSize = size;
+  tail->offset = token->offset + token->allocationSize - size;
+  tail->in_use = false;
+  tail->owner = this;
+  tail->prev = token;
+  tail->next = token->next;
+  if (token->next) {
+    token->next->prev = tail;
+  }
+  token->next = tail;
+  token->allocationSize -= size;
+  InsertFreeBlock(tail);
+}
+
+AllocationToken* TLSFAllocator::Allocate(::VkDeviceSize size,
+                                         ::VkDeviceSize alignment) {
+  if (size == 0) {
+    size = 1;
+  }
+  const ::VkDeviceSize align_m_1 = alignment - 1;
+  // This is the maximum amount of memory we will potentially have to
+  // search for in order to satisfy the alignment.
+  AllocationToken* token = FindFreeBlock(size + align_m_1);
+  if (!token) {
+    return nullptr;
+  }
+  RemoveFreeBlock(token);
+  return Carve(token, size, alignment);
+}
+
+AllocationToken* TLSFAllocator::AllocateLowest(::VkDeviceSize size,
+                                               ::VkDeviceSize alignment,
+                                               ::VkDeviceSize max_offset) {
+  if (size == 0) {
+    size = 1;
+  }
+  const ::VkDeviceSize align_m_1 = alignment - 1;
+  for (AllocationToken* token = first_block_;
+       token && token->offset < max_offset; token = token->next) {
+    if (token->in_use) {
+      continue;
+    }
+    const ::VkDeviceSize aligned_offset =
+        (token->offset + align_m_1) & ~align_m_1;
+    if (aligned_offset < max_offset &&
+        aligned_offset + size <= token->offset + token->allocationSize) {
+      RemoveFreeBlock(token);
+      return Carve(token, size, alignment);
+    }
+  }
+  return nullptr;
+}
+
+AllocationToken* TLSFAllocator::Carve(AllocationToken* token,
+                                      ::VkDeviceSize size,
+                                      ::VkDeviceSize alignment) {
+  const ::VkDeviceSize align_m_1 = alignment - 1;
+  const ::VkDeviceSize aligned_offset =
+      (token->offset + align_m_1) & ~align_m_1;
+  const ::VkDeviceSize padding = aligned_offset - token->offset;
+  if (padding) {
+    // Keep the bytes in front of the aligned offset as their own free block,
+    // so that they can be used by a later allocation.
+    SplitFreeTail(token, token->allocationSize - padding);
+    AllocationToken* aligned = token->next;
+    RemoveFreeBlock(aligned);
+    InsertFreeBlock(token);
+    token = aligned;
+  }
+  if (token->allocationSize > size) {
+    SplitFreeTail(token, token->allocationSize - size);
+  }
+  token->in_use = true;
+  token->requestedSize = size;
+  return token;
+}
+
+void TLSFAllocator::Free(AllocationToken* token) {
+  token->in_use = false;
+  // First try to coalesce this with its previous block.
+  if (token->prev && !token->prev->in_use) {
+    AllocationToken* prev_token = token->prev;
+    RemoveFreeBlock(prev_token);
+    prev_token->allocationSize += token->allocationSize;
+    prev_token->next = token->next;
+    if (token->next) {
+      token->next->prev = prev_token;
+    }
+    ReleaseToken(token);
+    token = prev_token;
+  }
+  // Now try to coalesce this with the subsequent block.
+  if (token->next && !token->next->in_use) {
+    AllocationToken* next_token = token->next;
+    RemoveFreeBlock(next_token);
+    token->allocationSize += next_token->allocationSize;
+    token->next = next_token->next;
+    if (token->next) {
+      token->next->prev = token;
+    }
+    ReleaseToken(next_token);
+  }
+  InsertFreeBlock(token);
+}
+
+void TLSFAllocator::GetFreeBlockStatistics(
+    uint64_t* count, ::VkDeviceSize* total_size,
+    ::VkDeviceSize* largest_size) const {
+  *count = 0;
+  *total_size = 0;
+  *largest_size = 0;
+  for (const AllocationToken* token = first_block_; token;
+       token = token->next) {
+    if (token->in_use) {
+      continue;
+    }
+    ++*count;
+    *total_size += token->allocationSize;
+    if (token->allocationSize > *largest_size) {
+      *largest_size = token->allocationSize;
+    }
+  }
+}
+
+AllocationToken* TLSFAllocator::NewToken() {
+  // The pool takes whole slabs of tokens at a time, so that we only very
+  // rarely have to allocate. New tokens are zeroed.
+  return tokens_.New();
+}
+
+void TLSFAllocator::ReleaseToken(AllocationToken* token) {
+  tokens_.Delete(token);
+}
+}  // namespace vulkan
@@ -0,0 +1,141 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_HELPERS_TLSF_ALLOCATOR_H_
+#define VULKAN_HELPERS_TLSF_ALLOCATOR_H_
+
+#include <cstdint>
+
+#include "support/containers/allocator.h"
+#include "support/containers/object_pool.h"
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+
+namespace vulkan {
+
+class TLSFAllocator;
+
+// These linked-list nodes are ordered by offset into the heap.
+// The first node has a prev of nullptr, and the last node has a next of
+// nullptr. Nodes that are not in use are additionally linked into
+// the free-list that matches their size through next_free and prev_free.
+struct AllocationToken {
+  // The allocator that this token belongs to.
+  TLSFAllocator* owner;
+  AllocationToken* next;
+  AllocationToken* prev;
+  AllocationToken* next_free;
+  AllocationToken* prev_free;
+  ::VkDeviceSize allocationSize;
+  // The number of bytes that the user of the allocation asked for. This may
+  // be less than allocationSize if the request was rounded up.
+  ::VkDeviceSize requestedSize;
+  ::VkDeviceSize offset;
+  bool in_use;
+};
+
+// TLSFAllocator is a two-level segregated-fit allocator for a range of
+// offsets. It does not own any memory itself, it only hands out
+// offsets into [0, size).
+// Free blocks are bucketed first by the power of two of their size, and then
+// linearly into kSecondLevelCount buckets within that power of two. Two
+// bitmaps track which buckets are non-empty, so finding a suitable block,
+// allocating and freeing are all constant time.
+// AllocationTokens are recycled internally, so once the allocator has warmed
+// up, Allocate and Free do not allocate any host memory.
+class TLSFAllocator {
+ public:
+  TLSFAllocator(containers::Allocator* allocator, ::VkDeviceSize size);
+
+  // Returns an AllocationToken describing a range of at least size bytes
+  // whose offset is a multiple of alignment. alignment must be a power of 2.
+  // Returns nullptr if no free block is large enough.
+  AllocationToken* Allocate(::VkDeviceSize size, ::VkDeviceSize alignment);
+
+  // Like Allocate, but returns the lowest-addressed range that fits, as long
+  // as it starts below max_offset. This walks every block, so it is meant
+  // for compaction rather than regular allocation.
+  AllocationToken* AllocateLowest(::VkDeviceSize size, ::VkDeviceSize alignment,
+                                  ::VkDeviceSize max_offset);
+
+  // Returns the range described by token to the allocator, merging it with
+  // any free neighbours.
+  void Free(AllocationToken* token);
+
+  // Makes this allocator hand out offsets into [0, size) instead. There must
+  // be no outstanding allocations.
+  void Reset(::VkDeviceSize size);
+
+  // Returns true if there are no outstanding allocations.
+  bool empty() const {
+    return first_block_->next == nullptr && !first_block_->in_use;
+  }
+
+  // Returns the total number of bytes managed by this allocator.
+  ::VkDeviceSize size() const { return size_; }
+
+  // Fills *count, *total_size and *largest_size with the number of free
+  // blocks, the number of free bytes and the size of the largest free block.
+  // This walks every block, so it should not be called per-allocation.
+  void GetFreeBlockStatistics(uint64_t* count, ::VkDeviceSize* total_size,
+                              ::VkDeviceSize* largest_size) const;
+
+  // Returns the smallest allocator size that is guaranteed to be able to
+  // satisfy a single allocation of the given size and alignment.
+  static ::VkDeviceSize MinimumSize(::VkDeviceSize size,
+                                    ::VkDeviceSize alignment);
+
+ private:
+  static const uint32_t kSecondLevelLog2 = 4;
+  static const uint32_t kSecondLevelCount = 1 << kSecondLevelLog2;
+  static const uint32_t kFirstLevelCount = 64 - kSecondLevelLog2 + 1;
+  // Returns size rounded up so that every block in the free-list it
+  // maps to is at least size bytes, or 0 on overflow.
+  static ::VkDeviceSize RoundUpSearchSize(::VkDeviceSize size);
+
+  // Fills *first_level and *second_level with the free-list that holds
+  // blocks of the given size.
+  static void Mapping(::VkDeviceSize size, uint32_t* first_level,
+                      uint32_t* second_level);
+
+  // Returns a free block with at least size bytes, or nullptr.
+  // The block is not removed from its free-list.
+  AllocationToken* FindFreeBlock(::VkDeviceSize size);
+  void InsertFreeBlock(AllocationToken* token);
+  void RemoveFreeBlock(AllocationToken* token);
+
+  // Marks size bytes of the free block token, starting at the first offset
+  // that is aligned to alignment, as in use. The rest of the block is
+  // returned to the free-lists. token must already be removed from the
+  // free-lists, and must be large enough. Returns the in-use block.
+  AllocationToken* Carve(AllocationToken* token, ::VkDeviceSize size,
+                         ::VkDeviceSize alignment);
+
+  // Splits the last size bytes off of token into a new free block.
+  void SplitFreeTail(AllocationToken* token, ::VkDeviceSize size);
+
+  AllocationToken* NewToken();
+  void ReleaseToken(AllocationToken* token);
+
+  ::VkDeviceSize size_;
+  AllocationToken* first_block_;
+  uint64_t first_level_bitmap_;
+  uint32_t second_level_bitmap_[kFirstLevelCount];
+  AllocationToken* free_lists_[kFirstLevelCount][kSecondLevelCount];
+  // Tokens are allocated in slabs, and recycled.
+  containers::ObjectPool<AllocationToken> tokens_;
+};
+}  // namespace vulkan
+
+#endif  // VULKAN_HELPERS_TLSF_ALLOCATOR_H_
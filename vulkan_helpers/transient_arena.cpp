@@ -0,0 +1,184 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_helpers/transient_arena.h"
+
+#include "vulkan_helpers/helper_functions.h"
+
+namespace vulkan {
+
+// The maximum value for nonCoherentAtomSize from the vulkan spec.
+// Every allocation is aligned to this, so that allocations can be
+// flushed and invalidated independently.
+static const ::VkDeviceSize kMaxNonCoherentAtomSize = 256;
+
+// Returns the greatest common divisor of a and b.
+static ::VkDeviceSize GreatestCommonDivisor(::VkDeviceSize a,
+                                            ::VkDeviceSize b) {
+  while (b != 0) {
+    ::VkDeviceSize remainder = a % b;
+    a = b;
+    b = remainder;
+  }
+  return a;
+}
+
+TransientArena::TransientArena(containers::Allocator* allocator,
+                               logging::Logger* log, VkDevice* device,
+                               ::VkBuffer buffer, ::VkDeviceMemory memory,
+                               ::VkDeviceSize memory_offset,
+                               ::VkDeviceSize size, char* base_address)
+    : allocator_(allocator),
+      log_(log),
+      device_(device),
+      buffer_(buffer),
+      memory_(memory),
+      memory_offset_(memory_offset),
+      size_(size),
+      base_address_(base_address),
+      head_(0),
+      tail_(0),
+      retired_head_(0),
+      retirements_(allocator),
+      fences_(allocator),
+      free_fences_(allocator) {
+  LOG_ASSERT(==, log_, 0u, memory_offset_ % kMaxNonCoherentAtomSize);
+}
+
+TransientArena::~TransientArena() {
+  // Make sure nothing is still using our fences before they are destroyed.
+  for (auto& retirement : retirements_) {
+    if (retirement.fence != VK_NULL_HANDLE) {
+      (*device_)->vkWaitForFences(*device_, 1, &retirement.fence, VK_TRUE,
+                                  0xFFFFFFFFFFFFFFFF);
+    }
+  }
+}
+
+bool TransientArena::Allocate(::VkDeviceSize size, ::VkDeviceSize alignment,
+                              Allocation* allocation) {
+  LOG_ASSERT(>, log_, alignment, 0u);
+  // The allocation must also start on a nonCoherentAtomSize boundary, so
+  // use the least common multiple of the two.
+  alignment = alignment / GreatestCommonDivisor(alignment,
+                                                kMaxNonCoherentAtomSize) *
+              kMaxNonCoherentAtomSize;
+  if (size == 0 || size > size_) {
+    return false;
+  }
+
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    uint64_t start = head_;
+    ::VkDeviceSize location = start % size_;
+    ::VkDeviceSize aligned =
+        (location + alignment - 1) / alignment * alignment;
+    if (aligned + size > size_) {
+      // This would run off of the end of the buffer, so skip to the
+      // start again.
+      start += size_ - location;
+      location = 0;
+      aligned = 0;
+    }
+    const uint64_t end = start + (aligned - location) + size;
+    if (end - tail_ <= size_) {
+      head_ = end;
+      allocation->buffer = buffer_;
+      allocation->offset = aligned;
+      allocation->size = size;
+      allocation->base_address = base_address_ + aligned;
+      return true;
+    }
+    // Try to make some space, and have one more go.
+    Reclaim();
+  }
+  return false;
+}
+
+void TransientArena::Flush(const Allocation& allocation) {
+  ::VkDeviceSize size = allocation.size;
+  if (size % kMaxNonCoherentAtomSize) {
+    size += kMaxNonCoherentAtomSize - (size % kMaxNonCoherentAtomSize);
+  }
+  if (allocation.offset + size > size_) {
+    size = size_ - allocation.offset;
+  }
+  VkMappedMemoryRange range{VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr,
+                            memory_, memory_offset_ + allocation.offset, size};
+  (*device_)->vkFlushMappedMemoryRanges(*device_, 1, &range);
+}
+
+void TransientArena::Invalidate(const Allocation& allocation) {
+  ::VkDeviceSize size = allocation.size;
+  if (size % kMaxNonCoherentAtomSize) {
+    size += kMaxNonCoherentAtomSize - (size % kMaxNonCoherentAtomSize);
+  }
+  if (allocation.offset + size > size_) {
+    size = size_ - allocation.offset;
+  }
+  VkMappedMemoryRange range{VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr,
+                            memory_, memory_offset_ + allocation.offset, size};
+  (*device_)->vkInvalidateMappedMemoryRanges(*device_, 1, &range);
+}
+
+::VkFence TransientArena::Retire() {
+  Reclaim();
+  if (head_ == retired_head_) {
+    return VK_NULL_HANDLE;
+  }
+  ::VkFence fence = GetFence();
+  retirements_.push_back(Retirement{fence, head_});
+  retired_head_ = head_;
+  return fence;
+}
+
+void TransientArena::RetireCompleted() {
+  if (head_ != retired_head_) {
+    retirements_.push_back(Retirement{VK_NULL_HANDLE, head_});
+    retired_head_ = head_;
+  }
+  Reclaim();
+}
+
+void TransientArena::Reclaim() {
+  while (!retirements_.empty()) {
+    Retirement& retirement = retirements_.front();
+    if (retirement.fence != VK_NULL_HANDLE) {
+      if ((*device_)->vkGetFenceStatus(*device_, retirement.fence) !=
+          VK_SUCCESS) {
+        // Everything after this was submitted later, so it cannot have
+        // completed either.
+        return;
+      }
+      LOG_ASSERT(
+          ==, log_, VK_SUCCESS,
+          (*device_)->vkResetFences(*device_, 1, &retirement.fence));
+      free_fences_.push_back(retirement.fence);
+    }
+    tail_ = retirement.end;
+    retirements_.pop_front();
+  }
+}
+
+::VkFence TransientArena::GetFence() {
+  if (free_fences_.empty()) {
+    fences_.push_back(CreateFence(device_));
+    return fences_.back().get_raw_object();
+  }
+  ::VkFence fence = free_fences_.back();
+  free_fences_.pop_back();
+  return fence;
+}
+
+}  // namespace vulkan
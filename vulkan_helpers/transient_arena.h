@@ -0,0 +1,121 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_HELPERS_TRANSIENT_ARENA_H_
+#define VULKAN_HELPERS_TRANSIENT_ARENA_H_
+
+#include <cstdint>
+
+#include "support/containers/allocator.h"
+#include "support/containers/deque.h"
+#include "support/containers/vector.h"
+#include "support/log/log.h"
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+#include "vulkan_wrapper/device_wrapper.h"
+#include "vulkan_wrapper/sub_objects.h"
+
+namespace vulkan {
+
+// TransientArena hands out short-lived slices of a single persistently
+// mapped, host-visible VkBuffer. It is meant for data that is only
+// used by a single submission, such as staging data for uploads and
+// readbacks.
+// Allocation is a pointer bump through a ring. Memory is never freed
+// individually; instead Retire() marks everything that has been allocated
+// so far as in use by the next submission to a queue, and that memory is
+// reclaimed wholesale once the fence of that submission signals.
+class TransientArena {
+ public:
+  struct Allocation {
+    ::VkBuffer buffer;
+    ::VkDeviceSize offset;
+    ::VkDeviceSize size;
+    char* base_address;
+  };
+
+  // The given buffer must be bound to memory (memory, memory_offset)
+  // which is mapped at base_address, and it must stay alive for the
+  // lifetime of this arena. memory_offset must be a multiple of
+  // nonCoherentAtomSize.
+  TransientArena(containers::Allocator* allocator, logging::Logger* log,
+                 VkDevice* device, ::VkBuffer buffer, ::VkDeviceMemory memory,
+                 ::VkDeviceSize memory_offset, ::VkDeviceSize size,
+                 char* base_address);
+  ~TransientArena();
+
+  // Fills *allocation with size bytes, whose offset is a multiple of
+  // alignment. alignment does not need to be a power of 2, so that it can be
+  // the element size of a format. Returns false if the arena does not have
+  // enough space left, in which case the caller is expected to fall back on
+  // a regular buffer.
+  bool Allocate(::VkDeviceSize size, ::VkDeviceSize alignment,
+                Allocation* allocation);
+
+  // Flushes host writes to the given allocation so they are visible to
+  // the device.
+  void Flush(const Allocation& allocation);
+  // Invalidates the given allocation so that device writes are visible to
+  // the host.
+  void Invalidate(const Allocation& allocation);
+
+  // Marks all allocations made so far as being used by the next batch that
+  // is submitted to a queue, and returns a fence that must be passed to
+  // that vkQueueSubmit. Their memory is reclaimed once the fence signals.
+  // Returns VK_NULL_HANDLE if there is nothing to retire, in which case
+  // the submission needs no fence from the arena.
+  ::VkFence Retire();
+  // Marks all allocations made so far as being used by work that is known
+  // to have completed already, such as after a vkQueueWaitIdle.
+  void RetireCompleted();
+
+  // Reclaims the memory for any retired allocations whose work has
+  // completed.
+  void Reclaim();
+
+  // Returns true if there are allocations that have not been retired.
+  bool has_unretired_allocations() const { return head_ != retired_head_; }
+
+  ::VkDeviceSize size() const { return size_; }
+
+ private:
+  struct Retirement {
+    ::VkFence fence;
+    uint64_t end;
+  };
+
+  // Returns a fence in the unsignaled state.
+  ::VkFence GetFence();
+
+  containers::Allocator* allocator_;
+  logging::Logger* log_;
+  VkDevice* device_;
+  ::VkBuffer buffer_;
+  ::VkDeviceMemory memory_;
+  ::VkDeviceSize memory_offset_;
+  ::VkDeviceSize size_;
+  char* base_address_;
+  // head_ and tail_ increase monotonically. The location in the buffer
+  // is the value modulo size_.
+  uint64_t head_;
+  uint64_t tail_;
+  uint64_t retired_head_;
+  containers::deque<Retirement> retirements_;
+  containers::vector<VkFence> fences_;
+  containers::vector<::VkFence> free_fences_;
+};
+
+}  // namespace vulkan
+
+#endif  // VULKAN_HELPERS_TRANSIENT_ARENA_H_
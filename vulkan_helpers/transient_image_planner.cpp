@@ -0,0 +1,183 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_helpers/transient_image_planner.h"
+
+#include <algorithm>
+
+namespace vulkan {
+
+TransientImagePlanner::TransientImagePlanner(containers::Allocator* allocator,
+                                             VulkanApplication* application)
+    : allocator_(allocator),
+      application_(application),
+      entries_(allocator),
+      images_(allocator),
+      token_(nullptr),
+      memory_size_(0),
+      unaliased_memory_size_(0) {}
+
+TransientImagePlanner::~TransientImagePlanner() {
+  // The images must be destroyed before their memory is returned.
+  images_.clear();
+  if (token_) {
+    application_->FreeImageMemory(token_);
+  }
+}
+
+size_t TransientImagePlanner::AddImage(const VkImageCreateInfo& create_info,
+                                       uint32_t first_use, uint32_t last_use) {
+  logging::Logger* log = application_->GetLogger();
+  LOG_ASSERT(==, log, true, images_.empty());
+  LOG_ASSERT(<=, log, first_use, last_use);
+  LOG_ASSERT(==, log, VK_IMAGE_LAYOUT_UNDEFINED, create_info.initialLayout);
+  Entry entry;
+  entry.create_info = create_info;
+  entry.first_use = first_use;
+  entry.last_use = last_use;
+  entry.offset = 0;
+  entry.aliased = false;
+  entries_.push_back(entry);
+  return entries_.size() - 1;
+}
+
+void TransientImagePlanner::Commit() {
+  logging::Logger* log = application_->GetLogger();
+  VkDevice& device = application_->device();
+  LOG_ASSERT(==, log, true, images_.empty());
+  if (entries_.empty()) {
+    return;
+  }
+
+  images_.reserve(entries_.size());
+  VkAllocationCallbacks* callbacks = device.allocation_callbacks();
+  VkMemoryRequirements requirements = {0, 1, ~0u};
+  for (auto& entry : entries_) {
+    ::VkImage raw_image;
+    LOG_ASSERT(==, log, VK_SUCCESS,
+               device->vkCreateImage(device, &entry.create_info, callbacks,
+                                     &raw_image));
+    images_.push_back(VkImage(raw_image, callbacks, &device));
+    device->vkGetImageMemoryRequirements(device, raw_image,
+                                         &entry.requirements);
+    unaliased_memory_size_ += entry.requirements.size;
+    if (entry.requirements.alignment > requirements.alignment) {
+      requirements.alignment = entry.requirements.alignment;
+    }
+    requirements.memoryTypeBits &= entry.requirements.memoryTypeBits;
+  }
+  requirements.size = PlaceEntries();
+  memory_size_ = requirements.size;
+
+  ::VkDeviceMemory memory;
+  ::VkDeviceSize offset;
+  token_ = application_->AllocateImageMemory(requirements, &memory, &offset);
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    device->vkBindImageMemory(device, images_[i], memory,
+                              offset + entries_[i].offset);
+  }
+  log->LogInfo("Placed ", entries_.size(), " transient images in ",
+               memory_size_, " bytes rather than ", unaliased_memory_size_);
+}
+
+::VkDeviceSize TransientImagePlanner::PlaceEntries() {
+  containers::vector<size_t> order(allocator_);
+  order.reserve(entries_.size());
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    order.push_back(i);
+  }
+  std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+    return entries_[a].requirements.size > entries_[b].requirements.size;
+  });
+
+  // The entries that have been placed, and whose lifetime overlaps the one
+  // being placed, sorted by offset.
+  containers::vector<const Entry*> neighbours(allocator_);
+  ::VkDeviceSize total_size = 0;
+  for (size_t i = 0; i < order.size(); ++i) {
+    Entry& entry = entries_[order[i]];
+    neighbours.clear();
+    for (size_t j = 0; j < i; ++j) {
+      const Entry& placed = entries_[order[j]];
+      if (LifetimesOverlap(entry, placed)) {
+        neighbours.push_back(&placed);
+      }
+    }
+    std::sort(neighbours.begin(), neighbours.end(),
+              [](const Entry* a, const Entry* b) {
+                return a->offset < b->offset;
+              });
+
+    // Find the first gap between neighbours that the entry fits in.
+    const ::VkDeviceSize align_m_1 = entry.requirements.alignment - 1;
+    ::VkDeviceSize offset = 0;
+    for (const Entry* neighbour : neighbours) {
+      const ::VkDeviceSize aligned = (offset + align_m_1) & ~align_m_1;
+      if (aligned + entry.requirements.size <= neighbour->offset) {
+        break;
+      }
+      const ::VkDeviceSize neighbour_end =
+          neighbour->offset + neighbour->requirements.size;
+      if (neighbour_end > offset) {
+        offset = neighbour_end;
+      }
+    }
+    entry.offset = (offset + align_m_1) & ~align_m_1;
+    if (entry.offset + entry.requirements.size > total_size) {
+      total_size = entry.offset + entry.requirements.size;
+    }
+  }
+
+  for (auto& entry : entries_) {
+    for (const auto& other : entries_) {
+      if (&entry != &other && MemoryOverlaps(entry, other)) {
+        entry.aliased = true;
+        break;
+      }
+    }
+  }
+  return total_size;
+}
+
+void TransientImagePlanner::RecordFirstUseBarrier(
+    VkCommandBuffer* command_buffer, size_t index, VkImageAspectFlags aspect,
+    VkImageLayout layout, VkAccessFlags dst_access,
+    VkPipelineStageFlags dst_stages) const {
+  const Entry& entry = entries_[index];
+  // If the memory is shared, any writes to the other images must complete
+  // before the layout transition, or they could land on top of it. We do
+  // not know which stages those writes came from, so wait for all of them.
+  const VkPipelineStageFlags src_stages =
+      entry.aliased ? VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+                    : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+  VkImageMemoryBarrier barrier{
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,  // sType
+      nullptr,                                 // pNext
+      entry.aliased ? VkAccessFlags(VK_ACCESS_MEMORY_WRITE_BIT)
+                    : VkAccessFlags(0),  // srcAccessMask
+      dst_access,                        // dstAccessMask
+      VK_IMAGE_LAYOUT_UNDEFINED,         // oldLayout
+      layout,                            // newLayout
+      VK_QUEUE_FAMILY_IGNORED,           // srcQueueFamilyIndex
+      VK_QUEUE_FAMILY_IGNORED,           // dstQueueFamilyIndex
+      images_[index],                    // image
+      {aspect, 0, entry.create_info.mipLevels, 0,
+       entry.create_info.arrayLayers}};
+  (*command_buffer)
+      ->vkCmdPipelineBarrier(*command_buffer, src_stages, dst_stages, 0, 0,
+                             nullptr, 0, nullptr, 1, &barrier);
+}
+
+}  // namespace vulkan
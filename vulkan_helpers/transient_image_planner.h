@@ -0,0 +1,114 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_HELPERS_TRANSIENT_IMAGE_PLANNER_H_
+#define VULKAN_HELPERS_TRANSIENT_IMAGE_PLANNER_H_
+
+#include "support/containers/allocator.h"
+#include "support/containers/vector.h"
+#include "vulkan_helpers/tlsf_allocator.h"
+#include "vulkan_helpers/vulkan_application.h"
+#include "vulkan_wrapper/command_buffer_wrapper.h"
+#include "vulkan_wrapper/sub_objects.h"
+
+namespace vulkan {
+
+// TransientImagePlanner places images that only live for part of a frame
+// into shared memory. Each image declares the first and the last pass of
+// the frame that it is used in. Images whose lifetimes do not overlap may
+// be bound to the same memory, so the memory needed is closer to the largest
+// set of images that are live at once than to the sum of all of them.
+//
+// Images are placed largest first, each at the lowest offset that does not
+// overlap an image whose lifetime overlaps its own. All of the images are
+// bound to a single allocation from the device-only image arena.
+//
+// The contents of an image that shares memory are lost between frames, and
+// must not be relied upon at its first use. Before that use, the image must
+// be transitioned with RecordFirstUseBarrier, which also waits for any work
+// on the images it shares memory with.
+class TransientImagePlanner {
+ public:
+  TransientImagePlanner(containers::Allocator* allocator,
+                        VulkanApplication* application);
+  ~TransientImagePlanner();
+
+  // Declares an image that is used from pass first_use to pass last_use
+  // of each frame, inclusive. Returns the index of the image.
+  // create_info.initialLayout must be VK_IMAGE_LAYOUT_UNDEFINED.
+  size_t AddImage(const VkImageCreateInfo& create_info, uint32_t first_use,
+                  uint32_t last_use);
+
+  // Creates every image that was added, and binds their memory.
+  // No images may be added after this.
+  void Commit();
+
+  // Returns the image for the given index. Only valid after Commit.
+  ::VkImage image(size_t index) const { return images_[index]; }
+
+  // Records a barrier that transitions image index from
+  // VK_IMAGE_LAYOUT_UNDEFINED to layout, for the first use of the image in
+  // the frame.
+  void RecordFirstUseBarrier(VkCommandBuffer* command_buffer, size_t index,
+                             VkImageAspectFlags aspect, VkImageLayout layout,
+                             VkAccessFlags dst_access,
+                             VkPipelineStageFlags dst_stages) const;
+
+  // Returns true if image index shares any of its memory with another image.
+  bool is_aliased(size_t index) const { return entries_[index].aliased; }
+
+  // Returns the number of bytes of memory that the images are bound to.
+  ::VkDeviceSize memory_size() const { return memory_size_; }
+  // Returns the number of bytes of memory that the images would need if
+  // none of them shared memory.
+  ::VkDeviceSize unaliased_memory_size() const {
+    return unaliased_memory_size_;
+  }
+
+ private:
+  struct Entry {
+    VkImageCreateInfo create_info;
+    uint32_t first_use;
+    uint32_t last_use;
+    VkMemoryRequirements requirements;
+    ::VkDeviceSize offset;
+    bool aliased;
+  };
+
+  // Returns true if the lifetimes of a and b overlap.
+  static bool LifetimesOverlap(const Entry& a, const Entry& b) {
+    return a.first_use <= b.last_use && b.first_use <= a.last_use;
+  }
+  // Returns true if the memory of a and b overlaps.
+  static bool MemoryOverlaps(const Entry& a, const Entry& b) {
+    return a.offset < b.offset + b.requirements.size &&
+           b.offset < a.offset + a.requirements.size;
+  }
+
+  // Sets the offset of every entry, and returns the total size needed.
+  ::VkDeviceSize PlaceEntries();
+
+  containers::Allocator* allocator_;
+  VulkanApplication* application_;
+  containers::vector<Entry> entries_;
+  containers::vector<VkImage> images_;
+  AllocationToken* token_;
+  ::VkDeviceSize memory_size_;
+  ::VkDeviceSize unaliased_memory_size_;
+};
+
+}  // namespace vulkan
+
+#endif  // VULKAN_HELPERS_TRANSIENT_IMAGE_PLANNER_H_
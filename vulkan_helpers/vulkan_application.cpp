@@ -17,9 +17,9 @@
 
 #include <algorithm>
 #include <fstream>
+#include <sstream>
 #include <tuple>
 
-#include "support/containers/unordered_map.h"
 #include "vulkan_helpers/helper_functions.h"
 #include "vulkan_helpers/vulkan_model.h"
 
@@ -30,16 +30,19 @@ namespace vulkan {
 VkDescriptorPool DescriptorSet::CreateDescriptorPool(
     containers::Allocator* allocator, VkDevice* device,
     std::initializer_list<VkDescriptorSetLayoutBinding> bindings) {
-  containers::unordered_map<uint32_t, uint32_t> counts(allocator);
+  // There are only ever a handful of descriptor types, so a linear search
+  // is cheaper than a map.
+  containers::small_vector<VkDescriptorPoolSize, 8> pool_sizes(allocator);
   for (auto binding : bindings) {
-    counts[static_cast<uint32_t>(binding.descriptorType)] +=
-        binding.descriptorCount;
-  }
-
-  containers::vector<VkDescriptorPoolSize> pool_sizes(allocator);
-  pool_sizes.reserve(counts.size());
-  for (auto p : counts) {
-    pool_sizes.push_back({static_cast<VkDescriptorType>(p.first), p.second});
+    auto it = std::find_if(pool_sizes.begin(), pool_sizes.end(),
+                           [&binding](const VkDescriptorPoolSize& size) {
+                             return size.type == binding.descriptorType;
+                           });
+    if (it == pool_sizes.end()) {
+      pool_sizes.push_back({binding.descriptorType, 0});
+      it = pool_sizes.end() - 1;
+    }
+    it->descriptorCount += binding.descriptorCount;
   }
 
   return vulkan::CreateDescriptorPool(
@@ -60,7 +63,8 @@ VulkanApplication::VulkanApplication(
     const std::initializer_list<const char*> extensions,
     const VkPhysicalDeviceFeatures& features, uint32_t host_buffer_size,
     uint32_t device_image_size, uint32_t device_buffer_size,
-    uint32_t coherent_buffer_size, bool use_async_compute_queue)
+    uint32_t coherent_buffer_size, bool use_async_compute_queue,
+    bool thread_safe_memory)
     : allocator_(allocator),
       log_(log),
       entry_data_(entry_data),
@@ -69,9 +73,13 @@ VulkanApplication::VulkanApplication(
       present_queue_(nullptr),
       render_queue_index_(0u),
       present_queue_index_(0u),
-      library_wrapper_(allocator_, log_),
-      instance_(CreateInstanceForApplication(allocator_, &library_wrapper_,
-                                             entry_data_)),
+      host_allocation_callbacks_(allocator_),
+      object_allocator_(allocator_, thread_safe_memory),
+      capture_(CreateCapture()),
+      library_wrapper_(allocator_, log_, true),
+      instance_(CreateInstanceForApplication(
+          allocator_, &library_wrapper_, entry_data_,
+          host_allocation_callbacks_.callbacks())),
       surface_(CreateDefaultSurface(&instance_, entry_data_)),
       device_(CreateDevice(extensions, features, use_async_compute_queue)),
       swapchain_(CreateDefaultSwapchain(&instance_, &device_, &surface_,
@@ -127,6 +135,7 @@ VulkanApplication::VulkanApplication(
 
   vulkan::LoadContainer(log_, device_->vkGetSwapchainImagesKHR,
                         &swapchain_images_, device_, swapchain_);
+  VkAllocationCallbacks* callbacks = device_.allocation_callbacks();
   // Relevant spec sections for determining what memory we will be allowed
   // to use for our buffer allocations.
   //  The memoryTypeBits member is identical for all VkBuffer objects created
@@ -148,22 +157,29 @@ VulkanApplication::VulkanApplication(
   // Furthermore for both types, we will have ZERO flags
   // set (we do not want to do sparse binding.)
 
-  containers::unique_ptr<VulkanArena>* device_memories[3] = {
-      &host_accessible_heap_, &device_only_buffer_heap_, &coherent_heap_};
-  uint32_t device_memory_sizes[3] = {host_buffer_size, device_buffer_size,
-                                     coherent_buffer_size};
+  // The readback heap is used for the same kind of buffers as the
+  // host-visible heap, but the host reads it rather than writing it.
+  containers::unique_ptr<VulkanArena>* device_memories[4] = {
+      &host_accessible_heap_, &device_only_buffer_heap_, &coherent_heap_,
+      &readback_heap_};
+  uint32_t device_memory_sizes[4] = {host_buffer_size, device_buffer_size,
+                                     coherent_buffer_size, host_buffer_size};
 
   const uint32_t kAllBufferBits =
       (VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT << 1) - 1;
 
-  VkBufferUsageFlags usages[3] = {
+  VkBufferUsageFlags usages[4] = {
       VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-      kAllBufferBits, kAllBufferBits};
-  VkMemoryPropertyFlags property_flags[3] = {
-      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT};
-
-  for (size_t i = 0; i < 3; ++i) {
+      kAllBufferBits, kAllBufferBits,
+      VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT};
+  MemoryUsage memory_usages[4] = {MemoryUsage::kUpload, MemoryUsage::kGpuOnly,
+                                  MemoryUsage::kDynamic,
+                                  MemoryUsage::kReadback};
+  // Buffers from the coherent heap are never flushed or invalidated.
+  VkMemoryPropertyFlags property_flags[4] = {
+      0, 0, VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 0};
+
+  for (size_t i = 0; i < 4; ++i) {
     // 1) Create a tiny buffer so that we can determine what memory flags are
     // required.
     VkBufferCreateInfo create_info = {
@@ -177,21 +193,24 @@ VulkanApplication::VulkanApplication(
         nullptr,                               //  pQueueFamilyIndices
     };
     ::VkBuffer buffer;
-    LOG_ASSERT(==, log_,
-               device_->vkCreateBuffer(device_, &create_info, nullptr, &buffer),
+    LOG_ASSERT(==, log_, device_->vkCreateBuffer(device_, &create_info,
+                                                 callbacks, &buffer),
                VK_SUCCESS);
     // Get the memory requirements for this buffer.
     VkMemoryRequirements requirements;
     device_->vkGetBufferMemoryRequirements(device_, buffer, &requirements);
-    device_->vkDestroyBuffer(device_, buffer, nullptr);
+    device_->vkDestroyBuffer(device_, buffer, callbacks);
 
-    uint32_t memory_index = GetMemoryIndex(
-        &device_, log_, requirements.memoryTypeBits, property_flags[i]);
+    uint32_t memory_index = GetMemoryIndexForUsage(
+        &device_, log_, requirements.memoryTypeBits, memory_usages[i],
+        device_memory_sizes[i], property_flags[i]);
     *device_memories[i] = containers::make_unique<VulkanArena>(
-        allocator_, allocator_, log_, device_memory_sizes[i], memory_index,
-        &device_,
-        (property_flags[i] & (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
-                              VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) != 0);
+        allocator_, allocator_, log_,
+        VulkanArena::Policy{ChunkSizeForArena(device_memory_sizes[i]),
+                            device_memory_sizes[i],
+                            kArenaIdleFramesBeforeRelease, usages[i],
+                            thread_safe_memory},
+        memory_index, &device_, memory_usages[i] != MemoryUsage::kGpuOnly);
   }
 
   // Same idea as above, but for image memory.
@@ -226,19 +245,221 @@ VulkanApplication::VulkanApplication(
     };
     ::VkImage image;
     LOG_ASSERT(==, log_, device_->vkCreateImage(device_, &image_create_info,
-                                                nullptr, &image),
+                                                callbacks, &image),
                VK_SUCCESS);
     VkMemoryRequirements requirements;
     device_->vkGetImageMemoryRequirements(device_, image, &requirements);
-    device_->vkDestroyImage(device_, image, nullptr);
+    device_->vkDestroyImage(device_, image, callbacks);
 
-    uint32_t memory_index =
-        GetMemoryIndex(&device_, log_, requirements.memoryTypeBits,
-                       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    uint32_t memory_index = GetMemoryIndexForUsage(
+        &device_, log_, requirements.memoryTypeBits, MemoryUsage::kGpuOnly,
+        device_image_size);
     device_only_image_heap_ = containers::make_unique<VulkanArena>(
-        allocator_, allocator_, log_, device_image_size, memory_index, &device_,
-        false);
+        allocator_, allocator_, log_,
+        VulkanArena::Policy{ChunkSizeForArena(device_image_size),
+                            device_image_size,
+                            kArenaIdleFramesBeforeRelease, 0,
+                            thread_safe_memory},
+        memory_index, &device_, false);
+
+    // Attachments that only live inside a render pass can use lazily
+    // allocated memory, which may never need to be backed at all on tiled
+    // devices. Their memory types are queried separately, since
+    // VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT changes them.
+    // The probe is the size of the swapchain, so that its requirements also
+    // give a chunk size that holds a typical attachment, rather than
+    // committing device_image_size bytes for the first one.
+    image_create_info.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                              VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+    image_create_info.extent.width = swapchain_.width();
+    image_create_info.extent.height = swapchain_.height();
+    LOG_ASSERT(==, log_, device_->vkCreateImage(device_, &image_create_info,
+                                                callbacks, &image),
+               VK_SUCCESS);
+    device_->vkGetImageMemoryRequirements(device_, image, &requirements);
+    device_->vkDestroyImage(device_, image, callbacks);
+
+    memory_index = GetMemoryIndexForUsage(
+        &device_, log_, requirements.memoryTypeBits,
+        MemoryUsage::kTransientAttachment, device_image_size);
+    ::VkDeviceSize transient_chunk_size = ChunkSizeForArena(device_image_size);
+    if (requirements.size < transient_chunk_size) {
+      transient_chunk_size = requirements.size;
+    }
+    transient_attachment_heap_ = containers::make_unique<VulkanArena>(
+        allocator_, allocator_, log_,
+        VulkanArena::Policy{transient_chunk_size, 0,
+                            kArenaIdleFramesBeforeRelease, 0,
+                            thread_safe_memory},
+        memory_index, &device_, false);
   }
+
+  host_accessible_pool_ = containers::make_unique<SlabPool>(
+      allocator_, allocator_, log_, host_accessible_heap_.get(),
+      thread_safe_memory);
+  coherent_pool_ = containers::make_unique<SlabPool>(
+      allocator_, allocator_, log_, coherent_heap_.get(), thread_safe_memory);
+  device_only_buffer_pool_ = containers::make_unique<SlabPool>(
+      allocator_, allocator_, log_, device_only_buffer_heap_.get(),
+      thread_safe_memory);
+  readback_pool_ = containers::make_unique<SlabPool>(
+      allocator_, allocator_, log_, readback_heap_.get(), thread_safe_memory);
+}
+
+VulkanApplication::~VulkanApplication() {
+  const char* file_name = entry_data_->options.memory_stats_file;
+  if (file_name && file_name[0] != '\0') {
+    if (WriteMemoryStatistics(file_name)) {
+      log_->LogInfo("Wrote memory statistics to ", file_name);
+    } else {
+      log_->LogError("Could not write memory statistics to ", file_name);
+    }
+  }
+  file_name = entry_data_->options.call_statistics_file;
+  if (file_name && file_name[0] != '\0') {
+    if (!CallStatistics::enabled()) {
+      log_->LogError("Vulkan calls are not counted in this build, configure "
+                     "with VULKAN_CALL_STATISTICS to write ", file_name);
+    } else if (WriteCallStatistics(file_name)) {
+      log_->LogInfo("Wrote Vulkan call statistics to ", file_name);
+    } else {
+      log_->LogError("Could not write Vulkan call statistics to ", file_name);
+    }
+  }
+}
+
+containers::unique_ptr<Capture> VulkanApplication::CreateCapture() {
+  const char* file_name = entry_data_->options.capture_file;
+  if (!file_name || file_name[0] == '\0') {
+    return nullptr;
+  }
+  if (!Capture::enabled()) {
+    log_->LogError("Vulkan calls are not captured in this build, configure "
+                   "with VULKAN_CAPTURE to write ", file_name);
+    return nullptr;
+  }
+  auto capture = containers::make_unique<Capture>(allocator_, allocator_, log_,
+                                                  file_name);
+  if (!capture->is_open()) {
+    return nullptr;
+  }
+  log_->LogInfo("Capturing Vulkan calls to ", file_name);
+  return capture;
+}
+
+void VulkanApplication::GetMemoryStatistics(
+    MemoryStatistics* statistics) const {
+  host_accessible_heap_->GetStatistics(&statistics->host_accessible_heap);
+  coherent_heap_->GetStatistics(&statistics->coherent_heap);
+  device_only_image_heap_->GetStatistics(&statistics->device_only_image_heap);
+  device_only_buffer_heap_->GetStatistics(
+      &statistics->device_only_buffer_heap);
+  readback_heap_->GetStatistics(&statistics->readback_heap);
+  transient_attachment_heap_->GetStatistics(
+      &statistics->transient_attachment_heap);
+  for (uint32_t i = 0; i < VK_SYSTEM_ALLOCATION_SCOPE_RANGE_SIZE; ++i) {
+    host_allocation_callbacks_.GetStatistics(
+        static_cast<VkSystemAllocationScope>(i),
+        &statistics->driver_host_memory[i]);
+  }
+}
+
+namespace {
+// Writes statistics to stream as a JSON member with the given name.
+void WriteArenaStatisticsJson(std::ostringstream* stream, const char* name,
+                              const ArenaStatistics& statistics) {
+  std::ostringstream& str = *stream;
+  str << "  \"" << name << "\": {\n";
+  str << "    \"allocated_size\": " << statistics.allocated_size << ",\n";
+  str << "    \"peak_allocated_size\": " << statistics.peak_allocated_size
+      << ",\n";
+  str << "    \"used_size\": " << statistics.used_size << ",\n";
+  str << "    \"peak_used_size\": " << statistics.peak_used_size << ",\n";
+  str << "    \"alignment_waste\": " << statistics.alignment_waste << ",\n";
+  str << "    \"allocation_count\": " << statistics.allocation_count << ",\n";
+  str << "    \"chunk_count\": " << statistics.chunk_count << ",\n";
+  str << "    \"free_block_count\": " << statistics.free_block_count << ",\n";
+  str << "    \"free_size\": " << statistics.free_size << ",\n";
+  str << "    \"largest_free_block\": " << statistics.largest_free_block
+      << ",\n";
+  str << "    \"fragmentation\": " << statistics.fragmentation << ",\n";
+  str << "    \"size_histogram\": [";
+  for (uint32_t i = 0; i < ArenaStatistics::kSizeHistogramBuckets; ++i) {
+    str << (i ? ", " : "") << statistics.size_histogram[i];
+  }
+  str << "]\n";
+  str << "  }";
+}
+
+// Writes the driver's host memory statistics to stream as a JSON member,
+// with one member per VkSystemAllocationScope.
+void WriteDriverHostMemoryJson(
+    std::ostringstream* stream,
+    const HostAllocationCallbacks::ScopeStatistics* statistics) {
+  const char* scope_names[VK_SYSTEM_ALLOCATION_SCOPE_RANGE_SIZE] = {
+      "command", "object", "cache", "device", "instance"};
+  std::ostringstream& str = *stream;
+  str << "  \"driver_host_memory\": {\n";
+  for (uint32_t i = 0; i < VK_SYSTEM_ALLOCATION_SCOPE_RANGE_SIZE; ++i) {
+    str << "    \"" << scope_names[i] << "\": {";
+    str << "\"allocated_size\": " << statistics[i].allocated_size << ", ";
+    str << "\"peak_allocated_size\": " << statistics[i].peak_allocated_size
+        << ", ";
+    str << "\"allocation_count\": " << statistics[i].allocation_count
+        << ", ";
+    str << "\"internal_size\": " << statistics[i].internal_size << "}";
+    str << (i + 1 < VK_SYSTEM_ALLOCATION_SCOPE_RANGE_SIZE ? ",\n" : "\n");
+  }
+  str << "  }";
+}
+}  // anonymous namespace
+
+containers::string VulkanApplication::GetMemoryStatisticsJson() const {
+  MemoryStatistics statistics;
+  GetMemoryStatistics(&statistics);
+  std::ostringstream str;
+  str << "{\n";
+  WriteArenaStatisticsJson(&str, "host_accessible_heap",
+                           statistics.host_accessible_heap);
+  str << ",\n";
+  WriteArenaStatisticsJson(&str, "coherent_heap", statistics.coherent_heap);
+  str << ",\n";
+  WriteArenaStatisticsJson(&str, "device_only_image_heap",
+                           statistics.device_only_image_heap);
+  str << ",\n";
+  WriteArenaStatisticsJson(&str, "device_only_buffer_heap",
+                           statistics.device_only_buffer_heap);
+  str << ",\n";
+  WriteArenaStatisticsJson(&str, "readback_heap", statistics.readback_heap);
+  str << ",\n";
+  WriteArenaStatisticsJson(&str, "transient_attachment_heap",
+                           statistics.transient_attachment_heap);
+  str << ",\n";
+  WriteDriverHostMemoryJson(&str, statistics.driver_host_memory);
+  str << "\n}\n";
+  return containers::string(str.str().c_str(), allocator_);
+}
+
+bool VulkanApplication::WriteMemoryStatistics(const char* file_name) const {
+  std::ofstream file;
+  file.open(file_name);
+  if (!file.is_open()) {
+    return false;
+  }
+  file << GetMemoryStatisticsJson();
+  file.close();
+  return !file.fail();
+}
+
+bool VulkanApplication::WriteCallStatistics(const char* file_name) const {
+  std::ofstream file;
+  file.open(file_name);
+  if (!file.is_open()) {
+    return false;
+  }
+  CallStatistics::WriteJson(file);
+  file.close();
+  return !file.fail();
 }
 
 VkDevice VulkanApplication::CreateDevice(
@@ -253,7 +474,8 @@ VkDevice VulkanApplication::CreateDevice(
       allocator_, &instance_, &surface_, &render_queue_index_,
       &present_queue_index_, extensions, features,
       entry_data_->options.prefer_separate_present,
-      create_async_compute_queue ? &compute_queue_index_ : nullptr));
+      create_async_compute_queue ? &compute_queue_index_ : nullptr,
+      host_allocation_callbacks_.callbacks()));
   if (device.is_valid()) {
     if (render_queue_index_ == present_queue_index_) {
       render_queue_concrete_ = containers::make_unique<VkQueue>(
@@ -278,11 +500,36 @@ VkDevice VulkanApplication::CreateDevice(
   return std::move(device);
 }
 
+AllocationToken* VulkanApplication::AllocateImageMemory(
+    const VkMemoryRequirements& requirements, ::VkDeviceMemory* memory,
+    ::VkDeviceSize* offset) {
+  LOG_ASSERT(!=, log_, 0u,
+             requirements.memoryTypeBits &
+                 (1u << device_only_image_heap_->memory_type_index()));
+  return device_only_image_heap_->AllocateMemory(
+      requirements.size, requirements.alignment, memory, offset, nullptr);
+}
+
 containers::unique_ptr<VulkanApplication::Image>
 VulkanApplication::CreateAndBindImage(const VkImageCreateInfo* create_info) {
+  return CreateAndBindImage(device_only_image_heap_.get(), create_info);
+}
+
+containers::unique_ptr<VulkanApplication::Image>
+VulkanApplication::CreateAndBindTransientAttachment(
+    const VkImageCreateInfo* create_info) {
+  LOG_ASSERT(!=, log_, 0u,
+             create_info->usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+  return CreateAndBindImage(transient_attachment_heap_.get(), create_info);
+}
+
+containers::unique_ptr<VulkanApplication::Image>
+VulkanApplication::CreateAndBindImage(VulkanArena* heap,
+                                      const VkImageCreateInfo* create_info) {
   ::VkImage image;
+  VkAllocationCallbacks* callbacks = device_.allocation_callbacks();
   LOG_ASSERT(==, log_,
-             device_->vkCreateImage(device_, create_info, nullptr, &image),
+             device_->vkCreateImage(device_, create_info, callbacks, &image),
              VK_SUCCESS);
   VkMemoryRequirements requirements;
   device_->vkGetImageMemoryRequirements(device_, image, &requirements);
@@ -290,19 +537,30 @@ VulkanApplication::CreateAndBindImage(const VkImageCreateInfo* create_info) {
   ::VkDeviceMemory memory;
   ::VkDeviceSize offset;
 
-  AllocationToken* token = device_only_image_heap_->AllocateMemory(
+  // The transient attachment Arena was probed with a color attachment.
+  // Other formats, such as depth formats, may not support its memory type,
+  // in which case the image is bound to ordinary device-only memory instead.
+  if (heap == transient_attachment_heap_.get() &&
+      !(requirements.memoryTypeBits & (1u << heap->memory_type_index()))) {
+    log_->LogInfo("Transient attachment of format ", create_info->format,
+                  " cannot use the transient attachment memory type");
+    heap = device_only_image_heap_.get();
+  }
+  LOG_ASSERT(!=, log_, 0u,
+             requirements.memoryTypeBits & (1u << heap->memory_type_index()));
+  AllocationToken* token = heap->AllocateMemory(
       requirements.size, requirements.alignment, &memory, &offset, nullptr);
 
   device_->vkBindImageMemory(device_, image, memory, offset);
 
   // We have to do it this way because Image is private and friended,
   // so we cannot go through make_unique.
-  Image* img = new (allocator_->malloc(sizeof(Image)))
-      Image(device_only_image_heap_.get(), token,
-            VkImage(image, nullptr, &device_), create_info->format);
+  Image* img = new (object_allocator_.malloc(sizeof(Image)))
+      Image(heap, token, VkImage(image, callbacks, &device_),
+            create_info->format);
 
   return containers::unique_ptr<Image>(
-      img, containers::UniqueDeleter(allocator_, sizeof(Image)));
+      img, containers::UniqueDeleter(&object_allocator_, sizeof(Image)));
 }
 
 containers::unique_ptr<VkImageView> VulkanApplication::CreateImageView(
@@ -320,19 +578,21 @@ containers::unique_ptr<VkImageView> VulkanApplication::CreateImageView(
       subresource_range,
   };
   ::VkImageView raw_view;
+  VkAllocationCallbacks* callbacks = device_.allocation_callbacks();
   LOG_ASSERT(==, log_, device_->vkCreateImageView(device_, &create_info,
-                                                  nullptr, &raw_view),
+                                                  callbacks, &raw_view),
              VK_SUCCESS);
   return containers::make_unique<vulkan::VkImageView>(
-      allocator_, VkImageView(raw_view, nullptr, &device_));
+      &object_allocator_, VkImageView(raw_view, callbacks, &device_));
 }
 
 containers::unique_ptr<VulkanApplication::Buffer>
-VulkanApplication::CreateAndBindBuffer(VulkanArena* heap,
+VulkanApplication::CreateAndBindBuffer(VulkanArena* heap, SlabPool* pool,
                                        const VkBufferCreateInfo* create_info) {
   ::VkBuffer buffer;
+  VkAllocationCallbacks* callbacks = device_.allocation_callbacks();
   LOG_ASSERT(==, log_,
-             device_->vkCreateBuffer(device_, create_info, nullptr, &buffer),
+             device_->vkCreateBuffer(device_, create_info, callbacks, &buffer),
              VK_SUCCESS);
   // Get the memory requirements for this buffer.
   VkMemoryRequirements requirements;
@@ -341,30 +601,115 @@ VulkanApplication::CreateAndBindBuffer(VulkanArena* heap,
   ::VkDeviceSize offset;
   char* base_address;
 
-  AllocationToken* token =
-      heap->AllocateMemory(requirements.size, requirements.alignment, &memory,
-                           &offset, &base_address);
+  AllocationToken* token = nullptr;
+  SlabPool::Allocation slot = {};
+  if (pool->Allocate(requirements.size, requirements.alignment, &slot)) {
+    memory = slot.memory;
+    offset = slot.offset;
+    base_address = slot.base_address;
+  } else {
+    token = heap->AllocateMemory(requirements.size, requirements.alignment,
+                                 &memory, &offset, &base_address);
+  }
 
   device_->vkBindBufferMemory(device_, buffer, memory, offset);
 
-  Buffer* buff = new (allocator_->malloc(sizeof(Buffer))) Buffer(
-      heap, token, VkBuffer(buffer, nullptr, &device_), base_address, device_,
-      memory, offset, requirements.size, &(device_->vkFlushMappedMemoryRanges),
+  Buffer* buff = new (object_allocator_.malloc(sizeof(Buffer))) Buffer(
+      heap, token, slot.slab, slot.slot, VkBuffer(buffer, callbacks, &device_),
+      base_address, device_, memory, offset, requirements.size,
+      &(device_->vkFlushMappedMemoryRanges),
       &(device_->vkInvalidateMappedMemoryRanges));
   return containers::unique_ptr<Buffer>(
-      buff, containers::UniqueDeleter(allocator_, sizeof(Buffer)));
+      buff, containers::UniqueDeleter(&object_allocator_, sizeof(Buffer)));
+}
+
+containers::unique_ptr<VulkanApplication::BufferSlice>
+VulkanApplication::CreateBufferSlice(VulkanArena* heap, ::VkDeviceSize size,
+                                     VkBufferUsageFlags usage) {
+  // Every slice of an arena shares the arena's buffers, so the usage cannot
+  // be chosen per slice.
+  LOG_ASSERT(==, log_, usage, usage & heap->buffer_usage());
+  ::VkBuffer buffer;
+  ::VkDeviceMemory memory;
+  ::VkDeviceSize offset;
+  char* base_address;
+  AllocationToken* token = heap->AllocateBufferRange(
+      size, 1, &buffer, &memory, &offset, &base_address);
+
+  BufferSlice* slice = new (object_allocator_.malloc(sizeof(BufferSlice)))
+      BufferSlice(heap, token, buffer, base_address, device_, memory, offset,
+                  size, &(device_->vkFlushMappedMemoryRanges),
+                  &(device_->vkInvalidateMappedMemoryRanges));
+  return containers::unique_ptr<BufferSlice>(
+      slice,
+      containers::UniqueDeleter(&object_allocator_, sizeof(BufferSlice)));
+}
+
+containers::unique_ptr<VulkanApplication::BufferSlice>
+VulkanApplication::CreateHostBufferSlice(::VkDeviceSize size,
+                                         VkBufferUsageFlags usage) {
+  return CreateBufferSlice(host_accessible_heap_.get(), size, usage);
+}
+
+containers::unique_ptr<VulkanApplication::BufferSlice>
+VulkanApplication::CreateCoherentBufferSlice(::VkDeviceSize size,
+                                             VkBufferUsageFlags usage) {
+  return CreateBufferSlice(coherent_heap_.get(), size, usage);
+}
+
+containers::unique_ptr<VulkanApplication::BufferSlice>
+VulkanApplication::CreateDeviceBufferSlice(::VkDeviceSize size,
+                                           VkBufferUsageFlags usage) {
+  return CreateBufferSlice(device_only_buffer_heap_.get(), size, usage);
+}
+
+TransientArena* VulkanApplication::transient_arena() {
+  if (!transient_arena_) {
+    VkBufferCreateInfo create_info = {
+        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,  // sType
+        nullptr,                               // pNext
+        0,                                     // flags
+        kTransientArenaSize,                   // size
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,  // usage
+        VK_SHARING_MODE_EXCLUSIVE,               // sharingMode
+        0,                                       // queueFamilyIndexCount
+        nullptr                                  // pQueueFamilyIndices
+    };
+    // Leave most of a small host-visible heap for the dedicated buffers
+    // that callers fall back on when the arena is full.
+    const ::VkDeviceSize host_size = host_accessible_heap_->max_size();
+    if (host_size != 0 && host_size / 4 < create_info.size) {
+      create_info.size = host_size / 4;
+    }
+    transient_buffer_ = CreateAndBindHostBuffer(&create_info);
+    transient_arena_ = containers::make_unique<TransientArena>(
+        allocator_, allocator_, log_, &device_, *transient_buffer_,
+        transient_buffer_->memory_, transient_buffer_->offset_,
+        transient_buffer_->size(), transient_buffer_->base_address());
+  }
+  return transient_arena_.get();
 }
 
 containers::unique_ptr<VulkanApplication::Buffer>
 VulkanApplication::CreateAndBindHostBuffer(
     const VkBufferCreateInfo* create_info) {
-  return CreateAndBindBuffer(host_accessible_heap_.get(), create_info);
+  return CreateAndBindBuffer(host_accessible_heap_.get(),
+                             host_accessible_pool_.get(), create_info);
 }
 
 containers::unique_ptr<VulkanApplication::Buffer>
 VulkanApplication::CreateAndBindCoherentBuffer(
     const VkBufferCreateInfo* create_info) {
-  return CreateAndBindBuffer(coherent_heap_.get(), create_info);
+  return CreateAndBindBuffer(coherent_heap_.get(), coherent_pool_.get(),
+                             create_info);
+}
+
+containers::unique_ptr<VulkanApplication::Buffer>
+VulkanApplication::CreateAndBindReadbackBuffer(
+    const VkBufferCreateInfo* create_info) {
+  return CreateAndBindBuffer(readback_heap_.get(), readback_pool_.get(),
+                             create_info);
 }
 
 containers::unique_ptr<VulkanApplication::Buffer>
@@ -402,7 +747,8 @@ VulkanApplication::CreateAndBindDefaultExclusiveCoherentBuffer(
 containers::unique_ptr<VulkanApplication::Buffer>
 VulkanApplication::CreateAndBindDeviceBuffer(
     const VkBufferCreateInfo* create_info) {
-  return CreateAndBindBuffer(device_only_buffer_heap_.get(), create_info);
+  return CreateAndBindBuffer(device_only_buffer_heap_.get(),
+                             device_only_buffer_pool_.get(), create_info);
 }
 
 containers::unique_ptr<VulkanApplication::Buffer>
@@ -434,11 +780,12 @@ containers::unique_ptr<VkBufferView> VulkanApplication::CreateBufferView(
       range,                                     // range
   };
   ::VkBufferView raw_view;
+  VkAllocationCallbacks* callbacks = device_.allocation_callbacks();
   LOG_ASSERT(==, log_, device_->vkCreateBufferView(device_, &create_info,
-                                                   nullptr, &raw_view),
+                                                   callbacks, &raw_view),
              VK_SUCCESS);
   return containers::make_unique<vulkan::VkBufferView>(
-      allocator_, VkBufferView(raw_view, nullptr, &device_));
+      &object_allocator_, VkBufferView(raw_view, callbacks, &device_));
 }
 
 std::tuple<bool, VkCommandBuffer, BufferPointer>
@@ -464,25 +811,45 @@ VulkanApplication::FillImageLayersData(
     return failure_return;
   }
 
-  containers::vector<::VkSemaphore> waits(wait_semaphores, allocator_);
-  containers::vector<::VkSemaphore> signals(signal_semaphores, allocator_);
-  containers::vector<VkPipelineStageFlags> wait_dst_stage_masks(
+  containers::small_vector<::VkSemaphore, 4> waits(wait_semaphores,
+                                                   allocator_);
+  containers::small_vector<::VkSemaphore, 4> signals(signal_semaphores,
+                                                     allocator_);
+  containers::small_vector<VkPipelineStageFlags, 4> wait_dst_stage_masks(
       waits.size(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, allocator_);
 
-  // Prepare the buffer to be used for data copying.
-  VkBufferCreateInfo buf_create_info{
-      VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-      nullptr,
-      0,
-      data.size(),
-      VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-      VK_SHARING_MODE_EXCLUSIVE,
-      0,
-      nullptr,
-  };
-  BufferPointer src_buffer = CreateAndBindHostBuffer(&buf_create_info);
-  std::copy_n(data.begin(), data.size(), src_buffer->base_address());
-  src_buffer->flush();
+  // Prepare the buffer to be used for data copying. If nothing else is
+  // waiting to be retired from the transient arena, and the caller has not
+  // given a fence of its own, stage the data there, so that it is retired
+  // with the fence of the submission below. Otherwise fall back to a
+  // dedicated buffer.
+  BufferPointer src_buffer(nullptr);
+  TransientArena* transient = transient_arena();
+  TransientArena::Allocation staging;
+  const bool use_transient =
+      fence == VK_NULL_HANDLE && !transient->has_unretired_allocations() &&
+      transient->Allocate(data.size(),
+                          GetBufferImageCopyOffsetAlignment(img->format()),
+                          &staging);
+  if (use_transient) {
+    std::copy_n(data.begin(), data.size(), staging.base_address);
+    transient->Flush(staging);
+  } else {
+    VkBufferCreateInfo buf_create_info{
+        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        nullptr,
+        0,
+        data.size(),
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VK_SHARING_MODE_EXCLUSIVE,
+        0,
+        nullptr,
+    };
+    src_buffer = CreateAndBindHostBuffer(&buf_create_info);
+    std::copy_n(data.begin(), data.size(), src_buffer->base_address());
+    src_buffer->flush();
+    staging = {*src_buffer, 0, data.size(), src_buffer->base_address()};
+  }
 
   // Get a command buffer and add commands/barriers to it.
   VkCommandBuffer command_buffer = GetCommandBuffer();
@@ -498,8 +865,8 @@ VulkanApplication::FillImageLayersData(
       VK_ACCESS_TRANSFER_READ_BIT,
       VK_QUEUE_FAMILY_IGNORED,
       VK_QUEUE_FAMILY_IGNORED,
-      *src_buffer,
-      0,
+      staging.buffer,
+      staging.offset,
       data.size(),
   };
   // Add an image barrier to change the layout set its access bit to transfer
@@ -525,8 +892,8 @@ VulkanApplication::FillImageLayersData(
       &image_barrier);
   // Copy data to the image.
   VkBufferImageCopy copy_info{
-      0, 0, 0, image_subresource, image_offset, image_extent};
-  command_buffer->vkCmdCopyBufferToImage(command_buffer, *src_buffer, *img,
+      staging.offset, 0, 0, image_subresource, image_offset, image_extent};
+  command_buffer->vkCmdCopyBufferToImage(command_buffer, staging.buffer, *img,
                                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                                          1, &copy_info);
   // Add a global barrier at the end to make sure the data written to the
@@ -558,6 +925,9 @@ VulkanApplication::FillImageLayersData(
       uint32_t(signals.size()),                         // signalSemaphoreCount
       signals.size() == 0 ? nullptr : signals.data()    // pSignalSemaphores
   };
+  if (use_transient) {
+    fence = transient->Retire();
+  }
   (*render_queue_)->vkQueueSubmit(render_queue(), 1, &submit_info, fence);
   return std::make_tuple(true, std::move(command_buffer),
                          std::move(src_buffer));
@@ -613,7 +983,7 @@ void VulkanApplication::FillHostVisibleBuffer(Buffer* buffer, const void* data,
   const char* d = reinterpret_cast<const char*>(data);
   size_t size = buffer->size() < data_size ? buffer->size() : data_size;
   memcpy(p + buffer_offset, d, size);
-  buffer->flush();
+  buffer->mark_host_written(buffer_offset, size);
   if (command_buffer) {
     VkBufferMemoryBarrier buf_barrier{
         VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
@@ -660,6 +1030,8 @@ bool VulkanApplication::DumpImageLayersData(
   }
 
   data->reserve(image_size);
+  // The host reads this buffer, so it comes from the readback heap rather
+  // than the transient arena.
   VkBufferCreateInfo buf_create_info = {
       VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,  // sType
       nullptr,                               // pNext
@@ -670,7 +1042,8 @@ bool VulkanApplication::DumpImageLayersData(
       0,                                     // queueFamilyIndexCount
       nullptr                                // pQueueFamilyIndices
   };
-  vulkan::BufferPointer dst_buffer = CreateAndBindHostBuffer(&buf_create_info);
+  vulkan::BufferPointer dst_buffer =
+      CreateAndBindReadbackBuffer(&buf_create_info);
 
   // Get a command buffer and add commands/barriers to it.
   VkCommandBuffer command_buffer = GetCommandBuffer();
@@ -688,7 +1061,7 @@ bool VulkanApplication::DumpImageLayersData(
       VK_QUEUE_FAMILY_IGNORED,
       *dst_buffer,
       0,
-      data->size(),
+      image_size,
   };
   // Add an image barrier to change the layout and set its access bit to
   // transfer read.
@@ -726,6 +1099,7 @@ bool VulkanApplication::DumpImageLayersData(
       command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
       VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &end_barrier, 0, nullptr, 0, nullptr);
   command_buffer->vkEndCommandBuffer(command_buffer);
+  dst_buffer->mark_device_written(0, image_size);
   // Submit the command buffer.
   ::VkCommandBuffer raw_cmd_buf = command_buffer.get_command_buffer();
   VkSubmitInfo submit_info{
@@ -745,136 +1119,244 @@ bool VulkanApplication::DumpImageLayersData(
                       static_cast<::VkFence>(VK_NULL_HANDLE));
   (*render_queue_)->vkQueueWaitIdle(render_queue());
   // Copy the data from the buffer to |data|.
-  dst_buffer->invalidate();
+  InvalidateDeviceWrites();
   std::for_each(dst_buffer->base_address(),
                 dst_buffer->base_address() + image_size,
                 [&data](uint8_t c) { data->push_back(c); });
   return true;
 }
 
-// These linked-list nodes are ordered by offset into the heap.
-// the first node has a prev of nullptr, and the last node has a next of
-// nullptr.
-struct AllocationToken {
-  AllocationToken* next;
-  AllocationToken* prev;
-  ::VkDeviceSize allocationSize;
-  ::VkDeviceSize offset;
-  // Location into the map of unused chunks. This is only valid when
-  // in_use == false.
-  containers::ordered_multimap<::VkDeviceSize, AllocationToken*>::iterator
-      map_location;
-  bool in_use;
-};
-
 VulkanArena::VulkanArena(containers::Allocator* allocator, logging::Logger* log,
-                         ::VkDeviceSize buffer_size, uint32_t memory_type_index,
+                         const Policy& policy, uint32_t memory_type_index,
                          VkDevice* device, bool map)
     : allocator_(allocator),
-      freeblocks_(allocator_),
-      first_block_(nullptr),
-      base_address_(nullptr),
-      device_(*device),
-      unmap_memory_function_(nullptr),
-      memory_(VK_NULL_HANDLE, nullptr, device),
+      policy_(policy),
+      memory_type_index_(memory_type_index),
+      map_(map),
+      needs_flush_(map && !(device->physical_device_memory_properties()
+                                .memoryTypes[memory_type_index]
+                                .propertyFlags &
+                            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)),
+      first_chunk_(nullptr),
+      last_chunk_(nullptr),
+      allocated_size_(0),
+      peak_allocated_size_(0),
+      used_size_(0),
+      peak_used_size_(0),
+      alignment_waste_(0),
+      allocation_count_(0),
+      host_writes_(allocator),
+      device_writes_(allocator),
+      device_(device),
       log_(log) {
-  // Actually allocate the bytes for this heap.
+  for (uint32_t i = 0; i < ArenaStatistics::kSizeHistogramBuckets; ++i) {
+    size_histogram_[i].store(0);
+  }
+}
+
+VulkanArena::~VulkanArena() {
+  // Make sure that there are no allocations left.
+  // This will trigger if someone has not freed all the memory before the
+  // heap has been destroyed.
+  Chunk* chunk = first_chunk_.load();
+  while (chunk) {
+    LOG_ASSERT(==, log_, true, chunk->blocks.empty());
+    if (chunk->blocks.size() != 0) {
+      ReleaseChunk(chunk);
+    }
+    Chunk* next = chunk->next.load();
+    allocator_->destroy(chunk);
+    chunk = next;
+  }
+}
+
+// The maximum value for nonCoherentAtomSize from the vulkan spec.
+// Table 31.2. Required Limits
+// See 10.2.1. Host Access to Device Memory Objects for
+// a description of why this must be used.
+static const ::VkDeviceSize kMaxNonCoherentAtomSize = 256;
+
+// Rounds size up to a multiple of kMaxNonCoherentAtomSize.
+static ::VkDeviceSize RoundUpToAtomSize(::VkDeviceSize size) {
+  return (size + kMaxNonCoherentAtomSize - 1) & ~(kMaxNonCoherentAtomSize - 1);
+}
+
+VulkanArena::Chunk* VulkanArena::AllocateChunk(
+    ::VkDeviceSize min_size, std::unique_lock<std::mutex>* chunk_lock) {
+  // Chunks are always a multiple of the atom size, so that the buffer
+  // spanning a chunk can be used for every allocation in it.
+  min_size = RoundUpToAtomSize(min_size);
+  ::VkDeviceSize buffer_size = RoundUpToAtomSize(
+      policy_.chunk_size > min_size ? policy_.chunk_size : min_size);
+  const ::VkDeviceSize allocated_size = allocated_size_.load();
+  if (policy_.max_size != 0) {
+    if (allocated_size + min_size > policy_.max_size) {
+      log_->LogError("Arena is limited to ", policy_.max_size,
+                     " bytes, and cannot grow by ", min_size, " more bytes");
+      return nullptr;
+    }
+    if (allocated_size + buffer_size > policy_.max_size) {
+      buffer_size = (policy_.max_size - allocated_size) &
+                    ~(kMaxNonCoherentAtomSize - 1);
+    }
+  }
+
+  // Actually allocate the bytes for this chunk.
   VkMemoryAllocateInfo allocate_info{
       VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,  // sType
       nullptr,                                 // pNext
       buffer_size,                             // allocationSize
-      memory_type_index};
+      memory_type_index_};
 
   VkResult res = VK_SUCCESS;
   ::VkDeviceMemory device_memory;
   VkDeviceSize original_size = buffer_size;
 
-  const auto& memory_properties = device->physical_device_memory_properties();
+  const auto& memory_properties = device_->physical_device_memory_properties();
 
-  log->LogInfo("Trying to allocate ", buffer_size, " bytes from heap that has ",
-               memory_properties
-                   .memoryHeaps[memory_properties.memoryTypes[memory_type_index]
-                                    .heapIndex]
-                   .size,
-               " bytes.");
+  log_->LogInfo(
+      "Trying to allocate ", buffer_size, " bytes from heap that has ",
+      memory_properties
+          .memoryHeaps[memory_properties.memoryTypes[memory_type_index_]
+                           .heapIndex]
+          .size,
+      " bytes.");
 
   do {
     if (res == VK_ERROR_OUT_OF_DEVICE_MEMORY) {
-      log->LogInfo("Could not allocate ", buffer_size,
-                   " bytes of "
-                   "device memory. Attempting to allocate ",
-                   static_cast<size_t>(buffer_size * 0.75), " bytes instead");
-      buffer_size =
-          static_cast<VkDeviceSize>(static_cast<float>(buffer_size) * 0.75f);
+      ::VkDeviceSize smaller_size = RoundUpToAtomSize(
+          static_cast<VkDeviceSize>(static_cast<float>(buffer_size) * 0.75f));
+      if (smaller_size < min_size) {
+        smaller_size = min_size;
+      }
+      log_->LogInfo("Could not allocate ", buffer_size,
+                    " bytes of "
+                    "device memory. Attempting to allocate ",
+                    smaller_size, " bytes instead");
+      buffer_size = smaller_size;
       allocate_info.allocationSize = buffer_size;
     }
 
-    res = (*device)->vkAllocateMemory(*device, &allocate_info, nullptr,
-                                      &device_memory);
-    // If we cannot even allocate 1/4 of the requested memory, it is time to
-    // fail.
+    res = (*device_)->vkAllocateMemory(*device_, &allocate_info,
+                                       device_->allocation_callbacks(),
+                                       &device_memory);
+    // If we cannot even allocate 1/4 of the requested memory, or the
+    // amount of memory that we actually need, it is time to fail.
   } while (res == VK_ERROR_OUT_OF_DEVICE_MEMORY &&
-           buffer_size > original_size / 4);
-  LOG_ASSERT(==, log, VK_SUCCESS, res);
-  memory_.initialize(device_memory);
+           buffer_size > original_size / 4 && buffer_size > min_size);
+  if (res != VK_SUCCESS) {
+    log_->LogError("Could not allocate a chunk of ", buffer_size,
+                   " bytes: ", res);
+    return nullptr;
+  }
 
-  // Create a new pointer that is the first block of memory. It contains
-  // all of the memory in the arena.
-  first_block_ = allocator_->construct<AllocationToken>(AllocationToken{
-      nullptr, nullptr, buffer_size, 0, freeblocks_.end(), false});
+  // Reuse a chunk whose memory has been released if there is one,
+  // otherwise add a new chunk to the end of the list.
+  Chunk* chunk = first_chunk_.load();
+  while (chunk) {
+    auto lock = Lock(&chunk->mutex);
+    if (chunk->blocks.size() == 0) {
+      break;
+    }
+    chunk = chunk->next.load();
+  }
+  if (!chunk) {
+    chunk = allocator_->construct<Chunk>(allocator_, device_);
+    if (last_chunk_) {
+      last_chunk_->next.store(chunk);
+    } else {
+      first_chunk_.store(chunk);
+    }
+    last_chunk_ = chunk;
+  }
 
-  // Since this has not been used yet, add it to our freeblock_ map.
-  first_block_->map_location =
-      freeblocks_.insert(std::make_pair(buffer_size, first_block_));
+  *chunk_lock = Lock(&chunk->mutex);
+  chunk->memory.initialize(device_memory);
+  chunk->blocks.Reset(buffer_size);
+  chunk->idle_frames = 0;
+  if (allocated_size + buffer_size > peak_allocated_size_) {
+    peak_allocated_size_ = allocated_size + buffer_size;
+  }
+  allocated_size_ += buffer_size;
 
-  if (map) {
+  if (map_) {
     // If we were asked to map this memory. (i.e. it is meant to be host
     // visible), then do it now.
-    LOG_ASSERT(
-        ==, log, VK_SUCCESS,
-        (*device)->vkMapMemory(*device, memory_, 0, buffer_size, 0,
-                               reinterpret_cast<void**>(&base_address_)));
-    // Store off the devices unmap memory function for the future, we only
-    // want to keep a reference to the raw device, and not the
-    // vulkan::VkDevice since vulkan::VkDevice is movable.
-    unmap_memory_function_ = &(*device)->vkUnmapMemory;
+    LOG_ASSERT(==, log_, VK_SUCCESS,
+               (*device_)->vkMapMemory(
+                   *device_, chunk->memory, 0, buffer_size, 0,
+                   reinterpret_cast<void**>(&chunk->base_address)));
   }
+  return chunk;
 }
 
-VulkanArena::~VulkanArena() {
-  // Make sure that there is only one block left, and that is is not in use.
-  // This will trigger if someone has not freed all the memory before the
-  // heap has been destroyed.
-  LOG_ASSERT(==, log_, true, first_block_->next == nullptr);
-  LOG_ASSERT(==, log_, false, first_block_->in_use);
-  if (base_address_) {
-    (*unmap_memory_function_)(device_, memory_);
+void VulkanArena::ReleaseChunk(Chunk* chunk) {
+  {
+    // Pending ranges in this chunk can no longer be flushed or invalidated.
+    auto lock = Lock(&writes_mutex_);
+    const ::VkDeviceMemory memory = chunk->memory;
+    auto in_chunk = [memory](const VkMappedMemoryRange& range) {
+      return range.memory == memory;
+    };
+    host_writes_.erase(
+        std::remove_if(host_writes_.begin(), host_writes_.end(), in_chunk),
+        host_writes_.end());
+    device_writes_.erase(
+        std::remove_if(device_writes_.begin(), device_writes_.end(), in_chunk),
+        device_writes_.end());
   }
-  allocator_->destroy(first_block_);
+  if (chunk->base_address) {
+    (*device_)->vkUnmapMemory(*device_, chunk->memory);
+    chunk->base_address = nullptr;
+  }
+  VkAllocationCallbacks* callbacks = device_->allocation_callbacks();
+  chunk->buffer = VkBuffer(VK_NULL_HANDLE, callbacks, device_);
+  chunk->memory = VkDeviceMemory(VK_NULL_HANDLE, callbacks, device_);
+  allocated_size_ -= chunk->blocks.size();
+  chunk->blocks.Reset(0);
+  chunk->idle_frames = 0;
 }
 
-// The maximum value for nonCoherentAtomSize from the vulkan spec.
-// Table 31.2. Required Limits
-// See 10.2.1. Host Access to Device Memory Objects for
-// a description of why this must be used.
-static const ::VkDeviceSize kMaxNonCoherentAtomSize = 256;
+void VulkanArena::ReleaseIdleChunks() {
+  auto growth_lock = Lock(&growth_mutex_);
+  for (Chunk* chunk = first_chunk_.load(); chunk; chunk = chunk->next.load()) {
+    auto lock = Lock(&chunk->mutex);
+    if (chunk->blocks.size() == 0) {
+      continue;
+    }
+    if (!chunk->blocks.empty()) {
+      chunk->idle_frames = 0;
+      continue;
+    }
+    if (++chunk->idle_frames <= policy_.idle_frames_before_release) {
+      continue;
+    }
+    log_->LogInfo("Releasing idle chunk of ", chunk->blocks.size(),
+                  " bytes");
+    ReleaseChunk(chunk);
+  }
+}
 
-AllocationToken* VulkanArena::AllocateMemory(::VkDeviceSize size,
-                                             ::VkDeviceSize alignment,
-                                             ::VkDeviceMemory* memory,
-                                             ::VkDeviceSize* offset,
-                                             char** base_address) {
+void VulkanArena::RoundForMapping(::VkDeviceSize* size,
+                                  ::VkDeviceSize* alignment) const {
   // If we are mapped memory, then no matter what alignment says, we
   // must also be aligned to kMaxNonCoherentAtomSize AND
   // for all intents and purposes our size must be a multiple of
   // kMaxNonCoherentAtomSize
-  if (base_address_) {
-    alignment = alignment > kMaxNonCoherentAtomSize ? alignment
-                                                    : kMaxNonCoherentAtomSize;
-    if ((size % kMaxNonCoherentAtomSize) != 0) {
-      size += (kMaxNonCoherentAtomSize - (size % kMaxNonCoherentAtomSize));
-    }
+  if (map_) {
+    *alignment = *alignment > kMaxNonCoherentAtomSize ? *alignment
+                                                      : kMaxNonCoherentAtomSize;
+    *size = RoundUpToAtomSize(*size);
   }
+}
+
+AllocationToken* VulkanArena::AllocateMemory(::VkDeviceSize size,
+                                             ::VkDeviceSize alignment,
+                                             ::VkDeviceMemory* memory,
+                                             ::VkDeviceSize* offset,
+                                             char** base_address) {
+  const ::VkDeviceSize requested_size = size;
+  RoundForMapping(&size, &alignment);
 
   // We use alignment - 1 quite a bit, so store it off here.
   const ::VkDeviceSize align_m_1 = alignment - 1;
@@ -882,126 +1364,374 @@ AllocationToken* VulkanArena::AllocateMemory(::VkDeviceSize size,
   LOG_ASSERT(==, log_, !(alignment & (align_m_1)),
              true);  // Alignment must be power of 2.
 
-  // This is the maximum amount of memory we will potentially have to
-  // allocate in order to satisfy the alignment.
-  ::VkDeviceSize to_allocate = size + align_m_1;
-
-  // Find a block that contains at LEAST enough memory for our allocation.
-  auto it = freeblocks_.lower_bound(to_allocate);
-  // Fail if there is not even a single free-block that can hold our
-  // allocation.
-  LOG_ASSERT(==, log_, true, freeblocks_.end() != it);
-
-  AllocationToken* token = it->second;
-  // Remove the block that we found from the freeblock map.
-  freeblocks_.erase(it);
-
-  // total_offset is the offset from the base of the entire arena to the
-  // correctly aligned base inside of the given block.
-  ::VkDeviceSize total_offset = (token->offset + (align_m_1)) & ~(align_m_1);
-  // offset_from_start is the offset from the start of the block to
-  // the alignment location.
-  ::VkDeviceSize offset_from_start = total_offset - token->offset;
-
-  // Our block may satisfy the alignment already, so only actually allocate
-  // the amount of memory we need.
-  // TODO(awoloszyn): If we find fragmentation to be a problem here, then
-  //   eventually actually allocate the total. If we do not do this,
-  //   then if we have (for example) a 128byte aligned block and we need
-  //   4K of memory, we wont be able to re-use this block for another 4K
-  //   allocation.
-  ::VkDeviceSize total_allocated =
-      to_allocate - (align_m_1 - offset_from_start);
-
-  // Remove the memory from the block.
-  // Push the block's base up by the allocated memory
-  token->allocationSize -= total_allocated;
-  token->offset += total_allocated;
-
-  // Create a new block that contains the memory in question.
-  AllocationToken* new_token = allocator_->construct<AllocationToken>(
-      AllocationToken{nullptr, token->prev, total_allocated, total_offset,
-                      freeblocks_.end(), true});
-
-  if (token->allocationSize > 0) {
-    // If there is still some space in this allocation, put it back, so we can
-    // get more out of it later.
-    token->map_location =
-        freeblocks_.insert(std::make_pair(token->allocationSize, token));
-
-    // Hook up all of our linked-list nodes.
-    new_token->next = token;
-    if (!token->prev) {
-      first_block_ = new_token;
-    } else {
-      new_token->prev = token->prev;
-      new_token->prev->next = new_token;
+  Chunk* chunk = nullptr;
+  AllocationToken* token = Allocate(size, alignment, &chunk);
+  RecordAllocation(token, requested_size);
+
+  // The chunk cannot be released while token is alive, so its memory can
+  // be read without its lock.
+  *memory = chunk->memory;
+  *offset = token->offset;
+  if (base_address) {
+    *base_address =
+        chunk->base_address ? chunk->base_address + token->offset : nullptr;
+  }
+  return token;
+}
+
+AllocationToken* VulkanArena::AllocateFromChunks(::VkDeviceSize size,
+                                                 ::VkDeviceSize alignment,
+                                                 Chunk** chunk) {
+  for (Chunk* c = first_chunk_.load(); c; c = c->next.load()) {
+    auto lock = Lock(&c->mutex);
+    AllocationToken* token = c->blocks.Allocate(size, alignment);
+    if (token) {
+      c->idle_frames = 0;
+      *chunk = c;
+      return token;
+    }
+  }
+  return nullptr;
+}
+
+AllocationToken* VulkanArena::Allocate(::VkDeviceSize size,
+                                       ::VkDeviceSize alignment,
+                                       Chunk** chunk) {
+  AllocationToken* token = AllocateFromChunks(size, alignment, chunk);
+  if (token) {
+    return token;
+  }
+  // None of our chunks have enough space, so grow the arena. Another thread
+  // may have done so while we waited for the lock, so look once more first.
+  auto growth_lock = Lock(&growth_mutex_);
+  token = AllocateFromChunks(size, alignment, chunk);
+  if (token) {
+    return token;
+  }
+  std::unique_lock<std::mutex> chunk_lock;
+  *chunk =
+      AllocateChunk(TLSFAllocator::MinimumSize(size, alignment), &chunk_lock);
+  // Fail if we are not allowed to, or cannot grow any more.
+  LOG_ASSERT(==, log_, true, nullptr != *chunk);
+  token = (*chunk)->blocks.Allocate(size, alignment);
+  LOG_ASSERT(==, log_, true, nullptr != token);
+  return token;
+}
+
+AllocationToken* VulkanArena::AllocateBufferRange(::VkDeviceSize size,
+                                                  ::VkDeviceSize alignment,
+                                                  ::VkBuffer* buffer,
+                                                  ::VkDeviceMemory* memory,
+                                                  ::VkDeviceSize* offset,
+                                                  char** base_address) {
+  LOG_ASSERT(!=, log_, 0u, policy_.buffer_usage);
+  const ::VkDeviceSize requested_size = size;
+  // Every buffer offset must satisfy the strictest of the
+  // min*BufferOffsetAlignment limits, which are at most 256 bytes, and
+  // mapped ranges must be aligned to kMaxNonCoherentAtomSize.
+  alignment =
+      alignment > kMaxNonCoherentAtomSize ? alignment : kMaxNonCoherentAtomSize;
+  size = RoundUpToAtomSize(size);
+  LOG_ASSERT(==, log_, !(alignment & (alignment - 1)),
+             true);  // Alignment must be power of 2.
+
+  Chunk* chunk = nullptr;
+  AllocationToken* token = Allocate(size, alignment, &chunk);
+  RecordAllocation(token, requested_size);
+
+  auto lock = Lock(&chunk->mutex);
+  if (chunk->buffer.get_raw_object() == VK_NULL_HANDLE) {
+    // This is the first range allocated from this chunk, so create the
+    // buffer that spans it.
+    VkBufferCreateInfo create_info = {
+        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,  // sType
+        nullptr,                               // pNext
+        0,                                     // flags
+        chunk->blocks.size(),                  // size
+        policy_.buffer_usage,                  // usage
+        VK_SHARING_MODE_EXCLUSIVE,             // sharingMode
+        0,                                     // queueFamilyIndexCount
+        nullptr,                               //  pQueueFamilyIndices
+    };
+    ::VkBuffer raw_buffer;
+    LOG_ASSERT(==, log_, VK_SUCCESS,
+               (*device_)->vkCreateBuffer(*device_, &create_info,
+                                          device_->allocation_callbacks(),
+                                          &raw_buffer));
+    chunk->buffer.initialize(raw_buffer);
+    VkMemoryRequirements requirements;
+    (*device_)->vkGetBufferMemoryRequirements(*device_, raw_buffer,
+                                              &requirements);
+    LOG_ASSERT(!=, log_, 0u,
+               requirements.memoryTypeBits & (1u << memory_type_index_));
+    LOG_ASSERT(<=, log_, requirements.size, chunk->blocks.size());
+    LOG_ASSERT(==, log_, VK_SUCCESS,
+               (*device_)->vkBindBufferMemory(*device_, raw_buffer,
+                                              chunk->memory, 0));
+  }
+
+  *buffer = chunk->buffer;
+  *memory = chunk->memory;
+  *offset = token->offset;
+  if (base_address) {
+    *base_address =
+        chunk->base_address ? chunk->base_address + token->offset : nullptr;
+  }
+  return token;
+}
+
+void VulkanArena::FreeMemory(AllocationToken* token) {
+  used_size_ -= token->allocationSize;
+  alignment_waste_ -= token->allocationSize - token->requestedSize;
+  --allocation_count_;
+  --size_histogram_[SizeHistogramBucket(token->allocationSize)];
+  Chunk* chunk = FindChunk(token);
+  auto lock = Lock(&chunk->mutex);
+  token->owner->Free(token);
+}
+
+VulkanArena::Chunk* VulkanArena::FindChunk(
+    const AllocationToken* token) const {
+  Chunk* chunk = first_chunk_.load();
+  while (chunk && &chunk->blocks != token->owner) {
+    chunk = chunk->next.load();
+  }
+  // The token must have been allocated from this arena.
+  LOG_ASSERT(==, log_, true, nullptr != chunk);
+  return chunk;
+}
+
+uint32_t VulkanArena::SizeHistogramBucket(::VkDeviceSize size) {
+  uint32_t bucket = 0;
+  while (size >>= 1) {
+    ++bucket;
+  }
+  return bucket < ArenaStatistics::kSizeHistogramBuckets
+             ? bucket
+             : ArenaStatistics::kSizeHistogramBuckets - 1;
+}
+
+void VulkanArena::RecordAllocation(AllocationToken* token,
+                                   ::VkDeviceSize requested_size) {
+  token->requestedSize = requested_size;
+  const ::VkDeviceSize used_size = used_size_ += token->allocationSize;
+  ::VkDeviceSize peak_used_size = peak_used_size_.load();
+  while (used_size > peak_used_size &&
+         !peak_used_size_.compare_exchange_weak(peak_used_size, used_size)) {
+  }
+  alignment_waste_ += token->allocationSize - requested_size;
+  ++allocation_count_;
+  ++size_histogram_[SizeHistogramBucket(token->allocationSize)];
+}
+
+void VulkanArena::GetStatistics(ArenaStatistics* statistics) const {
+  auto growth_lock = Lock(&growth_mutex_);
+  statistics->allocated_size = allocated_size_.load();
+  statistics->peak_allocated_size = peak_allocated_size_;
+  statistics->used_size = used_size_.load();
+  statistics->peak_used_size = peak_used_size_.load();
+  statistics->alignment_waste = alignment_waste_.load();
+  statistics->allocation_count = allocation_count_.load();
+  statistics->chunk_count = 0;
+  statistics->free_block_count = 0;
+  statistics->free_size = 0;
+  statistics->largest_free_block = 0;
+  for (Chunk* chunk = first_chunk_.load(); chunk; chunk = chunk->next.load()) {
+    auto lock = Lock(&chunk->mutex);
+    if (chunk->blocks.size() == 0) {
+      continue;
     }
-    token->prev = new_token;
-    new_token->next = token;
-    if (first_block_ == token) {
-      first_block_ = new_token;
+    ++statistics->chunk_count;
+    uint64_t count;
+    ::VkDeviceSize total_size;
+    ::VkDeviceSize largest_size;
+    chunk->blocks.GetFreeBlockStatistics(&count, &total_size, &largest_size);
+    statistics->free_block_count += count;
+    statistics->free_size += total_size;
+    if (largest_size > statistics->largest_free_block) {
+      statistics->largest_free_block = largest_size;
     }
-  } else {
-    // token happens to now be an empty block. So let's not put it back.
-    if (token->next) {
-      new_token->next = token->next;
-      token->next->prev = new_token;
+  }
+  statistics->fragmentation =
+      statistics->free_size
+          ? 1.0f - static_cast<float>(statistics->largest_free_block) /
+                       static_cast<float>(statistics->free_size)
+          : 0.0f;
+  for (uint32_t i = 0; i < ArenaStatistics::kSizeHistogramBuckets; ++i) {
+    statistics->size_histogram[i] = size_histogram_[i].load();
+  }
+}
+
+void VulkanArena::AddMappedRange(
+    containers::vector<VkMappedMemoryRange>* ranges, ::VkDeviceMemory memory,
+    ::VkDeviceSize offset, ::VkDeviceSize size) {
+  // Every allocation from a mapped arena starts and ends on an atom
+  // boundary, so rounding out never leaves the allocation.
+  const ::VkDeviceSize begin = offset & ~(kMaxNonCoherentAtomSize - 1);
+  const ::VkDeviceSize end = RoundUpToAtomSize(offset + size);
+  if (!ranges->empty()) {
+    // Writes are usually sequential, so try to extend the last range
+    // before adding a new one.
+    VkMappedMemoryRange& last = ranges->back();
+    if (last.memory == memory && begin <= last.offset + last.size &&
+        end >= last.offset) {
+      const ::VkDeviceSize last_end = last.offset + last.size;
+      last.offset = begin < last.offset ? begin : last.offset;
+      last.size = (end > last_end ? end : last_end) - last.offset;
+      return;
     }
-    if (token->prev) {
-      token->prev->next = new_token;
+  }
+  ranges->push_back(VkMappedMemoryRange{VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+                                        nullptr, memory, begin, end - begin});
+}
+
+void VulkanArena::MergeMappedRanges(
+    containers::vector<VkMappedMemoryRange>* ranges) {
+  std::sort(ranges->begin(), ranges->end(),
+            [](const VkMappedMemoryRange& a, const VkMappedMemoryRange& b) {
+              return a.memory != b.memory ? a.memory < b.memory
+                                          : a.offset < b.offset;
+            });
+  size_t merged = 0;
+  for (size_t i = 1; i < ranges->size(); ++i) {
+    VkMappedMemoryRange& last = (*ranges)[merged];
+    const VkMappedMemoryRange& range = (*ranges)[i];
+    if (range.memory == last.memory &&
+        range.offset <= last.offset + last.size) {
+      const ::VkDeviceSize end = range.offset + range.size;
+      if (end > last.offset + last.size) {
+        last.size = end - last.offset;
+      }
     } else {
-      first_block_ = new_token;
+      (*ranges)[++merged] = range;
     }
+  }
+  if (!ranges->empty()) {
+    ranges->resize(merged + 1);
+  }
+}
 
-    allocator_->destroy(token);
+void VulkanArena::MarkHostWritten(::VkDeviceMemory memory,
+                                  ::VkDeviceSize offset, ::VkDeviceSize size) {
+  if (!needs_flush_ || size == 0) {
+    return;
+  }
+  auto lock = Lock(&writes_mutex_);
+  AddMappedRange(&host_writes_, memory, offset, size);
+}
+
+void VulkanArena::MarkDeviceWritten(::VkDeviceMemory memory,
+                                    ::VkDeviceSize offset,
+                                    ::VkDeviceSize size) {
+  if (!needs_flush_ || size == 0) {
+    return;
+  }
+  auto lock = Lock(&writes_mutex_);
+  AddMappedRange(&device_writes_, memory, offset, size);
+}
+
+void VulkanArena::FlushHostWrites() {
+  auto lock = Lock(&writes_mutex_);
+  if (host_writes_.empty()) {
+    return;
+  }
+  MergeMappedRanges(&host_writes_);
+  LOG_ASSERT(==, log_, VK_SUCCESS,
+             (*device_)->vkFlushMappedMemoryRanges(
+                 *device_, static_cast<uint32_t>(host_writes_.size()),
+                 host_writes_.data()));
+  host_writes_.clear();
+}
+
+void VulkanArena::InvalidateDeviceWrites() {
+  auto lock = Lock(&writes_mutex_);
+  if (device_writes_.empty()) {
+    return;
+  }
+  MergeMappedRanges(&device_writes_);
+  LOG_ASSERT(==, log_, VK_SUCCESS,
+             (*device_)->vkInvalidateMappedMemoryRanges(
+                 *device_, static_cast<uint32_t>(device_writes_.size()),
+                 device_writes_.data()));
+  device_writes_.clear();
+}
+
+AllocationToken* VulkanArena::AllocateBelow(const AllocationToken* token,
+                                            ::VkDeviceSize size,
+                                            ::VkDeviceSize alignment,
+                                            ::VkDeviceMemory* memory,
+                                            ::VkDeviceSize* offset,
+                                            char** base_address) {
+  const ::VkDeviceSize requested_size = size;
+  RoundForMapping(&size, &alignment);
+  LOG_ASSERT(==, log_, !(alignment & (alignment - 1)),
+             true);  // Alignment must be power of 2.
+
+  Chunk* chunk = nullptr;
+  AllocationToken* new_token = nullptr;
+  for (Chunk* c = first_chunk_.load(); c; c = c->next.load()) {
+    auto lock = Lock(&c->mutex);
+    if (&c->blocks == token->owner) {
+      // Within the chunk the token lives in, only memory in front of it
+      // counts as lower.
+      new_token = c->blocks.AllocateLowest(size, alignment, token->offset);
+    } else {
+      new_token = c->blocks.Allocate(size, alignment);
+    }
+    if (new_token) {
+      c->idle_frames = 0;
+      chunk = c;
+      break;
+    }
+    if (&c->blocks == token->owner) {
+      break;
+    }
+  }
+  if (!new_token) {
+    return nullptr;
   }
-  *memory = memory_;
-  *offset = total_offset;
+  RecordAllocation(new_token, requested_size);
+
+  *memory = chunk->memory;
+  *offset = new_token->offset;
   if (base_address) {
-    *base_address = base_address_ ? base_address_ + total_offset : nullptr;
+    *base_address =
+        chunk->base_address ? chunk->base_address + new_token->offset : nullptr;
   }
   return new_token;
 }
 
-void VulkanArena::FreeMemory(AllocationToken* token) {
-  bool atAll = false;
-  // First try to coalesce this with its previous block.
-  while (token->prev && !token->prev->in_use) {
-    atAll = true;
-    // Take the previous token out of the map, and merge it with this one.
-    AllocationToken* prev_token = token->prev;
-    prev_token->allocationSize += token->allocationSize;
-    prev_token->next = token->next;
-    if (token->next) {
-      token->next->prev = prev_token;
-    }
-    // Remove the previous block from freeblocks_,
-    // we have now merged with it.
-    freeblocks_.erase(prev_token->map_location);
-    allocator_->destroy(token);
-    token = prev_token;
-  }
-  // Now try to coalesce this with any subsequent blocks.
-  while (token->next && !token->next->in_use) {
-    atAll = true;
-    // Take the previous token out of the map, and merge it with this one.
-    AllocationToken* next_token = token->next;
-    token->allocationSize += next_token->allocationSize;
-    token->next = next_token->next;
-    if (token->next) {
-      token->next->prev = token;
+::VkDeviceSize VulkanArena::GetCommittedSize() const {
+  if (!(device_->physical_device_memory_properties()
+            .memoryTypes[memory_type_index_]
+            .propertyFlags &
+        VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT)) {
+    return allocated_size_.load();
+  }
+  ::VkDeviceSize committed_size = 0;
+  for (Chunk* chunk = first_chunk_.load(); chunk; chunk = chunk->next.load()) {
+    auto lock = Lock(&chunk->mutex);
+    if (chunk->blocks.size() == 0) {
+      continue;
     }
-    // Remove the next block from freeblocks_,
-    // we have now merged with it.
-    freeblocks_.erase(next_token->map_location);
-    allocator_->destroy(next_token);
+    ::VkDeviceSize chunk_committed_size = 0;
+    (*device_)->vkGetDeviceMemoryCommitment(*device_, chunk->memory,
+                                            &chunk_committed_size);
+    committed_size += chunk_committed_size;
+  }
+  return committed_size;
+}
+
+size_t VulkanArena::chunk_index(const AllocationToken* token) const {
+  size_t i = 0;
+  Chunk* chunk = first_chunk_.load();
+  while (chunk && &chunk->blocks != token->owner) {
+    chunk = chunk->next.load();
+    ++i;
   }
-  // This block is no longer being used.
-  token->in_use = false;
-  // Push it back into freeblocks_.
-  token->map_location =
-      freeblocks_.insert(std::make_pair(token->allocationSize, token));
+  // The token must have been allocated from this arena.
+  LOG_ASSERT(==, log_, true, nullptr != chunk);
+  return i;
 }
 
 VulkanGraphicsPipeline::VulkanGraphicsPipeline(containers::Allocator* allocator,
@@ -1020,7 +1750,8 @@ VulkanGraphicsPipeline::VulkanGraphicsPipeline(containers::Allocator* allocator,
       attachments_(allocator),
       layout_(*layout),
       contained_stages_(0),
-      pipeline_(VK_NULL_HANDLE, nullptr, &application->device()) {
+      pipeline_(VK_NULL_HANDLE, application->device().allocation_callbacks(),
+                &application->device()) {
   MemoryClear(&vertex_input_state_);
   MemoryClear(&input_assembly_state_);
   MemoryClear(&tessellation_state_);
@@ -1104,11 +1835,13 @@ void VulkanGraphicsPipeline::AddShader(VkShaderStageFlagBits stage,
   };
 
   ::VkShaderModule module;
+  VkAllocationCallbacks* callbacks =
+      application_->device().allocation_callbacks();
   LOG_ASSERT(==, application_->GetLogger(), VK_SUCCESS,
              application_->device()->vkCreateShaderModule(
-                 application_->device(), &create_info, nullptr, &module));
+                 application_->device(), &create_info, callbacks, &module));
   shader_modules_.push_back(
-      VkShaderModule(module, nullptr, &application_->device()));
+      VkShaderModule(module, callbacks, &application_->device()));
 
   stages_.push_back({
       VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,  // sType
@@ -1243,7 +1976,8 @@ void VulkanGraphicsPipeline::Commit() {
   LOG_ASSERT(==, application_->GetLogger(), VK_SUCCESS,
              application_->device()->vkCreateGraphicsPipelines(
                  application_->device(), application_->pipeline_cache(), 1,
-                 &create_info, nullptr, &pipeline));
+                 &create_info, application_->device().allocation_callbacks(),
+                 &pipeline));
   pipeline_.initialize(pipeline);
 }
 
@@ -1253,14 +1987,17 @@ VulkanComputePipeline::VulkanComputePipeline(
     const VkShaderModuleCreateInfo& shader_module_create_info,
     const char* shader_entry)
     : application_(application),
-      pipeline_(VK_NULL_HANDLE, nullptr, &application->device()),
-      shader_module_(VK_NULL_HANDLE, nullptr, &application->device()),
+      pipeline_(VK_NULL_HANDLE, application->device().allocation_callbacks(),
+                &application->device()),
+      shader_module_(VK_NULL_HANDLE,
+                     application->device().allocation_callbacks(),
+                     &application->device()),
       layout_(*layout) {
   ::VkShaderModule raw_module;
   LOG_ASSERT(==, application_->GetLogger(), VK_SUCCESS,
              application_->device()->vkCreateShaderModule(
-                 application_->device(), &shader_module_create_info, nullptr,
-                 &raw_module));
+                 application_->device(), &shader_module_create_info,
+                 application_->device().allocation_callbacks(), &raw_module));
   shader_module_.initialize(raw_module);
   VkPipelineShaderStageCreateInfo shader_stage_create_info{
       VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,  // sType
@@ -1286,7 +2023,8 @@ VulkanComputePipeline::VulkanComputePipeline(
   LOG_ASSERT(==, application_->GetLogger(), VK_SUCCESS,
              application_->device()->vkCreateComputePipelines(
                  application_->device(), application_->pipeline_cache(), 1,
-                 &pipeline_create_info, nullptr, &pipeline));
+                 &pipeline_create_info,
+                 application_->device().allocation_callbacks(), &pipeline));
   pipeline_.initialize(pipeline);
 }
 
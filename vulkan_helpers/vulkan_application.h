@@ -16,12 +16,22 @@
 #ifndef VULKAN_HELPERS_VULKAN_APPLICATION
 #define VULKAN_HELPERS_VULKAN_APPLICATION
 
+#include <atomic>
+#include <mutex>
+
 #include "support/containers/allocator.h"
-#include "support/containers/ordered_multimap.h"
+#include "support/containers/object_pool.h"
+#include "support/containers/small_vector.h"
+#include "support/containers/string.h"
 #include "support/containers/vector.h"
 #include "support/entry/entry.h"
 #include "support/log/log.h"
 #include "vulkan_helpers/helper_functions.h"
+#include "vulkan_helpers/host_allocation_callbacks.h"
+#include "vulkan_helpers/slab_pool.h"
+#include "vulkan_helpers/tlsf_allocator.h"
+#include "vulkan_helpers/transient_arena.h"
+#include "vulkan_wrapper/capture.h"
 #include "vulkan_wrapper/command_buffer_wrapper.h"
 #include "vulkan_wrapper/device_wrapper.h"
 #include "vulkan_wrapper/instance_wrapper.h"
@@ -31,17 +41,73 @@
 
 namespace vulkan {
 struct VulkanModel;
-struct AllocationToken;
+
+// A snapshot of how the memory in a VulkanArena is being used.
+struct ArenaStatistics {
+  static const uint32_t kSizeHistogramBuckets = 32;
+
+  // The bytes of device memory held by the arena, now and at its peak.
+  ::VkDeviceSize allocated_size;
+  ::VkDeviceSize peak_allocated_size;
+  // The bytes handed out by the arena, now and at its peak.
+  ::VkDeviceSize used_size;
+  ::VkDeviceSize peak_used_size;
+  // The bytes handed out beyond what was asked for, because allocations
+  // from mapped memory are rounded up to the non-coherent atom size.
+  ::VkDeviceSize alignment_waste;
+  uint64_t allocation_count;
+  uint32_t chunk_count;
+  // The free space within the chunks that the arena holds.
+  uint64_t free_block_count;
+  ::VkDeviceSize free_size;
+  ::VkDeviceSize largest_free_block;
+  // 1 - largest_free_block / free_size. This is 0 when all of the free
+  // space is in a single block, and approaches 1 as it is split into
+  // many small blocks.
+  float fragmentation;
+  // size_histogram[i] counts the live allocations of [2^i, 2^(i+1)) bytes.
+  // The last bucket also counts all larger allocations.
+  uint64_t size_histogram[kSizeHistogramBuckets];
+};
 
 // This class represents a location in GPU memory for storing data.
 // You can suballocate memory from this region, and return memory to the
 // arena for future use.
+// The memory is made up of one or more chunks of ::VkDeviceMemory. Chunks
+// are allocated on demand when existing chunks cannot satisfy a request,
+// and chunks that stay empty are returned to the device by
+// ReleaseIdleChunks. Free blocks within each chunk are tracked by a
+// TLSFAllocator, so allocation and free are constant time.
+// If the arena is thread safe, each chunk has its own lock around its
+// TLSFAllocator, so threads only wait for each other when they use the same
+// chunk, or when the arena grows or shrinks.
 class VulkanArena {
  public:
+  // Controls how the arena grows and shrinks.
+  struct Policy {
+    // The size of each chunk of device memory. Allocations that do not fit
+    // into a chunk of this size get a chunk of their own.
+    ::VkDeviceSize chunk_size;
+    // The arena never holds more than max_size bytes of device memory.
+    // A max_size of 0 means there is no limit.
+    ::VkDeviceSize max_size;
+    // An empty chunk is released once it has been empty for this many calls
+    // to ReleaseIdleChunks.
+    uint32_t idle_frames_before_release;
+    // The usage for the VkBuffer that spans each chunk, and from which
+    // AllocateBufferRange suballocates. If this is 0, AllocateBufferRange
+    // cannot be used.
+    VkBufferUsageFlags buffer_usage;
+    // If true, the arena may be used from multiple threads at once.
+    bool thread_safe;
+  };
+
   // If map==true then the memory for this Arena is mapped to a host-visible
   // address.
+  // Unless policy.thread_safe is set, the arena must only be used from one
+  // thread at a time.
   VulkanArena(containers::Allocator* allocator, logging::Logger* log,
-              ::VkDeviceSize buffer_size, uint32_t memory_type_index,
+              const Policy& policy, uint32_t memory_type_index,
               VkDevice* device, bool map);
   ~VulkanArena();
 
@@ -54,20 +120,179 @@ class VulkanArena {
                                   ::VkDeviceMemory* memory,
                                   ::VkDeviceSize* offset, char** base_address);
 
+  // Like AllocateMemory, but also fills *buffer with a VkBuffer that spans
+  // the whole chunk the memory came from. *offset is the offset of the
+  // allocation in both the memory and the buffer.
+  // The buffer is created with policy.buffer_usage, the first time that
+  // a range is allocated from a chunk.
+  AllocationToken* AllocateBufferRange(::VkDeviceSize size,
+                                       ::VkDeviceSize alignment,
+                                       ::VkBuffer* buffer,
+                                       ::VkDeviceMemory* memory,
+                                       ::VkDeviceSize* offset,
+                                       char** base_address);
+
   // Frees the memory pointed to by the AllocationToken.
   void FreeMemory(AllocationToken* token);
 
+  // Like AllocateMemory, but only returns memory that is lower in the arena
+  // than token: either in an earlier chunk, or at a lower offset in the same
+  // chunk. This never grows the arena, and returns nullptr if there
+  // is no such space. It is used to compact the arena.
+  AllocationToken* AllocateBelow(const AllocationToken* token,
+                                 ::VkDeviceSize size, ::VkDeviceSize alignment,
+                                 ::VkDeviceMemory* memory,
+                                 ::VkDeviceSize* offset, char** base_address);
+
+  // Returns the position of the chunk that token was allocated from.
+  // Earlier chunks have lower positions.
+  size_t chunk_index(const AllocationToken* token) const;
+
+  // Releases any chunks that have been empty for longer than
+  // policy.idle_frames_before_release calls to this function.
+  // This is expected to be called once per frame.
+  void ReleaseIdleChunks();
+
+  // Returns the number of bytes of device memory currently held by
+  // this arena.
+  ::VkDeviceSize allocated_size() const { return allocated_size_.load(); }
+
+  // Returns the index of the memory type that this arena allocates from.
+  uint32_t memory_type_index() const { return memory_type_index_; }
+
+  // Returns the most device memory this arena will hold, or 0 if there is
+  // no limit.
+  ::VkDeviceSize max_size() const { return policy_.max_size; }
+
+  // Returns the usage of the buffers that AllocateBufferRange hands out.
+  VkBufferUsageFlags buffer_usage() const { return policy_.buffer_usage; }
+
+  // Returns the number of bytes of device memory that are actually backing
+  // this arena. This is less than allocated_size() if the memory is lazily
+  // allocated, and the device has not needed all of it.
+  ::VkDeviceSize GetCommittedSize() const;
+
+  // Fills *statistics with the current state of this arena.
+  void GetStatistics(ArenaStatistics* statistics) const;
+
+  // Records that the host has written size bytes at offset in memory, which
+  // must have come from this arena. The write becomes visible to the device
+  // at the next call to FlushHostWrites. This does nothing if the memory is
+  // host-coherent, or not mapped.
+  void MarkHostWritten(::VkDeviceMemory memory, ::VkDeviceSize offset,
+                       ::VkDeviceSize size);
+  // Records that the device has written size bytes at offset in memory, which
+  // the host is going to read. The write becomes visible to the host at the
+  // next call to InvalidateDeviceWrites. This does nothing if the memory is
+  // host-coherent, or not mapped.
+  void MarkDeviceWritten(::VkDeviceMemory memory, ::VkDeviceSize offset,
+                         ::VkDeviceSize size);
+  // Flushes every range recorded by MarkHostWritten since the last call,
+  // with at most one call to vkFlushMappedMemoryRanges. Ranges are rounded
+  // out to whole atoms, and ranges that touch are merged.
+  // This must be called before the device work that reads the writes is
+  // submitted.
+  void FlushHostWrites();
+  // Like FlushHostWrites, but invalidates the ranges recorded by
+  // MarkDeviceWritten. This must be called after the device work that
+  // wrote them has completed.
+  void InvalidateDeviceWrites();
+
  private:
+  // Chunks form a list that only ever grows while the arena is alive, so
+  // that it can be walked without a lock. When the memory of a chunk is
+  // released, the chunk stays in the list with a size of 0, and is reused
+  // the next time that the arena grows.
+  struct Chunk {
+    Chunk(containers::Allocator* allocator, VkDevice* device)
+        : blocks(allocator, 0),
+          memory(VK_NULL_HANDLE, device->allocation_callbacks(), device),
+          buffer(VK_NULL_HANDLE, device->allocation_callbacks(), device),
+          base_address(nullptr),
+          idle_frames(0),
+          next(nullptr) {}
+    // Guards everything below other than next, if the arena is thread safe.
+    std::mutex mutex;
+    TLSFAllocator blocks;
+    VkDeviceMemory memory;
+    // This is declared after memory, so that it is destroyed first.
+    VkBuffer buffer;
+    char* base_address;
+    uint32_t idle_frames;
+    std::atomic<Chunk*> next;
+  };
+
+  // If this arena is mapped, rounds *size and *alignment up so that the
+  // allocation can be flushed and invalidated on its own.
+  void RoundForMapping(::VkDeviceSize* size, ::VkDeviceSize* alignment) const;
+  // Allocates memory from the first chunk that has space, growing the arena
+  // if there is none, and sets *chunk to the chunk the memory came from.
+  AllocationToken* Allocate(::VkDeviceSize size, ::VkDeviceSize alignment,
+                            Chunk** chunk);
+  // Like Allocate, but returns nullptr rather than growing the arena.
+  AllocationToken* AllocateFromChunks(::VkDeviceSize size,
+                                      ::VkDeviceSize alignment, Chunk** chunk);
+  // Gives a chunk memory for at least min_size bytes, and returns it with
+  // *chunk_lock holding its lock, so that the caller can allocate from it
+  // first. Returns nullptr if that would exceed policy_.max_size, or if
+  // the device is out of memory. growth_mutex_ must be held.
+  Chunk* AllocateChunk(::VkDeviceSize min_size,
+                       std::unique_lock<std::mutex>* chunk_lock);
+  // Unmaps, and frees the memory for the given chunk, leaving it with a size
+  // of 0. growth_mutex_ and the lock for chunk must be held.
+  void ReleaseChunk(Chunk* chunk);
+  // Returns the chunk that token was allocated from.
+  Chunk* FindChunk(const AllocationToken* token) const;
+  // Updates the statistics for a new allocation of token, for which
+  // requested_size bytes were asked.
+  void RecordAllocation(AllocationToken* token, ::VkDeviceSize requested_size);
+  // Returns the bucket in ArenaStatistics::size_histogram for size.
+  static uint32_t SizeHistogramBucket(::VkDeviceSize size);
+  // Rounds the given range out to whole atoms, and adds it to *ranges.
+  void AddMappedRange(containers::vector<VkMappedMemoryRange>* ranges,
+                      ::VkDeviceMemory memory, ::VkDeviceSize offset,
+                      ::VkDeviceSize size);
+  // Sorts *ranges, and merges the ranges that overlap or touch.
+  static void MergeMappedRanges(
+      containers::vector<VkMappedMemoryRange>* ranges);
+  // Returns a lock on mutex if the arena is thread safe, or an empty
+  // lock otherwise.
+  std::unique_lock<std::mutex> Lock(std::mutex* mutex) const {
+    return policy_.thread_safe ? std::unique_lock<std::mutex>(*mutex)
+                               : std::unique_lock<std::mutex>();
+  }
+
   containers::Allocator* allocator_;
-  containers::ordered_multimap<::VkDeviceSize, AllocationToken*> freeblocks_;
-  AllocationToken* first_block_;
-  char* base_address_;
-  ::VkDevice device_;
-  LazyDeviceFunction<PFN_vkUnmapMemory>* unmap_memory_function_;
-  VkDeviceMemory memory_;
+  Policy policy_;
+  uint32_t memory_type_index_;
+  bool map_;
+  // True if the memory is mapped, and needs to be explicitly flushed and
+  // invalidated.
+  bool needs_flush_;
+  // If policy_.thread_safe is set, growth_mutex_ is held to add chunks to
+  // the list, to give chunks memory or release it, and to change
+  // allocated_size_ and peak_allocated_size_.
+  mutable std::mutex growth_mutex_;
+  std::atomic<Chunk*> first_chunk_;
+  Chunk* last_chunk_;
+  std::atomic<::VkDeviceSize> allocated_size_;
+  ::VkDeviceSize peak_allocated_size_;
+  // The statistics for allocations are updated without a lock.
+  std::atomic<::VkDeviceSize> used_size_;
+  std::atomic<::VkDeviceSize> peak_used_size_;
+  std::atomic<::VkDeviceSize> alignment_waste_;
+  std::atomic<uint64_t> allocation_count_;
+  std::atomic<uint64_t> size_histogram_[ArenaStatistics::kSizeHistogramBuckets];
+  // The ranges waiting for FlushHostWrites and InvalidateDeviceWrites.
+  // If policy_.thread_safe is set, these are guarded by writes_mutex_.
+  mutable std::mutex writes_mutex_;
+  containers::vector<VkMappedMemoryRange> host_writes_;
+  containers::vector<VkMappedMemoryRange> device_writes_;
+  VkDevice* device_;
   logging::Logger* log_;
 };
 
+class ArenaDefragmenter;
 class VulkanApplication;
 class PipelineLayout;
 
@@ -218,7 +443,8 @@ class PipelineLayout {
       containers::Allocator* allocator, VkDevice* device,
       std::initializer_list<std::initializer_list<VkDescriptorSetLayoutBinding>>
           layouts)
-      : pipeline_layout_(VK_NULL_HANDLE, nullptr, device),
+      : pipeline_layout_(VK_NULL_HANDLE, device->allocation_callbacks(),
+                         device),
         descriptor_set_layouts_(allocator) {
     containers::vector<::VkDescriptorSetLayout> raw_layouts(allocator);
     raw_layouts.reserve(layouts.size());
@@ -241,8 +467,9 @@ class PipelineLayout {
 
     ::VkPipelineLayout layout;
     LOG_ASSERT(==, device->GetLogger(), VK_SUCCESS,
-               (*device)->vkCreatePipelineLayout(*device, &create_info, nullptr,
-                                                 &layout));
+               (*device)->vkCreatePipelineLayout(
+                   *device, &create_info, device->allocation_callbacks(),
+                   &layout));
     pipeline_layout_.initialize(layout);
   }
   friend class VulkanApplication;
@@ -297,6 +524,7 @@ class VulkanApplication {
 
    private:
     friend class ::vulkan::VulkanApplication;
+    friend class ::vulkan::ArenaDefragmenter;
     Image(VulkanArena* heap, AllocationToken* token, VkImage&& image,
           VkFormat format)
         : heap_(heap),
@@ -312,10 +540,18 @@ class VulkanApplication {
   // The buffer class holds onto a VkBuffer. If this buffer was created
   // in a host-visible heap, then the host-visible address can be
   // retreved using base_address().
+  // Small buffers are bound to a slot in a SlabPool, rather than to their
+  // own allocation from the heap.
   class Buffer {
    public:
     operator ::VkBuffer() const { return buffer_; }
-    ~Buffer() { heap_->FreeMemory(token_); }
+    ~Buffer() {
+      if (slab_) {
+        SlabPool::Free(slab_, slab_slot_);
+      } else {
+        heap_->FreeMemory(token_);
+      }
+    }
     ::VkDeviceSize size() const { return size_; }
 
     // Returns the base_address of the host-visible section of memory.
@@ -352,18 +588,34 @@ class VulkanApplication {
       }
     }
 
+    // Records that the host has written the given range, rather than
+    // flushing it right away. See VulkanApplication::FlushHostWrites.
+    void mark_host_written(size_t offset, size_t size) {
+      heap_->MarkHostWritten(memory_, offset_ + offset, size);
+    }
+
+    // Records that the device is going to write the given range, for the
+    // host to read. See VulkanApplication::InvalidateDeviceWrites.
+    void mark_device_written(size_t offset, size_t size) {
+      heap_->MarkDeviceWritten(memory_, offset_ + offset, size);
+    }
+
    private:
     friend class ::vulkan::VulkanApplication;
+    friend class ::vulkan::ArenaDefragmenter;
     Buffer(
-        VulkanArena* heap, AllocationToken* token, VkBuffer&& buffer,
-        char* base_address, ::VkDevice device, ::VkDeviceMemory memory,
-        ::VkDeviceSize offset, ::VkDeviceSize size,
+        VulkanArena* heap, AllocationToken* token, SlabPool::Slab* slab,
+        uint32_t slab_slot, VkBuffer&& buffer, char* base_address,
+        ::VkDevice device, ::VkDeviceMemory memory, ::VkDeviceSize offset,
+        ::VkDeviceSize size,
         LazyDeviceFunction<PFN_vkFlushMappedMemoryRanges>* flush_memory_range,
         LazyDeviceFunction<PFN_vkInvalidateMappedMemoryRanges>*
             invalidate_memory_range)
         : base_address_(base_address),
           heap_(heap),
           token_(token),
+          slab_(slab),
+          slab_slot_(slab_slot),
           buffer_(std::move(buffer)),
           device_(device),
           memory_(memory),
@@ -373,7 +625,10 @@ class VulkanApplication {
           invalidate_memory_range_(invalidate_memory_range) {}
     char* base_address_;
     VulkanArena* heap_;
+    // token_ is nullptr if the memory came from a slab.
     AllocationToken* token_;
+    SlabPool::Slab* slab_;
+    uint32_t slab_slot_;
     VkBuffer buffer_;
     ::VkDevice device_;
     ::VkDeviceMemory memory_;
@@ -384,12 +639,132 @@ class VulkanApplication {
         invalidate_memory_range_;
   };
 
+  // A BufferSlice is a range of a VkBuffer that is shared with other
+  // slices from the same heap. Unlike Buffer, creating a BufferSlice does
+  // not create a new VkBuffer, or bind any memory.
+  // Anywhere the slice is used, offset() must be added to any offset
+  // into it, e.g. for vkCmdBindVertexBuffers or in a VkDescriptorBufferInfo.
+  // When it is destroyed, it will return the memory to the heap from which
+  // it was created.
+  class BufferSlice {
+   public:
+    ~BufferSlice() { heap_->FreeMemory(token_); }
+    ::VkBuffer buffer() const { return buffer_; }
+    ::VkDeviceSize offset() const { return offset_; }
+    ::VkDeviceSize size() const { return size_; }
+
+    // Returns a VkDescriptorBufferInfo that covers the whole slice.
+    VkDescriptorBufferInfo descriptor_info() const {
+      return VkDescriptorBufferInfo{buffer_, offset_, size_};
+    }
+
+    // Returns the base_address of the host-visible section of memory.
+    // Returns nullptr if the host-visible memory is not available.
+    char* base_address() const { return base_address_; }
+
+    // If this is host-visible memory, flushes the range so that
+    // writes are visible to the GPU.
+    void flush() { flush(0, size_); }
+
+    // If this is host-visible memory, flushes only the given range of the
+    // slice so that writes are visible to the GPU.
+    // offset must be a multiple of nonCoherentAtomSize.
+    void flush(size_t offset, size_t size) {
+      if (flush_memory_range_) {
+        VkMappedMemoryRange range{VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+                                  nullptr, memory_, offset_ + offset,
+                                  AtomSize(offset, size)};
+        (*flush_memory_range_)(device_, 1, &range);
+      }
+    }
+
+    // if this is host-visible memory, invalidates the range so that
+    // GPU writes become visible.
+    void invalidate() {
+      if (invalidate_memory_range_) {
+        VkMappedMemoryRange range{VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+                                  nullptr, memory_, offset_,
+                                  AtomSize(0, size_)};
+        (*invalidate_memory_range_)(device_, 1, &range);
+      }
+    }
+
+    // Records that the host has written the given range of the slice,
+    // rather than flushing it right away.
+    // See VulkanApplication::FlushHostWrites.
+    void mark_host_written(size_t offset, size_t size) {
+      heap_->MarkHostWritten(memory_, offset_ + offset, size);
+    }
+
+    // Records that the device is going to write the given range of the
+    // slice, for the host to read.
+    // See VulkanApplication::InvalidateDeviceWrites.
+    void mark_device_written(size_t offset, size_t size) {
+      heap_->MarkDeviceWritten(memory_, offset_ + offset, size);
+    }
+
+   private:
+    friend class ::vulkan::VulkanApplication;
+    BufferSlice(
+        VulkanArena* heap, AllocationToken* token, ::VkBuffer buffer,
+        char* base_address, ::VkDevice device, ::VkDeviceMemory memory,
+        ::VkDeviceSize offset, ::VkDeviceSize size,
+        LazyDeviceFunction<PFN_vkFlushMappedMemoryRanges>* flush_memory_range,
+        LazyDeviceFunction<PFN_vkInvalidateMappedMemoryRanges>*
+            invalidate_memory_range)
+        : base_address_(base_address),
+          heap_(heap),
+          token_(token),
+          buffer_(buffer),
+          device_(device),
+          memory_(memory),
+          offset_(offset),
+          size_(size),
+          flush_memory_range_(flush_memory_range),
+          invalidate_memory_range_(invalidate_memory_range) {}
+
+    // The memory behind a slice is allocated in whole atoms, so the size of
+    // a mapped range can always be rounded up to a multiple of 256, as long
+    // as it stays within the allocation.
+    ::VkDeviceSize AtomSize(size_t offset, size_t size) const {
+      ::VkDeviceSize rounded = (size + 255) & ~::VkDeviceSize(255);
+      return offset + rounded > token_->allocationSize
+                 ? token_->allocationSize - offset
+                 : rounded;
+    }
+
+    char* base_address_;
+    VulkanArena* heap_;
+    AllocationToken* token_;
+    ::VkBuffer buffer_;
+    ::VkDevice device_;
+    ::VkDeviceMemory memory_;
+    ::VkDeviceSize offset_;
+    ::VkDeviceSize size_;
+    LazyDeviceFunction<PFN_vkFlushMappedMemoryRanges>* flush_memory_range_;
+    LazyDeviceFunction<PFN_vkInvalidateMappedMemoryRanges>*
+        invalidate_memory_range_;
+  };
+
   // On creation creates an instance, device, surface, swapchain, queues,
   // and command pool for the application.
-  // It also creates 3 memory arenas with the given sizes.
-  //  One for host-visible buffers.
+  // It also creates 6 memory arenas, which hold at most the given sizes.
+  // They grow in chunks of at most kMaxArenaChunkSize, so large sizes only
+  // cost device memory once they are used.
+  //  One for host-visible buffers that the host writes.
   //  One for device-only-accessible buffers.
   //  One for device-only images.
+  //  One for transient attachments, which uses device_image_size.
+  //  One for host-coherent buffers, which are rewritten every frame.
+  //  One for host-visible buffers that the host reads, which uses
+  //    host_buffer_size.
+  // The memory type of each arena is picked by GetMemoryIndexForUsage, so
+  // for example the readback arena uses host-cached memory, and the
+  // host-coherent arena uses device-local memory, where they exist.
+  // No device memory is allocated for an arena until it is first used.
+  // If thread_safe_memory is true, then CreateAndBindImage,
+  // CreateAndBind*Buffer, Create*BufferSlice and the destruction of the
+  // returned objects may be called from multiple threads at once.
   VulkanApplication(containers::Allocator* allocator, logging::Logger* log,
                     const entry::entry_data* entry_data,
                     const std::initializer_list<const char*> extensions = {},
@@ -398,12 +773,32 @@ class VulkanApplication {
                     uint32_t device_image_size = 1024 * 128,
                     uint32_t device_buffer_size = 1024 * 128,
                     uint32_t coherent_buffer_size = 1024 * 128,
-                    bool use_async_compute_queue = false);
+                    bool use_async_compute_queue = false,
+                    bool thread_safe_memory = false);
+  // If the application was started with -memory-stats=<file>, writes the
+  // memory statistics to that file.
+  ~VulkanApplication();
 
   // Creates an image from the given create_info, and binds memory from the
   // device-only image Arena.
   containers::unique_ptr<Image> CreateAndBindImage(
       const VkImageCreateInfo* create_info);
+  // Creates an image from the given create_info, and binds memory from the
+  // transient attachment Arena, which uses lazily allocated memory if the
+  // device has any. If the image cannot use that memory type, it is bound to
+  // the device-only image Arena instead. create_info->usage must include
+  // VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT.
+  containers::unique_ptr<Image> CreateAndBindTransientAttachment(
+      const VkImageCreateInfo* create_info);
+  // Allocates memory that satisfies requirements from the device-only image
+  // Arena, for the caller to bind images to. The memory must be returned
+  // with FreeImageMemory.
+  AllocationToken* AllocateImageMemory(const VkMemoryRequirements& requirements,
+                                       ::VkDeviceMemory* memory,
+                                       ::VkDeviceSize* offset);
+  void FreeImageMemory(AllocationToken* token) {
+    device_only_image_heap_->FreeMemory(token);
+  }
   // Create an image view for the given image, with the same format of the
   // given image and the given image view type, subresource range.
   containers::unique_ptr<VkImageView> CreateImageView(
@@ -417,6 +812,12 @@ class VulkanApplication {
   // host-coherent buffer arena. Also maps the memory needed for the device.
   containers::unique_ptr<Buffer> CreateAndBindCoherentBuffer(
       const VkBufferCreateInfo* create_info);
+  // Creates a buffer from the given create_info, and binds memory from the
+  // readback buffer Arena. Also maps the memory needed for the device.
+  // This should be used for buffers that the device writes and the host
+  // reads, which must be invalidated before they are read.
+  containers::unique_ptr<Buffer> CreateAndBindReadbackBuffer(
+      const VkBufferCreateInfo* create_info);
   // Creates a buffer with the given size, usage flags from the host-visible
   // buffer Arena. The buffer is create with VkBufferCreateFlags set to 0,
   // VkSharingMode set to VK_SHARING_MODE_EXCLUSIVE.
@@ -436,6 +837,20 @@ class VulkanApplication {
   // VkSharingMode set to VK_SHARING_MODE_EXCLUSIVE.
   containers::unique_ptr<Buffer> CreateAndBindDefaultExclusiveDeviceBuffer(
       VkDeviceSize size, VkBufferUsageFlags usages);
+  // Creates a BufferSlice of the given size in the host-visible buffer
+  // Arena. The slice can be used for transfers.
+  // In each of these, usage is what the caller will use the slice for, and
+  // it must be supported by the Arena's buffers.
+  containers::unique_ptr<BufferSlice> CreateHostBufferSlice(
+      ::VkDeviceSize size, VkBufferUsageFlags usage);
+  // Creates a BufferSlice of the given size in the host-coherent buffer
+  // Arena. The slice can be used for anything a buffer can be used for.
+  containers::unique_ptr<BufferSlice> CreateCoherentBufferSlice(
+      ::VkDeviceSize size, VkBufferUsageFlags usage);
+  // Creates a BufferSlice of the given size in the device-only-accessible
+  // buffer Arena. The slice can be used for anything a buffer can be used for.
+  containers::unique_ptr<BufferSlice> CreateDeviceBufferSlice(
+      ::VkDeviceSize size, VkBufferUsageFlags usage);
   // Create a buffer view for the given buffer, with the same format of the
   // given buffer and the given buffer view offset and range.
   containers::unique_ptr<VkBufferView> CreateBufferView(::VkBuffer buffer,
@@ -452,6 +867,11 @@ class VulkanApplication {
   // VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL. If the operation can not be done
   // successfully, this method returns false and a command buffer wrapping
   // VK_NULL_HANDLE, the layout of the image will not be changed.
+  // The returned buffer holds the staging data and must be kept alive until
+  // the command buffer has executed. It is nullptr if the data was staged
+  // through transient_arena() instead, which is only done when |fence| is
+  // VK_NULL_HANDLE, so that the staging memory is retired with the arena's
+  // own fence.
   std::tuple<bool, VkCommandBuffer,
              containers::unique_ptr<VulkanApplication::Buffer>>
   FillImageLayersData(
@@ -471,9 +891,10 @@ class VulkanApplication {
                        VkAccessFlags target_usage);
 
   // Fills a mapped host-visible buffer with the given data.
-  // This calls the vkFlushMappedMemoryRanges upon the backing memory of the
-  // given host-visible buffer, then records a buffer memory barrier to the
-  // given command buffer.
+  // This records the written range to be flushed by the next call to
+  // FlushHostWrites, which EndAndSubmitCommandBuffer and the sample
+  // framework make before they submit, then records a buffer memory barrier
+  // to the given command buffer.
   void FillHostVisibleBuffer(Buffer* buffer, const void* data, size_t data_size,
                              size_t buffer_offset,
                              VkCommandBuffer* command_buffer,
@@ -524,16 +945,23 @@ class VulkanApplication {
   }
 
   // Ends the given command buffer and submits the command buffer to the given
-  // queue with the given wait semaphores, signal semaphores and fences. Returns
+  // queue with the given wait semaphores, signal semaphores and fences. Any
+  // pending host writes are flushed first (see FlushHostWrites). If fence
+  // is VK_NULL_HANDLE, then all transient memory allocated so far is
+  // retired with this submission (see RetireTransientMemory), so it must
+  // not be used by command buffers that are submitted later. Returns
   // the VkResult of the queue submit operation.
   VkResult EndAndSubmitCommandBuffer(
       VkCommandBuffer* cmd_buf, VkQueue* queue,
       std::initializer_list<::VkSemaphore> wait_semaphores,
       std::initializer_list<VkPipelineStageFlags> wait_stages,
       std::initializer_list<::VkSemaphore> signal_semaphores, ::VkFence fence) {
-    std::vector<::VkSemaphore> wait_semaphores_vec(wait_semaphores);
-    std::vector<VkPipelineStageFlags> wait_stages_vec(wait_stages);
-    std::vector<::VkSemaphore> signal_semaphores_vec(signal_semaphores);
+    containers::small_vector<::VkSemaphore, 4> wait_semaphores_vec(
+        wait_semaphores, allocator_);
+    containers::small_vector<VkPipelineStageFlags, 4> wait_stages_vec(
+        wait_stages, allocator_);
+    containers::small_vector<::VkSemaphore, 4> signal_semaphores_vec(
+        signal_semaphores, allocator_);
     (*cmd_buf)->vkEndCommandBuffer(*cmd_buf);
 
     auto& q = *queue;
@@ -549,6 +977,10 @@ class VulkanApplication {
         signal_semaphores_vec.data()             // pSignalSemaphores
     };
 
+    FlushHostWrites();
+    if (fence == VK_NULL_HANDLE) {
+      fence = RetireTransientMemory();
+    }
     VkResult r = q->vkQueueSubmit(q, 1, &submit_info, fence);
     return r;
   }
@@ -582,6 +1014,11 @@ class VulkanApplication {
   VkInstance& instance() { return instance_; }
 
   VkPipelineCache& pipeline_cache() { return pipeline_cache_; }
+  // The callbacks that the instance, the device, and every object created
+  // through this application use for host memory.
+  HostAllocationCallbacks& host_allocation_callbacks() {
+    return host_allocation_callbacks_;
+  }
 
   logging::Logger* GetLogger() { return log_; }
 
@@ -596,10 +1033,11 @@ class VulkanApplication {
         vals                                          // pCode
     };
     ::VkShaderModule module;
-    LOG_ASSERT(
-        ==, log_, VK_SUCCESS,
-        device_->vkCreateShaderModule(device_, &create_info, nullptr, &module));
-    return VkShaderModule(module, nullptr, &device_);
+    VkAllocationCallbacks* callbacks = device_.allocation_callbacks();
+    LOG_ASSERT(==, log_, VK_SUCCESS,
+               device_->vkCreateShaderModule(device_, &create_info, callbacks,
+                                             &module));
+    return VkShaderModule(module, callbacks, &device_);
   }
 
   // Returns true if the Present queue is not the same as the present queue.
@@ -633,12 +1071,12 @@ class VulkanApplication {
       std::initializer_list<VkAttachmentDescription> attachments,
       std::initializer_list<VkSubpassDescription> subpasses,
       std::initializer_list<VkSubpassDependency> dependencies) {
-    containers::vector<VkAttachmentDescription> attach(allocator_);
-    containers::vector<VkSubpassDescription> subpass(allocator_);
-    containers::vector<VkSubpassDependency> dep(allocator_);
-    attach.insert(attach.begin(), attachments.begin(), attachments.end());
-    subpass.insert(subpass.begin(), subpasses.begin(), subpasses.end());
-    dep.insert(dep.begin(), dependencies.begin(), dependencies.end());
+    containers::small_vector<VkAttachmentDescription, 8> attach(attachments,
+                                                                allocator_);
+    containers::small_vector<VkSubpassDescription, 4> subpass(subpasses,
+                                                              allocator_);
+    containers::small_vector<VkSubpassDependency, 4> dep(dependencies,
+                                                         allocator_);
 
     VkRenderPassCreateInfo create_info{
         VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,  // sType
@@ -653,10 +1091,11 @@ class VulkanApplication {
     };
 
     ::VkRenderPass render_pass;
+    VkAllocationCallbacks* callbacks = device_.allocation_callbacks();
     LOG_ASSERT(==, log_, VK_SUCCESS,
-               device_->vkCreateRenderPass(device_, &create_info, nullptr,
+               device_->vkCreateRenderPass(device_, &create_info, callbacks,
                                            &render_pass));
-    return vulkan::VkRenderPass(render_pass, nullptr, &device_);
+    return vulkan::VkRenderPass(render_pass, callbacks, &device_);
   }
 
   VulkanGraphicsPipeline CreateGraphicsPipeline(PipelineLayout* layout,
@@ -679,6 +1118,124 @@ class VulkanApplication {
 
   bool should_exit() const { return should_exit_.load(); }
 
+  // Returns the arena used for transient, host-visible staging memory.
+  // The arena is created the first time this is called.
+  TransientArena* transient_arena();
+
+  // Marks all transient memory that has been allocated so far as being
+  // used by the next batch submitted to a queue, and returns the fence that
+  // batch must be submitted with. The memory will be reused once that fence
+  // signals. Returns VK_NULL_HANDLE if there is nothing to retire.
+  // EndAndSubmitCommandBuffer does this for batches without a fence.
+  ::VkFence RetireTransientMemory() {
+    return transient_arena_ ? transient_arena_->Retire()
+                            : ::VkFence(VK_NULL_HANDLE);
+  }
+
+  // Marks all transient memory that has been allocated so far as being
+  // used by work that is known to have completed, so that it can be
+  // reused right away.
+  void RetireCompletedTransientMemory() {
+    if (transient_arena_) {
+      transient_arena_->RetireCompleted();
+    }
+  }
+
+  // The size of the buffer backing transient_arena(). It is a quarter of
+  // the host-visible heap instead, if that is limited to less than four
+  // times this.
+  static const ::VkDeviceSize kTransientArenaSize = 4 * 1024 * 1024;
+
+  // Returns chunks of device memory that have not been used for
+  // kArenaIdleFramesBeforeRelease frames back to the device.
+  // This is expected to be called once per frame.
+  void ReleaseIdleMemory() {
+    host_accessible_pool_->ReleaseIdleSlabs(kArenaIdleFramesBeforeRelease);
+    coherent_pool_->ReleaseIdleSlabs(kArenaIdleFramesBeforeRelease);
+    device_only_buffer_pool_->ReleaseIdleSlabs(kArenaIdleFramesBeforeRelease);
+    readback_pool_->ReleaseIdleSlabs(kArenaIdleFramesBeforeRelease);
+    host_accessible_heap_->ReleaseIdleChunks();
+    coherent_heap_->ReleaseIdleChunks();
+    device_only_image_heap_->ReleaseIdleChunks();
+    device_only_buffer_heap_->ReleaseIdleChunks();
+    readback_heap_->ReleaseIdleChunks();
+    transient_attachment_heap_->ReleaseIdleChunks();
+  }
+
+  // Statistics for each of the memory arenas.
+  struct MemoryStatistics {
+    ArenaStatistics host_accessible_heap;
+    ArenaStatistics coherent_heap;
+    ArenaStatistics device_only_image_heap;
+    ArenaStatistics device_only_buffer_heap;
+    ArenaStatistics readback_heap;
+    ArenaStatistics transient_attachment_heap;
+    // The host memory the driver has allocated through our callbacks,
+    // indexed by VkSystemAllocationScope.
+    HostAllocationCallbacks::ScopeStatistics
+        driver_host_memory[VK_SYSTEM_ALLOCATION_SCOPE_RANGE_SIZE];
+  };
+
+  // Flushes the host writes recorded with mark_host_written on any buffer or
+  // slice, with at most one call to vkFlushMappedMemoryRanges per arena.
+  // This must be called before submitting the work that reads them.
+  void FlushHostWrites() {
+    host_accessible_heap_->FlushHostWrites();
+    coherent_heap_->FlushHostWrites();
+    readback_heap_->FlushHostWrites();
+  }
+
+  // Invalidates the device writes recorded with mark_device_written on any
+  // buffer or slice, with at most one call to vkInvalidateMappedMemoryRanges
+  // per arena. This must be called after the work that wrote them has
+  // completed, before the host reads them.
+  void InvalidateDeviceWrites() {
+    host_accessible_heap_->InvalidateDeviceWrites();
+    coherent_heap_->InvalidateDeviceWrites();
+    readback_heap_->InvalidateDeviceWrites();
+  }
+
+  // Sets *allocated_size to the number of bytes of memory that have been
+  // allocated for transient attachments, and *committed_size to the number
+  // of those bytes that the device has actually had to back. Attachments
+  // that fell back to the device-only image Arena are not counted.
+  void GetTransientAttachmentMemory(::VkDeviceSize* allocated_size,
+                                    ::VkDeviceSize* committed_size) const {
+    *allocated_size = transient_attachment_heap_->allocated_size();
+    *committed_size = transient_attachment_heap_->GetCommittedSize();
+  }
+
+  // Fills *statistics with the current state of each memory arena.
+  void GetMemoryStatistics(MemoryStatistics* statistics) const;
+
+  // Returns the current memory statistics as a JSON object, with one member
+  // per arena, and one for the driver's host memory.
+  containers::string GetMemoryStatisticsJson() const;
+
+  // Writes GetMemoryStatisticsJson() to the given file. Returns false if the
+  // file could not be written.
+  bool WriteMemoryStatistics(const char* file_name) const;
+
+  // Writes CallStatistics::WriteJson() to the given file. Returns false if
+  // the file could not be written.
+  bool WriteCallStatistics(const char* file_name) const;
+
+  // The number of frames that a chunk of arena memory must be empty for
+  // before it is released.
+  static const uint32_t kArenaIdleFramesBeforeRelease = 120;
+
+  // The largest chunk of device memory that an arena commits at once.
+  static const ::VkDeviceSize kMaxArenaChunkSize = 16 * 1024 * 1024;
+
+  // Returns the chunk size for an arena that may hold at most max_size
+  // bytes.
+  static ::VkDeviceSize ChunkSizeForArena(::VkDeviceSize max_size) {
+    if (max_size < kMaxArenaChunkSize) {
+      return max_size;
+    }
+    return kMaxArenaChunkSize;
+  }
+
   static const VkAccessFlags kAllReadBits =
       VK_ACCESS_HOST_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT |
       VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
@@ -696,8 +1253,14 @@ class VulkanApplication {
   containers::Allocator* GetAllocator() { return allocator_; }
 
  private:
+  // Buffers that are small enough are allocated from pool, and the rest
+  // from heap. pool must allocate from heap.
   containers::unique_ptr<Buffer> CreateAndBindBuffer(
-      VulkanArena* heap, const VkBufferCreateInfo* create_info);
+      VulkanArena* heap, SlabPool* pool, const VkBufferCreateInfo* create_info);
+  containers::unique_ptr<Image> CreateAndBindImage(
+      VulkanArena* heap, const VkImageCreateInfo* create_info);
+  containers::unique_ptr<BufferSlice> CreateBufferSlice(
+      VulkanArena* heap, ::VkDeviceSize size, VkBufferUsageFlags usage);
 
   // Intended to be called by the constructor to create the device, since
   // VkDevice does not have a default constructor.
@@ -705,6 +1268,11 @@ class VulkanApplication {
                         const VkPhysicalDeviceFeatures& features,
                         bool create_async_compute_queue);
 
+  // Starts recording Vulkan calls to options.capture_file, if it is set.
+  // Intended to be called by the constructor, before the instance is
+  // created.
+  containers::unique_ptr<Capture> CreateCapture();
+
   containers::Allocator* allocator_;
   logging::Logger* log_;
   const entry::entry_data* entry_data_;
@@ -717,6 +1285,14 @@ class VulkanApplication {
   uint32_t present_queue_index_;
   uint32_t compute_queue_index_;
 
+  // This must outlive every Vulkan object, so it is declared before them.
+  HostAllocationCallbacks host_allocation_callbacks_;
+  // The Buffers, Images and views that this application hands out are
+  // small, and are allocated from pools rather than one by one.
+  containers::SizeClassAllocator object_allocator_;
+  // Declared before the instance, so that it records every call from its
+  // creation to its destruction.
+  containers::unique_ptr<Capture> capture_;
   LibraryWrapper library_wrapper_;
   VkInstance instance_;
   VkSurfaceKHR surface_;
@@ -728,11 +1304,23 @@ class VulkanApplication {
   containers::unique_ptr<VulkanArena> coherent_heap_;
   containers::unique_ptr<VulkanArena> device_only_image_heap_;
   containers::unique_ptr<VulkanArena> device_only_buffer_heap_;
+  containers::unique_ptr<VulkanArena> readback_heap_;
+  containers::unique_ptr<VulkanArena> transient_attachment_heap_;
+  // Pools for small buffers, one for each of the buffer heaps. These are
+  // declared after the heaps, so that they are destroyed first.
+  containers::unique_ptr<SlabPool> host_accessible_pool_;
+  containers::unique_ptr<SlabPool> coherent_pool_;
+  containers::unique_ptr<SlabPool> device_only_buffer_pool_;
+  containers::unique_ptr<SlabPool> readback_pool_;
+  containers::unique_ptr<Buffer> transient_buffer_;
+  containers::unique_ptr<TransientArena> transient_arena_;
   containers::vector<::VkImage> swapchain_images_;
   std::atomic<bool> should_exit_;
 };
 
 using BufferPointer = containers::unique_ptr<VulkanApplication::Buffer>;
+using BufferSlicePointer =
+    containers::unique_ptr<VulkanApplication::BufferSlice>;
 using ImagePointer = containers::unique_ptr<VulkanApplication::Image>;
 }  // namespace vulkan
 
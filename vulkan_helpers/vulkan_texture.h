@@ -52,28 +52,43 @@ struct VulkanTexture {
                       static_cast<const void*>(t.data), sizeof(t.data)) {}
 
   // Creates the image object.
-  // Also creates a temporary buffer object for the upload data
+  // The upload data is staged in the application's transient arena, or in
+  // a temporary buffer if the transient arena is full.
   // If this image has already been initialized, then this re-initializes it.
-  // Returns the temporary buffer used to upload the image. This should/can
-  // be safely deleted once the given command buffer has executed.
+  // The staging memory can be released once the given command buffer has
+  // executed, by calling InitializationComplete(). Transient staging memory
+  // is retired by the submission of the command buffer, through
+  // VulkanApplication::EndAndSubmitCommandBuffer or
+  // VulkanApplication::RetireTransientMemory().
   // The image is transitioned into "VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL"
   // during the upload operation.
   void InitializeData(vulkan::VulkanApplication* application,
                       vulkan::VkCommandBuffer* cmdBuffer,
                       VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT) {
-    VkBufferCreateInfo create_info = {
-        VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,  // sType
-        nullptr,                               // pNext
-        0,                                     // flags
-        data_size_,                            // size
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,      // usage
-        VK_SHARING_MODE_EXCLUSIVE,
-        0,
-        nullptr};
-    upload_buffer_ = application->CreateAndBindHostBuffer(&create_info);
-    void* copy_base = upload_buffer_->base_address();
-    memcpy(copy_base, data_, data_size_);
-    upload_buffer_->flush();
+    vulkan::TransientArena* transient = application->transient_arena();
+    vulkan::TransientArena::Allocation upload;
+    if (transient->Allocate(data_size_,
+                            vulkan::GetBufferImageCopyOffsetAlignment(format_),
+                            &upload)) {
+      memcpy(upload.base_address, data_, data_size_);
+      transient->Flush(upload);
+    } else {
+      VkBufferCreateInfo create_info = {
+          VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,  // sType
+          nullptr,                               // pNext
+          0,                                     // flags
+          data_size_,                            // size
+          VK_BUFFER_USAGE_TRANSFER_SRC_BIT,      // usage
+          VK_SHARING_MODE_EXCLUSIVE,
+          0,
+          nullptr};
+      upload_buffer_ = application->CreateAndBindHostBuffer(&create_info);
+      void* copy_base = upload_buffer_->base_address();
+      memcpy(copy_base, data_, data_size_);
+      upload_buffer_->flush();
+      upload = {*upload_buffer_, 0, data_size_,
+                upload_buffer_->base_address()};
+    }
 
     VkImageCreateInfo image_create_info = {
         VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,  // sType
@@ -107,13 +122,15 @@ struct VulkanTexture {
         {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}};
 
     ::VkImageView raw_view;
+    VkAllocationCallbacks* callbacks =
+        application->device().allocation_callbacks();
     LOG_ASSERT(
         ==, logger_, VK_SUCCESS,
         application->device()->vkCreateImageView(
-            application->device(), &view_create_info, nullptr, &raw_view));
+            application->device(), &view_create_info, callbacks, &raw_view));
     image_view_ = containers::make_unique<vulkan::VkImageView>(
         allocator_,
-        vulkan::VkImageView(raw_view, nullptr, &application->device()));
+        vulkan::VkImageView(raw_view, callbacks, &application->device()));
 
     VkImageMemoryBarrier barrier = {
         VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,  // sType
@@ -133,8 +150,8 @@ struct VulkanTexture {
         VK_ACCESS_TRANSFER_READ_BIT,              // dstAccessMask
         VK_QUEUE_FAMILY_IGNORED,                  // srcQueueFamilyIndex
         VK_QUEUE_FAMILY_IGNORED,                  // dstQueueFamilyIndex
-        *upload_buffer_,                          // buffer
-        0,                                        // offset
+        upload.buffer,                            // buffer
+        upload.offset,                            // offset
         data_size_,                               // size
     };
 
@@ -144,7 +161,7 @@ struct VulkanTexture {
                                &buffer_barrier, 1, &barrier);
 
     VkBufferImageCopy copy_params = {
-        0,                                     // bufferOffset
+        upload.offset,                         // bufferOffset
         0,                                     // bufferRowLength
         0,                                     // bufferImageHeight
         {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1},  // imageSubresource
@@ -155,7 +172,7 @@ struct VulkanTexture {
     };
 
     (*cmdBuffer)
-        ->vkCmdCopyBufferToImage(*cmdBuffer, *upload_buffer_, *image_,
+        ->vkCmdCopyBufferToImage(*cmdBuffer, upload.buffer, *image_,
                                  VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
                                  &copy_params);
     barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
@@ -0,0 +1,221 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_wrapper/call_statistics.h"
+
+#if VULKAN_CALL_STATISTICS
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace vulkan {
+
+namespace {
+// The counters of one function on one thread. Only that thread writes to
+// them, so they are updated without read-modify-write operations.
+struct FunctionCounters {
+  std::atomic<uint64_t> calls;
+  std::atomic<uint64_t> nanoseconds;
+  std::atomic<uint64_t> histogram[CallStatistics::kHistogramBuckets];
+};
+
+struct ThreadCounters {
+  ThreadCounters* next;
+  uint32_t index;
+  FunctionCounters functions[CallStatistics::kMaxFunctions];
+};
+
+void Increment(std::atomic<uint64_t>* counter, uint64_t value) {
+  counter->store(counter->load(std::memory_order_relaxed) + value,
+                 std::memory_order_relaxed);
+}
+
+// The functions and threads are never freed, since calls may be counted
+// until the program exits.
+struct GlobalState {
+  std::mutex mutex;
+  const char* names[CallStatistics::kMaxFunctions];
+  std::atomic<uint32_t> function_count;
+  std::atomic<ThreadCounters*> threads;
+  std::atomic<uint32_t> thread_count;
+  // The totals at the end of the last frame, and the most calls in a frame.
+  uint64_t last_frame_calls[CallStatistics::kMaxFunctions];
+  uint64_t last_frame_nanoseconds[CallStatistics::kMaxFunctions];
+  uint64_t max_calls_per_frame[CallStatistics::kMaxFunctions];
+  uint64_t frame_count;
+};
+
+GlobalState& state() {
+  // This is constructed on first use, and intentionally never destroyed,
+  // so that calls from other static destructors are still safe.
+  static GlobalState* global_state =
+      ::new (malloc(sizeof(GlobalState))) GlobalState();
+  return *global_state;
+}
+
+thread_local ThreadCounters* thread_counters = nullptr;
+
+ThreadCounters* GetThreadCounters() {
+  if (!thread_counters) {
+    GlobalState& global = state();
+    // Value-initializing the counters zeroes them.
+    ThreadCounters* counters =
+        ::new (malloc(sizeof(ThreadCounters))) ThreadCounters();
+    counters->index = global.thread_count++;
+    counters->next = global.threads.load();
+    while (!global.threads.compare_exchange_weak(counters->next, counters)) {
+    }
+    thread_counters = counters;
+  }
+  return thread_counters;
+}
+
+// Sums a function's counters over every thread.
+void GetTotals(uint32_t function, uint64_t* calls, uint64_t* nanoseconds) {
+  *calls = 0;
+  *nanoseconds = 0;
+  for (ThreadCounters* thread = state().threads.load(); thread;
+       thread = thread->next) {
+    *calls += thread->functions[function].calls.load(std::memory_order_relaxed);
+    *nanoseconds +=
+        thread->functions[function].nanoseconds.load(std::memory_order_relaxed);
+  }
+}
+}  // anonymous namespace
+
+std::atomic<bool> CallStatistics::timing_enabled_(true);
+
+uint32_t CallStatistics::RegisterFunction(const char* name) {
+  GlobalState& global = state();
+  std::lock_guard<std::mutex> lock(global.mutex);
+  const uint32_t count = global.function_count.load();
+  for (uint32_t i = 0; i < count; ++i) {
+    if (strcmp(global.names[i], name) == 0) {
+      return i;
+    }
+  }
+  if (count == kMaxFunctions) {
+    return kMaxFunctions;
+  }
+  global.names[count] = name;
+  global.function_count.store(count + 1);
+  return count;
+}
+
+void CallStatistics::RecordCall(uint32_t function, uint64_t nanoseconds) {
+  if (function >= kMaxFunctions) {
+    return;
+  }
+  FunctionCounters& counters = GetThreadCounters()->functions[function];
+  Increment(&counters.calls, 1);
+  if (nanoseconds) {
+    Increment(&counters.nanoseconds, nanoseconds);
+    uint32_t bucket = 0;
+    for (uint64_t limit = kFirstBucketNanoseconds;
+         nanoseconds > limit && bucket + 1 < kHistogramBuckets; limit *= 2) {
+      ++bucket;
+    }
+    Increment(&counters.histogram[bucket], 1);
+  }
+}
+
+void CallStatistics::EndFrame(containers::vector<FunctionSummary>* summary) {
+  GlobalState& global = state();
+  if (summary) {
+    summary->clear();
+  }
+  global.frame_count += 1;
+  const uint32_t count = global.function_count.load();
+  for (uint32_t i = 0; i < count; ++i) {
+    uint64_t calls;
+    uint64_t nanoseconds;
+    GetTotals(i, &calls, &nanoseconds);
+    const uint64_t frame_calls = calls - global.last_frame_calls[i];
+    const uint64_t frame_nanoseconds =
+        nanoseconds - global.last_frame_nanoseconds[i];
+    global.last_frame_calls[i] = calls;
+    global.last_frame_nanoseconds[i] = nanoseconds;
+    global.max_calls_per_frame[i] =
+        std::max(global.max_calls_per_frame[i], frame_calls);
+    if (summary && frame_calls) {
+      summary->push_back({global.names[i], frame_calls, frame_nanoseconds});
+    }
+  }
+  if (summary) {
+    std::sort(summary->begin(), summary->end(),
+              [](const FunctionSummary& a, const FunctionSummary& b) {
+                return a.calls > b.calls;
+              });
+  }
+}
+
+void CallStatistics::WriteJson(std::ostream& stream) {
+  GlobalState& global = state();
+  const uint32_t count = global.function_count.load();
+  stream << "{\n";
+  stream << "  \"frames\": " << global.frame_count << ",\n";
+  stream << "  \"timed\": " << (timing_enabled_.load() ? "true" : "false")
+         << ",\n";
+  stream << "  \"histogram_first_bucket_nanoseconds\": "
+         << kFirstBucketNanoseconds << ",\n";
+  stream << "  \"functions\": {";
+  bool first = true;
+  for (uint32_t i = 0; i < count; ++i) {
+    uint64_t calls;
+    uint64_t nanoseconds;
+    GetTotals(i, &calls, &nanoseconds);
+    if (!calls) {
+      continue;
+    }
+    stream << (first ? "\n" : ",\n");
+    first = false;
+    stream << "    \"" << global.names[i] << "\": {";
+    stream << "\"calls\": " << calls << ", ";
+    stream << "\"nanoseconds\": " << nanoseconds << ", ";
+    stream << "\"max_calls_per_frame\": " << global.max_calls_per_frame[i]
+           << ", ";
+    stream << "\"histogram\": [";
+    for (uint32_t bucket = 0; bucket < kHistogramBuckets; ++bucket) {
+      uint64_t bucket_calls = 0;
+      for (ThreadCounters* thread = global.threads.load(); thread;
+           thread = thread->next) {
+        bucket_calls += thread->functions[i].histogram[bucket].load(
+            std::memory_order_relaxed);
+      }
+      stream << (bucket ? ", " : "") << bucket_calls;
+    }
+    stream << "], \"calls_by_thread\": {";
+    bool first_thread = true;
+    for (ThreadCounters* thread = global.threads.load(); thread;
+         thread = thread->next) {
+      const uint64_t thread_calls =
+          thread->functions[i].calls.load(std::memory_order_relaxed);
+      if (thread_calls) {
+        stream << (first_thread ? "" : ", ") << "\"" << thread->index
+               << "\": " << thread_calls;
+        first_thread = false;
+      }
+    }
+    stream << "}}";
+  }
+  stream << "\n  }\n}\n";
+}
+
+}  // namespace vulkan
+
+#endif  // VULKAN_CALL_STATISTICS
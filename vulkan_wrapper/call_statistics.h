@@ -0,0 +1,113 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_WRAPPER_CALL_STATISTICS_H_
+#define VULKAN_WRAPPER_CALL_STATISTICS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+#include "support/containers/vector.h"
+
+// Builds with VULKAN_CALL_STATISTICS set to 1 count every call made through
+// a LazyFunction. Otherwise none of this is compiled into the call path.
+#ifndef VULKAN_CALL_STATISTICS
+#define VULKAN_CALL_STATISTICS 0
+#endif
+
+namespace vulkan {
+
+// CallStatistics counts the calls to each Vulkan function, on each thread,
+// and optionally times them into a histogram. Every thread counts into its
+// own table, so calls take no locks, and frames are delimited by EndFrame.
+//
+// Only builds with VULKAN_CALL_STATISTICS count anything. In other builds
+// every method does nothing.
+class CallStatistics {
+ public:
+  // Functions beyond this many are not counted.
+  static const uint32_t kMaxFunctions = 512;
+  // Call times are bucketed by the next power of two of their duration in
+  // nanoseconds, starting at 64ns. The last bucket holds everything longer.
+  static const uint32_t kHistogramBuckets = 24;
+  static const uint64_t kFirstBucketNanoseconds = 64;
+
+  struct FunctionSummary {
+    const char* name;
+    uint64_t calls;
+    uint64_t nanoseconds;
+  };
+
+#if VULKAN_CALL_STATISTICS
+  // Counts a single call for as long as it is alive.
+  class ScopedCall {
+   public:
+    explicit ScopedCall(uint32_t function)
+        : function_(function),
+          start_(timing_enabled_.load(std::memory_order_relaxed) ? Now()
+                                                                 : 0) {}
+    ~ScopedCall() { RecordCall(function_, start_ ? Now() - start_ : 0); }
+
+   private:
+    uint32_t function_;
+    uint64_t start_;
+  };
+
+  // Returns the id that calls to the function with the given name are
+  // counted under. name must outlive every count.
+  static uint32_t RegisterFunction(const char* name);
+
+  // Calls are timed unless this is turned off, which leaves just the
+  // counts and saves reading the clock twice per call.
+  static void set_timing_enabled(bool enabled) {
+    timing_enabled_.store(enabled);
+  }
+
+  // Ends the current frame. Every call counted since the previous frame
+  // ended, on any thread, belongs to it. If summary is not nullptr, it is
+  // filled with the functions that were called in the frame, most called
+  // first. This must not be called from more than one thread at a time.
+  static void EndFrame(containers::vector<FunctionSummary>* summary);
+
+  // Writes the totals for every function since the program started, with
+  // their histograms and a breakdown by thread, to stream as JSON.
+  static void WriteJson(std::ostream& stream);
+#else
+  static void set_timing_enabled(bool) {}
+  static void EndFrame(containers::vector<FunctionSummary>*) {}
+  static void WriteJson(std::ostream& stream) { stream << "{}\n"; }
+#endif
+
+  static bool enabled() { return VULKAN_CALL_STATISTICS != 0; }
+
+#if VULKAN_CALL_STATISTICS
+ private:
+  static uint64_t Now() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+  }
+  static void RecordCall(uint32_t function, uint64_t nanoseconds);
+
+  static std::atomic<bool> timing_enabled_;
+#endif
+};
+
+}  // namespace vulkan
+
+#endif  // VULKAN_WRAPPER_CALL_STATISTICS_H_
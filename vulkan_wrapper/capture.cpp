@@ -0,0 +1,347 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_wrapper/capture.h"
+
+#if VULKAN_CAPTURE
+
+#include <algorithm>
+#include <cstring>
+
+namespace vulkan {
+
+namespace {
+const char kMagic[8] = {'V', 'T', 'A', 'C', 'A', 'P', 'T', '\0'};
+const uint32_t kByteOrderMark = 0x01020304;
+
+// The start of every struct that can be in a pNext chain.
+struct ChainHeader {
+  VkStructureType sType;
+  const void* pNext;
+};
+
+// Returns the handle at address as a number, whatever its size.
+uint64_t HandleValue(const void* address, uint32_t size) {
+  if (size == sizeof(uint64_t)) {
+    uint64_t value;
+    memcpy(&value, address, sizeof(value));
+    return value;
+  }
+  uint32_t value;
+  memcpy(&value, address, sizeof(value));
+  return value;
+}
+
+template <typename T>
+const T& At(const void* address) {
+  return *static_cast<const T*>(address);
+}
+
+// Returns the number of elements behind a pointer field.
+uint64_t CountOf(const capture::Field& field, const void* owner) {
+  return field.count ? field.count(owner) : 1;
+}
+}  // anonymous namespace
+
+const uint32_t Capture::kVersion;
+const uint32_t Capture::kPageSize;
+std::atomic<Capture*> Capture::active_(nullptr);
+
+Capture::Capture(containers::Allocator* allocator, logging::Logger* logger,
+                 const char* path)
+    : logger_(logger),
+      file_(path, std::ios::out | std::ios::binary | std::ios::trunc),
+      buffer_(allocator),
+      function_ids_(allocator),
+      unknown_structs_(allocator),
+      memory_sizes_(allocator),
+      mappings_(allocator),
+      allocate_memory_(capture::FindFunctionType("vkAllocateMemory")),
+      free_memory_(capture::FindFunctionType("vkFreeMemory")),
+      map_memory_(capture::FindFunctionType("vkMapMemory")),
+      unmap_memory_(capture::FindFunctionType("vkUnmapMemory")),
+      flush_mapped_memory_ranges_(
+          capture::FindFunctionType("vkFlushMappedMemoryRanges")),
+      queue_submit_(capture::FindFunctionType("vkQueueSubmit")) {
+  if (!file_.is_open()) {
+    logger_->LogError("Could not open ", path, " to capture Vulkan calls");
+    return;
+  }
+  file_.write(kMagic, sizeof(kMagic));
+  WriteValue(kVersion);
+  WriteValue(kByteOrderMark);
+  WriteValue(static_cast<uint32_t>(sizeof(void*)));
+  WriteValue(static_cast<uint32_t>(VK_HEADER_VERSION));
+  Capture* expected = nullptr;
+  const bool only_capture = active_.compare_exchange_strong(expected, this);
+  LOG_ASSERT(==, logger_, true, only_capture);
+}
+
+Capture::~Capture() {
+  Capture* expected = this;
+  active_.compare_exchange_strong(expected, nullptr);
+}
+
+uint64_t Capture::BeginCall(const capture::FunctionType* type,
+                            const void* const* parameters) {
+  if (!type) {
+    return 0;
+  }
+  if (type == queue_submit_ || type == flush_mapped_memory_ranges_) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RecordMappedMemory(0);
+  } else if (type == unmap_memory_) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RecordMappedMemory(HandleValue(parameters[1], sizeof(VkDeviceMemory)));
+  }
+  for (uint32_t i = 0; i < type->parameter_count; ++i) {
+    const capture::Field& field = type->parameters[i];
+    if (field.kind != capture::kInOutCountField) {
+      continue;
+    }
+    const void* count = At<const void*>(parameters[field.offset]);
+    return count ? HandleValue(count, field.element_size) : 0;
+  }
+  return 0;
+}
+
+void Capture::EndCall(const capture::FunctionType* type,
+                      const void* const* parameters, const void* result,
+                      uint64_t in_out_count) {
+  if (!type) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const uint32_t id = GetFunctionId(type);
+  buffer_.clear();
+  if (type->supported) {
+    for (uint32_t i = 0; i < type->parameter_count; ++i) {
+      const capture::Field& field = type->parameters[i];
+      EncodeField(field, parameters[field.offset], parameters, true,
+                  in_out_count);
+    }
+  }
+  if (result) {
+    EncodeBytes(result, type->result_size);
+  }
+  WriteValue(kCallRecord);
+  WriteValue(id);
+  WriteValue(static_cast<uint32_t>(buffer_.size()));
+  file_.write(reinterpret_cast<const char*>(buffer_.data()), buffer_.size());
+  TrackMemory(type, parameters, result);
+}
+
+void Capture::RecordMappedMemory(uint64_t memory) {
+  for (auto& mapping : mappings_) {
+    if (memory && mapping.first != memory) {
+      continue;
+    }
+    Mapping& mapped = mapping.second;
+    const size_t size = mapped.recorded.size();
+    size_t page = 0;
+    while (page < size) {
+      const size_t page_size = std::min<size_t>(kPageSize, size - page);
+      if (memcmp(mapped.data + page, mapped.recorded.data() + page,
+                 page_size) == 0) {
+        page += page_size;
+        continue;
+      }
+      // Changed pages that are next to each other are written together.
+      size_t end = page + page_size;
+      while (end < size) {
+        const size_t next_size = std::min<size_t>(kPageSize, size - end);
+        if (memcmp(mapped.data + end, mapped.recorded.data() + end,
+                   next_size) == 0) {
+          break;
+        }
+        end += next_size;
+      }
+      memcpy(mapped.recorded.data() + page, mapped.data + page, end - page);
+      WriteValue(kMemoryRecord);
+      WriteValue(mapping.first);
+      WriteValue(static_cast<uint64_t>(mapped.offset + page));
+      WriteValue(static_cast<uint32_t>(end - page));
+      file_.write(reinterpret_cast<const char*>(mapped.data + page),
+                  end - page);
+      page = end;
+    }
+  }
+}
+
+void Capture::TrackMemory(const capture::FunctionType* type,
+                          const void* const* parameters, const void* result) {
+  if (type == allocate_memory_) {
+    if (At<VkResult>(result) == VK_SUCCESS) {
+      const VkMemoryAllocateInfo* info =
+          At<const VkMemoryAllocateInfo*>(parameters[1]);
+      const void* memory = At<const void*>(parameters[3]);
+      memory_sizes_[HandleValue(memory, sizeof(VkDeviceMemory))] =
+          info->allocationSize;
+    }
+  } else if (type == free_memory_) {
+    const uint64_t memory = HandleValue(parameters[1], sizeof(VkDeviceMemory));
+    mappings_.erase(memory);
+    memory_sizes_.erase(memory);
+  } else if (type == map_memory_) {
+    const uint64_t memory = HandleValue(parameters[1], sizeof(VkDeviceMemory));
+    auto allocation = memory_sizes_.find(memory);
+    if (At<VkResult>(result) != VK_SUCCESS ||
+        allocation == memory_sizes_.end()) {
+      return;
+    }
+    const VkDeviceSize offset = At<VkDeviceSize>(parameters[2]);
+    VkDeviceSize size = At<VkDeviceSize>(parameters[3]);
+    if (size == VK_WHOLE_SIZE) {
+      size = allocation->second - offset;
+    }
+    uint8_t* data = static_cast<uint8_t*>(*At<void**>(parameters[5]));
+    containers::vector<uint8_t> recorded(data, data + size,
+                                         buffer_.get_allocator());
+    mappings_.emplace(memory, Mapping{offset, data, std::move(recorded)});
+  } else if (type == unmap_memory_) {
+    mappings_.erase(HandleValue(parameters[1], sizeof(VkDeviceMemory)));
+  }
+}
+
+uint32_t Capture::GetFunctionId(const capture::FunctionType* type) {
+  const uint32_t next_id = static_cast<uint32_t>(function_ids_.size()) + 1;
+  auto inserted = function_ids_.emplace(type, next_id);
+  if (inserted.second) {
+    if (!type->supported) {
+      logger_->LogError("Calls to ", type->name,
+                        " are captured without their parameters, and cannot "
+                        "be replayed");
+    }
+    const uint32_t length = static_cast<uint32_t>(strlen(type->name));
+    WriteValue(kFunctionRecord);
+    WriteValue(next_id);
+    WriteValue(length);
+    file_.write(type->name, length);
+  }
+  return inserted.first->second;
+}
+
+void Capture::EncodeField(const capture::Field& field, const void* address,
+                          const void* owner, bool parameter,
+                          uint64_t in_out_count) {
+  switch (field.kind) {
+    case capture::kValueField:
+    case capture::kHandleField:
+      // Struct members are already in the bytes of the struct.
+      if (parameter) {
+        EncodeBytes(address, field.element_size);
+      }
+      break;
+    case capture::kStructField:
+      EncodeFields(field.element_type, static_cast<const uint8_t*>(address));
+      break;
+    case capture::kPointerField:
+    case capture::kHandlePointerField: {
+      const uint8_t* elements = At<const uint8_t*>(address);
+      Encode(static_cast<uint8_t>(elements != nullptr));
+      if (!elements) {
+        break;
+      }
+      const uint64_t count = CountOf(field, owner);
+      Encode(count);
+      for (uint64_t i = 0; i < count; ++i) {
+        const uint8_t* element = elements + i * field.element_size;
+        EncodeBytes(element, field.element_size);
+        if (field.element_type) {
+          EncodeFields(field.element_type, element);
+        }
+      }
+      break;
+    }
+    case capture::kStringField:
+      EncodeString(At<const char*>(address));
+      break;
+    case capture::kStringArrayField: {
+      const char* const* strings = At<const char* const*>(address);
+      Encode(static_cast<uint8_t>(strings != nullptr));
+      if (!strings) {
+        break;
+      }
+      const uint64_t count = CountOf(field, owner);
+      Encode(count);
+      for (uint64_t i = 0; i < count; ++i) {
+        EncodeString(strings[i]);
+      }
+      break;
+    }
+    case capture::kNextField: {
+      const ChainHeader* next = At<const ChainHeader*>(address);
+      const capture::StructType* type =
+          next ? capture::FindStructType(next->sType) : nullptr;
+      if (next && !type &&
+          unknown_structs_.emplace(next->sType, true).second) {
+        logger_->LogError("Capture does not know the struct with sType ",
+                          next->sType, ", so the pNext chain ends there");
+      }
+      Encode(static_cast<uint8_t>(type != nullptr));
+      if (type) {
+        Encode(static_cast<int32_t>(next->sType));
+        EncodeBytes(next, type->size);
+        EncodeFields(type, reinterpret_cast<const uint8_t*>(next));
+      }
+      break;
+    }
+    case capture::kOutputField:
+    case capture::kOutputHandleField: {
+      const uint8_t* elements = At<const uint8_t*>(address);
+      Encode(static_cast<uint8_t>(elements != nullptr));
+      if (!elements) {
+        break;
+      }
+      const uint64_t count = CountOf(field, owner);
+      Encode(count);
+      // The replayer only needs the handles that were written, so that it
+      // can map them to its own.
+      if (field.kind == capture::kOutputHandleField) {
+        EncodeBytes(elements, count * field.element_size);
+      }
+      break;
+    }
+    case capture::kInOutCountField:
+      Encode(static_cast<uint8_t>(At<const void*>(address) != nullptr));
+      if (At<const void*>(address)) {
+        Encode(in_out_count);
+      }
+      break;
+    case capture::kIgnoredField:
+      break;
+  }
+}
+
+void Capture::EncodeFields(const capture::StructType* type,
+                           const uint8_t* data) {
+  for (uint32_t i = 0; i < type->field_count; ++i) {
+    const capture::Field& field = type->fields[i];
+    EncodeField(field, data + field.offset, data, false, 0);
+  }
+}
+
+void Capture::EncodeString(const char* value) {
+  Encode(static_cast<uint8_t>(value != nullptr));
+  if (value) {
+    const uint32_t length = static_cast<uint32_t>(strlen(value));
+    Encode(length);
+    EncodeBytes(value, length);
+  }
+}
+
+}  // namespace vulkan
+
+#endif  // VULKAN_CAPTURE
@@ -0,0 +1,208 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_WRAPPER_CAPTURE_H_
+#define VULKAN_WRAPPER_CAPTURE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+
+#include "support/containers/allocator.h"
+#include "support/containers/flat_hash_map.h"
+#include "support/containers/vector.h"
+#include "support/log/log.h"
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+#include "vulkan_wrapper/capture_tables.h"
+
+// Builds with VULKAN_CAPTURE set to 1 can record every call made through a
+// LazyFunction. Otherwise none of this is compiled into the call path.
+#ifndef VULKAN_CAPTURE
+#define VULKAN_CAPTURE 0
+#endif
+
+namespace vulkan {
+
+// Capture records every Vulkan call made while it is alive, with everything
+// that the call reads, to a file that Replayer can issue again against any
+// driver. Only one Capture should be alive at a time.
+//
+// The file starts with the 8 bytes "VTACAPT\0", a uint32_t version, the
+// uint32_t 0x01020304, which gives the byte order of every number that
+// follows, and the uint32_t sizes of a pointer and VK_HEADER_VERSION. Then
+// there is a sequence of records, each starting with a uint8_t RecordType:
+//   kFunctionRecord: uint32_t id, then the name of the function as a
+//     uint32_t length followed by its bytes. This comes before the first
+//     call to that function.
+//   kCallRecord: uint32_t function id, uint32_t size, then the parameters
+//     as described in capture_tables.h, followed by the result. Calls are
+//     recorded as they return.
+//   kMemoryRecord: uint64_t VkDeviceMemory, uint64_t offset, uint32_t size,
+//     then the bytes that the application wrote to mapped memory at that
+//     offset. These are written before the vkQueueSubmit,
+//     vkFlushMappedMemoryRanges or vkUnmapMemory that makes them visible.
+//
+// Only builds with VULKAN_CAPTURE record anything. In other builds a
+// Capture is never open.
+class Capture {
+ public:
+  static const uint32_t kVersion = 1;
+  enum RecordType : uint8_t {
+    kFunctionRecord = 1,
+    kCallRecord = 2,
+    kMemoryRecord = 3
+  };
+  // Mapped memory is compared against what was last recorded in pages of
+  // this many bytes.
+  static const uint32_t kPageSize = 4096;
+
+  static bool enabled() { return VULKAN_CAPTURE != 0; }
+
+#if VULKAN_CAPTURE
+  // Replaces the file at path, and starts recording.
+  Capture(containers::Allocator* allocator, logging::Logger* logger,
+          const char* path);
+  ~Capture();
+
+  // Returns false if the file could not be opened, in which case nothing is
+  // recorded.
+  bool is_open() const { return file_.is_open(); }
+
+  // Returns the Capture that is recording, or nullptr if there is none.
+  static Capture* active() { return active_.load(std::memory_order_acquire); }
+
+  // Calls function with args, and records the call as type. args may be
+  // wrappers that convert to the parameters of function.
+  template <typename R, typename... P, typename... Args>
+  R Call(const capture::FunctionType* type, R(VKAPI_PTR* function)(P...),
+         const Args&... args) {
+    return Invoke<R, P...>(type, function, args...);
+  }
+#else
+  Capture(containers::Allocator*, logging::Logger*, const char*) {}
+  bool is_open() const { return false; }
+#endif
+
+#if VULKAN_CAPTURE
+ private:
+  template <typename T>
+  struct Identity {
+    typedef T type;
+  };
+
+  // Holds the result of a call, so that void calls can be recorded the
+  // same way as any other.
+  template <typename R>
+  struct Result {
+    template <typename F, typename... P>
+    Result(F function, P... parameters) : value(function(parameters...)) {}
+    const void* address() const { return &value; }
+    R get() const { return value; }
+    R value;
+  };
+
+  template <typename R, typename... P>
+  R Invoke(const capture::FunctionType* type, R(VKAPI_PTR* function)(P...),
+           typename Identity<P>::type... parameters) {
+    const void* const addresses[] = {&parameters..., nullptr};
+    const uint64_t in_out_count = BeginCall(type, addresses);
+    const Result<R> result(function, parameters...);
+    EndCall(type, addresses, result.address(), in_out_count);
+    return result.get();
+  }
+
+  // The part of the memory of a VkDeviceMemory that is mapped, and a copy
+  // of what was last recorded of it.
+  struct Mapping {
+    uint64_t offset;
+    uint8_t* data;
+    containers::vector<uint8_t> recorded;
+  };
+
+  // Records the memory that the call may make visible to the device, and
+  // returns the value of its in/out count parameter, if it has one.
+  uint64_t BeginCall(const capture::FunctionType* type,
+                     const void* const* parameters);
+  // Records the call, and tracks the memory that it allocates or maps.
+  void EndCall(const capture::FunctionType* type,
+               const void* const* parameters, const void* result,
+               uint64_t in_out_count);
+
+  // Records the pages of mapped memory that have changed since they were
+  // last recorded, for every mapping if memory is 0.
+  void RecordMappedMemory(uint64_t memory);
+  void TrackMemory(const capture::FunctionType* type,
+                   const void* const* parameters, const void* result);
+  // Returns the id of the function in this file, writing its record if it
+  // is new.
+  uint32_t GetFunctionId(const capture::FunctionType* type);
+
+  void EncodeField(const capture::Field& field, const void* address,
+                   const void* owner, bool parameter, uint64_t in_out_count);
+  void EncodeFields(const capture::StructType* type, const uint8_t* data);
+  void EncodeString(const char* value);
+  template <typename T>
+  void Encode(const T& value) {
+    EncodeBytes(&value, sizeof(T));
+  }
+  void EncodeBytes(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    buffer_.insert(buffer_.end(), bytes, bytes + size);
+  }
+
+  template <typename T>
+  void WriteValue(const T& value) {
+    file_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  static std::atomic<Capture*> active_;
+
+  logging::Logger* logger_;
+  std::ofstream file_;
+  // Guards everything below, so that calls from many threads are recorded
+  // one at a time.
+  std::mutex mutex_;
+  containers::vector<uint8_t> buffer_;
+  containers::flat_hash_map<const capture::FunctionType*, uint32_t>
+      function_ids_;
+  containers::flat_hash_map<uint32_t, bool> unknown_structs_;
+  containers::flat_hash_map<uint64_t, VkDeviceSize> memory_sizes_;
+  containers::flat_hash_map<uint64_t, Mapping> mappings_;
+
+  const capture::FunctionType* allocate_memory_;
+  const capture::FunctionType* free_memory_;
+  const capture::FunctionType* map_memory_;
+  const capture::FunctionType* unmap_memory_;
+  const capture::FunctionType* flush_mapped_memory_ranges_;
+  const capture::FunctionType* queue_submit_;
+#endif
+};
+
+#if VULKAN_CAPTURE
+template <>
+struct Capture::Result<void> {
+  template <typename F, typename... P>
+  Result(F function, P... parameters) {
+    function(parameters...);
+  }
+  const void* address() const { return nullptr; }
+  void get() const {}
+};
+#endif
+
+}  // namespace vulkan
+
+#endif  // VULKAN_WRAPPER_CAPTURE_H_
@@ -0,0 +1,6107 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// This file is generated by tools/generate_capture_tables.py from
+// third_party/vulkan/vulkan.h. Do not edit it by hand.
+
+#include "vulkan_wrapper/capture_tables.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace vulkan {
+namespace capture {
+namespace {
+
+// VkInstanceCreateInfo::ppEnabledLayerNames
+uint64_t Count0(const void* owner) {
+  const VkInstanceCreateInfo* s =
+      static_cast<const VkInstanceCreateInfo*>(owner);
+  return s->enabledLayerCount;
+}
+
+// VkInstanceCreateInfo::ppEnabledExtensionNames
+uint64_t Count1(const void* owner) {
+  const VkInstanceCreateInfo* s =
+      static_cast<const VkInstanceCreateInfo*>(owner);
+  return s->enabledExtensionCount;
+}
+
+// VkDeviceQueueCreateInfo::pQueuePriorities
+uint64_t Count2(const void* owner) {
+  const VkDeviceQueueCreateInfo* s =
+      static_cast<const VkDeviceQueueCreateInfo*>(owner);
+  return s->queueCount;
+}
+
+// VkDeviceCreateInfo::pQueueCreateInfos
+uint64_t Count3(const void* owner) {
+  const VkDeviceCreateInfo* s = static_cast<const VkDeviceCreateInfo*>(owner);
+  return s->queueCreateInfoCount;
+}
+
+// VkDeviceCreateInfo::ppEnabledLayerNames
+uint64_t Count4(const void* owner) {
+  const VkDeviceCreateInfo* s = static_cast<const VkDeviceCreateInfo*>(owner);
+  return s->enabledLayerCount;
+}
+
+// VkDeviceCreateInfo::ppEnabledExtensionNames
+uint64_t Count5(const void* owner) {
+  const VkDeviceCreateInfo* s = static_cast<const VkDeviceCreateInfo*>(owner);
+  return s->enabledExtensionCount;
+}
+
+// VkSubmitInfo::pWaitSemaphores
+uint64_t Count6(const void* owner) {
+  const VkSubmitInfo* s = static_cast<const VkSubmitInfo*>(owner);
+  return s->waitSemaphoreCount;
+}
+
+// VkSubmitInfo::pWaitDstStageMask
+uint64_t Count7(const void* owner) {
+  const VkSubmitInfo* s = static_cast<const VkSubmitInfo*>(owner);
+  return s->waitSemaphoreCount;
+}
+
+// VkSubmitInfo::pCommandBuffers
+uint64_t Count8(const void* owner) {
+  const VkSubmitInfo* s = static_cast<const VkSubmitInfo*>(owner);
+  return s->commandBufferCount;
+}
+
+// VkSubmitInfo::pSignalSemaphores
+uint64_t Count9(const void* owner) {
+  const VkSubmitInfo* s = static_cast<const VkSubmitInfo*>(owner);
+  return s->signalSemaphoreCount;
+}
+
+// VkSparseBufferMemoryBindInfo::pBinds
+uint64_t Count10(const void* owner) {
+  const VkSparseBufferMemoryBindInfo* s =
+      static_cast<const VkSparseBufferMemoryBindInfo*>(owner);
+  return s->bindCount;
+}
+
+// VkSparseImageOpaqueMemoryBindInfo::pBinds
+uint64_t Count11(const void* owner) {
+  const VkSparseImageOpaqueMemoryBindInfo* s =
+      static_cast<const VkSparseImageOpaqueMemoryBindInfo*>(owner);
+  return s->bindCount;
+}
+
+// VkSparseImageMemoryBindInfo::pBinds
+uint64_t Count12(const void* owner) {
+  const VkSparseImageMemoryBindInfo* s =
+      static_cast<const VkSparseImageMemoryBindInfo*>(owner);
+  return s->bindCount;
+}
+
+// VkBindSparseInfo::pWaitSemaphores
+uint64_t Count13(const void* owner) {
+  const VkBindSparseInfo* s = static_cast<const VkBindSparseInfo*>(owner);
+  return s->waitSemaphoreCount;
+}
+
+// VkBindSparseInfo::pBufferBinds
+uint64_t Count14(const void* owner) {
+  const VkBindSparseInfo* s = static_cast<const VkBindSparseInfo*>(owner);
+  return s->bufferBindCount;
+}
+
+// VkBindSparseInfo::pImageOpaqueBinds
+uint64_t Count15(const void* owner) {
+  const VkBindSparseInfo* s = static_cast<const VkBindSparseInfo*>(owner);
+  return s->imageOpaqueBindCount;
+}
+
+// VkBindSparseInfo::pImageBinds
+uint64_t Count16(const void* owner) {
+  const VkBindSparseInfo* s = static_cast<const VkBindSparseInfo*>(owner);
+  return s->imageBindCount;
+}
+
+// VkBindSparseInfo::pSignalSemaphores
+uint64_t Count17(const void* owner) {
+  const VkBindSparseInfo* s = static_cast<const VkBindSparseInfo*>(owner);
+  return s->signalSemaphoreCount;
+}
+
+// VkBufferCreateInfo::pQueueFamilyIndices
+uint64_t Count18(const void* owner) {
+  const VkBufferCreateInfo* s = static_cast<const VkBufferCreateInfo*>(owner);
+  return s->queueFamilyIndexCount;
+}
+
+// VkImageCreateInfo::pQueueFamilyIndices
+uint64_t Count19(const void* owner) {
+  const VkImageCreateInfo* s = static_cast<const VkImageCreateInfo*>(owner);
+  return s->queueFamilyIndexCount;
+}
+
+// VkShaderModuleCreateInfo::pCode
+uint64_t Count20(const void* owner) {
+  const VkShaderModuleCreateInfo* s =
+      static_cast<const VkShaderModuleCreateInfo*>(owner);
+  return s->codeSize / sizeof(uint32_t);
+}
+
+// VkPipelineCacheCreateInfo::pInitialData
+uint64_t Count21(const void* owner) {
+  const VkPipelineCacheCreateInfo* s =
+      static_cast<const VkPipelineCacheCreateInfo*>(owner);
+  return s->initialDataSize;
+}
+
+// VkSpecializationInfo::pMapEntries
+uint64_t Count22(const void* owner) {
+  const VkSpecializationInfo* s =
+      static_cast<const VkSpecializationInfo*>(owner);
+  return s->mapEntryCount;
+}
+
+// VkSpecializationInfo::pData
+uint64_t Count23(const void* owner) {
+  const VkSpecializationInfo* s =
+      static_cast<const VkSpecializationInfo*>(owner);
+  return s->dataSize;
+}
+
+// VkPipelineVertexInputStateCreateInfo::pVertexBindingDescriptions
+uint64_t Count24(const void* owner) {
+  const VkPipelineVertexInputStateCreateInfo* s =
+      static_cast<const VkPipelineVertexInputStateCreateInfo*>(owner);
+  return s->vertexBindingDescriptionCount;
+}
+
+// VkPipelineVertexInputStateCreateInfo::pVertexAttributeDescriptions
+uint64_t Count25(const void* owner) {
+  const VkPipelineVertexInputStateCreateInfo* s =
+      static_cast<const VkPipelineVertexInputStateCreateInfo*>(owner);
+  return s->vertexAttributeDescriptionCount;
+}
+
+// VkPipelineViewportStateCreateInfo::pViewports
+uint64_t Count26(const void* owner) {
+  const VkPipelineViewportStateCreateInfo* s =
+      static_cast<const VkPipelineViewportStateCreateInfo*>(owner);
+  return s->viewportCount;
+}
+
+// VkPipelineViewportStateCreateInfo::pScissors
+uint64_t Count27(const void* owner) {
+  const VkPipelineViewportStateCreateInfo* s =
+      static_cast<const VkPipelineViewportStateCreateInfo*>(owner);
+  return s->scissorCount;
+}
+
+// VkPipelineMultisampleStateCreateInfo::pSampleMask
+uint64_t Count28(const void* owner) {
+  const VkPipelineMultisampleStateCreateInfo* s =
+      static_cast<const VkPipelineMultisampleStateCreateInfo*>(owner);
+  return (s->rasterizationSamples + 31) / 32;
+}
+
+// VkPipelineColorBlendStateCreateInfo::pAttachments
+uint64_t Count29(const void* owner) {
+  const VkPipelineColorBlendStateCreateInfo* s =
+      static_cast<const VkPipelineColorBlendStateCreateInfo*>(owner);
+  return s->attachmentCount;
+}
+
+// VkPipelineDynamicStateCreateInfo::pDynamicStates
+uint64_t Count30(const void* owner) {
+  const VkPipelineDynamicStateCreateInfo* s =
+      static_cast<const VkPipelineDynamicStateCreateInfo*>(owner);
+  return s->dynamicStateCount;
+}
+
+// VkGraphicsPipelineCreateInfo::pStages
+uint64_t Count31(const void* owner) {
+  const VkGraphicsPipelineCreateInfo* s =
+      static_cast<const VkGraphicsPipelineCreateInfo*>(owner);
+  return s->stageCount;
+}
+
+// VkPipelineLayoutCreateInfo::pSetLayouts
+uint64_t Count32(const void* owner) {
+  const VkPipelineLayoutCreateInfo* s =
+      static_cast<const VkPipelineLayoutCreateInfo*>(owner);
+  return s->setLayoutCount;
+}
+
+// VkPipelineLayoutCreateInfo::pPushConstantRanges
+uint64_t Count33(const void* owner) {
+  const VkPipelineLayoutCreateInfo* s =
+      static_cast<const VkPipelineLayoutCreateInfo*>(owner);
+  return s->pushConstantRangeCount;
+}
+
+// VkDescriptorSetLayoutBinding::pImmutableSamplers
+uint64_t Count34(const void* owner) {
+  const VkDescriptorSetLayoutBinding* s =
+      static_cast<const VkDescriptorSetLayoutBinding*>(owner);
+  switch (s->descriptorType) {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+      return s->descriptorCount;
+    default:
+      return 0;
+  }
+}
+
+// VkDescriptorSetLayoutCreateInfo::pBindings
+uint64_t Count35(const void* owner) {
+  const VkDescriptorSetLayoutCreateInfo* s =
+      static_cast<const VkDescriptorSetLayoutCreateInfo*>(owner);
+  return s->bindingCount;
+}
+
+// VkDescriptorPoolCreateInfo::pPoolSizes
+uint64_t Count36(const void* owner) {
+  const VkDescriptorPoolCreateInfo* s =
+      static_cast<const VkDescriptorPoolCreateInfo*>(owner);
+  return s->poolSizeCount;
+}
+
+// VkDescriptorSetAllocateInfo::pSetLayouts
+uint64_t Count37(const void* owner) {
+  const VkDescriptorSetAllocateInfo* s =
+      static_cast<const VkDescriptorSetAllocateInfo*>(owner);
+  return s->descriptorSetCount;
+}
+
+// VkWriteDescriptorSet::pImageInfo
+uint64_t Count38(const void* owner) {
+  const VkWriteDescriptorSet* s =
+      static_cast<const VkWriteDescriptorSet*>(owner);
+  switch (s->descriptorType) {
+    case VK_DESCRIPTOR_TYPE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+      return s->descriptorCount;
+    default:
+      return 0;
+  }
+}
+
+// VkWriteDescriptorSet::pBufferInfo
+uint64_t Count39(const void* owner) {
+  const VkWriteDescriptorSet* s =
+      static_cast<const VkWriteDescriptorSet*>(owner);
+  switch (s->descriptorType) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+      return s->descriptorCount;
+    default:
+      return 0;
+  }
+}
+
+// VkWriteDescriptorSet::pTexelBufferView
+uint64_t Count40(const void* owner) {
+  const VkWriteDescriptorSet* s =
+      static_cast<const VkWriteDescriptorSet*>(owner);
+  switch (s->descriptorType) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+      return s->descriptorCount;
+    default:
+      return 0;
+  }
+}
+
+// VkFramebufferCreateInfo::pAttachments
+uint64_t Count41(const void* owner) {
+  const VkFramebufferCreateInfo* s =
+      static_cast<const VkFramebufferCreateInfo*>(owner);
+  return s->attachmentCount;
+}
+
+// VkSubpassDescription::pInputAttachments
+uint64_t Count42(const void* owner) {
+  const VkSubpassDescription* s =
+      static_cast<const VkSubpassDescription*>(owner);
+  return s->inputAttachmentCount;
+}
+
+// VkSubpassDescription::pColorAttachments
+uint64_t Count43(const void* owner) {
+  const VkSubpassDescription* s =
+      static_cast<const VkSubpassDescription*>(owner);
+  return s->colorAttachmentCount;
+}
+
+// VkSubpassDescription::pResolveAttachments
+uint64_t Count44(const void* owner) {
+  const VkSubpassDescription* s =
+      static_cast<const VkSubpassDescription*>(owner);
+  return s->colorAttachmentCount;
+}
+
+// VkSubpassDescription::pPreserveAttachments
+uint64_t Count45(const void* owner) {
+  const VkSubpassDescription* s =
+      static_cast<const VkSubpassDescription*>(owner);
+  return s->preserveAttachmentCount;
+}
+
+// VkRenderPassCreateInfo::pAttachments
+uint64_t Count46(const void* owner) {
+  const VkRenderPassCreateInfo* s =
+      static_cast<const VkRenderPassCreateInfo*>(owner);
+  return s->attachmentCount;
+}
+
+// VkRenderPassCreateInfo::pSubpasses
+uint64_t Count47(const void* owner) {
+  const VkRenderPassCreateInfo* s =
+      static_cast<const VkRenderPassCreateInfo*>(owner);
+  return s->subpassCount;
+}
+
+// VkRenderPassCreateInfo::pDependencies
+uint64_t Count48(const void* owner) {
+  const VkRenderPassCreateInfo* s =
+      static_cast<const VkRenderPassCreateInfo*>(owner);
+  return s->dependencyCount;
+}
+
+// VkRenderPassBeginInfo::pClearValues
+uint64_t Count49(const void* owner) {
+  const VkRenderPassBeginInfo* s =
+      static_cast<const VkRenderPassBeginInfo*>(owner);
+  return s->clearValueCount;
+}
+
+// VkSwapchainCreateInfoKHR::pQueueFamilyIndices
+uint64_t Count50(const void* owner) {
+  const VkSwapchainCreateInfoKHR* s =
+      static_cast<const VkSwapchainCreateInfoKHR*>(owner);
+  return s->queueFamilyIndexCount;
+}
+
+// VkPresentInfoKHR::pWaitSemaphores
+uint64_t Count51(const void* owner) {
+  const VkPresentInfoKHR* s = static_cast<const VkPresentInfoKHR*>(owner);
+  return s->waitSemaphoreCount;
+}
+
+// VkPresentInfoKHR::pSwapchains
+uint64_t Count52(const void* owner) {
+  const VkPresentInfoKHR* s = static_cast<const VkPresentInfoKHR*>(owner);
+  return s->swapchainCount;
+}
+
+// VkPresentInfoKHR::pImageIndices
+uint64_t Count53(const void* owner) {
+  const VkPresentInfoKHR* s = static_cast<const VkPresentInfoKHR*>(owner);
+  return s->swapchainCount;
+}
+
+// VkPresentInfoKHR::pResults
+uint64_t Count54(const void* owner) {
+  const VkPresentInfoKHR* s = static_cast<const VkPresentInfoKHR*>(owner);
+  return s->swapchainCount;
+}
+
+// VkPresentRegionKHR::pRectangles
+uint64_t Count55(const void* owner) {
+  const VkPresentRegionKHR* s = static_cast<const VkPresentRegionKHR*>(owner);
+  return s->rectangleCount;
+}
+
+// VkPresentRegionsKHR::pRegions
+uint64_t Count56(const void* owner) {
+  const VkPresentRegionsKHR* s = static_cast<const VkPresentRegionsKHR*>(owner);
+  return s->swapchainCount;
+}
+
+// VkDescriptorUpdateTemplateCreateInfoKHR::pDescriptorUpdateEntries
+uint64_t Count57(const void* owner) {
+  const VkDescriptorUpdateTemplateCreateInfoKHR* s =
+      static_cast<const VkDescriptorUpdateTemplateCreateInfoKHR*>(owner);
+  return s->descriptorUpdateEntryCount;
+}
+
+// VkDebugMarkerObjectTagInfoEXT::pTag
+uint64_t Count58(const void* owner) {
+  const VkDebugMarkerObjectTagInfoEXT* s =
+      static_cast<const VkDebugMarkerObjectTagInfoEXT*>(owner);
+  return s->tagSize;
+}
+
+// VkRenderPassMultiviewCreateInfoKHX::pViewMasks
+uint64_t Count59(const void* owner) {
+  const VkRenderPassMultiviewCreateInfoKHX* s =
+      static_cast<const VkRenderPassMultiviewCreateInfoKHX*>(owner);
+  return s->subpassCount;
+}
+
+// VkRenderPassMultiviewCreateInfoKHX::pViewOffsets
+uint64_t Count60(const void* owner) {
+  const VkRenderPassMultiviewCreateInfoKHX* s =
+      static_cast<const VkRenderPassMultiviewCreateInfoKHX*>(owner);
+  return s->dependencyCount;
+}
+
+// VkRenderPassMultiviewCreateInfoKHX::pCorrelationMasks
+uint64_t Count61(const void* owner) {
+  const VkRenderPassMultiviewCreateInfoKHX* s =
+      static_cast<const VkRenderPassMultiviewCreateInfoKHX*>(owner);
+  return s->correlationMaskCount;
+}
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoNV::pAcquireSyncs
+uint64_t Count62(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoNV* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV*>(owner);
+  return s->acquireCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoNV::pAcquireKeys
+uint64_t Count63(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoNV* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV*>(owner);
+  return s->acquireCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoNV::pAcquireTimeoutMilliseconds
+uint64_t Count64(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoNV* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV*>(owner);
+  return s->acquireCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoNV::pReleaseSyncs
+uint64_t Count65(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoNV* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV*>(owner);
+  return s->releaseCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoNV::pReleaseKeys
+uint64_t Count66(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoNV* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV*>(owner);
+  return s->releaseCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+// VkBindBufferMemoryInfoKHX::pDeviceIndices
+uint64_t Count67(const void* owner) {
+  const VkBindBufferMemoryInfoKHX* s =
+      static_cast<const VkBindBufferMemoryInfoKHX*>(owner);
+  return s->deviceIndexCount;
+}
+
+// VkBindImageMemoryInfoKHX::pDeviceIndices
+uint64_t Count68(const void* owner) {
+  const VkBindImageMemoryInfoKHX* s =
+      static_cast<const VkBindImageMemoryInfoKHX*>(owner);
+  return s->deviceIndexCount;
+}
+
+// VkBindImageMemoryInfoKHX::pSFRRects
+uint64_t Count69(const void* owner) {
+  const VkBindImageMemoryInfoKHX* s =
+      static_cast<const VkBindImageMemoryInfoKHX*>(owner);
+  return s->SFRRectCount;
+}
+
+// VkDeviceGroupRenderPassBeginInfoKHX::pDeviceRenderAreas
+uint64_t Count70(const void* owner) {
+  const VkDeviceGroupRenderPassBeginInfoKHX* s =
+      static_cast<const VkDeviceGroupRenderPassBeginInfoKHX*>(owner);
+  return s->deviceRenderAreaCount;
+}
+
+// VkDeviceGroupSubmitInfoKHX::pWaitSemaphoreDeviceIndices
+uint64_t Count71(const void* owner) {
+  const VkDeviceGroupSubmitInfoKHX* s =
+      static_cast<const VkDeviceGroupSubmitInfoKHX*>(owner);
+  return s->waitSemaphoreCount;
+}
+
+// VkDeviceGroupSubmitInfoKHX::pCommandBufferDeviceMasks
+uint64_t Count72(const void* owner) {
+  const VkDeviceGroupSubmitInfoKHX* s =
+      static_cast<const VkDeviceGroupSubmitInfoKHX*>(owner);
+  return s->commandBufferCount;
+}
+
+// VkDeviceGroupSubmitInfoKHX::pSignalSemaphoreDeviceIndices
+uint64_t Count73(const void* owner) {
+  const VkDeviceGroupSubmitInfoKHX* s =
+      static_cast<const VkDeviceGroupSubmitInfoKHX*>(owner);
+  return s->signalSemaphoreCount;
+}
+
+// VkDeviceGroupPresentInfoKHX::pDeviceMasks
+uint64_t Count74(const void* owner) {
+  const VkDeviceGroupPresentInfoKHX* s =
+      static_cast<const VkDeviceGroupPresentInfoKHX*>(owner);
+  return s->swapchainCount;
+}
+
+// VkValidationFlagsEXT::pDisabledValidationChecks
+uint64_t Count75(const void* owner) {
+  const VkValidationFlagsEXT* s =
+      static_cast<const VkValidationFlagsEXT*>(owner);
+  return s->disabledValidationCheckCount;
+}
+
+// VkDeviceGroupDeviceCreateInfoKHX::pPhysicalDevices
+uint64_t Count76(const void* owner) {
+  const VkDeviceGroupDeviceCreateInfoKHX* s =
+      static_cast<const VkDeviceGroupDeviceCreateInfoKHX*>(owner);
+  return s->physicalDeviceCount;
+}
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoKHX::pAcquireSyncs
+uint64_t Count77(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoKHX* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHX*>(owner);
+  return s->acquireCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoKHX::pAcquireKeys
+uint64_t Count78(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoKHX* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHX*>(owner);
+  return s->acquireCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoKHX::pAcquireTimeouts
+uint64_t Count79(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoKHX* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHX*>(owner);
+  return s->acquireCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoKHX::pReleaseSyncs
+uint64_t Count80(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoKHX* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHX*>(owner);
+  return s->releaseCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+// VkWin32KeyedMutexAcquireReleaseInfoKHX::pReleaseKeys
+uint64_t Count81(const void* owner) {
+  const VkWin32KeyedMutexAcquireReleaseInfoKHX* s =
+      static_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHX*>(owner);
+  return s->releaseCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+// VkD3D12FenceSubmitInfoKHX::pWaitSemaphoreValues
+uint64_t Count82(const void* owner) {
+  const VkD3D12FenceSubmitInfoKHX* s =
+      static_cast<const VkD3D12FenceSubmitInfoKHX*>(owner);
+  return s->waitSemaphoreValuesCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+// VkD3D12FenceSubmitInfoKHX::pSignalSemaphoreValues
+uint64_t Count83(const void* owner) {
+  const VkD3D12FenceSubmitInfoKHX* s =
+      static_cast<const VkD3D12FenceSubmitInfoKHX*>(owner);
+  return s->signalSemaphoreValuesCount;
+}
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+// VkIndirectCommandsLayoutCreateInfoNVX::pTokens
+uint64_t Count84(const void* owner) {
+  const VkIndirectCommandsLayoutCreateInfoNVX* s =
+      static_cast<const VkIndirectCommandsLayoutCreateInfoNVX*>(owner);
+  return s->tokenCount;
+}
+
+// VkCmdProcessCommandsInfoNVX::pIndirectCommandsTokens
+uint64_t Count85(const void* owner) {
+  const VkCmdProcessCommandsInfoNVX* s =
+      static_cast<const VkCmdProcessCommandsInfoNVX*>(owner);
+  return s->indirectCommandsTokenCount;
+}
+
+// VkObjectTableCreateInfoNVX::pObjectEntryTypes
+uint64_t Count86(const void* owner) {
+  const VkObjectTableCreateInfoNVX* s =
+      static_cast<const VkObjectTableCreateInfoNVX*>(owner);
+  return s->objectCount;
+}
+
+// VkObjectTableCreateInfoNVX::pObjectEntryCounts
+uint64_t Count87(const void* owner) {
+  const VkObjectTableCreateInfoNVX* s =
+      static_cast<const VkObjectTableCreateInfoNVX*>(owner);
+  return s->objectCount;
+}
+
+// VkObjectTableCreateInfoNVX::pObjectEntryUsageFlags
+uint64_t Count88(const void* owner) {
+  const VkObjectTableCreateInfoNVX* s =
+      static_cast<const VkObjectTableCreateInfoNVX*>(owner);
+  return s->objectCount;
+}
+
+// VkPipelineViewportWScalingStateCreateInfoNV::pViewportWScalings
+uint64_t Count89(const void* owner) {
+  const VkPipelineViewportWScalingStateCreateInfoNV* s =
+      static_cast<const VkPipelineViewportWScalingStateCreateInfoNV*>(owner);
+  return s->viewportCount;
+}
+
+// VkPresentTimesInfoGOOGLE::pTimes
+uint64_t Count90(const void* owner) {
+  const VkPresentTimesInfoGOOGLE* s =
+      static_cast<const VkPresentTimesInfoGOOGLE*>(owner);
+  return s->swapchainCount;
+}
+
+// VkPipelineViewportSwizzleStateCreateInfoNV::pViewportSwizzles
+uint64_t Count91(const void* owner) {
+  const VkPipelineViewportSwizzleStateCreateInfoNV* s =
+      static_cast<const VkPipelineViewportSwizzleStateCreateInfoNV*>(owner);
+  return s->viewportCount;
+}
+
+// VkPipelineDiscardRectangleStateCreateInfoEXT::pDiscardRectangles
+uint64_t Count92(const void* owner) {
+  const VkPipelineDiscardRectangleStateCreateInfoEXT* s =
+      static_cast<const VkPipelineDiscardRectangleStateCreateInfoEXT*>(owner);
+  return s->discardRectangleCount;
+}
+
+// vkEnumeratePhysicalDevices::pPhysicalDevices
+uint64_t Count93(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPhysicalDeviceCount = Parameter<uint32_t*>(parameters, 1);
+  return *pPhysicalDeviceCount;
+}
+
+// vkGetPhysicalDeviceQueueFamilyProperties::pQueueFamilyProperties
+uint64_t Count94(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pQueueFamilyPropertyCount = Parameter<uint32_t*>(parameters, 1);
+  return *pQueueFamilyPropertyCount;
+}
+
+// vkEnumerateInstanceExtensionProperties::pProperties
+uint64_t Count95(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 1);
+  return *pPropertyCount;
+}
+
+// vkEnumerateDeviceExtensionProperties::pProperties
+uint64_t Count96(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 2);
+  return *pPropertyCount;
+}
+
+// vkEnumerateInstanceLayerProperties::pProperties
+uint64_t Count97(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 0);
+  return *pPropertyCount;
+}
+
+// vkEnumerateDeviceLayerProperties::pProperties
+uint64_t Count98(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 1);
+  return *pPropertyCount;
+}
+
+// vkQueueSubmit::pSubmits
+uint64_t Count99(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t submitCount = Parameter<uint32_t>(parameters, 1);
+  return submitCount;
+}
+
+// vkFlushMappedMemoryRanges::pMemoryRanges
+uint64_t Count100(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t memoryRangeCount = Parameter<uint32_t>(parameters, 1);
+  return memoryRangeCount;
+}
+
+// vkInvalidateMappedMemoryRanges::pMemoryRanges
+uint64_t Count101(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t memoryRangeCount = Parameter<uint32_t>(parameters, 1);
+  return memoryRangeCount;
+}
+
+// vkGetImageSparseMemoryRequirements::pSparseMemoryRequirements
+uint64_t Count102(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pSparseMemoryRequirementCount = Parameter<uint32_t*>(parameters, 2);
+  return *pSparseMemoryRequirementCount;
+}
+
+// vkGetPhysicalDeviceSparseImageFormatProperties::pProperties
+uint64_t Count103(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 6);
+  return *pPropertyCount;
+}
+
+// vkQueueBindSparse::pBindInfo
+uint64_t Count104(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t bindInfoCount = Parameter<uint32_t>(parameters, 1);
+  return bindInfoCount;
+}
+
+// vkResetFences::pFences
+uint64_t Count105(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t fenceCount = Parameter<uint32_t>(parameters, 1);
+  return fenceCount;
+}
+
+// vkWaitForFences::pFences
+uint64_t Count106(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t fenceCount = Parameter<uint32_t>(parameters, 1);
+  return fenceCount;
+}
+
+// vkGetQueryPoolResults::pData
+uint64_t Count107(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  size_t dataSize = Parameter<size_t>(parameters, 4);
+  return dataSize;
+}
+
+// vkGetPipelineCacheData::pData
+uint64_t Count108(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  size_t* pDataSize = Parameter<size_t*>(parameters, 2);
+  return *pDataSize;
+}
+
+// vkMergePipelineCaches::pSrcCaches
+uint64_t Count109(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t srcCacheCount = Parameter<uint32_t>(parameters, 2);
+  return srcCacheCount;
+}
+
+// vkCreateGraphicsPipelines::pCreateInfos
+uint64_t Count110(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t createInfoCount = Parameter<uint32_t>(parameters, 2);
+  return createInfoCount;
+}
+
+// vkCreateGraphicsPipelines::pPipelines
+uint64_t Count111(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t createInfoCount = Parameter<uint32_t>(parameters, 2);
+  return createInfoCount;
+}
+
+// vkCreateComputePipelines::pCreateInfos
+uint64_t Count112(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t createInfoCount = Parameter<uint32_t>(parameters, 2);
+  return createInfoCount;
+}
+
+// vkCreateComputePipelines::pPipelines
+uint64_t Count113(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t createInfoCount = Parameter<uint32_t>(parameters, 2);
+  return createInfoCount;
+}
+
+// vkAllocateDescriptorSets::pDescriptorSets
+uint64_t Count114(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  const VkDescriptorSetAllocateInfo* pAllocateInfo =
+      Parameter<const VkDescriptorSetAllocateInfo*>(parameters, 1);
+  return pAllocateInfo->descriptorSetCount;
+}
+
+// vkFreeDescriptorSets::pDescriptorSets
+uint64_t Count115(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t descriptorSetCount = Parameter<uint32_t>(parameters, 2);
+  return descriptorSetCount;
+}
+
+// vkUpdateDescriptorSets::pDescriptorWrites
+uint64_t Count116(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t descriptorWriteCount = Parameter<uint32_t>(parameters, 1);
+  return descriptorWriteCount;
+}
+
+// vkUpdateDescriptorSets::pDescriptorCopies
+uint64_t Count117(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t descriptorCopyCount = Parameter<uint32_t>(parameters, 3);
+  return descriptorCopyCount;
+}
+
+// vkAllocateCommandBuffers::pCommandBuffers
+uint64_t Count118(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  const VkCommandBufferAllocateInfo* pAllocateInfo =
+      Parameter<const VkCommandBufferAllocateInfo*>(parameters, 1);
+  return pAllocateInfo->commandBufferCount;
+}
+
+// vkFreeCommandBuffers::pCommandBuffers
+uint64_t Count119(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t commandBufferCount = Parameter<uint32_t>(parameters, 2);
+  return commandBufferCount;
+}
+
+// vkCmdSetViewport::pViewports
+uint64_t Count120(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t viewportCount = Parameter<uint32_t>(parameters, 2);
+  return viewportCount;
+}
+
+// vkCmdSetScissor::pScissors
+uint64_t Count121(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t scissorCount = Parameter<uint32_t>(parameters, 2);
+  return scissorCount;
+}
+
+// vkCmdSetBlendConstants::blendConstants
+uint64_t Count122(const void*) {
+  return 4;
+}
+
+// vkCmdBindDescriptorSets::pDescriptorSets
+uint64_t Count123(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t descriptorSetCount = Parameter<uint32_t>(parameters, 4);
+  return descriptorSetCount;
+}
+
+// vkCmdBindDescriptorSets::pDynamicOffsets
+uint64_t Count124(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t dynamicOffsetCount = Parameter<uint32_t>(parameters, 6);
+  return dynamicOffsetCount;
+}
+
+// vkCmdBindVertexBuffers::pBuffers
+uint64_t Count125(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t bindingCount = Parameter<uint32_t>(parameters, 2);
+  return bindingCount;
+}
+
+// vkCmdBindVertexBuffers::pOffsets
+uint64_t Count126(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t bindingCount = Parameter<uint32_t>(parameters, 2);
+  return bindingCount;
+}
+
+// vkCmdCopyBuffer::pRegions
+uint64_t Count127(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t regionCount = Parameter<uint32_t>(parameters, 3);
+  return regionCount;
+}
+
+// vkCmdCopyImage::pRegions
+uint64_t Count128(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t regionCount = Parameter<uint32_t>(parameters, 5);
+  return regionCount;
+}
+
+// vkCmdBlitImage::pRegions
+uint64_t Count129(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t regionCount = Parameter<uint32_t>(parameters, 5);
+  return regionCount;
+}
+
+// vkCmdCopyBufferToImage::pRegions
+uint64_t Count130(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t regionCount = Parameter<uint32_t>(parameters, 4);
+  return regionCount;
+}
+
+// vkCmdCopyImageToBuffer::pRegions
+uint64_t Count131(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t regionCount = Parameter<uint32_t>(parameters, 4);
+  return regionCount;
+}
+
+// vkCmdUpdateBuffer::pData
+uint64_t Count132(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  VkDeviceSize dataSize = Parameter<VkDeviceSize>(parameters, 3);
+  return dataSize;
+}
+
+// vkCmdClearColorImage::pRanges
+uint64_t Count133(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t rangeCount = Parameter<uint32_t>(parameters, 4);
+  return rangeCount;
+}
+
+// vkCmdClearDepthStencilImage::pRanges
+uint64_t Count134(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t rangeCount = Parameter<uint32_t>(parameters, 4);
+  return rangeCount;
+}
+
+// vkCmdClearAttachments::pAttachments
+uint64_t Count135(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t attachmentCount = Parameter<uint32_t>(parameters, 1);
+  return attachmentCount;
+}
+
+// vkCmdClearAttachments::pRects
+uint64_t Count136(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t rectCount = Parameter<uint32_t>(parameters, 3);
+  return rectCount;
+}
+
+// vkCmdResolveImage::pRegions
+uint64_t Count137(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t regionCount = Parameter<uint32_t>(parameters, 5);
+  return regionCount;
+}
+
+// vkCmdWaitEvents::pEvents
+uint64_t Count138(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t eventCount = Parameter<uint32_t>(parameters, 1);
+  return eventCount;
+}
+
+// vkCmdWaitEvents::pMemoryBarriers
+uint64_t Count139(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t memoryBarrierCount = Parameter<uint32_t>(parameters, 5);
+  return memoryBarrierCount;
+}
+
+// vkCmdWaitEvents::pBufferMemoryBarriers
+uint64_t Count140(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t bufferMemoryBarrierCount = Parameter<uint32_t>(parameters, 7);
+  return bufferMemoryBarrierCount;
+}
+
+// vkCmdWaitEvents::pImageMemoryBarriers
+uint64_t Count141(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t imageMemoryBarrierCount = Parameter<uint32_t>(parameters, 9);
+  return imageMemoryBarrierCount;
+}
+
+// vkCmdPipelineBarrier::pMemoryBarriers
+uint64_t Count142(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t memoryBarrierCount = Parameter<uint32_t>(parameters, 4);
+  return memoryBarrierCount;
+}
+
+// vkCmdPipelineBarrier::pBufferMemoryBarriers
+uint64_t Count143(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t bufferMemoryBarrierCount = Parameter<uint32_t>(parameters, 6);
+  return bufferMemoryBarrierCount;
+}
+
+// vkCmdPipelineBarrier::pImageMemoryBarriers
+uint64_t Count144(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t imageMemoryBarrierCount = Parameter<uint32_t>(parameters, 8);
+  return imageMemoryBarrierCount;
+}
+
+// vkCmdPushConstants::pValues
+uint64_t Count145(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t size = Parameter<uint32_t>(parameters, 4);
+  return size;
+}
+
+// vkCmdExecuteCommands::pCommandBuffers
+uint64_t Count146(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t commandBufferCount = Parameter<uint32_t>(parameters, 1);
+  return commandBufferCount;
+}
+
+// vkGetPhysicalDeviceSurfaceFormatsKHR::pSurfaceFormats
+uint64_t Count147(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pSurfaceFormatCount = Parameter<uint32_t*>(parameters, 2);
+  return *pSurfaceFormatCount;
+}
+
+// vkGetPhysicalDeviceSurfacePresentModesKHR::pPresentModes
+uint64_t Count148(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPresentModeCount = Parameter<uint32_t*>(parameters, 2);
+  return *pPresentModeCount;
+}
+
+// vkGetSwapchainImagesKHR::pSwapchainImages
+uint64_t Count149(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pSwapchainImageCount = Parameter<uint32_t*>(parameters, 2);
+  return *pSwapchainImageCount;
+}
+
+// vkGetPhysicalDeviceDisplayPropertiesKHR::pProperties
+uint64_t Count150(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 1);
+  return *pPropertyCount;
+}
+
+// vkGetPhysicalDeviceDisplayPlanePropertiesKHR::pProperties
+uint64_t Count151(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 1);
+  return *pPropertyCount;
+}
+
+// vkGetDisplayPlaneSupportedDisplaysKHR::pDisplays
+uint64_t Count152(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pDisplayCount = Parameter<uint32_t*>(parameters, 2);
+  return *pDisplayCount;
+}
+
+// vkGetDisplayModePropertiesKHR::pProperties
+uint64_t Count153(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 2);
+  return *pPropertyCount;
+}
+
+// vkCreateSharedSwapchainsKHR::pCreateInfos
+uint64_t Count154(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t swapchainCount = Parameter<uint32_t>(parameters, 1);
+  return swapchainCount;
+}
+
+// vkCreateSharedSwapchainsKHR::pSwapchains
+uint64_t Count155(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t swapchainCount = Parameter<uint32_t>(parameters, 1);
+  return swapchainCount;
+}
+
+// vkGetPhysicalDeviceQueueFamilyProperties2KHR::pQueueFamilyProperties
+uint64_t Count156(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pQueueFamilyPropertyCount = Parameter<uint32_t*>(parameters, 1);
+  return *pQueueFamilyPropertyCount;
+}
+
+// vkGetPhysicalDeviceSparseImageFormatProperties2KHR::pProperties
+uint64_t Count157(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPropertyCount = Parameter<uint32_t*>(parameters, 2);
+  return *pPropertyCount;
+}
+
+// vkCmdPushDescriptorSetKHR::pDescriptorWrites
+uint64_t Count158(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t descriptorWriteCount = Parameter<uint32_t>(parameters, 4);
+  return descriptorWriteCount;
+}
+
+// vkBindBufferMemory2KHX::pBindInfos
+uint64_t Count159(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t bindInfoCount = Parameter<uint32_t>(parameters, 1);
+  return bindInfoCount;
+}
+
+// vkBindImageMemory2KHX::pBindInfos
+uint64_t Count160(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t bindInfoCount = Parameter<uint32_t>(parameters, 1);
+  return bindInfoCount;
+}
+
+// vkGetPhysicalDevicePresentRectanglesKHX::pRects
+uint64_t Count161(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pRectCount = Parameter<uint32_t*>(parameters, 2);
+  return *pRectCount;
+}
+
+// vkEnumeratePhysicalDeviceGroupsKHX::pPhysicalDeviceGroupProperties
+uint64_t Count162(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPhysicalDeviceGroupCount = Parameter<uint32_t*>(parameters, 1);
+  return *pPhysicalDeviceGroupCount;
+}
+
+// vkUnregisterObjectsNVX::pObjectEntryTypes
+uint64_t Count163(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t objectCount = Parameter<uint32_t>(parameters, 2);
+  return objectCount;
+}
+
+// vkUnregisterObjectsNVX::pObjectIndices
+uint64_t Count164(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t objectCount = Parameter<uint32_t>(parameters, 2);
+  return objectCount;
+}
+
+// vkCmdSetViewportWScalingNV::pViewportWScalings
+uint64_t Count165(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t viewportCount = Parameter<uint32_t>(parameters, 2);
+  return viewportCount;
+}
+
+// vkGetPastPresentationTimingGOOGLE::pPresentationTimings
+uint64_t Count166(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t* pPresentationTimingCount = Parameter<uint32_t*>(parameters, 2);
+  return *pPresentationTimingCount;
+}
+
+// vkCmdSetDiscardRectangleEXT::pDiscardRectangles
+uint64_t Count167(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t discardRectangleCount = Parameter<uint32_t>(parameters, 2);
+  return discardRectangleCount;
+}
+
+// vkSetHdrMetadataEXT::pSwapchains
+uint64_t Count168(const void* owner) {
+  const void* const* parameters = static_cast<const void* const*>(owner);
+  uint32_t swapchainCount = Parameter<uint32_t>(parameters, 1);
+  return swapchainCount;
+}
+
+const Field kVkApplicationInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkApplicationInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pApplicationName", kStringField,
+     offsetof(VkApplicationInfo, pApplicationName), 1, nullptr, 0, nullptr},
+    {"pEngineName", kStringField, offsetof(VkApplicationInfo, pEngineName), 1,
+     nullptr, 0, nullptr},
+};
+const StructType kVkApplicationInfoType = {
+    "VkApplicationInfo", sizeof(VkApplicationInfo), true,
+    VK_STRUCTURE_TYPE_APPLICATION_INFO, kVkApplicationInfoFields, 3};
+
+const Field kVkInstanceCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkInstanceCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pApplicationInfo", kPointerField,
+     offsetof(VkInstanceCreateInfo, pApplicationInfo),
+     sizeof(VkApplicationInfo), &kVkApplicationInfoType, 0, nullptr},
+    {"ppEnabledLayerNames", kStringArrayField,
+     offsetof(VkInstanceCreateInfo, ppEnabledLayerNames), sizeof(char*),
+     nullptr, 0, &Count0},
+    {"ppEnabledExtensionNames", kStringArrayField,
+     offsetof(VkInstanceCreateInfo, ppEnabledExtensionNames), sizeof(char*),
+     nullptr, 0, &Count1},
+};
+const StructType kVkInstanceCreateInfoType = {
+    "VkInstanceCreateInfo", sizeof(VkInstanceCreateInfo), true,
+    VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, kVkInstanceCreateInfoFields, 4};
+
+const Field kVkDeviceQueueCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceQueueCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pQueuePriorities", kPointerField,
+     offsetof(VkDeviceQueueCreateInfo, pQueuePriorities), sizeof(float),
+     nullptr, 0, &Count2},
+};
+const StructType kVkDeviceQueueCreateInfoType = {
+    "VkDeviceQueueCreateInfo", sizeof(VkDeviceQueueCreateInfo), true,
+    VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO, kVkDeviceQueueCreateInfoFields,
+    2};
+
+const Field kVkDeviceCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pQueueCreateInfos", kPointerField,
+     offsetof(VkDeviceCreateInfo, pQueueCreateInfos),
+     sizeof(VkDeviceQueueCreateInfo), &kVkDeviceQueueCreateInfoType, 0,
+     &Count3},
+    {"ppEnabledLayerNames", kStringArrayField,
+     offsetof(VkDeviceCreateInfo, ppEnabledLayerNames), sizeof(char*), nullptr,
+     0, &Count4},
+    {"ppEnabledExtensionNames", kStringArrayField,
+     offsetof(VkDeviceCreateInfo, ppEnabledExtensionNames), sizeof(char*),
+     nullptr, 0, &Count5},
+    {"pEnabledFeatures", kPointerField,
+     offsetof(VkDeviceCreateInfo, pEnabledFeatures),
+     sizeof(VkPhysicalDeviceFeatures), nullptr, 0, nullptr},
+};
+const StructType kVkDeviceCreateInfoType = {
+    "VkDeviceCreateInfo", sizeof(VkDeviceCreateInfo), true,
+    VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, kVkDeviceCreateInfoFields, 5};
+
+const Field kVkSubmitInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkSubmitInfo, pNext), sizeof(void*), nullptr,
+     0, nullptr},
+    {"pWaitSemaphores", kHandlePointerField,
+     offsetof(VkSubmitInfo, pWaitSemaphores), sizeof(VkSemaphore), nullptr, 4,
+     &Count6},
+    {"pWaitDstStageMask", kPointerField,
+     offsetof(VkSubmitInfo, pWaitDstStageMask), sizeof(VkPipelineStageFlags),
+     nullptr, 0, &Count7},
+    {"pCommandBuffers", kHandlePointerField,
+     offsetof(VkSubmitInfo, pCommandBuffers), sizeof(VkCommandBuffer), nullptr,
+     5, &Count8},
+    {"pSignalSemaphores", kHandlePointerField,
+     offsetof(VkSubmitInfo, pSignalSemaphores), sizeof(VkSemaphore), nullptr, 4,
+     &Count9},
+};
+const StructType kVkSubmitInfoType = {
+    "VkSubmitInfo", sizeof(VkSubmitInfo), true, VK_STRUCTURE_TYPE_SUBMIT_INFO,
+    kVkSubmitInfoFields, 5};
+
+const Field kVkMemoryAllocateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkMemoryAllocateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkMemoryAllocateInfoType = {
+    "VkMemoryAllocateInfo", sizeof(VkMemoryAllocateInfo), true,
+    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, kVkMemoryAllocateInfoFields, 1};
+
+const Field kVkMappedMemoryRangeFields[] = {
+    {"pNext", kNextField, offsetof(VkMappedMemoryRange, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"memory", kHandleField, offsetof(VkMappedMemoryRange, memory),
+     sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+};
+const StructType kVkMappedMemoryRangeType = {
+    "VkMappedMemoryRange", sizeof(VkMappedMemoryRange), true,
+    VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, kVkMappedMemoryRangeFields, 2};
+
+const Field kVkSparseMemoryBindFields[] = {
+    {"memory", kHandleField, offsetof(VkSparseMemoryBind, memory),
+     sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+};
+const StructType kVkSparseMemoryBindType = {
+    "VkSparseMemoryBind", sizeof(VkSparseMemoryBind), false, VkStructureType(0),
+    kVkSparseMemoryBindFields, 1};
+
+const Field kVkSparseBufferMemoryBindInfoFields[] = {
+    {"buffer", kHandleField, offsetof(VkSparseBufferMemoryBindInfo, buffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"pBinds", kPointerField, offsetof(VkSparseBufferMemoryBindInfo, pBinds),
+     sizeof(VkSparseMemoryBind), &kVkSparseMemoryBindType, 0, &Count10},
+};
+const StructType kVkSparseBufferMemoryBindInfoType = {
+    "VkSparseBufferMemoryBindInfo", sizeof(VkSparseBufferMemoryBindInfo), false,
+    VkStructureType(0), kVkSparseBufferMemoryBindInfoFields, 2};
+
+const Field kVkSparseImageOpaqueMemoryBindInfoFields[] = {
+    {"image", kHandleField, offsetof(VkSparseImageOpaqueMemoryBindInfo, image),
+     sizeof(VkImage), nullptr, 9, nullptr},
+    {"pBinds", kPointerField,
+     offsetof(VkSparseImageOpaqueMemoryBindInfo, pBinds),
+     sizeof(VkSparseMemoryBind), &kVkSparseMemoryBindType, 0, &Count11},
+};
+const StructType kVkSparseImageOpaqueMemoryBindInfoType = {
+    "VkSparseImageOpaqueMemoryBindInfo",
+    sizeof(VkSparseImageOpaqueMemoryBindInfo), false, VkStructureType(0),
+    kVkSparseImageOpaqueMemoryBindInfoFields, 2};
+
+const Field kVkSparseImageMemoryBindFields[] = {
+    {"memory", kHandleField, offsetof(VkSparseImageMemoryBind, memory),
+     sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+};
+const StructType kVkSparseImageMemoryBindType = {
+    "VkSparseImageMemoryBind", sizeof(VkSparseImageMemoryBind), false,
+    VkStructureType(0), kVkSparseImageMemoryBindFields, 1};
+
+const Field kVkSparseImageMemoryBindInfoFields[] = {
+    {"image", kHandleField, offsetof(VkSparseImageMemoryBindInfo, image),
+     sizeof(VkImage), nullptr, 9, nullptr},
+    {"pBinds", kPointerField, offsetof(VkSparseImageMemoryBindInfo, pBinds),
+     sizeof(VkSparseImageMemoryBind), &kVkSparseImageMemoryBindType, 0,
+     &Count12},
+};
+const StructType kVkSparseImageMemoryBindInfoType = {
+    "VkSparseImageMemoryBindInfo", sizeof(VkSparseImageMemoryBindInfo), false,
+    VkStructureType(0), kVkSparseImageMemoryBindInfoFields, 2};
+
+const Field kVkBindSparseInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkBindSparseInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pWaitSemaphores", kHandlePointerField,
+     offsetof(VkBindSparseInfo, pWaitSemaphores), sizeof(VkSemaphore), nullptr,
+     4, &Count13},
+    {"pBufferBinds", kPointerField, offsetof(VkBindSparseInfo, pBufferBinds),
+     sizeof(VkSparseBufferMemoryBindInfo), &kVkSparseBufferMemoryBindInfoType,
+     0, &Count14},
+    {"pImageOpaqueBinds", kPointerField,
+     offsetof(VkBindSparseInfo, pImageOpaqueBinds),
+     sizeof(VkSparseImageOpaqueMemoryBindInfo),
+     &kVkSparseImageOpaqueMemoryBindInfoType, 0, &Count15},
+    {"pImageBinds", kPointerField, offsetof(VkBindSparseInfo, pImageBinds),
+     sizeof(VkSparseImageMemoryBindInfo), &kVkSparseImageMemoryBindInfoType, 0,
+     &Count16},
+    {"pSignalSemaphores", kHandlePointerField,
+     offsetof(VkBindSparseInfo, pSignalSemaphores), sizeof(VkSemaphore),
+     nullptr, 4, &Count17},
+};
+const StructType kVkBindSparseInfoType = {
+    "VkBindSparseInfo", sizeof(VkBindSparseInfo), true,
+    VK_STRUCTURE_TYPE_BIND_SPARSE_INFO, kVkBindSparseInfoFields, 6};
+
+const Field kVkFenceCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkFenceCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkFenceCreateInfoType = {
+    "VkFenceCreateInfo", sizeof(VkFenceCreateInfo), true,
+    VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, kVkFenceCreateInfoFields, 1};
+
+const Field kVkSemaphoreCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkSemaphoreCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkSemaphoreCreateInfoType = {
+    "VkSemaphoreCreateInfo", sizeof(VkSemaphoreCreateInfo), true,
+    VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO, kVkSemaphoreCreateInfoFields, 1};
+
+const Field kVkEventCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkEventCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkEventCreateInfoType = {
+    "VkEventCreateInfo", sizeof(VkEventCreateInfo), true,
+    VK_STRUCTURE_TYPE_EVENT_CREATE_INFO, kVkEventCreateInfoFields, 1};
+
+const Field kVkQueryPoolCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkQueryPoolCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkQueryPoolCreateInfoType = {
+    "VkQueryPoolCreateInfo", sizeof(VkQueryPoolCreateInfo), true,
+    VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO, kVkQueryPoolCreateInfoFields, 1};
+
+const Field kVkBufferCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkBufferCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pQueueFamilyIndices", kPointerField,
+     offsetof(VkBufferCreateInfo, pQueueFamilyIndices), sizeof(uint32_t),
+     nullptr, 0, &Count18},
+};
+const StructType kVkBufferCreateInfoType = {
+    "VkBufferCreateInfo", sizeof(VkBufferCreateInfo), true,
+    VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO, kVkBufferCreateInfoFields, 2};
+
+const Field kVkBufferViewCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkBufferViewCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"buffer", kHandleField, offsetof(VkBufferViewCreateInfo, buffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+};
+const StructType kVkBufferViewCreateInfoType = {
+    "VkBufferViewCreateInfo", sizeof(VkBufferViewCreateInfo), true,
+    VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO, kVkBufferViewCreateInfoFields,
+    2};
+
+const Field kVkImageCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkImageCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pQueueFamilyIndices", kPointerField,
+     offsetof(VkImageCreateInfo, pQueueFamilyIndices), sizeof(uint32_t),
+     nullptr, 0, &Count19},
+};
+const StructType kVkImageCreateInfoType = {
+    "VkImageCreateInfo", sizeof(VkImageCreateInfo), true,
+    VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO, kVkImageCreateInfoFields, 2};
+
+const Field kVkImageViewCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkImageViewCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"image", kHandleField, offsetof(VkImageViewCreateInfo, image),
+     sizeof(VkImage), nullptr, 9, nullptr},
+};
+const StructType kVkImageViewCreateInfoType = {
+    "VkImageViewCreateInfo", sizeof(VkImageViewCreateInfo), true,
+    VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO, kVkImageViewCreateInfoFields, 2};
+
+const Field kVkShaderModuleCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkShaderModuleCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pCode", kPointerField, offsetof(VkShaderModuleCreateInfo, pCode),
+     sizeof(uint32_t), nullptr, 0, &Count20},
+};
+const StructType kVkShaderModuleCreateInfoType = {
+    "VkShaderModuleCreateInfo", sizeof(VkShaderModuleCreateInfo), true,
+    VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+    kVkShaderModuleCreateInfoFields, 2};
+
+const Field kVkPipelineCacheCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkPipelineCacheCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pInitialData", kPointerField,
+     offsetof(VkPipelineCacheCreateInfo, pInitialData), 1, nullptr, 0,
+     &Count21},
+};
+const StructType kVkPipelineCacheCreateInfoType = {
+    "VkPipelineCacheCreateInfo", sizeof(VkPipelineCacheCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+    kVkPipelineCacheCreateInfoFields, 2};
+
+const Field kVkSpecializationInfoFields[] = {
+    {"pMapEntries", kPointerField, offsetof(VkSpecializationInfo, pMapEntries),
+     sizeof(VkSpecializationMapEntry), nullptr, 0, &Count22},
+    {"pData", kPointerField, offsetof(VkSpecializationInfo, pData), 1, nullptr,
+     0, &Count23},
+};
+const StructType kVkSpecializationInfoType = {
+    "VkSpecializationInfo", sizeof(VkSpecializationInfo), false,
+    VkStructureType(0), kVkSpecializationInfoFields, 2};
+
+const Field kVkPipelineShaderStageCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkPipelineShaderStageCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"module", kHandleField, offsetof(VkPipelineShaderStageCreateInfo, module),
+     sizeof(VkShaderModule), nullptr, 14, nullptr},
+    {"pName", kStringField, offsetof(VkPipelineShaderStageCreateInfo, pName), 1,
+     nullptr, 0, nullptr},
+    {"pSpecializationInfo", kPointerField,
+     offsetof(VkPipelineShaderStageCreateInfo, pSpecializationInfo),
+     sizeof(VkSpecializationInfo), &kVkSpecializationInfoType, 0, nullptr},
+};
+const StructType kVkPipelineShaderStageCreateInfoType = {
+    "VkPipelineShaderStageCreateInfo", sizeof(VkPipelineShaderStageCreateInfo),
+    true, VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+    kVkPipelineShaderStageCreateInfoFields, 4};
+
+const Field kVkPipelineVertexInputStateCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkPipelineVertexInputStateCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pVertexBindingDescriptions", kPointerField,
+     offsetof(VkPipelineVertexInputStateCreateInfo, pVertexBindingDescriptions),
+     sizeof(VkVertexInputBindingDescription), nullptr, 0, &Count24},
+    {"pVertexAttributeDescriptions", kPointerField,
+     offsetof(VkPipelineVertexInputStateCreateInfo, pVertexAttributeDescriptions),
+     sizeof(VkVertexInputAttributeDescription), nullptr, 0, &Count25},
+};
+const StructType kVkPipelineVertexInputStateCreateInfoType = {
+    "VkPipelineVertexInputStateCreateInfo",
+    sizeof(VkPipelineVertexInputStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+    kVkPipelineVertexInputStateCreateInfoFields, 3};
+
+const Field kVkPipelineInputAssemblyStateCreateInfoFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPipelineInputAssemblyStateCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPipelineInputAssemblyStateCreateInfoType = {
+    "VkPipelineInputAssemblyStateCreateInfo",
+    sizeof(VkPipelineInputAssemblyStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+    kVkPipelineInputAssemblyStateCreateInfoFields, 1};
+
+const Field kVkPipelineTessellationStateCreateInfoFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPipelineTessellationStateCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPipelineTessellationStateCreateInfoType = {
+    "VkPipelineTessellationStateCreateInfo",
+    sizeof(VkPipelineTessellationStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO,
+    kVkPipelineTessellationStateCreateInfoFields, 1};
+
+const Field kVkPipelineViewportStateCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkPipelineViewportStateCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pViewports", kPointerField,
+     offsetof(VkPipelineViewportStateCreateInfo, pViewports),
+     sizeof(VkViewport), nullptr, 0, &Count26},
+    {"pScissors", kPointerField,
+     offsetof(VkPipelineViewportStateCreateInfo, pScissors), sizeof(VkRect2D),
+     nullptr, 0, &Count27},
+};
+const StructType kVkPipelineViewportStateCreateInfoType = {
+    "VkPipelineViewportStateCreateInfo",
+    sizeof(VkPipelineViewportStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+    kVkPipelineViewportStateCreateInfoFields, 3};
+
+const Field kVkPipelineRasterizationStateCreateInfoFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPipelineRasterizationStateCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPipelineRasterizationStateCreateInfoType = {
+    "VkPipelineRasterizationStateCreateInfo",
+    sizeof(VkPipelineRasterizationStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+    kVkPipelineRasterizationStateCreateInfoFields, 1};
+
+const Field kVkPipelineMultisampleStateCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkPipelineMultisampleStateCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pSampleMask", kPointerField,
+     offsetof(VkPipelineMultisampleStateCreateInfo, pSampleMask),
+     sizeof(VkSampleMask), nullptr, 0, &Count28},
+};
+const StructType kVkPipelineMultisampleStateCreateInfoType = {
+    "VkPipelineMultisampleStateCreateInfo",
+    sizeof(VkPipelineMultisampleStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+    kVkPipelineMultisampleStateCreateInfoFields, 2};
+
+const Field kVkPipelineDepthStencilStateCreateInfoFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPipelineDepthStencilStateCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPipelineDepthStencilStateCreateInfoType = {
+    "VkPipelineDepthStencilStateCreateInfo",
+    sizeof(VkPipelineDepthStencilStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+    kVkPipelineDepthStencilStateCreateInfoFields, 1};
+
+const Field kVkPipelineColorBlendStateCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkPipelineColorBlendStateCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pAttachments", kPointerField,
+     offsetof(VkPipelineColorBlendStateCreateInfo, pAttachments),
+     sizeof(VkPipelineColorBlendAttachmentState), nullptr, 0, &Count29},
+};
+const StructType kVkPipelineColorBlendStateCreateInfoType = {
+    "VkPipelineColorBlendStateCreateInfo",
+    sizeof(VkPipelineColorBlendStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+    kVkPipelineColorBlendStateCreateInfoFields, 2};
+
+const Field kVkPipelineDynamicStateCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkPipelineDynamicStateCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pDynamicStates", kPointerField,
+     offsetof(VkPipelineDynamicStateCreateInfo, pDynamicStates),
+     sizeof(VkDynamicState), nullptr, 0, &Count30},
+};
+const StructType kVkPipelineDynamicStateCreateInfoType = {
+    "VkPipelineDynamicStateCreateInfo",
+    sizeof(VkPipelineDynamicStateCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+    kVkPipelineDynamicStateCreateInfoFields, 2};
+
+const Field kVkGraphicsPipelineCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkGraphicsPipelineCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pStages", kPointerField, offsetof(VkGraphicsPipelineCreateInfo, pStages),
+     sizeof(VkPipelineShaderStageCreateInfo),
+     &kVkPipelineShaderStageCreateInfoType, 0, &Count31},
+    {"pVertexInputState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pVertexInputState),
+     sizeof(VkPipelineVertexInputStateCreateInfo),
+     &kVkPipelineVertexInputStateCreateInfoType, 0, nullptr},
+    {"pInputAssemblyState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pInputAssemblyState),
+     sizeof(VkPipelineInputAssemblyStateCreateInfo),
+     &kVkPipelineInputAssemblyStateCreateInfoType, 0, nullptr},
+    {"pTessellationState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pTessellationState),
+     sizeof(VkPipelineTessellationStateCreateInfo),
+     &kVkPipelineTessellationStateCreateInfoType, 0, nullptr},
+    {"pViewportState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pViewportState),
+     sizeof(VkPipelineViewportStateCreateInfo),
+     &kVkPipelineViewportStateCreateInfoType, 0, nullptr},
+    {"pRasterizationState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pRasterizationState),
+     sizeof(VkPipelineRasterizationStateCreateInfo),
+     &kVkPipelineRasterizationStateCreateInfoType, 0, nullptr},
+    {"pMultisampleState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pMultisampleState),
+     sizeof(VkPipelineMultisampleStateCreateInfo),
+     &kVkPipelineMultisampleStateCreateInfoType, 0, nullptr},
+    {"pDepthStencilState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pDepthStencilState),
+     sizeof(VkPipelineDepthStencilStateCreateInfo),
+     &kVkPipelineDepthStencilStateCreateInfoType, 0, nullptr},
+    {"pColorBlendState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pColorBlendState),
+     sizeof(VkPipelineColorBlendStateCreateInfo),
+     &kVkPipelineColorBlendStateCreateInfoType, 0, nullptr},
+    {"pDynamicState", kPointerField,
+     offsetof(VkGraphicsPipelineCreateInfo, pDynamicState),
+     sizeof(VkPipelineDynamicStateCreateInfo),
+     &kVkPipelineDynamicStateCreateInfoType, 0, nullptr},
+    {"layout", kHandleField, offsetof(VkGraphicsPipelineCreateInfo, layout),
+     sizeof(VkPipelineLayout), nullptr, 16, nullptr},
+    {"renderPass", kHandleField,
+     offsetof(VkGraphicsPipelineCreateInfo, renderPass), sizeof(VkRenderPass),
+     nullptr, 17, nullptr},
+    {"basePipelineHandle", kHandleField,
+     offsetof(VkGraphicsPipelineCreateInfo, basePipelineHandle),
+     sizeof(VkPipeline), nullptr, 18, nullptr},
+};
+const StructType kVkGraphicsPipelineCreateInfoType = {
+    "VkGraphicsPipelineCreateInfo", sizeof(VkGraphicsPipelineCreateInfo), true,
+    VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+    kVkGraphicsPipelineCreateInfoFields, 14};
+
+const Field kVkComputePipelineCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkComputePipelineCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"stage", kStructField, offsetof(VkComputePipelineCreateInfo, stage),
+     sizeof(VkPipelineShaderStageCreateInfo),
+     &kVkPipelineShaderStageCreateInfoType, 0, nullptr},
+    {"layout", kHandleField, offsetof(VkComputePipelineCreateInfo, layout),
+     sizeof(VkPipelineLayout), nullptr, 16, nullptr},
+    {"basePipelineHandle", kHandleField,
+     offsetof(VkComputePipelineCreateInfo, basePipelineHandle),
+     sizeof(VkPipeline), nullptr, 18, nullptr},
+};
+const StructType kVkComputePipelineCreateInfoType = {
+    "VkComputePipelineCreateInfo", sizeof(VkComputePipelineCreateInfo), true,
+    VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+    kVkComputePipelineCreateInfoFields, 4};
+
+const Field kVkPipelineLayoutCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkPipelineLayoutCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pSetLayouts", kHandlePointerField,
+     offsetof(VkPipelineLayoutCreateInfo, pSetLayouts),
+     sizeof(VkDescriptorSetLayout), nullptr, 19, &Count32},
+    {"pPushConstantRanges", kPointerField,
+     offsetof(VkPipelineLayoutCreateInfo, pPushConstantRanges),
+     sizeof(VkPushConstantRange), nullptr, 0, &Count33},
+};
+const StructType kVkPipelineLayoutCreateInfoType = {
+    "VkPipelineLayoutCreateInfo", sizeof(VkPipelineLayoutCreateInfo), true,
+    VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+    kVkPipelineLayoutCreateInfoFields, 3};
+
+const Field kVkSamplerCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkSamplerCreateInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkSamplerCreateInfoType = {
+    "VkSamplerCreateInfo", sizeof(VkSamplerCreateInfo), true,
+    VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO, kVkSamplerCreateInfoFields, 1};
+
+const Field kVkDescriptorSetLayoutBindingFields[] = {
+    {"pImmutableSamplers", kHandlePointerField,
+     offsetof(VkDescriptorSetLayoutBinding, pImmutableSamplers),
+     sizeof(VkSampler), nullptr, 20, &Count34},
+};
+const StructType kVkDescriptorSetLayoutBindingType = {
+    "VkDescriptorSetLayoutBinding", sizeof(VkDescriptorSetLayoutBinding), false,
+    VkStructureType(0), kVkDescriptorSetLayoutBindingFields, 1};
+
+const Field kVkDescriptorSetLayoutCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkDescriptorSetLayoutCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pBindings", kPointerField,
+     offsetof(VkDescriptorSetLayoutCreateInfo, pBindings),
+     sizeof(VkDescriptorSetLayoutBinding), &kVkDescriptorSetLayoutBindingType,
+     0, &Count35},
+};
+const StructType kVkDescriptorSetLayoutCreateInfoType = {
+    "VkDescriptorSetLayoutCreateInfo", sizeof(VkDescriptorSetLayoutCreateInfo),
+    true, VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+    kVkDescriptorSetLayoutCreateInfoFields, 2};
+
+const Field kVkDescriptorPoolCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkDescriptorPoolCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pPoolSizes", kPointerField,
+     offsetof(VkDescriptorPoolCreateInfo, pPoolSizes),
+     sizeof(VkDescriptorPoolSize), nullptr, 0, &Count36},
+};
+const StructType kVkDescriptorPoolCreateInfoType = {
+    "VkDescriptorPoolCreateInfo", sizeof(VkDescriptorPoolCreateInfo), true,
+    VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+    kVkDescriptorPoolCreateInfoFields, 2};
+
+const Field kVkDescriptorSetAllocateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkDescriptorSetAllocateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"descriptorPool", kHandleField,
+     offsetof(VkDescriptorSetAllocateInfo, descriptorPool),
+     sizeof(VkDescriptorPool), nullptr, 21, nullptr},
+    {"pSetLayouts", kHandlePointerField,
+     offsetof(VkDescriptorSetAllocateInfo, pSetLayouts),
+     sizeof(VkDescriptorSetLayout), nullptr, 19, &Count37},
+};
+const StructType kVkDescriptorSetAllocateInfoType = {
+    "VkDescriptorSetAllocateInfo", sizeof(VkDescriptorSetAllocateInfo), true,
+    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+    kVkDescriptorSetAllocateInfoFields, 3};
+
+const Field kVkDescriptorImageInfoFields[] = {
+    {"sampler", kHandleField, offsetof(VkDescriptorImageInfo, sampler),
+     sizeof(VkSampler), nullptr, 20, nullptr},
+    {"imageView", kHandleField, offsetof(VkDescriptorImageInfo, imageView),
+     sizeof(VkImageView), nullptr, 13, nullptr},
+};
+const StructType kVkDescriptorImageInfoType = {
+    "VkDescriptorImageInfo", sizeof(VkDescriptorImageInfo), false,
+    VkStructureType(0), kVkDescriptorImageInfoFields, 2};
+
+const Field kVkDescriptorBufferInfoFields[] = {
+    {"buffer", kHandleField, offsetof(VkDescriptorBufferInfo, buffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+};
+const StructType kVkDescriptorBufferInfoType = {
+    "VkDescriptorBufferInfo", sizeof(VkDescriptorBufferInfo), false,
+    VkStructureType(0), kVkDescriptorBufferInfoFields, 1};
+
+const Field kVkWriteDescriptorSetFields[] = {
+    {"pNext", kNextField, offsetof(VkWriteDescriptorSet, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"dstSet", kHandleField, offsetof(VkWriteDescriptorSet, dstSet),
+     sizeof(VkDescriptorSet), nullptr, 22, nullptr},
+    {"pImageInfo", kPointerField, offsetof(VkWriteDescriptorSet, pImageInfo),
+     sizeof(VkDescriptorImageInfo), &kVkDescriptorImageInfoType, 0, &Count38},
+    {"pBufferInfo", kPointerField, offsetof(VkWriteDescriptorSet, pBufferInfo),
+     sizeof(VkDescriptorBufferInfo), &kVkDescriptorBufferInfoType, 0, &Count39},
+    {"pTexelBufferView", kHandlePointerField,
+     offsetof(VkWriteDescriptorSet, pTexelBufferView), sizeof(VkBufferView),
+     nullptr, 12, &Count40},
+};
+const StructType kVkWriteDescriptorSetType = {
+    "VkWriteDescriptorSet", sizeof(VkWriteDescriptorSet), true,
+    VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, kVkWriteDescriptorSetFields, 5};
+
+const Field kVkCopyDescriptorSetFields[] = {
+    {"pNext", kNextField, offsetof(VkCopyDescriptorSet, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"srcSet", kHandleField, offsetof(VkCopyDescriptorSet, srcSet),
+     sizeof(VkDescriptorSet), nullptr, 22, nullptr},
+    {"dstSet", kHandleField, offsetof(VkCopyDescriptorSet, dstSet),
+     sizeof(VkDescriptorSet), nullptr, 22, nullptr},
+};
+const StructType kVkCopyDescriptorSetType = {
+    "VkCopyDescriptorSet", sizeof(VkCopyDescriptorSet), true,
+    VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET, kVkCopyDescriptorSetFields, 3};
+
+const Field kVkFramebufferCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkFramebufferCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"renderPass", kHandleField, offsetof(VkFramebufferCreateInfo, renderPass),
+     sizeof(VkRenderPass), nullptr, 17, nullptr},
+    {"pAttachments", kHandlePointerField,
+     offsetof(VkFramebufferCreateInfo, pAttachments), sizeof(VkImageView),
+     nullptr, 13, &Count41},
+};
+const StructType kVkFramebufferCreateInfoType = {
+    "VkFramebufferCreateInfo", sizeof(VkFramebufferCreateInfo), true,
+    VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, kVkFramebufferCreateInfoFields,
+    3};
+
+const Field kVkSubpassDescriptionFields[] = {
+    {"pInputAttachments", kPointerField,
+     offsetof(VkSubpassDescription, pInputAttachments),
+     sizeof(VkAttachmentReference), nullptr, 0, &Count42},
+    {"pColorAttachments", kPointerField,
+     offsetof(VkSubpassDescription, pColorAttachments),
+     sizeof(VkAttachmentReference), nullptr, 0, &Count43},
+    {"pResolveAttachments", kPointerField,
+     offsetof(VkSubpassDescription, pResolveAttachments),
+     sizeof(VkAttachmentReference), nullptr, 0, &Count44},
+    {"pDepthStencilAttachment", kPointerField,
+     offsetof(VkSubpassDescription, pDepthStencilAttachment),
+     sizeof(VkAttachmentReference), nullptr, 0, nullptr},
+    {"pPreserveAttachments", kPointerField,
+     offsetof(VkSubpassDescription, pPreserveAttachments), sizeof(uint32_t),
+     nullptr, 0, &Count45},
+};
+const StructType kVkSubpassDescriptionType = {
+    "VkSubpassDescription", sizeof(VkSubpassDescription), false,
+    VkStructureType(0), kVkSubpassDescriptionFields, 5};
+
+const Field kVkRenderPassCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkRenderPassCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pAttachments", kPointerField,
+     offsetof(VkRenderPassCreateInfo, pAttachments),
+     sizeof(VkAttachmentDescription), nullptr, 0, &Count46},
+    {"pSubpasses", kPointerField, offsetof(VkRenderPassCreateInfo, pSubpasses),
+     sizeof(VkSubpassDescription), &kVkSubpassDescriptionType, 0, &Count47},
+    {"pDependencies", kPointerField,
+     offsetof(VkRenderPassCreateInfo, pDependencies),
+     sizeof(VkSubpassDependency), nullptr, 0, &Count48},
+};
+const StructType kVkRenderPassCreateInfoType = {
+    "VkRenderPassCreateInfo", sizeof(VkRenderPassCreateInfo), true,
+    VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, kVkRenderPassCreateInfoFields,
+    4};
+
+const Field kVkCommandPoolCreateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkCommandPoolCreateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkCommandPoolCreateInfoType = {
+    "VkCommandPoolCreateInfo", sizeof(VkCommandPoolCreateInfo), true,
+    VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO, kVkCommandPoolCreateInfoFields,
+    1};
+
+const Field kVkCommandBufferAllocateInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkCommandBufferAllocateInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"commandPool", kHandleField,
+     offsetof(VkCommandBufferAllocateInfo, commandPool), sizeof(VkCommandPool),
+     nullptr, 24, nullptr},
+};
+const StructType kVkCommandBufferAllocateInfoType = {
+    "VkCommandBufferAllocateInfo", sizeof(VkCommandBufferAllocateInfo), true,
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+    kVkCommandBufferAllocateInfoFields, 2};
+
+const Field kVkCommandBufferInheritanceInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkCommandBufferInheritanceInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"renderPass", kHandleField,
+     offsetof(VkCommandBufferInheritanceInfo, renderPass), sizeof(VkRenderPass),
+     nullptr, 17, nullptr},
+    {"framebuffer", kHandleField,
+     offsetof(VkCommandBufferInheritanceInfo, framebuffer),
+     sizeof(VkFramebuffer), nullptr, 23, nullptr},
+};
+const StructType kVkCommandBufferInheritanceInfoType = {
+    "VkCommandBufferInheritanceInfo", sizeof(VkCommandBufferInheritanceInfo),
+    true, VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+    kVkCommandBufferInheritanceInfoFields, 3};
+
+const Field kVkCommandBufferBeginInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkCommandBufferBeginInfo, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pInheritanceInfo", kPointerField,
+     offsetof(VkCommandBufferBeginInfo, pInheritanceInfo),
+     sizeof(VkCommandBufferInheritanceInfo),
+     &kVkCommandBufferInheritanceInfoType, 0, nullptr},
+};
+const StructType kVkCommandBufferBeginInfoType = {
+    "VkCommandBufferBeginInfo", sizeof(VkCommandBufferBeginInfo), true,
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+    kVkCommandBufferBeginInfoFields, 2};
+
+const Field kVkMemoryBarrierFields[] = {
+    {"pNext", kNextField, offsetof(VkMemoryBarrier, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkMemoryBarrierType = {
+    "VkMemoryBarrier", sizeof(VkMemoryBarrier), true,
+    VK_STRUCTURE_TYPE_MEMORY_BARRIER, kVkMemoryBarrierFields, 1};
+
+const Field kVkBufferMemoryBarrierFields[] = {
+    {"pNext", kNextField, offsetof(VkBufferMemoryBarrier, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"buffer", kHandleField, offsetof(VkBufferMemoryBarrier, buffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+};
+const StructType kVkBufferMemoryBarrierType = {
+    "VkBufferMemoryBarrier", sizeof(VkBufferMemoryBarrier), true,
+    VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER, kVkBufferMemoryBarrierFields, 2};
+
+const Field kVkImageMemoryBarrierFields[] = {
+    {"pNext", kNextField, offsetof(VkImageMemoryBarrier, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"image", kHandleField, offsetof(VkImageMemoryBarrier, image),
+     sizeof(VkImage), nullptr, 9, nullptr},
+};
+const StructType kVkImageMemoryBarrierType = {
+    "VkImageMemoryBarrier", sizeof(VkImageMemoryBarrier), true,
+    VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER, kVkImageMemoryBarrierFields, 2};
+
+const Field kVkRenderPassBeginInfoFields[] = {
+    {"pNext", kNextField, offsetof(VkRenderPassBeginInfo, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"renderPass", kHandleField, offsetof(VkRenderPassBeginInfo, renderPass),
+     sizeof(VkRenderPass), nullptr, 17, nullptr},
+    {"framebuffer", kHandleField, offsetof(VkRenderPassBeginInfo, framebuffer),
+     sizeof(VkFramebuffer), nullptr, 23, nullptr},
+    {"pClearValues", kPointerField,
+     offsetof(VkRenderPassBeginInfo, pClearValues), sizeof(VkClearValue),
+     nullptr, 0, &Count49},
+};
+const StructType kVkRenderPassBeginInfoType = {
+    "VkRenderPassBeginInfo", sizeof(VkRenderPassBeginInfo), true,
+    VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, kVkRenderPassBeginInfoFields, 4};
+
+const Field kVkSwapchainCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkSwapchainCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"surface", kHandleField, offsetof(VkSwapchainCreateInfoKHR, surface),
+     sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pQueueFamilyIndices", kPointerField,
+     offsetof(VkSwapchainCreateInfoKHR, pQueueFamilyIndices), sizeof(uint32_t),
+     nullptr, 0, &Count50},
+    {"oldSwapchain", kHandleField,
+     offsetof(VkSwapchainCreateInfoKHR, oldSwapchain), sizeof(VkSwapchainKHR),
+     nullptr, 26, nullptr},
+};
+const StructType kVkSwapchainCreateInfoKHRType = {
+    "VkSwapchainCreateInfoKHR", sizeof(VkSwapchainCreateInfoKHR), true,
+    VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+    kVkSwapchainCreateInfoKHRFields, 4};
+
+const Field kVkPresentInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkPresentInfoKHR, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pWaitSemaphores", kHandlePointerField,
+     offsetof(VkPresentInfoKHR, pWaitSemaphores), sizeof(VkSemaphore), nullptr,
+     4, &Count51},
+    {"pSwapchains", kHandlePointerField,
+     offsetof(VkPresentInfoKHR, pSwapchains), sizeof(VkSwapchainKHR), nullptr,
+     26, &Count52},
+    {"pImageIndices", kPointerField, offsetof(VkPresentInfoKHR, pImageIndices),
+     sizeof(uint32_t), nullptr, 0, &Count53},
+    {"pResults", kOutputField, offsetof(VkPresentInfoKHR, pResults),
+     sizeof(VkResult), nullptr, 0, &Count54},
+};
+const StructType kVkPresentInfoKHRType = {
+    "VkPresentInfoKHR", sizeof(VkPresentInfoKHR), true,
+    VK_STRUCTURE_TYPE_PRESENT_INFO_KHR, kVkPresentInfoKHRFields, 5};
+
+const Field kVkDisplayPropertiesKHRFields[] = {
+    {"display", kHandleField, offsetof(VkDisplayPropertiesKHR, display),
+     sizeof(VkDisplayKHR), nullptr, 27, nullptr},
+    {"displayName", kStringField, offsetof(VkDisplayPropertiesKHR, displayName),
+     1, nullptr, 0, nullptr},
+};
+const StructType kVkDisplayPropertiesKHRType = {
+    "VkDisplayPropertiesKHR", sizeof(VkDisplayPropertiesKHR), false,
+    VkStructureType(0), kVkDisplayPropertiesKHRFields, 2};
+
+const Field kVkDisplayModePropertiesKHRFields[] = {
+    {"displayMode", kHandleField,
+     offsetof(VkDisplayModePropertiesKHR, displayMode),
+     sizeof(VkDisplayModeKHR), nullptr, 28, nullptr},
+};
+const StructType kVkDisplayModePropertiesKHRType = {
+    "VkDisplayModePropertiesKHR", sizeof(VkDisplayModePropertiesKHR), false,
+    VkStructureType(0), kVkDisplayModePropertiesKHRFields, 1};
+
+const Field kVkDisplayModeCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkDisplayModeCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkDisplayModeCreateInfoKHRType = {
+    "VkDisplayModeCreateInfoKHR", sizeof(VkDisplayModeCreateInfoKHR), true,
+    VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR,
+    kVkDisplayModeCreateInfoKHRFields, 1};
+
+const Field kVkDisplayPlanePropertiesKHRFields[] = {
+    {"currentDisplay", kHandleField,
+     offsetof(VkDisplayPlanePropertiesKHR, currentDisplay),
+     sizeof(VkDisplayKHR), nullptr, 27, nullptr},
+};
+const StructType kVkDisplayPlanePropertiesKHRType = {
+    "VkDisplayPlanePropertiesKHR", sizeof(VkDisplayPlanePropertiesKHR), false,
+    VkStructureType(0), kVkDisplayPlanePropertiesKHRFields, 1};
+
+const Field kVkDisplaySurfaceCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkDisplaySurfaceCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"displayMode", kHandleField,
+     offsetof(VkDisplaySurfaceCreateInfoKHR, displayMode),
+     sizeof(VkDisplayModeKHR), nullptr, 28, nullptr},
+};
+const StructType kVkDisplaySurfaceCreateInfoKHRType = {
+    "VkDisplaySurfaceCreateInfoKHR", sizeof(VkDisplaySurfaceCreateInfoKHR),
+    true, VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR,
+    kVkDisplaySurfaceCreateInfoKHRFields, 2};
+
+const Field kVkDisplayPresentInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkDisplayPresentInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkDisplayPresentInfoKHRType = {
+    "VkDisplayPresentInfoKHR", sizeof(VkDisplayPresentInfoKHR), true,
+    VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR, kVkDisplayPresentInfoKHRFields,
+    1};
+
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+const Field kVkXlibSurfaceCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkXlibSurfaceCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkXlibSurfaceCreateInfoKHRType = {
+    "VkXlibSurfaceCreateInfoKHR", sizeof(VkXlibSurfaceCreateInfoKHR), true,
+    VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR,
+    kVkXlibSurfaceCreateInfoKHRFields, 1};
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+const Field kVkXcbSurfaceCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkXcbSurfaceCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkXcbSurfaceCreateInfoKHRType = {
+    "VkXcbSurfaceCreateInfoKHR", sizeof(VkXcbSurfaceCreateInfoKHR), true,
+    VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR,
+    kVkXcbSurfaceCreateInfoKHRFields, 1};
+#endif  // VK_USE_PLATFORM_XCB_KHR
+
+#if defined(VK_USE_PLATFORM_WAYLAND_KHR)
+const Field kVkWaylandSurfaceCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkWaylandSurfaceCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkWaylandSurfaceCreateInfoKHRType = {
+    "VkWaylandSurfaceCreateInfoKHR", sizeof(VkWaylandSurfaceCreateInfoKHR),
+    true, VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR,
+    kVkWaylandSurfaceCreateInfoKHRFields, 1};
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+
+#if defined(VK_USE_PLATFORM_MIR_KHR)
+const Field kVkMirSurfaceCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkMirSurfaceCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkMirSurfaceCreateInfoKHRType = {
+    "VkMirSurfaceCreateInfoKHR", sizeof(VkMirSurfaceCreateInfoKHR), true,
+    VK_STRUCTURE_TYPE_MIR_SURFACE_CREATE_INFO_KHR,
+    kVkMirSurfaceCreateInfoKHRFields, 1};
+#endif  // VK_USE_PLATFORM_MIR_KHR
+
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+const Field kVkAndroidSurfaceCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkAndroidSurfaceCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkAndroidSurfaceCreateInfoKHRType = {
+    "VkAndroidSurfaceCreateInfoKHR", sizeof(VkAndroidSurfaceCreateInfoKHR),
+    true, VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR,
+    kVkAndroidSurfaceCreateInfoKHRFields, 1};
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+const Field kVkWin32SurfaceCreateInfoKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkWin32SurfaceCreateInfoKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkWin32SurfaceCreateInfoKHRType = {
+    "VkWin32SurfaceCreateInfoKHR", sizeof(VkWin32SurfaceCreateInfoKHR), true,
+    VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR,
+    kVkWin32SurfaceCreateInfoKHRFields, 1};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+const Field kVkPhysicalDeviceFeatures2KHRFields[] = {
+    {"pNext", kNextField, offsetof(VkPhysicalDeviceFeatures2KHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceFeatures2KHRType = {
+    "VkPhysicalDeviceFeatures2KHR", sizeof(VkPhysicalDeviceFeatures2KHR), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR,
+    kVkPhysicalDeviceFeatures2KHRFields, 1};
+
+const Field kVkPhysicalDeviceProperties2KHRFields[] = {
+    {"pNext", kNextField, offsetof(VkPhysicalDeviceProperties2KHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceProperties2KHRType = {
+    "VkPhysicalDeviceProperties2KHR", sizeof(VkPhysicalDeviceProperties2KHR),
+    true, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR,
+    kVkPhysicalDeviceProperties2KHRFields, 1};
+
+const Field kVkFormatProperties2KHRFields[] = {
+    {"pNext", kNextField, offsetof(VkFormatProperties2KHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkFormatProperties2KHRType = {
+    "VkFormatProperties2KHR", sizeof(VkFormatProperties2KHR), true,
+    VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2_KHR, kVkFormatProperties2KHRFields,
+    1};
+
+const Field kVkImageFormatProperties2KHRFields[] = {
+    {"pNext", kNextField, offsetof(VkImageFormatProperties2KHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkImageFormatProperties2KHRType = {
+    "VkImageFormatProperties2KHR", sizeof(VkImageFormatProperties2KHR), true,
+    VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2_KHR,
+    kVkImageFormatProperties2KHRFields, 1};
+
+const Field kVkPhysicalDeviceImageFormatInfo2KHRFields[] = {
+    {"pNext", kNextField, offsetof(VkPhysicalDeviceImageFormatInfo2KHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceImageFormatInfo2KHRType = {
+    "VkPhysicalDeviceImageFormatInfo2KHR",
+    sizeof(VkPhysicalDeviceImageFormatInfo2KHR), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2_KHR,
+    kVkPhysicalDeviceImageFormatInfo2KHRFields, 1};
+
+const Field kVkQueueFamilyProperties2KHRFields[] = {
+    {"pNext", kNextField, offsetof(VkQueueFamilyProperties2KHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkQueueFamilyProperties2KHRType = {
+    "VkQueueFamilyProperties2KHR", sizeof(VkQueueFamilyProperties2KHR), true,
+    VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2_KHR,
+    kVkQueueFamilyProperties2KHRFields, 1};
+
+const Field kVkPhysicalDeviceMemoryProperties2KHRFields[] = {
+    {"pNext", kNextField, offsetof(VkPhysicalDeviceMemoryProperties2KHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceMemoryProperties2KHRType = {
+    "VkPhysicalDeviceMemoryProperties2KHR",
+    sizeof(VkPhysicalDeviceMemoryProperties2KHR), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR,
+    kVkPhysicalDeviceMemoryProperties2KHRFields, 1};
+
+const Field kVkSparseImageFormatProperties2KHRFields[] = {
+    {"pNext", kNextField, offsetof(VkSparseImageFormatProperties2KHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkSparseImageFormatProperties2KHRType = {
+    "VkSparseImageFormatProperties2KHR",
+    sizeof(VkSparseImageFormatProperties2KHR), true,
+    VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2_KHR,
+    kVkSparseImageFormatProperties2KHRFields, 1};
+
+const Field kVkPhysicalDeviceSparseImageFormatInfo2KHRFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPhysicalDeviceSparseImageFormatInfo2KHR, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceSparseImageFormatInfo2KHRType = {
+    "VkPhysicalDeviceSparseImageFormatInfo2KHR",
+    sizeof(VkPhysicalDeviceSparseImageFormatInfo2KHR), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2_KHR,
+    kVkPhysicalDeviceSparseImageFormatInfo2KHRFields, 1};
+
+const Field kVkPhysicalDevicePushDescriptorPropertiesKHRFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPhysicalDevicePushDescriptorPropertiesKHR, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDevicePushDescriptorPropertiesKHRType = {
+    "VkPhysicalDevicePushDescriptorPropertiesKHR",
+    sizeof(VkPhysicalDevicePushDescriptorPropertiesKHR), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR,
+    kVkPhysicalDevicePushDescriptorPropertiesKHRFields, 1};
+
+const Field kVkPresentRegionKHRFields[] = {
+    {"pRectangles", kPointerField, offsetof(VkPresentRegionKHR, pRectangles),
+     sizeof(VkRectLayerKHR), nullptr, 0, &Count55},
+};
+const StructType kVkPresentRegionKHRType = {
+    "VkPresentRegionKHR", sizeof(VkPresentRegionKHR), false, VkStructureType(0),
+    kVkPresentRegionKHRFields, 1};
+
+const Field kVkPresentRegionsKHRFields[] = {
+    {"pNext", kNextField, offsetof(VkPresentRegionsKHR, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pRegions", kPointerField, offsetof(VkPresentRegionsKHR, pRegions),
+     sizeof(VkPresentRegionKHR), &kVkPresentRegionKHRType, 0, &Count56},
+};
+const StructType kVkPresentRegionsKHRType = {
+    "VkPresentRegionsKHR", sizeof(VkPresentRegionsKHR), true,
+    VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR, kVkPresentRegionsKHRFields, 2};
+
+const Field kVkDescriptorUpdateTemplateCreateInfoKHRFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkDescriptorUpdateTemplateCreateInfoKHR, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pDescriptorUpdateEntries", kPointerField,
+     offsetof(VkDescriptorUpdateTemplateCreateInfoKHR, pDescriptorUpdateEntries),
+     sizeof(VkDescriptorUpdateTemplateEntryKHR), nullptr, 0, &Count57},
+    {"descriptorSetLayout", kHandleField,
+     offsetof(VkDescriptorUpdateTemplateCreateInfoKHR, descriptorSetLayout),
+     sizeof(VkDescriptorSetLayout), nullptr, 19, nullptr},
+    {"pipelineLayout", kHandleField,
+     offsetof(VkDescriptorUpdateTemplateCreateInfoKHR, pipelineLayout),
+     sizeof(VkPipelineLayout), nullptr, 16, nullptr},
+};
+const StructType kVkDescriptorUpdateTemplateCreateInfoKHRType = {
+    "VkDescriptorUpdateTemplateCreateInfoKHR",
+    sizeof(VkDescriptorUpdateTemplateCreateInfoKHR), true,
+    VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR,
+    kVkDescriptorUpdateTemplateCreateInfoKHRFields, 4};
+
+const Field kVkDebugReportCallbackCreateInfoEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkDebugReportCallbackCreateInfoEXT, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkDebugReportCallbackCreateInfoEXTType = {
+    "VkDebugReportCallbackCreateInfoEXT",
+    sizeof(VkDebugReportCallbackCreateInfoEXT), true,
+    VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT,
+    kVkDebugReportCallbackCreateInfoEXTFields, 1};
+
+const Field kVkPipelineRasterizationStateRasterizationOrderAMDFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPipelineRasterizationStateRasterizationOrderAMD, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPipelineRasterizationStateRasterizationOrderAMDType = {
+    "VkPipelineRasterizationStateRasterizationOrderAMD",
+    sizeof(VkPipelineRasterizationStateRasterizationOrderAMD), true,
+    VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD,
+    kVkPipelineRasterizationStateRasterizationOrderAMDFields, 1};
+
+const Field kVkDebugMarkerObjectNameInfoEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkDebugMarkerObjectNameInfoEXT, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pObjectName", kStringField,
+     offsetof(VkDebugMarkerObjectNameInfoEXT, pObjectName), 1, nullptr, 0,
+     nullptr},
+};
+const StructType kVkDebugMarkerObjectNameInfoEXTType = {
+    "VkDebugMarkerObjectNameInfoEXT", sizeof(VkDebugMarkerObjectNameInfoEXT),
+    true, VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT,
+    kVkDebugMarkerObjectNameInfoEXTFields, 2};
+
+const Field kVkDebugMarkerObjectTagInfoEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkDebugMarkerObjectTagInfoEXT, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pTag", kPointerField, offsetof(VkDebugMarkerObjectTagInfoEXT, pTag), 1,
+     nullptr, 0, &Count58},
+};
+const StructType kVkDebugMarkerObjectTagInfoEXTType = {
+    "VkDebugMarkerObjectTagInfoEXT", sizeof(VkDebugMarkerObjectTagInfoEXT),
+    true, VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT,
+    kVkDebugMarkerObjectTagInfoEXTFields, 2};
+
+const Field kVkDebugMarkerMarkerInfoEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkDebugMarkerMarkerInfoEXT, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pMarkerName", kStringField,
+     offsetof(VkDebugMarkerMarkerInfoEXT, pMarkerName), 1, nullptr, 0, nullptr},
+};
+const StructType kVkDebugMarkerMarkerInfoEXTType = {
+    "VkDebugMarkerMarkerInfoEXT", sizeof(VkDebugMarkerMarkerInfoEXT), true,
+    VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT,
+    kVkDebugMarkerMarkerInfoEXTFields, 2};
+
+const Field kVkDedicatedAllocationImageCreateInfoNVFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkDedicatedAllocationImageCreateInfoNV, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkDedicatedAllocationImageCreateInfoNVType = {
+    "VkDedicatedAllocationImageCreateInfoNV",
+    sizeof(VkDedicatedAllocationImageCreateInfoNV), true,
+    VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV,
+    kVkDedicatedAllocationImageCreateInfoNVFields, 1};
+
+const Field kVkDedicatedAllocationBufferCreateInfoNVFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkDedicatedAllocationBufferCreateInfoNV, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkDedicatedAllocationBufferCreateInfoNVType = {
+    "VkDedicatedAllocationBufferCreateInfoNV",
+    sizeof(VkDedicatedAllocationBufferCreateInfoNV), true,
+    VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV,
+    kVkDedicatedAllocationBufferCreateInfoNVFields, 1};
+
+const Field kVkDedicatedAllocationMemoryAllocateInfoNVFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkDedicatedAllocationMemoryAllocateInfoNV, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"image", kHandleField,
+     offsetof(VkDedicatedAllocationMemoryAllocateInfoNV, image),
+     sizeof(VkImage), nullptr, 9, nullptr},
+    {"buffer", kHandleField,
+     offsetof(VkDedicatedAllocationMemoryAllocateInfoNV, buffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+};
+const StructType kVkDedicatedAllocationMemoryAllocateInfoNVType = {
+    "VkDedicatedAllocationMemoryAllocateInfoNV",
+    sizeof(VkDedicatedAllocationMemoryAllocateInfoNV), true,
+    VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV,
+    kVkDedicatedAllocationMemoryAllocateInfoNVFields, 3};
+
+const Field kVkRenderPassMultiviewCreateInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkRenderPassMultiviewCreateInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pViewMasks", kPointerField,
+     offsetof(VkRenderPassMultiviewCreateInfoKHX, pViewMasks), sizeof(uint32_t),
+     nullptr, 0, &Count59},
+    {"pViewOffsets", kPointerField,
+     offsetof(VkRenderPassMultiviewCreateInfoKHX, pViewOffsets),
+     sizeof(int32_t), nullptr, 0, &Count60},
+    {"pCorrelationMasks", kPointerField,
+     offsetof(VkRenderPassMultiviewCreateInfoKHX, pCorrelationMasks),
+     sizeof(uint32_t), nullptr, 0, &Count61},
+};
+const StructType kVkRenderPassMultiviewCreateInfoKHXType = {
+    "VkRenderPassMultiviewCreateInfoKHX",
+    sizeof(VkRenderPassMultiviewCreateInfoKHX), true,
+    VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO_KHX,
+    kVkRenderPassMultiviewCreateInfoKHXFields, 4};
+
+const Field kVkPhysicalDeviceMultiviewFeaturesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkPhysicalDeviceMultiviewFeaturesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceMultiviewFeaturesKHXType = {
+    "VkPhysicalDeviceMultiviewFeaturesKHX",
+    sizeof(VkPhysicalDeviceMultiviewFeaturesKHX), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES_KHX,
+    kVkPhysicalDeviceMultiviewFeaturesKHXFields, 1};
+
+const Field kVkPhysicalDeviceMultiviewPropertiesKHXFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPhysicalDeviceMultiviewPropertiesKHX, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceMultiviewPropertiesKHXType = {
+    "VkPhysicalDeviceMultiviewPropertiesKHX",
+    sizeof(VkPhysicalDeviceMultiviewPropertiesKHX), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES_KHX,
+    kVkPhysicalDeviceMultiviewPropertiesKHXFields, 1};
+
+const Field kVkExternalMemoryImageCreateInfoNVFields[] = {
+    {"pNext", kNextField, offsetof(VkExternalMemoryImageCreateInfoNV, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExternalMemoryImageCreateInfoNVType = {
+    "VkExternalMemoryImageCreateInfoNV",
+    sizeof(VkExternalMemoryImageCreateInfoNV), true,
+    VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV,
+    kVkExternalMemoryImageCreateInfoNVFields, 1};
+
+const Field kVkExportMemoryAllocateInfoNVFields[] = {
+    {"pNext", kNextField, offsetof(VkExportMemoryAllocateInfoNV, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExportMemoryAllocateInfoNVType = {
+    "VkExportMemoryAllocateInfoNV", sizeof(VkExportMemoryAllocateInfoNV), true,
+    VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV,
+    kVkExportMemoryAllocateInfoNVFields, 1};
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+const Field kVkImportMemoryWin32HandleInfoNVFields[] = {
+    {"pNext", kNextField, offsetof(VkImportMemoryWin32HandleInfoNV, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkImportMemoryWin32HandleInfoNVType = {
+    "VkImportMemoryWin32HandleInfoNV", sizeof(VkImportMemoryWin32HandleInfoNV),
+    true, VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV,
+    kVkImportMemoryWin32HandleInfoNVFields, 1};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+const Field kVkExportMemoryWin32HandleInfoNVFields[] = {
+    {"pNext", kNextField, offsetof(VkExportMemoryWin32HandleInfoNV, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExportMemoryWin32HandleInfoNVType = {
+    "VkExportMemoryWin32HandleInfoNV", sizeof(VkExportMemoryWin32HandleInfoNV),
+    true, VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV,
+    kVkExportMemoryWin32HandleInfoNVFields, 1};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+const Field kVkWin32KeyedMutexAcquireReleaseInfoNVFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoNV, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pAcquireSyncs", kHandlePointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoNV, pAcquireSyncs),
+     sizeof(VkDeviceMemory), nullptr, 7, &Count62},
+    {"pAcquireKeys", kPointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoNV, pAcquireKeys),
+     sizeof(uint64_t), nullptr, 0, &Count63},
+    {"pAcquireTimeoutMilliseconds", kPointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoNV, pAcquireTimeoutMilliseconds),
+     sizeof(uint32_t), nullptr, 0, &Count64},
+    {"pReleaseSyncs", kHandlePointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoNV, pReleaseSyncs),
+     sizeof(VkDeviceMemory), nullptr, 7, &Count65},
+    {"pReleaseKeys", kPointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoNV, pReleaseKeys),
+     sizeof(uint64_t), nullptr, 0, &Count66},
+};
+const StructType kVkWin32KeyedMutexAcquireReleaseInfoNVType = {
+    "VkWin32KeyedMutexAcquireReleaseInfoNV",
+    sizeof(VkWin32KeyedMutexAcquireReleaseInfoNV), true,
+    VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV,
+    kVkWin32KeyedMutexAcquireReleaseInfoNVFields, 6};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+const Field kVkMemoryAllocateFlagsInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkMemoryAllocateFlagsInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkMemoryAllocateFlagsInfoKHXType = {
+    "VkMemoryAllocateFlagsInfoKHX", sizeof(VkMemoryAllocateFlagsInfoKHX), true,
+    VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO_KHX,
+    kVkMemoryAllocateFlagsInfoKHXFields, 1};
+
+const Field kVkBindBufferMemoryInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkBindBufferMemoryInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"buffer", kHandleField, offsetof(VkBindBufferMemoryInfoKHX, buffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"memory", kHandleField, offsetof(VkBindBufferMemoryInfoKHX, memory),
+     sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"pDeviceIndices", kPointerField,
+     offsetof(VkBindBufferMemoryInfoKHX, pDeviceIndices), sizeof(uint32_t),
+     nullptr, 0, &Count67},
+};
+const StructType kVkBindBufferMemoryInfoKHXType = {
+    "VkBindBufferMemoryInfoKHX", sizeof(VkBindBufferMemoryInfoKHX), true,
+    VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO_KHX,
+    kVkBindBufferMemoryInfoKHXFields, 4};
+
+const Field kVkBindImageMemoryInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkBindImageMemoryInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"image", kHandleField, offsetof(VkBindImageMemoryInfoKHX, image),
+     sizeof(VkImage), nullptr, 9, nullptr},
+    {"memory", kHandleField, offsetof(VkBindImageMemoryInfoKHX, memory),
+     sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"pDeviceIndices", kPointerField,
+     offsetof(VkBindImageMemoryInfoKHX, pDeviceIndices), sizeof(uint32_t),
+     nullptr, 0, &Count68},
+    {"pSFRRects", kPointerField, offsetof(VkBindImageMemoryInfoKHX, pSFRRects),
+     sizeof(VkRect2D), nullptr, 0, &Count69},
+};
+const StructType kVkBindImageMemoryInfoKHXType = {
+    "VkBindImageMemoryInfoKHX", sizeof(VkBindImageMemoryInfoKHX), true,
+    VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO_KHX,
+    kVkBindImageMemoryInfoKHXFields, 5};
+
+const Field kVkDeviceGroupRenderPassBeginInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGroupRenderPassBeginInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pDeviceRenderAreas", kPointerField,
+     offsetof(VkDeviceGroupRenderPassBeginInfoKHX, pDeviceRenderAreas),
+     sizeof(VkRect2D), nullptr, 0, &Count70},
+};
+const StructType kVkDeviceGroupRenderPassBeginInfoKHXType = {
+    "VkDeviceGroupRenderPassBeginInfoKHX",
+    sizeof(VkDeviceGroupRenderPassBeginInfoKHX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO_KHX,
+    kVkDeviceGroupRenderPassBeginInfoKHXFields, 2};
+
+const Field kVkDeviceGroupCommandBufferBeginInfoKHXFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkDeviceGroupCommandBufferBeginInfoKHX, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkDeviceGroupCommandBufferBeginInfoKHXType = {
+    "VkDeviceGroupCommandBufferBeginInfoKHX",
+    sizeof(VkDeviceGroupCommandBufferBeginInfoKHX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO_KHX,
+    kVkDeviceGroupCommandBufferBeginInfoKHXFields, 1};
+
+const Field kVkDeviceGroupSubmitInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGroupSubmitInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pWaitSemaphoreDeviceIndices", kPointerField,
+     offsetof(VkDeviceGroupSubmitInfoKHX, pWaitSemaphoreDeviceIndices),
+     sizeof(uint32_t), nullptr, 0, &Count71},
+    {"pCommandBufferDeviceMasks", kPointerField,
+     offsetof(VkDeviceGroupSubmitInfoKHX, pCommandBufferDeviceMasks),
+     sizeof(uint32_t), nullptr, 0, &Count72},
+    {"pSignalSemaphoreDeviceIndices", kPointerField,
+     offsetof(VkDeviceGroupSubmitInfoKHX, pSignalSemaphoreDeviceIndices),
+     sizeof(uint32_t), nullptr, 0, &Count73},
+};
+const StructType kVkDeviceGroupSubmitInfoKHXType = {
+    "VkDeviceGroupSubmitInfoKHX", sizeof(VkDeviceGroupSubmitInfoKHX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO_KHX,
+    kVkDeviceGroupSubmitInfoKHXFields, 4};
+
+const Field kVkDeviceGroupBindSparseInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGroupBindSparseInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkDeviceGroupBindSparseInfoKHXType = {
+    "VkDeviceGroupBindSparseInfoKHX", sizeof(VkDeviceGroupBindSparseInfoKHX),
+    true, VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO_KHX,
+    kVkDeviceGroupBindSparseInfoKHXFields, 1};
+
+const Field kVkDeviceGroupPresentCapabilitiesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGroupPresentCapabilitiesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkDeviceGroupPresentCapabilitiesKHXType = {
+    "VkDeviceGroupPresentCapabilitiesKHX",
+    sizeof(VkDeviceGroupPresentCapabilitiesKHX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHX,
+    kVkDeviceGroupPresentCapabilitiesKHXFields, 1};
+
+const Field kVkImageSwapchainCreateInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkImageSwapchainCreateInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"swapchain", kHandleField,
+     offsetof(VkImageSwapchainCreateInfoKHX, swapchain), sizeof(VkSwapchainKHR),
+     nullptr, 26, nullptr},
+};
+const StructType kVkImageSwapchainCreateInfoKHXType = {
+    "VkImageSwapchainCreateInfoKHX", sizeof(VkImageSwapchainCreateInfoKHX),
+    true, VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHX,
+    kVkImageSwapchainCreateInfoKHXFields, 2};
+
+const Field kVkBindImageMemorySwapchainInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkBindImageMemorySwapchainInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"swapchain", kHandleField,
+     offsetof(VkBindImageMemorySwapchainInfoKHX, swapchain),
+     sizeof(VkSwapchainKHR), nullptr, 26, nullptr},
+};
+const StructType kVkBindImageMemorySwapchainInfoKHXType = {
+    "VkBindImageMemorySwapchainInfoKHX",
+    sizeof(VkBindImageMemorySwapchainInfoKHX), true,
+    VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHX,
+    kVkBindImageMemorySwapchainInfoKHXFields, 2};
+
+const Field kVkAcquireNextImageInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkAcquireNextImageInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"swapchain", kHandleField, offsetof(VkAcquireNextImageInfoKHX, swapchain),
+     sizeof(VkSwapchainKHR), nullptr, 26, nullptr},
+    {"semaphore", kHandleField, offsetof(VkAcquireNextImageInfoKHX, semaphore),
+     sizeof(VkSemaphore), nullptr, 4, nullptr},
+    {"fence", kHandleField, offsetof(VkAcquireNextImageInfoKHX, fence),
+     sizeof(VkFence), nullptr, 6, nullptr},
+};
+const StructType kVkAcquireNextImageInfoKHXType = {
+    "VkAcquireNextImageInfoKHX", sizeof(VkAcquireNextImageInfoKHX), true,
+    VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHX,
+    kVkAcquireNextImageInfoKHXFields, 4};
+
+const Field kVkDeviceGroupPresentInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGroupPresentInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pDeviceMasks", kPointerField,
+     offsetof(VkDeviceGroupPresentInfoKHX, pDeviceMasks), sizeof(uint32_t),
+     nullptr, 0, &Count74},
+};
+const StructType kVkDeviceGroupPresentInfoKHXType = {
+    "VkDeviceGroupPresentInfoKHX", sizeof(VkDeviceGroupPresentInfoKHX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHX,
+    kVkDeviceGroupPresentInfoKHXFields, 2};
+
+const Field kVkDeviceGroupSwapchainCreateInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGroupSwapchainCreateInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkDeviceGroupSwapchainCreateInfoKHXType = {
+    "VkDeviceGroupSwapchainCreateInfoKHX",
+    sizeof(VkDeviceGroupSwapchainCreateInfoKHX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHX,
+    kVkDeviceGroupSwapchainCreateInfoKHXFields, 1};
+
+const Field kVkValidationFlagsEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkValidationFlagsEXT, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pDisabledValidationChecks", kOutputField,
+     offsetof(VkValidationFlagsEXT, pDisabledValidationChecks),
+     sizeof(VkValidationCheckEXT), nullptr, 0, &Count75},
+};
+const StructType kVkValidationFlagsEXTType = {
+    "VkValidationFlagsEXT", sizeof(VkValidationFlagsEXT), true,
+    VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT, kVkValidationFlagsEXTFields, 2};
+
+#if defined(VK_USE_PLATFORM_VI_NN)
+const Field kVkViSurfaceCreateInfoNNFields[] = {
+    {"pNext", kNextField, offsetof(VkViSurfaceCreateInfoNN, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkViSurfaceCreateInfoNNType = {
+    "VkViSurfaceCreateInfoNN", sizeof(VkViSurfaceCreateInfoNN), true,
+    VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN, kVkViSurfaceCreateInfoNNFields,
+    1};
+#endif  // VK_USE_PLATFORM_VI_NN
+
+const Field kVkPhysicalDeviceGroupPropertiesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkPhysicalDeviceGroupPropertiesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"physicalDevices", kHandleField,
+     offsetof(VkPhysicalDeviceGroupPropertiesKHX, physicalDevices),
+     sizeof(VkPhysicalDevice), nullptr, 1, nullptr},
+};
+const StructType kVkPhysicalDeviceGroupPropertiesKHXType = {
+    "VkPhysicalDeviceGroupPropertiesKHX",
+    sizeof(VkPhysicalDeviceGroupPropertiesKHX), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES_KHX,
+    kVkPhysicalDeviceGroupPropertiesKHXFields, 2};
+
+const Field kVkDeviceGroupDeviceCreateInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGroupDeviceCreateInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pPhysicalDevices", kHandlePointerField,
+     offsetof(VkDeviceGroupDeviceCreateInfoKHX, pPhysicalDevices),
+     sizeof(VkPhysicalDevice), nullptr, 1, &Count76},
+};
+const StructType kVkDeviceGroupDeviceCreateInfoKHXType = {
+    "VkDeviceGroupDeviceCreateInfoKHX",
+    sizeof(VkDeviceGroupDeviceCreateInfoKHX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO_KHX,
+    kVkDeviceGroupDeviceCreateInfoKHXFields, 2};
+
+const Field kVkPhysicalDeviceExternalImageFormatInfoKHXFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPhysicalDeviceExternalImageFormatInfoKHX, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceExternalImageFormatInfoKHXType = {
+    "VkPhysicalDeviceExternalImageFormatInfoKHX",
+    sizeof(VkPhysicalDeviceExternalImageFormatInfoKHX), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO_KHX,
+    kVkPhysicalDeviceExternalImageFormatInfoKHXFields, 1};
+
+const Field kVkExternalImageFormatPropertiesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExternalImageFormatPropertiesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExternalImageFormatPropertiesKHXType = {
+    "VkExternalImageFormatPropertiesKHX",
+    sizeof(VkExternalImageFormatPropertiesKHX), true,
+    VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES_KHX,
+    kVkExternalImageFormatPropertiesKHXFields, 1};
+
+const Field kVkPhysicalDeviceExternalBufferInfoKHXFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPhysicalDeviceExternalBufferInfoKHX, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceExternalBufferInfoKHXType = {
+    "VkPhysicalDeviceExternalBufferInfoKHX",
+    sizeof(VkPhysicalDeviceExternalBufferInfoKHX), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO_KHX,
+    kVkPhysicalDeviceExternalBufferInfoKHXFields, 1};
+
+const Field kVkExternalBufferPropertiesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExternalBufferPropertiesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExternalBufferPropertiesKHXType = {
+    "VkExternalBufferPropertiesKHX", sizeof(VkExternalBufferPropertiesKHX),
+    true, VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES_KHX,
+    kVkExternalBufferPropertiesKHXFields, 1};
+
+const Field kVkPhysicalDeviceIDPropertiesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkPhysicalDeviceIDPropertiesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceIDPropertiesKHXType = {
+    "VkPhysicalDeviceIDPropertiesKHX", sizeof(VkPhysicalDeviceIDPropertiesKHX),
+    true, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES_KHX,
+    kVkPhysicalDeviceIDPropertiesKHXFields, 1};
+
+const Field kVkExternalMemoryImageCreateInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExternalMemoryImageCreateInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExternalMemoryImageCreateInfoKHXType = {
+    "VkExternalMemoryImageCreateInfoKHX",
+    sizeof(VkExternalMemoryImageCreateInfoKHX), true,
+    VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_KHX,
+    kVkExternalMemoryImageCreateInfoKHXFields, 1};
+
+const Field kVkExternalMemoryBufferCreateInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExternalMemoryBufferCreateInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExternalMemoryBufferCreateInfoKHXType = {
+    "VkExternalMemoryBufferCreateInfoKHX",
+    sizeof(VkExternalMemoryBufferCreateInfoKHX), true,
+    VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO_KHX,
+    kVkExternalMemoryBufferCreateInfoKHXFields, 1};
+
+const Field kVkExportMemoryAllocateInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExportMemoryAllocateInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExportMemoryAllocateInfoKHXType = {
+    "VkExportMemoryAllocateInfoKHX", sizeof(VkExportMemoryAllocateInfoKHX),
+    true, VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_KHX,
+    kVkExportMemoryAllocateInfoKHXFields, 1};
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkImportMemoryWin32HandleInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkImportMemoryWin32HandleInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkImportMemoryWin32HandleInfoKHXType = {
+    "VkImportMemoryWin32HandleInfoKHX",
+    sizeof(VkImportMemoryWin32HandleInfoKHX), true,
+    VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHX,
+    kVkImportMemoryWin32HandleInfoKHXFields, 1};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkExportMemoryWin32HandleInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExportMemoryWin32HandleInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExportMemoryWin32HandleInfoKHXType = {
+    "VkExportMemoryWin32HandleInfoKHX",
+    sizeof(VkExportMemoryWin32HandleInfoKHX), true,
+    VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHX,
+    kVkExportMemoryWin32HandleInfoKHXFields, 1};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkMemoryWin32HandlePropertiesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkMemoryWin32HandlePropertiesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkMemoryWin32HandlePropertiesKHXType = {
+    "VkMemoryWin32HandlePropertiesKHX",
+    sizeof(VkMemoryWin32HandlePropertiesKHX), true,
+    VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHX,
+    kVkMemoryWin32HandlePropertiesKHXFields, 1};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+const Field kVkImportMemoryFdInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkImportMemoryFdInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkImportMemoryFdInfoKHXType = {
+    "VkImportMemoryFdInfoKHX", sizeof(VkImportMemoryFdInfoKHX), true,
+    VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHX, kVkImportMemoryFdInfoKHXFields,
+    1};
+
+const Field kVkMemoryFdPropertiesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkMemoryFdPropertiesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkMemoryFdPropertiesKHXType = {
+    "VkMemoryFdPropertiesKHX", sizeof(VkMemoryFdPropertiesKHX), true,
+    VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHX, kVkMemoryFdPropertiesKHXFields,
+    1};
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+const Field kVkWin32KeyedMutexAcquireReleaseInfoKHXFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoKHX, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pAcquireSyncs", kHandlePointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoKHX, pAcquireSyncs),
+     sizeof(VkDeviceMemory), nullptr, 7, &Count77},
+    {"pAcquireKeys", kPointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoKHX, pAcquireKeys),
+     sizeof(uint64_t), nullptr, 0, &Count78},
+    {"pAcquireTimeouts", kPointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoKHX, pAcquireTimeouts),
+     sizeof(uint32_t), nullptr, 0, &Count79},
+    {"pReleaseSyncs", kHandlePointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoKHX, pReleaseSyncs),
+     sizeof(VkDeviceMemory), nullptr, 7, &Count80},
+    {"pReleaseKeys", kPointerField,
+     offsetof(VkWin32KeyedMutexAcquireReleaseInfoKHX, pReleaseKeys),
+     sizeof(uint64_t), nullptr, 0, &Count81},
+};
+const StructType kVkWin32KeyedMutexAcquireReleaseInfoKHXType = {
+    "VkWin32KeyedMutexAcquireReleaseInfoKHX",
+    sizeof(VkWin32KeyedMutexAcquireReleaseInfoKHX), true,
+    VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHX,
+    kVkWin32KeyedMutexAcquireReleaseInfoKHXFields, 6};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+const Field kVkPhysicalDeviceExternalSemaphoreInfoKHXFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPhysicalDeviceExternalSemaphoreInfoKHX, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceExternalSemaphoreInfoKHXType = {
+    "VkPhysicalDeviceExternalSemaphoreInfoKHX",
+    sizeof(VkPhysicalDeviceExternalSemaphoreInfoKHX), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO_KHX,
+    kVkPhysicalDeviceExternalSemaphoreInfoKHXFields, 1};
+
+const Field kVkExternalSemaphorePropertiesKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExternalSemaphorePropertiesKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExternalSemaphorePropertiesKHXType = {
+    "VkExternalSemaphorePropertiesKHX",
+    sizeof(VkExternalSemaphorePropertiesKHX), true,
+    VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES_KHX,
+    kVkExternalSemaphorePropertiesKHXFields, 1};
+
+const Field kVkExportSemaphoreCreateInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExportSemaphoreCreateInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExportSemaphoreCreateInfoKHXType = {
+    "VkExportSemaphoreCreateInfoKHX", sizeof(VkExportSemaphoreCreateInfoKHX),
+    true, VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO_KHX,
+    kVkExportSemaphoreCreateInfoKHXFields, 1};
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkImportSemaphoreWin32HandleInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkImportSemaphoreWin32HandleInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"semaphore", kHandleField,
+     offsetof(VkImportSemaphoreWin32HandleInfoKHX, semaphore),
+     sizeof(VkSemaphore), nullptr, 4, nullptr},
+};
+const StructType kVkImportSemaphoreWin32HandleInfoKHXType = {
+    "VkImportSemaphoreWin32HandleInfoKHX",
+    sizeof(VkImportSemaphoreWin32HandleInfoKHX), true,
+    VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHX,
+    kVkImportSemaphoreWin32HandleInfoKHXFields, 2};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkExportSemaphoreWin32HandleInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkExportSemaphoreWin32HandleInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkExportSemaphoreWin32HandleInfoKHXType = {
+    "VkExportSemaphoreWin32HandleInfoKHX",
+    sizeof(VkExportSemaphoreWin32HandleInfoKHX), true,
+    VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHX,
+    kVkExportSemaphoreWin32HandleInfoKHXFields, 1};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkD3D12FenceSubmitInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkD3D12FenceSubmitInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pWaitSemaphoreValues", kPointerField,
+     offsetof(VkD3D12FenceSubmitInfoKHX, pWaitSemaphoreValues),
+     sizeof(uint64_t), nullptr, 0, &Count82},
+    {"pSignalSemaphoreValues", kPointerField,
+     offsetof(VkD3D12FenceSubmitInfoKHX, pSignalSemaphoreValues),
+     sizeof(uint64_t), nullptr, 0, &Count83},
+};
+const StructType kVkD3D12FenceSubmitInfoKHXType = {
+    "VkD3D12FenceSubmitInfoKHX", sizeof(VkD3D12FenceSubmitInfoKHX), true,
+    VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHX,
+    kVkD3D12FenceSubmitInfoKHXFields, 3};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+const Field kVkImportSemaphoreFdInfoKHXFields[] = {
+    {"pNext", kNextField, offsetof(VkImportSemaphoreFdInfoKHX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"semaphore", kHandleField, offsetof(VkImportSemaphoreFdInfoKHX, semaphore),
+     sizeof(VkSemaphore), nullptr, 4, nullptr},
+};
+const StructType kVkImportSemaphoreFdInfoKHXType = {
+    "VkImportSemaphoreFdInfoKHX", sizeof(VkImportSemaphoreFdInfoKHX), true,
+    VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHX,
+    kVkImportSemaphoreFdInfoKHXFields, 2};
+
+const Field kVkDeviceGeneratedCommandsFeaturesNVXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGeneratedCommandsFeaturesNVX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkDeviceGeneratedCommandsFeaturesNVXType = {
+    "VkDeviceGeneratedCommandsFeaturesNVX",
+    sizeof(VkDeviceGeneratedCommandsFeaturesNVX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GENERATED_COMMANDS_FEATURES_NVX,
+    kVkDeviceGeneratedCommandsFeaturesNVXFields, 1};
+
+const Field kVkDeviceGeneratedCommandsLimitsNVXFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceGeneratedCommandsLimitsNVX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkDeviceGeneratedCommandsLimitsNVXType = {
+    "VkDeviceGeneratedCommandsLimitsNVX",
+    sizeof(VkDeviceGeneratedCommandsLimitsNVX), true,
+    VK_STRUCTURE_TYPE_DEVICE_GENERATED_COMMANDS_LIMITS_NVX,
+    kVkDeviceGeneratedCommandsLimitsNVXFields, 1};
+
+const Field kVkIndirectCommandsTokenNVXFields[] = {
+    {"buffer", kHandleField, offsetof(VkIndirectCommandsTokenNVX, buffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+};
+const StructType kVkIndirectCommandsTokenNVXType = {
+    "VkIndirectCommandsTokenNVX", sizeof(VkIndirectCommandsTokenNVX), false,
+    VkStructureType(0), kVkIndirectCommandsTokenNVXFields, 1};
+
+const Field kVkIndirectCommandsLayoutCreateInfoNVXFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkIndirectCommandsLayoutCreateInfoNVX, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pTokens", kPointerField,
+     offsetof(VkIndirectCommandsLayoutCreateInfoNVX, pTokens),
+     sizeof(VkIndirectCommandsLayoutTokenNVX), nullptr, 0, &Count84},
+};
+const StructType kVkIndirectCommandsLayoutCreateInfoNVXType = {
+    "VkIndirectCommandsLayoutCreateInfoNVX",
+    sizeof(VkIndirectCommandsLayoutCreateInfoNVX), true,
+    VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NVX,
+    kVkIndirectCommandsLayoutCreateInfoNVXFields, 2};
+
+const Field kVkCmdProcessCommandsInfoNVXFields[] = {
+    {"pNext", kNextField, offsetof(VkCmdProcessCommandsInfoNVX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"objectTable", kHandleField,
+     offsetof(VkCmdProcessCommandsInfoNVX, objectTable),
+     sizeof(VkObjectTableNVX), nullptr, 31, nullptr},
+    {"indirectCommandsLayout", kHandleField,
+     offsetof(VkCmdProcessCommandsInfoNVX, indirectCommandsLayout),
+     sizeof(VkIndirectCommandsLayoutNVX), nullptr, 32, nullptr},
+    {"pIndirectCommandsTokens", kPointerField,
+     offsetof(VkCmdProcessCommandsInfoNVX, pIndirectCommandsTokens),
+     sizeof(VkIndirectCommandsTokenNVX), &kVkIndirectCommandsTokenNVXType, 0,
+     &Count85},
+    {"targetCommandBuffer", kHandleField,
+     offsetof(VkCmdProcessCommandsInfoNVX, targetCommandBuffer),
+     sizeof(VkCommandBuffer), nullptr, 5, nullptr},
+    {"sequencesCountBuffer", kHandleField,
+     offsetof(VkCmdProcessCommandsInfoNVX, sequencesCountBuffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"sequencesIndexBuffer", kHandleField,
+     offsetof(VkCmdProcessCommandsInfoNVX, sequencesIndexBuffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+};
+const StructType kVkCmdProcessCommandsInfoNVXType = {
+    "VkCmdProcessCommandsInfoNVX", sizeof(VkCmdProcessCommandsInfoNVX), true,
+    VK_STRUCTURE_TYPE_CMD_PROCESS_COMMANDS_INFO_NVX,
+    kVkCmdProcessCommandsInfoNVXFields, 7};
+
+const Field kVkCmdReserveSpaceForCommandsInfoNVXFields[] = {
+    {"pNext", kNextField, offsetof(VkCmdReserveSpaceForCommandsInfoNVX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"objectTable", kHandleField,
+     offsetof(VkCmdReserveSpaceForCommandsInfoNVX, objectTable),
+     sizeof(VkObjectTableNVX), nullptr, 31, nullptr},
+    {"indirectCommandsLayout", kHandleField,
+     offsetof(VkCmdReserveSpaceForCommandsInfoNVX, indirectCommandsLayout),
+     sizeof(VkIndirectCommandsLayoutNVX), nullptr, 32, nullptr},
+};
+const StructType kVkCmdReserveSpaceForCommandsInfoNVXType = {
+    "VkCmdReserveSpaceForCommandsInfoNVX",
+    sizeof(VkCmdReserveSpaceForCommandsInfoNVX), true,
+    VK_STRUCTURE_TYPE_CMD_RESERVE_SPACE_FOR_COMMANDS_INFO_NVX,
+    kVkCmdReserveSpaceForCommandsInfoNVXFields, 3};
+
+const Field kVkObjectTableCreateInfoNVXFields[] = {
+    {"pNext", kNextField, offsetof(VkObjectTableCreateInfoNVX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pObjectEntryTypes", kPointerField,
+     offsetof(VkObjectTableCreateInfoNVX, pObjectEntryTypes),
+     sizeof(VkObjectEntryTypeNVX), nullptr, 0, &Count86},
+    {"pObjectEntryCounts", kPointerField,
+     offsetof(VkObjectTableCreateInfoNVX, pObjectEntryCounts), sizeof(uint32_t),
+     nullptr, 0, &Count87},
+    {"pObjectEntryUsageFlags", kPointerField,
+     offsetof(VkObjectTableCreateInfoNVX, pObjectEntryUsageFlags),
+     sizeof(VkObjectEntryUsageFlagsNVX), nullptr, 0, &Count88},
+};
+const StructType kVkObjectTableCreateInfoNVXType = {
+    "VkObjectTableCreateInfoNVX", sizeof(VkObjectTableCreateInfoNVX), true,
+    VK_STRUCTURE_TYPE_OBJECT_TABLE_CREATE_INFO_NVX,
+    kVkObjectTableCreateInfoNVXFields, 4};
+
+const Field kVkObjectTablePipelineEntryNVXFields[] = {
+    {"pipeline", kHandleField,
+     offsetof(VkObjectTablePipelineEntryNVX, pipeline), sizeof(VkPipeline),
+     nullptr, 18, nullptr},
+};
+const StructType kVkObjectTablePipelineEntryNVXType = {
+    "VkObjectTablePipelineEntryNVX", sizeof(VkObjectTablePipelineEntryNVX),
+    false, VkStructureType(0), kVkObjectTablePipelineEntryNVXFields, 1};
+
+const Field kVkObjectTableDescriptorSetEntryNVXFields[] = {
+    {"pipelineLayout", kHandleField,
+     offsetof(VkObjectTableDescriptorSetEntryNVX, pipelineLayout),
+     sizeof(VkPipelineLayout), nullptr, 16, nullptr},
+    {"descriptorSet", kHandleField,
+     offsetof(VkObjectTableDescriptorSetEntryNVX, descriptorSet),
+     sizeof(VkDescriptorSet), nullptr, 22, nullptr},
+};
+const StructType kVkObjectTableDescriptorSetEntryNVXType = {
+    "VkObjectTableDescriptorSetEntryNVX",
+    sizeof(VkObjectTableDescriptorSetEntryNVX), false, VkStructureType(0),
+    kVkObjectTableDescriptorSetEntryNVXFields, 2};
+
+const Field kVkObjectTableVertexBufferEntryNVXFields[] = {
+    {"buffer", kHandleField,
+     offsetof(VkObjectTableVertexBufferEntryNVX, buffer), sizeof(VkBuffer),
+     nullptr, 8, nullptr},
+};
+const StructType kVkObjectTableVertexBufferEntryNVXType = {
+    "VkObjectTableVertexBufferEntryNVX",
+    sizeof(VkObjectTableVertexBufferEntryNVX), false, VkStructureType(0),
+    kVkObjectTableVertexBufferEntryNVXFields, 1};
+
+const Field kVkObjectTableIndexBufferEntryNVXFields[] = {
+    {"buffer", kHandleField, offsetof(VkObjectTableIndexBufferEntryNVX, buffer),
+     sizeof(VkBuffer), nullptr, 8, nullptr},
+};
+const StructType kVkObjectTableIndexBufferEntryNVXType = {
+    "VkObjectTableIndexBufferEntryNVX",
+    sizeof(VkObjectTableIndexBufferEntryNVX), false, VkStructureType(0),
+    kVkObjectTableIndexBufferEntryNVXFields, 1};
+
+const Field kVkObjectTablePushConstantEntryNVXFields[] = {
+    {"pipelineLayout", kHandleField,
+     offsetof(VkObjectTablePushConstantEntryNVX, pipelineLayout),
+     sizeof(VkPipelineLayout), nullptr, 16, nullptr},
+};
+const StructType kVkObjectTablePushConstantEntryNVXType = {
+    "VkObjectTablePushConstantEntryNVX",
+    sizeof(VkObjectTablePushConstantEntryNVX), false, VkStructureType(0),
+    kVkObjectTablePushConstantEntryNVXFields, 1};
+
+const Field kVkPipelineViewportWScalingStateCreateInfoNVFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPipelineViewportWScalingStateCreateInfoNV, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pViewportWScalings", kPointerField,
+     offsetof(VkPipelineViewportWScalingStateCreateInfoNV, pViewportWScalings),
+     sizeof(VkViewportWScalingNV), nullptr, 0, &Count89},
+};
+const StructType kVkPipelineViewportWScalingStateCreateInfoNVType = {
+    "VkPipelineViewportWScalingStateCreateInfoNV",
+    sizeof(VkPipelineViewportWScalingStateCreateInfoNV), true,
+    VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV,
+    kVkPipelineViewportWScalingStateCreateInfoNVFields, 2};
+
+const Field kVkSurfaceCapabilities2EXTFields[] = {
+    {"pNext", kNextField, offsetof(VkSurfaceCapabilities2EXT, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkSurfaceCapabilities2EXTType = {
+    "VkSurfaceCapabilities2EXT", sizeof(VkSurfaceCapabilities2EXT), true,
+    VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES2_EXT,
+    kVkSurfaceCapabilities2EXTFields, 1};
+
+const Field kVkDisplayPowerInfoEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkDisplayPowerInfoEXT, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkDisplayPowerInfoEXTType = {
+    "VkDisplayPowerInfoEXT", sizeof(VkDisplayPowerInfoEXT), true,
+    VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT, kVkDisplayPowerInfoEXTFields, 1};
+
+const Field kVkDeviceEventInfoEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkDeviceEventInfoEXT, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkDeviceEventInfoEXTType = {
+    "VkDeviceEventInfoEXT", sizeof(VkDeviceEventInfoEXT), true,
+    VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT, kVkDeviceEventInfoEXTFields, 1};
+
+const Field kVkDisplayEventInfoEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkDisplayEventInfoEXT, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkDisplayEventInfoEXTType = {
+    "VkDisplayEventInfoEXT", sizeof(VkDisplayEventInfoEXT), true,
+    VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT, kVkDisplayEventInfoEXTFields, 1};
+
+const Field kVkSwapchainCounterCreateInfoEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkSwapchainCounterCreateInfoEXT, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkSwapchainCounterCreateInfoEXTType = {
+    "VkSwapchainCounterCreateInfoEXT", sizeof(VkSwapchainCounterCreateInfoEXT),
+    true, VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT,
+    kVkSwapchainCounterCreateInfoEXTFields, 1};
+
+const Field kVkPresentTimesInfoGOOGLEFields[] = {
+    {"pNext", kNextField, offsetof(VkPresentTimesInfoGOOGLE, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pTimes", kPointerField, offsetof(VkPresentTimesInfoGOOGLE, pTimes),
+     sizeof(VkPresentTimeGOOGLE), nullptr, 0, &Count90},
+};
+const StructType kVkPresentTimesInfoGOOGLEType = {
+    "VkPresentTimesInfoGOOGLE", sizeof(VkPresentTimesInfoGOOGLE), true,
+    VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE,
+    kVkPresentTimesInfoGOOGLEFields, 2};
+
+const Field kVkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVXFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVXType = {
+    "VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX",
+    sizeof(VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX,
+    kVkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVXFields, 1};
+
+const Field kVkPipelineViewportSwizzleStateCreateInfoNVFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPipelineViewportSwizzleStateCreateInfoNV, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+    {"pViewportSwizzles", kPointerField,
+     offsetof(VkPipelineViewportSwizzleStateCreateInfoNV, pViewportSwizzles),
+     sizeof(VkViewportSwizzleNV), nullptr, 0, &Count91},
+};
+const StructType kVkPipelineViewportSwizzleStateCreateInfoNVType = {
+    "VkPipelineViewportSwizzleStateCreateInfoNV",
+    sizeof(VkPipelineViewportSwizzleStateCreateInfoNV), true,
+    VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV,
+    kVkPipelineViewportSwizzleStateCreateInfoNVFields, 2};
+
+const Field kVkPhysicalDeviceDiscardRectanglePropertiesEXTFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPhysicalDeviceDiscardRectanglePropertiesEXT, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+};
+const StructType kVkPhysicalDeviceDiscardRectanglePropertiesEXTType = {
+    "VkPhysicalDeviceDiscardRectanglePropertiesEXT",
+    sizeof(VkPhysicalDeviceDiscardRectanglePropertiesEXT), true,
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT,
+    kVkPhysicalDeviceDiscardRectanglePropertiesEXTFields, 1};
+
+const Field kVkPipelineDiscardRectangleStateCreateInfoEXTFields[] = {
+    {"pNext", kNextField,
+     offsetof(VkPipelineDiscardRectangleStateCreateInfoEXT, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pDiscardRectangles", kPointerField,
+     offsetof(VkPipelineDiscardRectangleStateCreateInfoEXT, pDiscardRectangles),
+     sizeof(VkRect2D), nullptr, 0, &Count92},
+};
+const StructType kVkPipelineDiscardRectangleStateCreateInfoEXTType = {
+    "VkPipelineDiscardRectangleStateCreateInfoEXT",
+    sizeof(VkPipelineDiscardRectangleStateCreateInfoEXT), true,
+    VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT,
+    kVkPipelineDiscardRectangleStateCreateInfoEXTFields, 2};
+
+const Field kVkHdrMetadataEXTFields[] = {
+    {"pNext", kNextField, offsetof(VkHdrMetadataEXT, pNext), sizeof(void*),
+     nullptr, 0, nullptr},
+};
+const StructType kVkHdrMetadataEXTType = {
+    "VkHdrMetadataEXT", sizeof(VkHdrMetadataEXT), true,
+    VK_STRUCTURE_TYPE_HDR_METADATA_EXT, kVkHdrMetadataEXTFields, 1};
+
+#if defined(VK_USE_PLATFORM_IOS_MVK)
+const Field kVkIOSSurfaceCreateInfoMVKFields[] = {
+    {"pNext", kNextField, offsetof(VkIOSSurfaceCreateInfoMVK, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pView", kPointerField, offsetof(VkIOSSurfaceCreateInfoMVK, pView), 1,
+     nullptr, 0, nullptr},
+};
+const StructType kVkIOSSurfaceCreateInfoMVKType = {
+    "VkIOSSurfaceCreateInfoMVK", sizeof(VkIOSSurfaceCreateInfoMVK), true,
+    VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK,
+    kVkIOSSurfaceCreateInfoMVKFields, 2};
+#endif  // VK_USE_PLATFORM_IOS_MVK
+
+#if defined(VK_USE_PLATFORM_MACOS_MVK)
+const Field kVkMacOSSurfaceCreateInfoMVKFields[] = {
+    {"pNext", kNextField, offsetof(VkMacOSSurfaceCreateInfoMVK, pNext),
+     sizeof(void*), nullptr, 0, nullptr},
+    {"pView", kPointerField, offsetof(VkMacOSSurfaceCreateInfoMVK, pView), 1,
+     nullptr, 0, nullptr},
+};
+const StructType kVkMacOSSurfaceCreateInfoMVKType = {
+    "VkMacOSSurfaceCreateInfoMVK", sizeof(VkMacOSSurfaceCreateInfoMVK), true,
+    VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK,
+    kVkMacOSSurfaceCreateInfoMVKFields, 2};
+#endif  // VK_USE_PLATFORM_MACOS_MVK
+
+const Field kVkCreateInstanceParameters[] = {
+    {"pCreateInfo", kPointerField, 0, sizeof(VkInstanceCreateInfo),
+     &kVkInstanceCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 1, sizeof(void*), nullptr, 0, nullptr},
+    {"pInstance", kOutputHandleField, 2, sizeof(VkInstance), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkDestroyInstanceParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pAllocator", kIgnoredField, 1, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkEnumeratePhysicalDevicesParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pPhysicalDeviceCount", kInOutCountField, 1, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pPhysicalDevices", kOutputHandleField, 2, sizeof(VkPhysicalDevice),
+     nullptr, 1, &Count93},
+};
+
+const Field kVkGetPhysicalDeviceFeaturesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pFeatures", kOutputField, 1, sizeof(VkPhysicalDeviceFeatures), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkGetPhysicalDeviceFormatPropertiesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"format", kValueField, 1, sizeof(VkFormat), nullptr, 0, nullptr},
+    {"pFormatProperties", kOutputField, 2, sizeof(VkFormatProperties), nullptr,
+     0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceImageFormatPropertiesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"format", kValueField, 1, sizeof(VkFormat), nullptr, 0, nullptr},
+    {"type", kValueField, 2, sizeof(VkImageType), nullptr, 0, nullptr},
+    {"tiling", kValueField, 3, sizeof(VkImageTiling), nullptr, 0, nullptr},
+    {"usage", kValueField, 4, sizeof(VkImageUsageFlags), nullptr, 0, nullptr},
+    {"flags", kValueField, 5, sizeof(VkImageCreateFlags), nullptr, 0, nullptr},
+    {"pImageFormatProperties", kOutputField, 6, sizeof(VkImageFormatProperties),
+     nullptr, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDevicePropertiesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pProperties", kOutputField, 1, sizeof(VkPhysicalDeviceProperties),
+     nullptr, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceQueueFamilyPropertiesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pQueueFamilyPropertyCount", kInOutCountField, 1, sizeof(uint32_t),
+     nullptr, 0, nullptr},
+    {"pQueueFamilyProperties", kOutputField, 2, sizeof(VkQueueFamilyProperties),
+     nullptr, 0, &Count94},
+};
+
+const Field kVkGetPhysicalDeviceMemoryPropertiesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pMemoryProperties", kOutputField, 1,
+     sizeof(VkPhysicalDeviceMemoryProperties), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateDeviceParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkDeviceCreateInfo),
+     &kVkDeviceCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pDevice", kOutputHandleField, 3, sizeof(VkDevice), nullptr, 2, nullptr},
+};
+
+const Field kVkDestroyDeviceParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pAllocator", kIgnoredField, 1, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkEnumerateInstanceExtensionPropertiesParameters[] = {
+    {"pLayerName", kStringField, 0, 1, nullptr, 0, nullptr},
+    {"pPropertyCount", kInOutCountField, 1, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 2, sizeof(VkExtensionProperties), nullptr, 0,
+     &Count95},
+};
+
+const Field kVkEnumerateDeviceExtensionPropertiesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pLayerName", kStringField, 1, 1, nullptr, 0, nullptr},
+    {"pPropertyCount", kInOutCountField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 3, sizeof(VkExtensionProperties), nullptr, 0,
+     &Count96},
+};
+
+const Field kVkEnumerateInstanceLayerPropertiesParameters[] = {
+    {"pPropertyCount", kInOutCountField, 0, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 1, sizeof(VkLayerProperties), nullptr, 0,
+     &Count97},
+};
+
+const Field kVkEnumerateDeviceLayerPropertiesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pPropertyCount", kInOutCountField, 1, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 2, sizeof(VkLayerProperties), nullptr, 0,
+     &Count98},
+};
+
+const Field kVkGetDeviceQueueParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"queueFamilyIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"queueIndex", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pQueue", kOutputHandleField, 3, sizeof(VkQueue), nullptr, 3, nullptr},
+};
+
+const Field kVkQueueSubmitParameters[] = {
+    {"queue", kHandleField, 0, sizeof(VkQueue), nullptr, 3, nullptr},
+    {"submitCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pSubmits", kPointerField, 2, sizeof(VkSubmitInfo), &kVkSubmitInfoType, 0,
+     &Count99},
+    {"fence", kHandleField, 3, sizeof(VkFence), nullptr, 6, nullptr},
+};
+
+const Field kVkQueueWaitIdleParameters[] = {
+    {"queue", kHandleField, 0, sizeof(VkQueue), nullptr, 3, nullptr},
+};
+
+const Field kVkDeviceWaitIdleParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+};
+
+const Field kVkAllocateMemoryParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pAllocateInfo", kPointerField, 1, sizeof(VkMemoryAllocateInfo),
+     &kVkMemoryAllocateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pMemory", kOutputHandleField, 3, sizeof(VkDeviceMemory), nullptr, 7,
+     nullptr},
+};
+
+const Field kVkFreeMemoryParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memory", kHandleField, 1, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkMapMemoryParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memory", kHandleField, 1, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"offset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"size", kValueField, 3, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"flags", kValueField, 4, sizeof(VkMemoryMapFlags), nullptr, 0, nullptr},
+    {"ppData", kOutputField, 5, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkUnmapMemoryParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memory", kHandleField, 1, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+};
+
+const Field kVkFlushMappedMemoryRangesParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memoryRangeCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pMemoryRanges", kPointerField, 2, sizeof(VkMappedMemoryRange),
+     &kVkMappedMemoryRangeType, 0, &Count100},
+};
+
+const Field kVkInvalidateMappedMemoryRangesParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memoryRangeCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pMemoryRanges", kPointerField, 2, sizeof(VkMappedMemoryRange),
+     &kVkMappedMemoryRangeType, 0, &Count101},
+};
+
+const Field kVkGetDeviceMemoryCommitmentParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memory", kHandleField, 1, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"pCommittedMemoryInBytes", kOutputField, 2, sizeof(VkDeviceSize), nullptr,
+     0, nullptr},
+};
+
+const Field kVkBindBufferMemoryParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"memory", kHandleField, 2, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"memoryOffset", kValueField, 3, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+};
+
+const Field kVkBindImageMemoryParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"image", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"memory", kHandleField, 2, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"memoryOffset", kValueField, 3, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+};
+
+const Field kVkGetBufferMemoryRequirementsParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"pMemoryRequirements", kOutputField, 2, sizeof(VkMemoryRequirements),
+     nullptr, 0, nullptr},
+};
+
+const Field kVkGetImageMemoryRequirementsParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"image", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"pMemoryRequirements", kOutputField, 2, sizeof(VkMemoryRequirements),
+     nullptr, 0, nullptr},
+};
+
+const Field kVkGetImageSparseMemoryRequirementsParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"image", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"pSparseMemoryRequirementCount", kInOutCountField, 2, sizeof(uint32_t),
+     nullptr, 0, nullptr},
+    {"pSparseMemoryRequirements", kOutputField, 3,
+     sizeof(VkSparseImageMemoryRequirements), nullptr, 0, &Count102},
+};
+
+const Field kVkGetPhysicalDeviceSparseImageFormatPropertiesParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"format", kValueField, 1, sizeof(VkFormat), nullptr, 0, nullptr},
+    {"type", kValueField, 2, sizeof(VkImageType), nullptr, 0, nullptr},
+    {"samples", kValueField, 3, sizeof(VkSampleCountFlagBits), nullptr, 0,
+     nullptr},
+    {"usage", kValueField, 4, sizeof(VkImageUsageFlags), nullptr, 0, nullptr},
+    {"tiling", kValueField, 5, sizeof(VkImageTiling), nullptr, 0, nullptr},
+    {"pPropertyCount", kInOutCountField, 6, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 7, sizeof(VkSparseImageFormatProperties),
+     nullptr, 0, &Count103},
+};
+
+const Field kVkQueueBindSparseParameters[] = {
+    {"queue", kHandleField, 0, sizeof(VkQueue), nullptr, 3, nullptr},
+    {"bindInfoCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pBindInfo", kPointerField, 2, sizeof(VkBindSparseInfo),
+     &kVkBindSparseInfoType, 0, &Count104},
+    {"fence", kHandleField, 3, sizeof(VkFence), nullptr, 6, nullptr},
+};
+
+const Field kVkCreateFenceParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkFenceCreateInfo),
+     &kVkFenceCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pFence", kOutputHandleField, 3, sizeof(VkFence), nullptr, 6, nullptr},
+};
+
+const Field kVkDestroyFenceParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"fence", kHandleField, 1, sizeof(VkFence), nullptr, 6, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkResetFencesParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"fenceCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pFences", kHandlePointerField, 2, sizeof(VkFence), nullptr, 6, &Count105},
+};
+
+const Field kVkGetFenceStatusParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"fence", kHandleField, 1, sizeof(VkFence), nullptr, 6, nullptr},
+};
+
+const Field kVkWaitForFencesParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"fenceCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pFences", kHandlePointerField, 2, sizeof(VkFence), nullptr, 6, &Count106},
+    {"waitAll", kValueField, 3, sizeof(VkBool32), nullptr, 0, nullptr},
+    {"timeout", kValueField, 4, sizeof(uint64_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateSemaphoreParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkSemaphoreCreateInfo),
+     &kVkSemaphoreCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSemaphore", kOutputHandleField, 3, sizeof(VkSemaphore), nullptr, 4,
+     nullptr},
+};
+
+const Field kVkDestroySemaphoreParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"semaphore", kHandleField, 1, sizeof(VkSemaphore), nullptr, 4, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateEventParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkEventCreateInfo),
+     &kVkEventCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pEvent", kOutputHandleField, 3, sizeof(VkEvent), nullptr, 10, nullptr},
+};
+
+const Field kVkDestroyEventParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"event", kHandleField, 1, sizeof(VkEvent), nullptr, 10, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkGetEventStatusParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"event", kHandleField, 1, sizeof(VkEvent), nullptr, 10, nullptr},
+};
+
+const Field kVkSetEventParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"event", kHandleField, 1, sizeof(VkEvent), nullptr, 10, nullptr},
+};
+
+const Field kVkResetEventParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"event", kHandleField, 1, sizeof(VkEvent), nullptr, 10, nullptr},
+};
+
+const Field kVkCreateQueryPoolParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkQueryPoolCreateInfo),
+     &kVkQueryPoolCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pQueryPool", kOutputHandleField, 3, sizeof(VkQueryPool), nullptr, 11,
+     nullptr},
+};
+
+const Field kVkDestroyQueryPoolParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"queryPool", kHandleField, 1, sizeof(VkQueryPool), nullptr, 11, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkGetQueryPoolResultsParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"queryPool", kHandleField, 1, sizeof(VkQueryPool), nullptr, 11, nullptr},
+    {"firstQuery", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"queryCount", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"dataSize", kValueField, 4, sizeof(size_t), nullptr, 0, nullptr},
+    {"pData", kOutputField, 5, 1, nullptr, 0, &Count107},
+    {"stride", kValueField, 6, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"flags", kValueField, 7, sizeof(VkQueryResultFlags), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateBufferParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkBufferCreateInfo),
+     &kVkBufferCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pBuffer", kOutputHandleField, 3, sizeof(VkBuffer), nullptr, 8, nullptr},
+};
+
+const Field kVkDestroyBufferParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateBufferViewParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkBufferViewCreateInfo),
+     &kVkBufferViewCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pView", kOutputHandleField, 3, sizeof(VkBufferView), nullptr, 12,
+     nullptr},
+};
+
+const Field kVkDestroyBufferViewParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"bufferView", kHandleField, 1, sizeof(VkBufferView), nullptr, 12, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateImageParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkImageCreateInfo),
+     &kVkImageCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pImage", kOutputHandleField, 3, sizeof(VkImage), nullptr, 9, nullptr},
+};
+
+const Field kVkDestroyImageParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"image", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkGetImageSubresourceLayoutParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"image", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"pSubresource", kPointerField, 2, sizeof(VkImageSubresource), nullptr, 0,
+     nullptr},
+    {"pLayout", kOutputField, 3, sizeof(VkSubresourceLayout), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkCreateImageViewParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkImageViewCreateInfo),
+     &kVkImageViewCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pView", kOutputHandleField, 3, sizeof(VkImageView), nullptr, 13, nullptr},
+};
+
+const Field kVkDestroyImageViewParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"imageView", kHandleField, 1, sizeof(VkImageView), nullptr, 13, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateShaderModuleParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkShaderModuleCreateInfo),
+     &kVkShaderModuleCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pShaderModule", kOutputHandleField, 3, sizeof(VkShaderModule), nullptr,
+     14, nullptr},
+};
+
+const Field kVkDestroyShaderModuleParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"shaderModule", kHandleField, 1, sizeof(VkShaderModule), nullptr, 14,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreatePipelineCacheParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkPipelineCacheCreateInfo),
+     &kVkPipelineCacheCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pPipelineCache", kOutputHandleField, 3, sizeof(VkPipelineCache), nullptr,
+     15, nullptr},
+};
+
+const Field kVkDestroyPipelineCacheParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pipelineCache", kHandleField, 1, sizeof(VkPipelineCache), nullptr, 15,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkGetPipelineCacheDataParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pipelineCache", kHandleField, 1, sizeof(VkPipelineCache), nullptr, 15,
+     nullptr},
+    {"pDataSize", kInOutCountField, 2, sizeof(size_t), nullptr, 0, nullptr},
+    {"pData", kOutputField, 3, 1, nullptr, 0, &Count108},
+};
+
+const Field kVkMergePipelineCachesParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"dstCache", kHandleField, 1, sizeof(VkPipelineCache), nullptr, 15,
+     nullptr},
+    {"srcCacheCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pSrcCaches", kHandlePointerField, 3, sizeof(VkPipelineCache), nullptr, 15,
+     &Count109},
+};
+
+const Field kVkCreateGraphicsPipelinesParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pipelineCache", kHandleField, 1, sizeof(VkPipelineCache), nullptr, 15,
+     nullptr},
+    {"createInfoCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pCreateInfos", kPointerField, 3, sizeof(VkGraphicsPipelineCreateInfo),
+     &kVkGraphicsPipelineCreateInfoType, 0, &Count110},
+    {"pAllocator", kIgnoredField, 4, sizeof(void*), nullptr, 0, nullptr},
+    {"pPipelines", kOutputHandleField, 5, sizeof(VkPipeline), nullptr, 18,
+     &Count111},
+};
+
+const Field kVkCreateComputePipelinesParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pipelineCache", kHandleField, 1, sizeof(VkPipelineCache), nullptr, 15,
+     nullptr},
+    {"createInfoCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pCreateInfos", kPointerField, 3, sizeof(VkComputePipelineCreateInfo),
+     &kVkComputePipelineCreateInfoType, 0, &Count112},
+    {"pAllocator", kIgnoredField, 4, sizeof(void*), nullptr, 0, nullptr},
+    {"pPipelines", kOutputHandleField, 5, sizeof(VkPipeline), nullptr, 18,
+     &Count113},
+};
+
+const Field kVkDestroyPipelineParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pipeline", kHandleField, 1, sizeof(VkPipeline), nullptr, 18, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreatePipelineLayoutParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkPipelineLayoutCreateInfo),
+     &kVkPipelineLayoutCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pPipelineLayout", kOutputHandleField, 3, sizeof(VkPipelineLayout),
+     nullptr, 16, nullptr},
+};
+
+const Field kVkDestroyPipelineLayoutParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pipelineLayout", kHandleField, 1, sizeof(VkPipelineLayout), nullptr, 16,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateSamplerParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkSamplerCreateInfo),
+     &kVkSamplerCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSampler", kOutputHandleField, 3, sizeof(VkSampler), nullptr, 20,
+     nullptr},
+};
+
+const Field kVkDestroySamplerParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"sampler", kHandleField, 1, sizeof(VkSampler), nullptr, 20, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateDescriptorSetLayoutParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkDescriptorSetLayoutCreateInfo),
+     &kVkDescriptorSetLayoutCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSetLayout", kOutputHandleField, 3, sizeof(VkDescriptorSetLayout),
+     nullptr, 19, nullptr},
+};
+
+const Field kVkDestroyDescriptorSetLayoutParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"descriptorSetLayout", kHandleField, 1, sizeof(VkDescriptorSetLayout),
+     nullptr, 19, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateDescriptorPoolParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkDescriptorPoolCreateInfo),
+     &kVkDescriptorPoolCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pDescriptorPool", kOutputHandleField, 3, sizeof(VkDescriptorPool),
+     nullptr, 21, nullptr},
+};
+
+const Field kVkDestroyDescriptorPoolParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"descriptorPool", kHandleField, 1, sizeof(VkDescriptorPool), nullptr, 21,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkResetDescriptorPoolParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"descriptorPool", kHandleField, 1, sizeof(VkDescriptorPool), nullptr, 21,
+     nullptr},
+    {"flags", kValueField, 2, sizeof(VkDescriptorPoolResetFlags), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkAllocateDescriptorSetsParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pAllocateInfo", kPointerField, 1, sizeof(VkDescriptorSetAllocateInfo),
+     &kVkDescriptorSetAllocateInfoType, 0, nullptr},
+    {"pDescriptorSets", kOutputHandleField, 2, sizeof(VkDescriptorSet), nullptr,
+     22, &Count114},
+};
+
+const Field kVkFreeDescriptorSetsParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"descriptorPool", kHandleField, 1, sizeof(VkDescriptorPool), nullptr, 21,
+     nullptr},
+    {"descriptorSetCount", kValueField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pDescriptorSets", kHandlePointerField, 3, sizeof(VkDescriptorSet),
+     nullptr, 22, &Count115},
+};
+
+const Field kVkUpdateDescriptorSetsParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"descriptorWriteCount", kValueField, 1, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pDescriptorWrites", kPointerField, 2, sizeof(VkWriteDescriptorSet),
+     &kVkWriteDescriptorSetType, 0, &Count116},
+    {"descriptorCopyCount", kValueField, 3, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pDescriptorCopies", kPointerField, 4, sizeof(VkCopyDescriptorSet),
+     &kVkCopyDescriptorSetType, 0, &Count117},
+};
+
+const Field kVkCreateFramebufferParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkFramebufferCreateInfo),
+     &kVkFramebufferCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pFramebuffer", kOutputHandleField, 3, sizeof(VkFramebuffer), nullptr, 23,
+     nullptr},
+};
+
+const Field kVkDestroyFramebufferParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"framebuffer", kHandleField, 1, sizeof(VkFramebuffer), nullptr, 23,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateRenderPassParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkRenderPassCreateInfo),
+     &kVkRenderPassCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pRenderPass", kOutputHandleField, 3, sizeof(VkRenderPass), nullptr, 17,
+     nullptr},
+};
+
+const Field kVkDestroyRenderPassParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"renderPass", kHandleField, 1, sizeof(VkRenderPass), nullptr, 17, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkGetRenderAreaGranularityParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"renderPass", kHandleField, 1, sizeof(VkRenderPass), nullptr, 17, nullptr},
+    {"pGranularity", kOutputField, 2, sizeof(VkExtent2D), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateCommandPoolParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkCommandPoolCreateInfo),
+     &kVkCommandPoolCreateInfoType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pCommandPool", kOutputHandleField, 3, sizeof(VkCommandPool), nullptr, 24,
+     nullptr},
+};
+
+const Field kVkDestroyCommandPoolParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"commandPool", kHandleField, 1, sizeof(VkCommandPool), nullptr, 24,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkResetCommandPoolParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"commandPool", kHandleField, 1, sizeof(VkCommandPool), nullptr, 24,
+     nullptr},
+    {"flags", kValueField, 2, sizeof(VkCommandPoolResetFlags), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkAllocateCommandBuffersParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pAllocateInfo", kPointerField, 1, sizeof(VkCommandBufferAllocateInfo),
+     &kVkCommandBufferAllocateInfoType, 0, nullptr},
+    {"pCommandBuffers", kOutputHandleField, 2, sizeof(VkCommandBuffer), nullptr,
+     5, &Count118},
+};
+
+const Field kVkFreeCommandBuffersParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"commandPool", kHandleField, 1, sizeof(VkCommandPool), nullptr, 24,
+     nullptr},
+    {"commandBufferCount", kValueField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pCommandBuffers", kHandlePointerField, 3, sizeof(VkCommandBuffer),
+     nullptr, 5, &Count119},
+};
+
+const Field kVkBeginCommandBufferParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pBeginInfo", kPointerField, 1, sizeof(VkCommandBufferBeginInfo),
+     &kVkCommandBufferBeginInfoType, 0, nullptr},
+};
+
+const Field kVkEndCommandBufferParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+};
+
+const Field kVkResetCommandBufferParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"flags", kValueField, 1, sizeof(VkCommandBufferResetFlags), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkCmdBindPipelineParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pipelineBindPoint", kValueField, 1, sizeof(VkPipelineBindPoint), nullptr,
+     0, nullptr},
+    {"pipeline", kHandleField, 2, sizeof(VkPipeline), nullptr, 18, nullptr},
+};
+
+const Field kVkCmdSetViewportParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"firstViewport", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"viewportCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pViewports", kPointerField, 3, sizeof(VkViewport), nullptr, 0, &Count120},
+};
+
+const Field kVkCmdSetScissorParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"firstScissor", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"scissorCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pScissors", kPointerField, 3, sizeof(VkRect2D), nullptr, 0, &Count121},
+};
+
+const Field kVkCmdSetLineWidthParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"lineWidth", kValueField, 1, sizeof(float), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdSetDepthBiasParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"depthBiasConstantFactor", kValueField, 1, sizeof(float), nullptr, 0,
+     nullptr},
+    {"depthBiasClamp", kValueField, 2, sizeof(float), nullptr, 0, nullptr},
+    {"depthBiasSlopeFactor", kValueField, 3, sizeof(float), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkCmdSetBlendConstantsParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"blendConstants", kPointerField, 1, sizeof(float), nullptr, 0, &Count122},
+};
+
+const Field kVkCmdSetDepthBoundsParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"minDepthBounds", kValueField, 1, sizeof(float), nullptr, 0, nullptr},
+    {"maxDepthBounds", kValueField, 2, sizeof(float), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdSetStencilCompareMaskParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"faceMask", kValueField, 1, sizeof(VkStencilFaceFlags), nullptr, 0,
+     nullptr},
+    {"compareMask", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdSetStencilWriteMaskParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"faceMask", kValueField, 1, sizeof(VkStencilFaceFlags), nullptr, 0,
+     nullptr},
+    {"writeMask", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdSetStencilReferenceParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"faceMask", kValueField, 1, sizeof(VkStencilFaceFlags), nullptr, 0,
+     nullptr},
+    {"reference", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdBindDescriptorSetsParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pipelineBindPoint", kValueField, 1, sizeof(VkPipelineBindPoint), nullptr,
+     0, nullptr},
+    {"layout", kHandleField, 2, sizeof(VkPipelineLayout), nullptr, 16, nullptr},
+    {"firstSet", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"descriptorSetCount", kValueField, 4, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pDescriptorSets", kHandlePointerField, 5, sizeof(VkDescriptorSet),
+     nullptr, 22, &Count123},
+    {"dynamicOffsetCount", kValueField, 6, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pDynamicOffsets", kPointerField, 7, sizeof(uint32_t), nullptr, 0,
+     &Count124},
+};
+
+const Field kVkCmdBindIndexBufferParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"offset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"indexType", kValueField, 3, sizeof(VkIndexType), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdBindVertexBuffersParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"firstBinding", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"bindingCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pBuffers", kHandlePointerField, 3, sizeof(VkBuffer), nullptr, 8,
+     &Count125},
+    {"pOffsets", kPointerField, 4, sizeof(VkDeviceSize), nullptr, 0, &Count126},
+};
+
+const Field kVkCmdDrawParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"vertexCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"instanceCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"firstVertex", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"firstInstance", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdDrawIndexedParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"indexCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"instanceCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"firstIndex", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"vertexOffset", kValueField, 4, sizeof(int32_t), nullptr, 0, nullptr},
+    {"firstInstance", kValueField, 5, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdDrawIndirectParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"offset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"drawCount", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"stride", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdDrawIndexedIndirectParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"offset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"drawCount", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"stride", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdDispatchParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"groupCountX", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"groupCountY", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"groupCountZ", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdDispatchIndirectParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"offset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdCopyBufferParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"srcBuffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"dstBuffer", kHandleField, 2, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"regionCount", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRegions", kPointerField, 4, sizeof(VkBufferCopy), nullptr, 0, &Count127},
+};
+
+const Field kVkCmdCopyImageParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"srcImage", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"srcImageLayout", kValueField, 2, sizeof(VkImageLayout), nullptr, 0,
+     nullptr},
+    {"dstImage", kHandleField, 3, sizeof(VkImage), nullptr, 9, nullptr},
+    {"dstImageLayout", kValueField, 4, sizeof(VkImageLayout), nullptr, 0,
+     nullptr},
+    {"regionCount", kValueField, 5, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRegions", kPointerField, 6, sizeof(VkImageCopy), nullptr, 0, &Count128},
+};
+
+const Field kVkCmdBlitImageParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"srcImage", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"srcImageLayout", kValueField, 2, sizeof(VkImageLayout), nullptr, 0,
+     nullptr},
+    {"dstImage", kHandleField, 3, sizeof(VkImage), nullptr, 9, nullptr},
+    {"dstImageLayout", kValueField, 4, sizeof(VkImageLayout), nullptr, 0,
+     nullptr},
+    {"regionCount", kValueField, 5, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRegions", kPointerField, 6, sizeof(VkImageBlit), nullptr, 0, &Count129},
+    {"filter", kValueField, 7, sizeof(VkFilter), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdCopyBufferToImageParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"srcBuffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"dstImage", kHandleField, 2, sizeof(VkImage), nullptr, 9, nullptr},
+    {"dstImageLayout", kValueField, 3, sizeof(VkImageLayout), nullptr, 0,
+     nullptr},
+    {"regionCount", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRegions", kPointerField, 5, sizeof(VkBufferImageCopy), nullptr, 0,
+     &Count130},
+};
+
+const Field kVkCmdCopyImageToBufferParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"srcImage", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"srcImageLayout", kValueField, 2, sizeof(VkImageLayout), nullptr, 0,
+     nullptr},
+    {"dstBuffer", kHandleField, 3, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"regionCount", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRegions", kPointerField, 5, sizeof(VkBufferImageCopy), nullptr, 0,
+     &Count131},
+};
+
+const Field kVkCmdUpdateBufferParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"dstBuffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"dstOffset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"dataSize", kValueField, 3, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"pData", kPointerField, 4, 1, nullptr, 0, &Count132},
+};
+
+const Field kVkCmdFillBufferParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"dstBuffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"dstOffset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"size", kValueField, 3, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"data", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdClearColorImageParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"image", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"imageLayout", kValueField, 2, sizeof(VkImageLayout), nullptr, 0, nullptr},
+    {"pColor", kPointerField, 3, sizeof(VkClearColorValue), nullptr, 0,
+     nullptr},
+    {"rangeCount", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRanges", kPointerField, 5, sizeof(VkImageSubresourceRange), nullptr, 0,
+     &Count133},
+};
+
+const Field kVkCmdClearDepthStencilImageParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"image", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"imageLayout", kValueField, 2, sizeof(VkImageLayout), nullptr, 0, nullptr},
+    {"pDepthStencil", kPointerField, 3, sizeof(VkClearDepthStencilValue),
+     nullptr, 0, nullptr},
+    {"rangeCount", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRanges", kPointerField, 5, sizeof(VkImageSubresourceRange), nullptr, 0,
+     &Count134},
+};
+
+const Field kVkCmdClearAttachmentsParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"attachmentCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pAttachments", kPointerField, 2, sizeof(VkClearAttachment), nullptr, 0,
+     &Count135},
+    {"rectCount", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRects", kPointerField, 4, sizeof(VkClearRect), nullptr, 0, &Count136},
+};
+
+const Field kVkCmdResolveImageParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"srcImage", kHandleField, 1, sizeof(VkImage), nullptr, 9, nullptr},
+    {"srcImageLayout", kValueField, 2, sizeof(VkImageLayout), nullptr, 0,
+     nullptr},
+    {"dstImage", kHandleField, 3, sizeof(VkImage), nullptr, 9, nullptr},
+    {"dstImageLayout", kValueField, 4, sizeof(VkImageLayout), nullptr, 0,
+     nullptr},
+    {"regionCount", kValueField, 5, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRegions", kPointerField, 6, sizeof(VkImageResolve), nullptr, 0,
+     &Count137},
+};
+
+const Field kVkCmdSetEventParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"event", kHandleField, 1, sizeof(VkEvent), nullptr, 10, nullptr},
+    {"stageMask", kValueField, 2, sizeof(VkPipelineStageFlags), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkCmdResetEventParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"event", kHandleField, 1, sizeof(VkEvent), nullptr, 10, nullptr},
+    {"stageMask", kValueField, 2, sizeof(VkPipelineStageFlags), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkCmdWaitEventsParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"eventCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pEvents", kHandlePointerField, 2, sizeof(VkEvent), nullptr, 10,
+     &Count138},
+    {"srcStageMask", kValueField, 3, sizeof(VkPipelineStageFlags), nullptr, 0,
+     nullptr},
+    {"dstStageMask", kValueField, 4, sizeof(VkPipelineStageFlags), nullptr, 0,
+     nullptr},
+    {"memoryBarrierCount", kValueField, 5, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pMemoryBarriers", kPointerField, 6, sizeof(VkMemoryBarrier),
+     &kVkMemoryBarrierType, 0, &Count139},
+    {"bufferMemoryBarrierCount", kValueField, 7, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pBufferMemoryBarriers", kPointerField, 8, sizeof(VkBufferMemoryBarrier),
+     &kVkBufferMemoryBarrierType, 0, &Count140},
+    {"imageMemoryBarrierCount", kValueField, 9, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pImageMemoryBarriers", kPointerField, 10, sizeof(VkImageMemoryBarrier),
+     &kVkImageMemoryBarrierType, 0, &Count141},
+};
+
+const Field kVkCmdPipelineBarrierParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"srcStageMask", kValueField, 1, sizeof(VkPipelineStageFlags), nullptr, 0,
+     nullptr},
+    {"dstStageMask", kValueField, 2, sizeof(VkPipelineStageFlags), nullptr, 0,
+     nullptr},
+    {"dependencyFlags", kValueField, 3, sizeof(VkDependencyFlags), nullptr, 0,
+     nullptr},
+    {"memoryBarrierCount", kValueField, 4, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pMemoryBarriers", kPointerField, 5, sizeof(VkMemoryBarrier),
+     &kVkMemoryBarrierType, 0, &Count142},
+    {"bufferMemoryBarrierCount", kValueField, 6, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pBufferMemoryBarriers", kPointerField, 7, sizeof(VkBufferMemoryBarrier),
+     &kVkBufferMemoryBarrierType, 0, &Count143},
+    {"imageMemoryBarrierCount", kValueField, 8, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pImageMemoryBarriers", kPointerField, 9, sizeof(VkImageMemoryBarrier),
+     &kVkImageMemoryBarrierType, 0, &Count144},
+};
+
+const Field kVkCmdBeginQueryParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"queryPool", kHandleField, 1, sizeof(VkQueryPool), nullptr, 11, nullptr},
+    {"query", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"flags", kValueField, 3, sizeof(VkQueryControlFlags), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdEndQueryParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"queryPool", kHandleField, 1, sizeof(VkQueryPool), nullptr, 11, nullptr},
+    {"query", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdResetQueryPoolParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"queryPool", kHandleField, 1, sizeof(VkQueryPool), nullptr, 11, nullptr},
+    {"firstQuery", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"queryCount", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdWriteTimestampParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pipelineStage", kValueField, 1, sizeof(VkPipelineStageFlagBits), nullptr,
+     0, nullptr},
+    {"queryPool", kHandleField, 2, sizeof(VkQueryPool), nullptr, 11, nullptr},
+    {"query", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdCopyQueryPoolResultsParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"queryPool", kHandleField, 1, sizeof(VkQueryPool), nullptr, 11, nullptr},
+    {"firstQuery", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"queryCount", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"dstBuffer", kHandleField, 4, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"dstOffset", kValueField, 5, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"stride", kValueField, 6, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"flags", kValueField, 7, sizeof(VkQueryResultFlags), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdPushConstantsParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"layout", kHandleField, 1, sizeof(VkPipelineLayout), nullptr, 16, nullptr},
+    {"stageFlags", kValueField, 2, sizeof(VkShaderStageFlags), nullptr, 0,
+     nullptr},
+    {"offset", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"size", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pValues", kPointerField, 5, 1, nullptr, 0, &Count145},
+};
+
+const Field kVkCmdBeginRenderPassParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pRenderPassBegin", kPointerField, 1, sizeof(VkRenderPassBeginInfo),
+     &kVkRenderPassBeginInfoType, 0, nullptr},
+    {"contents", kValueField, 2, sizeof(VkSubpassContents), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkCmdNextSubpassParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"contents", kValueField, 1, sizeof(VkSubpassContents), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkCmdEndRenderPassParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+};
+
+const Field kVkCmdExecuteCommandsParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"commandBufferCount", kValueField, 1, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pCommandBuffers", kHandlePointerField, 2, sizeof(VkCommandBuffer),
+     nullptr, 5, &Count146},
+};
+
+const Field kVkDestroySurfaceKHRParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"surface", kHandleField, 1, sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceSurfaceSupportKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"queueFamilyIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"surface", kHandleField, 2, sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pSupported", kOutputField, 3, sizeof(VkBool32), nullptr, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceSurfaceCapabilitiesKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"surface", kHandleField, 1, sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pSurfaceCapabilities", kOutputField, 2, sizeof(VkSurfaceCapabilitiesKHR),
+     nullptr, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceSurfaceFormatsKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"surface", kHandleField, 1, sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pSurfaceFormatCount", kInOutCountField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pSurfaceFormats", kOutputField, 3, sizeof(VkSurfaceFormatKHR), nullptr, 0,
+     &Count147},
+};
+
+const Field kVkGetPhysicalDeviceSurfacePresentModesKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"surface", kHandleField, 1, sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pPresentModeCount", kInOutCountField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pPresentModes", kOutputField, 3, sizeof(VkPresentModeKHR), nullptr, 0,
+     &Count148},
+};
+
+const Field kVkCreateSwapchainKHRParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkSwapchainCreateInfoKHR),
+     &kVkSwapchainCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSwapchain", kOutputHandleField, 3, sizeof(VkSwapchainKHR), nullptr, 26,
+     nullptr},
+};
+
+const Field kVkDestroySwapchainKHRParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"swapchain", kHandleField, 1, sizeof(VkSwapchainKHR), nullptr, 26,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkGetSwapchainImagesKHRParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"swapchain", kHandleField, 1, sizeof(VkSwapchainKHR), nullptr, 26,
+     nullptr},
+    {"pSwapchainImageCount", kInOutCountField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pSwapchainImages", kOutputHandleField, 3, sizeof(VkImage), nullptr, 9,
+     &Count149},
+};
+
+const Field kVkAcquireNextImageKHRParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"swapchain", kHandleField, 1, sizeof(VkSwapchainKHR), nullptr, 26,
+     nullptr},
+    {"timeout", kValueField, 2, sizeof(uint64_t), nullptr, 0, nullptr},
+    {"semaphore", kHandleField, 3, sizeof(VkSemaphore), nullptr, 4, nullptr},
+    {"fence", kHandleField, 4, sizeof(VkFence), nullptr, 6, nullptr},
+    {"pImageIndex", kOutputField, 5, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkQueuePresentKHRParameters[] = {
+    {"queue", kHandleField, 0, sizeof(VkQueue), nullptr, 3, nullptr},
+    {"pPresentInfo", kPointerField, 1, sizeof(VkPresentInfoKHR),
+     &kVkPresentInfoKHRType, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceDisplayPropertiesKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pPropertyCount", kInOutCountField, 1, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 2, sizeof(VkDisplayPropertiesKHR), nullptr, 0,
+     &Count150},
+};
+
+const Field kVkGetPhysicalDeviceDisplayPlanePropertiesKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pPropertyCount", kInOutCountField, 1, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 2, sizeof(VkDisplayPlanePropertiesKHR),
+     nullptr, 0, &Count151},
+};
+
+const Field kVkGetDisplayPlaneSupportedDisplaysKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"planeIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pDisplayCount", kInOutCountField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pDisplays", kOutputHandleField, 3, sizeof(VkDisplayKHR), nullptr, 27,
+     &Count152},
+};
+
+const Field kVkGetDisplayModePropertiesKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"display", kHandleField, 1, sizeof(VkDisplayKHR), nullptr, 27, nullptr},
+    {"pPropertyCount", kInOutCountField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 3, sizeof(VkDisplayModePropertiesKHR),
+     nullptr, 0, &Count153},
+};
+
+const Field kVkCreateDisplayModeKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"display", kHandleField, 1, sizeof(VkDisplayKHR), nullptr, 27, nullptr},
+    {"pCreateInfo", kPointerField, 2, sizeof(VkDisplayModeCreateInfoKHR),
+     &kVkDisplayModeCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 3, sizeof(void*), nullptr, 0, nullptr},
+    {"pMode", kOutputHandleField, 4, sizeof(VkDisplayModeKHR), nullptr, 28,
+     nullptr},
+};
+
+const Field kVkGetDisplayPlaneCapabilitiesKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"mode", kHandleField, 1, sizeof(VkDisplayModeKHR), nullptr, 28, nullptr},
+    {"planeIndex", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pCapabilities", kOutputField, 3, sizeof(VkDisplayPlaneCapabilitiesKHR),
+     nullptr, 0, nullptr},
+};
+
+const Field kVkCreateDisplayPlaneSurfaceKHRParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkDisplaySurfaceCreateInfoKHR),
+     &kVkDisplaySurfaceCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+
+const Field kVkCreateSharedSwapchainsKHRParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"swapchainCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pCreateInfos", kPointerField, 2, sizeof(VkSwapchainCreateInfoKHR),
+     &kVkSwapchainCreateInfoKHRType, 0, &Count154},
+    {"pAllocator", kIgnoredField, 3, sizeof(void*), nullptr, 0, nullptr},
+    {"pSwapchains", kOutputHandleField, 4, sizeof(VkSwapchainKHR), nullptr, 26,
+     &Count155},
+};
+
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+const Field kVkCreateXlibSurfaceKHRParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkXlibSurfaceCreateInfoKHR),
+     &kVkXlibSurfaceCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+const Field kVkGetPhysicalDeviceXlibPresentationSupportKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"queueFamilyIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"dpy", kValueField, 2, sizeof(Display*), nullptr, 0, nullptr},
+    {"visualID", kValueField, 3, sizeof(VisualID), nullptr, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+const Field kVkCreateXcbSurfaceKHRParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkXcbSurfaceCreateInfoKHR),
+     &kVkXcbSurfaceCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_XCB_KHR
+
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+const Field kVkGetPhysicalDeviceXcbPresentationSupportKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"queueFamilyIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"connection", kValueField, 2, sizeof(xcb_connection_t*), nullptr, 0,
+     nullptr},
+    {"visual_id", kValueField, 3, sizeof(xcb_visualid_t), nullptr, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_XCB_KHR
+
+#if defined(VK_USE_PLATFORM_WAYLAND_KHR)
+const Field kVkCreateWaylandSurfaceKHRParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkWaylandSurfaceCreateInfoKHR),
+     &kVkWaylandSurfaceCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+
+#if defined(VK_USE_PLATFORM_WAYLAND_KHR)
+const Field kVkGetPhysicalDeviceWaylandPresentationSupportKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"queueFamilyIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"display", kValueField, 2, sizeof(struct wl_display*), nullptr, 0,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+
+#if defined(VK_USE_PLATFORM_MIR_KHR)
+const Field kVkCreateMirSurfaceKHRParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkMirSurfaceCreateInfoKHR),
+     &kVkMirSurfaceCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_MIR_KHR
+
+#if defined(VK_USE_PLATFORM_MIR_KHR)
+const Field kVkGetPhysicalDeviceMirPresentationSupportKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"queueFamilyIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"connection", kValueField, 2, sizeof(MirConnection*), nullptr, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_MIR_KHR
+
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+const Field kVkCreateAndroidSurfaceKHRParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkAndroidSurfaceCreateInfoKHR),
+     &kVkAndroidSurfaceCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+const Field kVkCreateWin32SurfaceKHRParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkWin32SurfaceCreateInfoKHR),
+     &kVkWin32SurfaceCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+const Field kVkGetPhysicalDeviceWin32PresentationSupportKHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"queueFamilyIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+const Field kVkGetPhysicalDeviceFeatures2KHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pFeatures", kOutputField, 1, sizeof(VkPhysicalDeviceFeatures2KHR),
+     &kVkPhysicalDeviceFeatures2KHRType, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceProperties2KHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pProperties", kOutputField, 1, sizeof(VkPhysicalDeviceProperties2KHR),
+     &kVkPhysicalDeviceProperties2KHRType, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceFormatProperties2KHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"format", kValueField, 1, sizeof(VkFormat), nullptr, 0, nullptr},
+    {"pFormatProperties", kOutputField, 2, sizeof(VkFormatProperties2KHR),
+     &kVkFormatProperties2KHRType, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceImageFormatProperties2KHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pImageFormatInfo", kPointerField, 1,
+     sizeof(VkPhysicalDeviceImageFormatInfo2KHR),
+     &kVkPhysicalDeviceImageFormatInfo2KHRType, 0, nullptr},
+    {"pImageFormatProperties", kOutputField, 2,
+     sizeof(VkImageFormatProperties2KHR), &kVkImageFormatProperties2KHRType, 0,
+     nullptr},
+};
+
+const Field kVkGetPhysicalDeviceQueueFamilyProperties2KHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pQueueFamilyPropertyCount", kInOutCountField, 1, sizeof(uint32_t),
+     nullptr, 0, nullptr},
+    {"pQueueFamilyProperties", kOutputField, 2,
+     sizeof(VkQueueFamilyProperties2KHR), &kVkQueueFamilyProperties2KHRType, 0,
+     &Count156},
+};
+
+const Field kVkGetPhysicalDeviceMemoryProperties2KHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pMemoryProperties", kOutputField, 1,
+     sizeof(VkPhysicalDeviceMemoryProperties2KHR),
+     &kVkPhysicalDeviceMemoryProperties2KHRType, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceSparseImageFormatProperties2KHRParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pFormatInfo", kPointerField, 1,
+     sizeof(VkPhysicalDeviceSparseImageFormatInfo2KHR),
+     &kVkPhysicalDeviceSparseImageFormatInfo2KHRType, 0, nullptr},
+    {"pPropertyCount", kInOutCountField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pProperties", kOutputField, 3, sizeof(VkSparseImageFormatProperties2KHR),
+     &kVkSparseImageFormatProperties2KHRType, 0, &Count157},
+};
+
+const Field kVkTrimCommandPoolKHRParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"commandPool", kHandleField, 1, sizeof(VkCommandPool), nullptr, 24,
+     nullptr},
+    {"flags", kValueField, 2, sizeof(VkCommandPoolTrimFlagsKHR), nullptr, 0,
+     nullptr},
+};
+
+const Field kVkCmdPushDescriptorSetKHRParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pipelineBindPoint", kValueField, 1, sizeof(VkPipelineBindPoint), nullptr,
+     0, nullptr},
+    {"layout", kHandleField, 2, sizeof(VkPipelineLayout), nullptr, 16, nullptr},
+    {"set", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"descriptorWriteCount", kValueField, 4, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pDescriptorWrites", kPointerField, 5, sizeof(VkWriteDescriptorSet),
+     &kVkWriteDescriptorSetType, 0, &Count158},
+};
+
+const Field kVkCreateDescriptorUpdateTemplateKHRParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1,
+     sizeof(VkDescriptorUpdateTemplateCreateInfoKHR),
+     &kVkDescriptorUpdateTemplateCreateInfoKHRType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pDescriptorUpdateTemplate", kOutputHandleField, 3,
+     sizeof(VkDescriptorUpdateTemplateKHR), nullptr, 29, nullptr},
+};
+
+const Field kVkDestroyDescriptorUpdateTemplateKHRParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"descriptorUpdateTemplate", kHandleField, 1,
+     sizeof(VkDescriptorUpdateTemplateKHR), nullptr, 29, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateDebugReportCallbackEXTParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1,
+     sizeof(VkDebugReportCallbackCreateInfoEXT),
+     &kVkDebugReportCallbackCreateInfoEXTType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pCallback", kOutputHandleField, 3, sizeof(VkDebugReportCallbackEXT),
+     nullptr, 30, nullptr},
+};
+
+const Field kVkDestroyDebugReportCallbackEXTParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"callback", kHandleField, 1, sizeof(VkDebugReportCallbackEXT), nullptr, 30,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkDebugReportMessageEXTParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"flags", kValueField, 1, sizeof(VkDebugReportFlagsEXT), nullptr, 0,
+     nullptr},
+    {"objectType", kValueField, 2, sizeof(VkDebugReportObjectTypeEXT), nullptr,
+     0, nullptr},
+    {"object", kValueField, 3, sizeof(uint64_t), nullptr, 0, nullptr},
+    {"location", kValueField, 4, sizeof(size_t), nullptr, 0, nullptr},
+    {"messageCode", kValueField, 5, sizeof(int32_t), nullptr, 0, nullptr},
+    {"pLayerPrefix", kStringField, 6, 1, nullptr, 0, nullptr},
+    {"pMessage", kStringField, 7, 1, nullptr, 0, nullptr},
+};
+
+const Field kVkDebugMarkerSetObjectTagEXTParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pTagInfo", kOutputField, 1, sizeof(VkDebugMarkerObjectTagInfoEXT),
+     &kVkDebugMarkerObjectTagInfoEXTType, 0, nullptr},
+};
+
+const Field kVkDebugMarkerSetObjectNameEXTParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pNameInfo", kOutputField, 1, sizeof(VkDebugMarkerObjectNameInfoEXT),
+     &kVkDebugMarkerObjectNameInfoEXTType, 0, nullptr},
+};
+
+const Field kVkCmdDebugMarkerBeginEXTParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pMarkerInfo", kOutputField, 1, sizeof(VkDebugMarkerMarkerInfoEXT),
+     &kVkDebugMarkerMarkerInfoEXTType, 0, nullptr},
+};
+
+const Field kVkCmdDebugMarkerEndEXTParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+};
+
+const Field kVkCmdDebugMarkerInsertEXTParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pMarkerInfo", kOutputField, 1, sizeof(VkDebugMarkerMarkerInfoEXT),
+     &kVkDebugMarkerMarkerInfoEXTType, 0, nullptr},
+};
+
+const Field kVkCmdDrawIndirectCountAMDParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"offset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"countBuffer", kHandleField, 3, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"countBufferOffset", kValueField, 4, sizeof(VkDeviceSize), nullptr, 0,
+     nullptr},
+    {"maxDrawCount", kValueField, 5, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"stride", kValueField, 6, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdDrawIndexedIndirectCountAMDParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"buffer", kHandleField, 1, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"offset", kValueField, 2, sizeof(VkDeviceSize), nullptr, 0, nullptr},
+    {"countBuffer", kHandleField, 3, sizeof(VkBuffer), nullptr, 8, nullptr},
+    {"countBufferOffset", kValueField, 4, sizeof(VkDeviceSize), nullptr, 0,
+     nullptr},
+    {"maxDrawCount", kValueField, 5, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"stride", kValueField, 6, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceExternalImageFormatPropertiesNVParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"format", kValueField, 1, sizeof(VkFormat), nullptr, 0, nullptr},
+    {"type", kValueField, 2, sizeof(VkImageType), nullptr, 0, nullptr},
+    {"tiling", kValueField, 3, sizeof(VkImageTiling), nullptr, 0, nullptr},
+    {"usage", kValueField, 4, sizeof(VkImageUsageFlags), nullptr, 0, nullptr},
+    {"flags", kValueField, 5, sizeof(VkImageCreateFlags), nullptr, 0, nullptr},
+    {"externalHandleType", kValueField, 6,
+     sizeof(VkExternalMemoryHandleTypeFlagsNV), nullptr, 0, nullptr},
+    {"pExternalImageFormatProperties", kOutputField, 7,
+     sizeof(VkExternalImageFormatPropertiesNV), nullptr, 0, nullptr},
+};
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+const Field kVkGetMemoryWin32HandleNVParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memory", kHandleField, 1, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"handleType", kValueField, 2, sizeof(VkExternalMemoryHandleTypeFlagsNV),
+     nullptr, 0, nullptr},
+    {"pHandle", kOutputField, 3, sizeof(HANDLE), nullptr, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+const Field kVkGetDeviceGroupPeerMemoryFeaturesKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"heapIndex", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"localDeviceIndex", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"remoteDeviceIndex", kValueField, 3, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pPeerMemoryFeatures", kOutputField, 4,
+     sizeof(VkPeerMemoryFeatureFlagsKHX), nullptr, 0, nullptr},
+};
+
+const Field kVkBindBufferMemory2KHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"bindInfoCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pBindInfos", kPointerField, 2, sizeof(VkBindBufferMemoryInfoKHX),
+     &kVkBindBufferMemoryInfoKHXType, 0, &Count159},
+};
+
+const Field kVkBindImageMemory2KHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"bindInfoCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pBindInfos", kPointerField, 2, sizeof(VkBindImageMemoryInfoKHX),
+     &kVkBindImageMemoryInfoKHXType, 0, &Count160},
+};
+
+const Field kVkCmdSetDeviceMaskKHXParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"deviceMask", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkGetDeviceGroupPresentCapabilitiesKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pDeviceGroupPresentCapabilities", kOutputField, 1,
+     sizeof(VkDeviceGroupPresentCapabilitiesKHX),
+     &kVkDeviceGroupPresentCapabilitiesKHXType, 0, nullptr},
+};
+
+const Field kVkGetDeviceGroupSurfacePresentModesKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"surface", kHandleField, 1, sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pModes", kOutputField, 2, sizeof(VkDeviceGroupPresentModeFlagsKHX),
+     nullptr, 0, nullptr},
+};
+
+const Field kVkAcquireNextImage2KHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pAcquireInfo", kPointerField, 1, sizeof(VkAcquireNextImageInfoKHX),
+     &kVkAcquireNextImageInfoKHXType, 0, nullptr},
+    {"pImageIndex", kOutputField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdDispatchBaseKHXParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"baseGroupX", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"baseGroupY", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"baseGroupZ", kValueField, 3, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"groupCountX", kValueField, 4, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"groupCountY", kValueField, 5, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"groupCountZ", kValueField, 6, sizeof(uint32_t), nullptr, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDevicePresentRectanglesKHXParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"surface", kHandleField, 1, sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pRectCount", kInOutCountField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pRects", kOutputField, 3, sizeof(VkRect2D), nullptr, 0, &Count161},
+};
+
+#if defined(VK_USE_PLATFORM_VI_NN)
+const Field kVkCreateViSurfaceNNParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkViSurfaceCreateInfoNN),
+     &kVkViSurfaceCreateInfoNNType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_VI_NN
+
+const Field kVkEnumeratePhysicalDeviceGroupsKHXParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pPhysicalDeviceGroupCount", kInOutCountField, 1, sizeof(uint32_t),
+     nullptr, 0, nullptr},
+    {"pPhysicalDeviceGroupProperties", kOutputField, 2,
+     sizeof(VkPhysicalDeviceGroupPropertiesKHX),
+     &kVkPhysicalDeviceGroupPropertiesKHXType, 0, &Count162},
+};
+
+const Field kVkGetPhysicalDeviceExternalBufferPropertiesKHXParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pExternalBufferInfo", kPointerField, 1,
+     sizeof(VkPhysicalDeviceExternalBufferInfoKHX),
+     &kVkPhysicalDeviceExternalBufferInfoKHXType, 0, nullptr},
+    {"pExternalBufferProperties", kOutputField, 2,
+     sizeof(VkExternalBufferPropertiesKHX), &kVkExternalBufferPropertiesKHXType,
+     0, nullptr},
+};
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkGetMemoryWin32HandleKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memory", kHandleField, 1, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"handleType", kValueField, 2,
+     sizeof(VkExternalMemoryHandleTypeFlagBitsKHX), nullptr, 0, nullptr},
+    {"pHandle", kOutputField, 3, sizeof(HANDLE), nullptr, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkGetMemoryWin32HandlePropertiesKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"handleType", kValueField, 1,
+     sizeof(VkExternalMemoryHandleTypeFlagBitsKHX), nullptr, 0, nullptr},
+    {"handle", kValueField, 2, sizeof(HANDLE), nullptr, 0, nullptr},
+    {"pMemoryWin32HandleProperties", kOutputField, 3,
+     sizeof(VkMemoryWin32HandlePropertiesKHX),
+     &kVkMemoryWin32HandlePropertiesKHXType, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+const Field kVkGetMemoryFdKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"memory", kHandleField, 1, sizeof(VkDeviceMemory), nullptr, 7, nullptr},
+    {"handleType", kValueField, 2,
+     sizeof(VkExternalMemoryHandleTypeFlagBitsKHX), nullptr, 0, nullptr},
+    {"pFd", kOutputField, 3, sizeof(int), nullptr, 0, nullptr},
+};
+
+const Field kVkGetMemoryFdPropertiesKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"handleType", kValueField, 1,
+     sizeof(VkExternalMemoryHandleTypeFlagBitsKHX), nullptr, 0, nullptr},
+    {"fd", kValueField, 2, sizeof(int), nullptr, 0, nullptr},
+    {"pMemoryFdProperties", kOutputField, 3, sizeof(VkMemoryFdPropertiesKHX),
+     &kVkMemoryFdPropertiesKHXType, 0, nullptr},
+};
+
+const Field kVkGetPhysicalDeviceExternalSemaphorePropertiesKHXParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pExternalSemaphoreInfo", kPointerField, 1,
+     sizeof(VkPhysicalDeviceExternalSemaphoreInfoKHX),
+     &kVkPhysicalDeviceExternalSemaphoreInfoKHXType, 0, nullptr},
+    {"pExternalSemaphoreProperties", kOutputField, 2,
+     sizeof(VkExternalSemaphorePropertiesKHX),
+     &kVkExternalSemaphorePropertiesKHXType, 0, nullptr},
+};
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkImportSemaphoreWin32HandleKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pImportSemaphoreWin32HandleInfo", kPointerField, 1,
+     sizeof(VkImportSemaphoreWin32HandleInfoKHX),
+     &kVkImportSemaphoreWin32HandleInfoKHXType, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+const Field kVkGetSemaphoreWin32HandleKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"semaphore", kHandleField, 1, sizeof(VkSemaphore), nullptr, 4, nullptr},
+    {"handleType", kValueField, 2,
+     sizeof(VkExternalSemaphoreHandleTypeFlagBitsKHX), nullptr, 0, nullptr},
+    {"pHandle", kOutputField, 3, sizeof(HANDLE), nullptr, 0, nullptr},
+};
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+const Field kVkImportSemaphoreFdKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pImportSemaphoreFdInfo", kPointerField, 1,
+     sizeof(VkImportSemaphoreFdInfoKHX), &kVkImportSemaphoreFdInfoKHXType, 0,
+     nullptr},
+};
+
+const Field kVkGetSemaphoreFdKHXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"semaphore", kHandleField, 1, sizeof(VkSemaphore), nullptr, 4, nullptr},
+    {"handleType", kValueField, 2,
+     sizeof(VkExternalSemaphoreHandleTypeFlagBitsKHX), nullptr, 0, nullptr},
+    {"pFd", kOutputField, 3, sizeof(int), nullptr, 0, nullptr},
+};
+
+const Field kVkCmdProcessCommandsNVXParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pProcessCommandsInfo", kPointerField, 1,
+     sizeof(VkCmdProcessCommandsInfoNVX), &kVkCmdProcessCommandsInfoNVXType, 0,
+     nullptr},
+};
+
+const Field kVkCmdReserveSpaceForCommandsNVXParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"pReserveSpaceInfo", kPointerField, 1,
+     sizeof(VkCmdReserveSpaceForCommandsInfoNVX),
+     &kVkCmdReserveSpaceForCommandsInfoNVXType, 0, nullptr},
+};
+
+const Field kVkCreateIndirectCommandsLayoutNVXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1,
+     sizeof(VkIndirectCommandsLayoutCreateInfoNVX),
+     &kVkIndirectCommandsLayoutCreateInfoNVXType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pIndirectCommandsLayout", kOutputHandleField, 3,
+     sizeof(VkIndirectCommandsLayoutNVX), nullptr, 32, nullptr},
+};
+
+const Field kVkDestroyIndirectCommandsLayoutNVXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"indirectCommandsLayout", kHandleField, 1,
+     sizeof(VkIndirectCommandsLayoutNVX), nullptr, 32, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkCreateObjectTableNVXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkObjectTableCreateInfoNVX),
+     &kVkObjectTableCreateInfoNVXType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pObjectTable", kOutputHandleField, 3, sizeof(VkObjectTableNVX), nullptr,
+     31, nullptr},
+};
+
+const Field kVkDestroyObjectTableNVXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"objectTable", kHandleField, 1, sizeof(VkObjectTableNVX), nullptr, 31,
+     nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+};
+
+const Field kVkUnregisterObjectsNVXParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"objectTable", kHandleField, 1, sizeof(VkObjectTableNVX), nullptr, 31,
+     nullptr},
+    {"objectCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pObjectEntryTypes", kPointerField, 3, sizeof(VkObjectEntryTypeNVX),
+     nullptr, 0, &Count163},
+    {"pObjectIndices", kPointerField, 4, sizeof(uint32_t), nullptr, 0,
+     &Count164},
+};
+
+const Field kVkGetPhysicalDeviceGeneratedCommandsPropertiesNVXParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"pFeatures", kOutputField, 1, sizeof(VkDeviceGeneratedCommandsFeaturesNVX),
+     &kVkDeviceGeneratedCommandsFeaturesNVXType, 0, nullptr},
+    {"pLimits", kOutputField, 2, sizeof(VkDeviceGeneratedCommandsLimitsNVX),
+     &kVkDeviceGeneratedCommandsLimitsNVXType, 0, nullptr},
+};
+
+const Field kVkCmdSetViewportWScalingNVParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"firstViewport", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"viewportCount", kValueField, 2, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pViewportWScalings", kPointerField, 3, sizeof(VkViewportWScalingNV),
+     nullptr, 0, &Count165},
+};
+
+const Field kVkReleaseDisplayEXTParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"display", kHandleField, 1, sizeof(VkDisplayKHR), nullptr, 27, nullptr},
+};
+
+#if defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)
+const Field kVkAcquireXlibDisplayEXTParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"dpy", kValueField, 1, sizeof(Display*), nullptr, 0, nullptr},
+    {"display", kHandleField, 2, sizeof(VkDisplayKHR), nullptr, 27, nullptr},
+};
+#endif  // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+
+#if defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)
+const Field kVkGetRandROutputDisplayEXTParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"dpy", kValueField, 1, sizeof(Display*), nullptr, 0, nullptr},
+    {"rrOutput", kValueField, 2, sizeof(RROutput), nullptr, 0, nullptr},
+    {"pDisplay", kOutputHandleField, 3, sizeof(VkDisplayKHR), nullptr, 27,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+
+const Field kVkGetPhysicalDeviceSurfaceCapabilities2EXTParameters[] = {
+    {"physicalDevice", kHandleField, 0, sizeof(VkPhysicalDevice), nullptr, 1,
+     nullptr},
+    {"surface", kHandleField, 1, sizeof(VkSurfaceKHR), nullptr, 25, nullptr},
+    {"pSurfaceCapabilities", kOutputField, 2, sizeof(VkSurfaceCapabilities2EXT),
+     &kVkSurfaceCapabilities2EXTType, 0, nullptr},
+};
+
+const Field kVkDisplayPowerControlEXTParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"display", kHandleField, 1, sizeof(VkDisplayKHR), nullptr, 27, nullptr},
+    {"pDisplayPowerInfo", kPointerField, 2, sizeof(VkDisplayPowerInfoEXT),
+     &kVkDisplayPowerInfoEXTType, 0, nullptr},
+};
+
+const Field kVkRegisterDeviceEventEXTParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"pDeviceEventInfo", kPointerField, 1, sizeof(VkDeviceEventInfoEXT),
+     &kVkDeviceEventInfoEXTType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pFence", kOutputHandleField, 3, sizeof(VkFence), nullptr, 6, nullptr},
+};
+
+const Field kVkRegisterDisplayEventEXTParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"display", kHandleField, 1, sizeof(VkDisplayKHR), nullptr, 27, nullptr},
+    {"pDisplayEventInfo", kPointerField, 2, sizeof(VkDisplayEventInfoEXT),
+     &kVkDisplayEventInfoEXTType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 3, sizeof(void*), nullptr, 0, nullptr},
+    {"pFence", kOutputHandleField, 4, sizeof(VkFence), nullptr, 6, nullptr},
+};
+
+const Field kVkGetSwapchainCounterEXTParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"swapchain", kHandleField, 1, sizeof(VkSwapchainKHR), nullptr, 26,
+     nullptr},
+    {"counter", kValueField, 2, sizeof(VkSurfaceCounterFlagBitsEXT), nullptr, 0,
+     nullptr},
+    {"pCounterValue", kOutputField, 3, sizeof(uint64_t), nullptr, 0, nullptr},
+};
+
+const Field kVkGetRefreshCycleDurationGOOGLEParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"swapchain", kHandleField, 1, sizeof(VkSwapchainKHR), nullptr, 26,
+     nullptr},
+    {"pDisplayTimingProperties", kOutputField, 2,
+     sizeof(VkRefreshCycleDurationGOOGLE), nullptr, 0, nullptr},
+};
+
+const Field kVkGetPastPresentationTimingGOOGLEParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"swapchain", kHandleField, 1, sizeof(VkSwapchainKHR), nullptr, 26,
+     nullptr},
+    {"pPresentationTimingCount", kInOutCountField, 2, sizeof(uint32_t), nullptr,
+     0, nullptr},
+    {"pPresentationTimings", kOutputField, 3,
+     sizeof(VkPastPresentationTimingGOOGLE), nullptr, 0, &Count166},
+};
+
+const Field kVkCmdSetDiscardRectangleEXTParameters[] = {
+    {"commandBuffer", kHandleField, 0, sizeof(VkCommandBuffer), nullptr, 5,
+     nullptr},
+    {"firstDiscardRectangle", kValueField, 1, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"discardRectangleCount", kValueField, 2, sizeof(uint32_t), nullptr, 0,
+     nullptr},
+    {"pDiscardRectangles", kPointerField, 3, sizeof(VkRect2D), nullptr, 0,
+     &Count167},
+};
+
+const Field kVkSetHdrMetadataEXTParameters[] = {
+    {"device", kHandleField, 0, sizeof(VkDevice), nullptr, 2, nullptr},
+    {"swapchainCount", kValueField, 1, sizeof(uint32_t), nullptr, 0, nullptr},
+    {"pSwapchains", kHandlePointerField, 2, sizeof(VkSwapchainKHR), nullptr, 26,
+     &Count168},
+    {"pMetadata", kPointerField, 3, sizeof(VkHdrMetadataEXT),
+     &kVkHdrMetadataEXTType, 0, nullptr},
+};
+
+#if defined(VK_USE_PLATFORM_IOS_MVK)
+const Field kVkCreateIOSSurfaceMVKParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkIOSSurfaceCreateInfoMVK),
+     &kVkIOSSurfaceCreateInfoMVKType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_IOS_MVK
+
+#if defined(VK_USE_PLATFORM_MACOS_MVK)
+const Field kVkCreateMacOSSurfaceMVKParameters[] = {
+    {"instance", kHandleField, 0, sizeof(VkInstance), nullptr, 0, nullptr},
+    {"pCreateInfo", kPointerField, 1, sizeof(VkMacOSSurfaceCreateInfoMVK),
+     &kVkMacOSSurfaceCreateInfoMVKType, 0, nullptr},
+    {"pAllocator", kIgnoredField, 2, sizeof(void*), nullptr, 0, nullptr},
+    {"pSurface", kOutputHandleField, 3, sizeof(VkSurfaceKHR), nullptr, 25,
+     nullptr},
+};
+#endif  // VK_USE_PLATFORM_MACOS_MVK
+
+// These are sorted by name, for FindFunctionType.
+const FunctionType kFunctionTypes[] = {
+    {"vkAcquireNextImage2KHX", kVkAcquireNextImage2KHXParameters, 3,
+     sizeof(VkResult), true},
+    {"vkAcquireNextImageKHR", kVkAcquireNextImageKHRParameters, 6,
+     sizeof(VkResult), true},
+#if defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)
+    {"vkAcquireXlibDisplayEXT", kVkAcquireXlibDisplayEXTParameters, 3,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkAllocateCommandBuffers", kVkAllocateCommandBuffersParameters, 3,
+     sizeof(VkResult), true},
+    {"vkAllocateDescriptorSets", kVkAllocateDescriptorSetsParameters, 3,
+     sizeof(VkResult), true},
+    {"vkAllocateMemory", kVkAllocateMemoryParameters, 4, sizeof(VkResult),
+     true},
+    {"vkBeginCommandBuffer", kVkBeginCommandBufferParameters, 2,
+     sizeof(VkResult), true},
+    {"vkBindBufferMemory", kVkBindBufferMemoryParameters, 4, sizeof(VkResult),
+     true},
+    {"vkBindBufferMemory2KHX", kVkBindBufferMemory2KHXParameters, 3,
+     sizeof(VkResult), true},
+    {"vkBindImageMemory", kVkBindImageMemoryParameters, 4, sizeof(VkResult),
+     true},
+    {"vkBindImageMemory2KHX", kVkBindImageMemory2KHXParameters, 3,
+     sizeof(VkResult), true},
+    {"vkCmdBeginQuery", kVkCmdBeginQueryParameters, 4, 0, true},
+    {"vkCmdBeginRenderPass", kVkCmdBeginRenderPassParameters, 3, 0, true},
+    {"vkCmdBindDescriptorSets", kVkCmdBindDescriptorSetsParameters, 8, 0, true},
+    {"vkCmdBindIndexBuffer", kVkCmdBindIndexBufferParameters, 4, 0, true},
+    {"vkCmdBindPipeline", kVkCmdBindPipelineParameters, 3, 0, true},
+    {"vkCmdBindVertexBuffers", kVkCmdBindVertexBuffersParameters, 5, 0, true},
+    {"vkCmdBlitImage", kVkCmdBlitImageParameters, 8, 0, true},
+    {"vkCmdClearAttachments", kVkCmdClearAttachmentsParameters, 5, 0, true},
+    {"vkCmdClearColorImage", kVkCmdClearColorImageParameters, 6, 0, true},
+    {"vkCmdClearDepthStencilImage", kVkCmdClearDepthStencilImageParameters, 6,
+     0, true},
+    {"vkCmdCopyBuffer", kVkCmdCopyBufferParameters, 5, 0, true},
+    {"vkCmdCopyBufferToImage", kVkCmdCopyBufferToImageParameters, 6, 0, true},
+    {"vkCmdCopyImage", kVkCmdCopyImageParameters, 7, 0, true},
+    {"vkCmdCopyImageToBuffer", kVkCmdCopyImageToBufferParameters, 6, 0, true},
+    {"vkCmdCopyQueryPoolResults", kVkCmdCopyQueryPoolResultsParameters, 8, 0,
+     true},
+    {"vkCmdDebugMarkerBeginEXT", kVkCmdDebugMarkerBeginEXTParameters, 2, 0,
+     true},
+    {"vkCmdDebugMarkerEndEXT", kVkCmdDebugMarkerEndEXTParameters, 1, 0, true},
+    {"vkCmdDebugMarkerInsertEXT", kVkCmdDebugMarkerInsertEXTParameters, 2, 0,
+     true},
+    {"vkCmdDispatch", kVkCmdDispatchParameters, 4, 0, true},
+    {"vkCmdDispatchBaseKHX", kVkCmdDispatchBaseKHXParameters, 7, 0, true},
+    {"vkCmdDispatchIndirect", kVkCmdDispatchIndirectParameters, 3, 0, true},
+    {"vkCmdDraw", kVkCmdDrawParameters, 5, 0, true},
+    {"vkCmdDrawIndexed", kVkCmdDrawIndexedParameters, 6, 0, true},
+    {"vkCmdDrawIndexedIndirect", kVkCmdDrawIndexedIndirectParameters, 5, 0,
+     true},
+    {"vkCmdDrawIndexedIndirectCountAMD",
+     kVkCmdDrawIndexedIndirectCountAMDParameters, 7, 0, true},
+    {"vkCmdDrawIndirect", kVkCmdDrawIndirectParameters, 5, 0, true},
+    {"vkCmdDrawIndirectCountAMD", kVkCmdDrawIndirectCountAMDParameters, 7, 0,
+     true},
+    {"vkCmdEndQuery", kVkCmdEndQueryParameters, 3, 0, true},
+    {"vkCmdEndRenderPass", kVkCmdEndRenderPassParameters, 1, 0, true},
+    {"vkCmdExecuteCommands", kVkCmdExecuteCommandsParameters, 3, 0, true},
+    {"vkCmdFillBuffer", kVkCmdFillBufferParameters, 5, 0, true},
+    {"vkCmdNextSubpass", kVkCmdNextSubpassParameters, 2, 0, true},
+    {"vkCmdPipelineBarrier", kVkCmdPipelineBarrierParameters, 10, 0, true},
+    {"vkCmdProcessCommandsNVX", kVkCmdProcessCommandsNVXParameters, 2, 0, true},
+    {"vkCmdPushConstants", kVkCmdPushConstantsParameters, 6, 0, true},
+    {"vkCmdPushDescriptorSetKHR", kVkCmdPushDescriptorSetKHRParameters, 6, 0,
+     true},
+    {"vkCmdPushDescriptorSetWithTemplateKHR", nullptr, 0, 0, false},
+    {"vkCmdReserveSpaceForCommandsNVX",
+     kVkCmdReserveSpaceForCommandsNVXParameters, 2, 0, true},
+    {"vkCmdResetEvent", kVkCmdResetEventParameters, 3, 0, true},
+    {"vkCmdResetQueryPool", kVkCmdResetQueryPoolParameters, 4, 0, true},
+    {"vkCmdResolveImage", kVkCmdResolveImageParameters, 7, 0, true},
+    {"vkCmdSetBlendConstants", kVkCmdSetBlendConstantsParameters, 2, 0, true},
+    {"vkCmdSetDepthBias", kVkCmdSetDepthBiasParameters, 4, 0, true},
+    {"vkCmdSetDepthBounds", kVkCmdSetDepthBoundsParameters, 3, 0, true},
+    {"vkCmdSetDeviceMaskKHX", kVkCmdSetDeviceMaskKHXParameters, 2, 0, true},
+    {"vkCmdSetDiscardRectangleEXT", kVkCmdSetDiscardRectangleEXTParameters, 4,
+     0, true},
+    {"vkCmdSetEvent", kVkCmdSetEventParameters, 3, 0, true},
+    {"vkCmdSetLineWidth", kVkCmdSetLineWidthParameters, 2, 0, true},
+    {"vkCmdSetScissor", kVkCmdSetScissorParameters, 4, 0, true},
+    {"vkCmdSetStencilCompareMask", kVkCmdSetStencilCompareMaskParameters, 3, 0,
+     true},
+    {"vkCmdSetStencilReference", kVkCmdSetStencilReferenceParameters, 3, 0,
+     true},
+    {"vkCmdSetStencilWriteMask", kVkCmdSetStencilWriteMaskParameters, 3, 0,
+     true},
+    {"vkCmdSetViewport", kVkCmdSetViewportParameters, 4, 0, true},
+    {"vkCmdSetViewportWScalingNV", kVkCmdSetViewportWScalingNVParameters, 4, 0,
+     true},
+    {"vkCmdUpdateBuffer", kVkCmdUpdateBufferParameters, 5, 0, true},
+    {"vkCmdWaitEvents", kVkCmdWaitEventsParameters, 11, 0, true},
+    {"vkCmdWriteTimestamp", kVkCmdWriteTimestampParameters, 4, 0, true},
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    {"vkCreateAndroidSurfaceKHR", kVkCreateAndroidSurfaceKHRParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+    {"vkCreateBuffer", kVkCreateBufferParameters, 4, sizeof(VkResult), true},
+    {"vkCreateBufferView", kVkCreateBufferViewParameters, 4, sizeof(VkResult),
+     true},
+    {"vkCreateCommandPool", kVkCreateCommandPoolParameters, 4, sizeof(VkResult),
+     true},
+    {"vkCreateComputePipelines", kVkCreateComputePipelinesParameters, 6,
+     sizeof(VkResult), true},
+    {"vkCreateDebugReportCallbackEXT",
+     kVkCreateDebugReportCallbackEXTParameters, 4, sizeof(VkResult), true},
+    {"vkCreateDescriptorPool", kVkCreateDescriptorPoolParameters, 4,
+     sizeof(VkResult), true},
+    {"vkCreateDescriptorSetLayout", kVkCreateDescriptorSetLayoutParameters, 4,
+     sizeof(VkResult), true},
+    {"vkCreateDescriptorUpdateTemplateKHR",
+     kVkCreateDescriptorUpdateTemplateKHRParameters, 4, sizeof(VkResult), true},
+    {"vkCreateDevice", kVkCreateDeviceParameters, 4, sizeof(VkResult), true},
+    {"vkCreateDisplayModeKHR", kVkCreateDisplayModeKHRParameters, 5,
+     sizeof(VkResult), true},
+    {"vkCreateDisplayPlaneSurfaceKHR",
+     kVkCreateDisplayPlaneSurfaceKHRParameters, 4, sizeof(VkResult), true},
+    {"vkCreateEvent", kVkCreateEventParameters, 4, sizeof(VkResult), true},
+    {"vkCreateFence", kVkCreateFenceParameters, 4, sizeof(VkResult), true},
+    {"vkCreateFramebuffer", kVkCreateFramebufferParameters, 4, sizeof(VkResult),
+     true},
+    {"vkCreateGraphicsPipelines", kVkCreateGraphicsPipelinesParameters, 6,
+     sizeof(VkResult), true},
+#if defined(VK_USE_PLATFORM_IOS_MVK)
+    {"vkCreateIOSSurfaceMVK", kVkCreateIOSSurfaceMVKParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_IOS_MVK
+    {"vkCreateImage", kVkCreateImageParameters, 4, sizeof(VkResult), true},
+    {"vkCreateImageView", kVkCreateImageViewParameters, 4, sizeof(VkResult),
+     true},
+    {"vkCreateIndirectCommandsLayoutNVX",
+     kVkCreateIndirectCommandsLayoutNVXParameters, 4, sizeof(VkResult), true},
+    {"vkCreateInstance", kVkCreateInstanceParameters, 3, sizeof(VkResult),
+     true},
+#if defined(VK_USE_PLATFORM_MACOS_MVK)
+    {"vkCreateMacOSSurfaceMVK", kVkCreateMacOSSurfaceMVKParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_MACOS_MVK
+#if defined(VK_USE_PLATFORM_MIR_KHR)
+    {"vkCreateMirSurfaceKHR", kVkCreateMirSurfaceKHRParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_MIR_KHR
+    {"vkCreateObjectTableNVX", kVkCreateObjectTableNVXParameters, 4,
+     sizeof(VkResult), true},
+    {"vkCreatePipelineCache", kVkCreatePipelineCacheParameters, 4,
+     sizeof(VkResult), true},
+    {"vkCreatePipelineLayout", kVkCreatePipelineLayoutParameters, 4,
+     sizeof(VkResult), true},
+    {"vkCreateQueryPool", kVkCreateQueryPoolParameters, 4, sizeof(VkResult),
+     true},
+    {"vkCreateRenderPass", kVkCreateRenderPassParameters, 4, sizeof(VkResult),
+     true},
+    {"vkCreateSampler", kVkCreateSamplerParameters, 4, sizeof(VkResult), true},
+    {"vkCreateSemaphore", kVkCreateSemaphoreParameters, 4, sizeof(VkResult),
+     true},
+    {"vkCreateShaderModule", kVkCreateShaderModuleParameters, 4,
+     sizeof(VkResult), true},
+    {"vkCreateSharedSwapchainsKHR", kVkCreateSharedSwapchainsKHRParameters, 5,
+     sizeof(VkResult), true},
+    {"vkCreateSwapchainKHR", kVkCreateSwapchainKHRParameters, 4,
+     sizeof(VkResult), true},
+#if defined(VK_USE_PLATFORM_VI_NN)
+    {"vkCreateViSurfaceNN", kVkCreateViSurfaceNNParameters, 4, sizeof(VkResult),
+     true},
+#endif  // VK_USE_PLATFORM_VI_NN
+#if defined(VK_USE_PLATFORM_WAYLAND_KHR)
+    {"vkCreateWaylandSurfaceKHR", kVkCreateWaylandSurfaceKHRParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkCreateWin32SurfaceKHR", kVkCreateWin32SurfaceKHRParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+    {"vkCreateXcbSurfaceKHR", kVkCreateXcbSurfaceKHRParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_XCB_KHR
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+    {"vkCreateXlibSurfaceKHR", kVkCreateXlibSurfaceKHRParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+    {"vkDebugMarkerSetObjectNameEXT", kVkDebugMarkerSetObjectNameEXTParameters,
+     2, sizeof(VkResult), true},
+    {"vkDebugMarkerSetObjectTagEXT", kVkDebugMarkerSetObjectTagEXTParameters, 2,
+     sizeof(VkResult), true},
+    {"vkDebugReportMessageEXT", kVkDebugReportMessageEXTParameters, 8, 0, true},
+    {"vkDestroyBuffer", kVkDestroyBufferParameters, 3, 0, true},
+    {"vkDestroyBufferView", kVkDestroyBufferViewParameters, 3, 0, true},
+    {"vkDestroyCommandPool", kVkDestroyCommandPoolParameters, 3, 0, true},
+    {"vkDestroyDebugReportCallbackEXT",
+     kVkDestroyDebugReportCallbackEXTParameters, 3, 0, true},
+    {"vkDestroyDescriptorPool", kVkDestroyDescriptorPoolParameters, 3, 0, true},
+    {"vkDestroyDescriptorSetLayout", kVkDestroyDescriptorSetLayoutParameters, 3,
+     0, true},
+    {"vkDestroyDescriptorUpdateTemplateKHR",
+     kVkDestroyDescriptorUpdateTemplateKHRParameters, 3, 0, true},
+    {"vkDestroyDevice", kVkDestroyDeviceParameters, 2, 0, true},
+    {"vkDestroyEvent", kVkDestroyEventParameters, 3, 0, true},
+    {"vkDestroyFence", kVkDestroyFenceParameters, 3, 0, true},
+    {"vkDestroyFramebuffer", kVkDestroyFramebufferParameters, 3, 0, true},
+    {"vkDestroyImage", kVkDestroyImageParameters, 3, 0, true},
+    {"vkDestroyImageView", kVkDestroyImageViewParameters, 3, 0, true},
+    {"vkDestroyIndirectCommandsLayoutNVX",
+     kVkDestroyIndirectCommandsLayoutNVXParameters, 3, 0, true},
+    {"vkDestroyInstance", kVkDestroyInstanceParameters, 2, 0, true},
+    {"vkDestroyObjectTableNVX", kVkDestroyObjectTableNVXParameters, 3, 0, true},
+    {"vkDestroyPipeline", kVkDestroyPipelineParameters, 3, 0, true},
+    {"vkDestroyPipelineCache", kVkDestroyPipelineCacheParameters, 3, 0, true},
+    {"vkDestroyPipelineLayout", kVkDestroyPipelineLayoutParameters, 3, 0, true},
+    {"vkDestroyQueryPool", kVkDestroyQueryPoolParameters, 3, 0, true},
+    {"vkDestroyRenderPass", kVkDestroyRenderPassParameters, 3, 0, true},
+    {"vkDestroySampler", kVkDestroySamplerParameters, 3, 0, true},
+    {"vkDestroySemaphore", kVkDestroySemaphoreParameters, 3, 0, true},
+    {"vkDestroyShaderModule", kVkDestroyShaderModuleParameters, 3, 0, true},
+    {"vkDestroySurfaceKHR", kVkDestroySurfaceKHRParameters, 3, 0, true},
+    {"vkDestroySwapchainKHR", kVkDestroySwapchainKHRParameters, 3, 0, true},
+    {"vkDeviceWaitIdle", kVkDeviceWaitIdleParameters, 1, sizeof(VkResult),
+     true},
+    {"vkDisplayPowerControlEXT", kVkDisplayPowerControlEXTParameters, 3,
+     sizeof(VkResult), true},
+    {"vkEndCommandBuffer", kVkEndCommandBufferParameters, 1, sizeof(VkResult),
+     true},
+    {"vkEnumerateDeviceExtensionProperties",
+     kVkEnumerateDeviceExtensionPropertiesParameters, 4, sizeof(VkResult),
+     true},
+    {"vkEnumerateDeviceLayerProperties",
+     kVkEnumerateDeviceLayerPropertiesParameters, 3, sizeof(VkResult), true},
+    {"vkEnumerateInstanceExtensionProperties",
+     kVkEnumerateInstanceExtensionPropertiesParameters, 3, sizeof(VkResult),
+     true},
+    {"vkEnumerateInstanceLayerProperties",
+     kVkEnumerateInstanceLayerPropertiesParameters, 2, sizeof(VkResult), true},
+    {"vkEnumeratePhysicalDeviceGroupsKHX",
+     kVkEnumeratePhysicalDeviceGroupsKHXParameters, 3, sizeof(VkResult), true},
+    {"vkEnumeratePhysicalDevices", kVkEnumeratePhysicalDevicesParameters, 3,
+     sizeof(VkResult), true},
+    {"vkFlushMappedMemoryRanges", kVkFlushMappedMemoryRangesParameters, 3,
+     sizeof(VkResult), true},
+    {"vkFreeCommandBuffers", kVkFreeCommandBuffersParameters, 4, 0, true},
+    {"vkFreeDescriptorSets", kVkFreeDescriptorSetsParameters, 4,
+     sizeof(VkResult), true},
+    {"vkFreeMemory", kVkFreeMemoryParameters, 3, 0, true},
+    {"vkGetBufferMemoryRequirements", kVkGetBufferMemoryRequirementsParameters,
+     3, 0, true},
+    {"vkGetDeviceGroupPeerMemoryFeaturesKHX",
+     kVkGetDeviceGroupPeerMemoryFeaturesKHXParameters, 5, 0, true},
+    {"vkGetDeviceGroupPresentCapabilitiesKHX",
+     kVkGetDeviceGroupPresentCapabilitiesKHXParameters, 2, sizeof(VkResult),
+     true},
+    {"vkGetDeviceGroupSurfacePresentModesKHX",
+     kVkGetDeviceGroupSurfacePresentModesKHXParameters, 3, sizeof(VkResult),
+     true},
+    {"vkGetDeviceMemoryCommitment", kVkGetDeviceMemoryCommitmentParameters, 3,
+     0, true},
+    {"vkGetDeviceQueue", kVkGetDeviceQueueParameters, 4, 0, true},
+    {"vkGetDisplayModePropertiesKHR", kVkGetDisplayModePropertiesKHRParameters,
+     4, sizeof(VkResult), true},
+    {"vkGetDisplayPlaneCapabilitiesKHR",
+     kVkGetDisplayPlaneCapabilitiesKHRParameters, 4, sizeof(VkResult), true},
+    {"vkGetDisplayPlaneSupportedDisplaysKHR",
+     kVkGetDisplayPlaneSupportedDisplaysKHRParameters, 4, sizeof(VkResult),
+     true},
+    {"vkGetEventStatus", kVkGetEventStatusParameters, 2, sizeof(VkResult),
+     true},
+    {"vkGetFenceStatus", kVkGetFenceStatusParameters, 2, sizeof(VkResult),
+     true},
+    {"vkGetImageMemoryRequirements", kVkGetImageMemoryRequirementsParameters, 3,
+     0, true},
+    {"vkGetImageSparseMemoryRequirements",
+     kVkGetImageSparseMemoryRequirementsParameters, 4, 0, true},
+    {"vkGetImageSubresourceLayout", kVkGetImageSubresourceLayoutParameters, 4,
+     0, true},
+    {"vkGetMemoryFdKHX", kVkGetMemoryFdKHXParameters, 4, sizeof(VkResult),
+     true},
+    {"vkGetMemoryFdPropertiesKHX", kVkGetMemoryFdPropertiesKHXParameters, 4,
+     sizeof(VkResult), true},
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    {"vkGetMemoryWin32HandleKHX", kVkGetMemoryWin32HandleKHXParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkGetMemoryWin32HandleNV", kVkGetMemoryWin32HandleNVParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    {"vkGetMemoryWin32HandlePropertiesKHX",
+     kVkGetMemoryWin32HandlePropertiesKHXParameters, 4, sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+    {"vkGetPastPresentationTimingGOOGLE",
+     kVkGetPastPresentationTimingGOOGLEParameters, 4, sizeof(VkResult), true},
+    {"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+     kVkGetPhysicalDeviceDisplayPlanePropertiesKHRParameters, 3,
+     sizeof(VkResult), true},
+    {"vkGetPhysicalDeviceDisplayPropertiesKHR",
+     kVkGetPhysicalDeviceDisplayPropertiesKHRParameters, 3, sizeof(VkResult),
+     true},
+    {"vkGetPhysicalDeviceExternalBufferPropertiesKHX",
+     kVkGetPhysicalDeviceExternalBufferPropertiesKHXParameters, 3, 0, true},
+    {"vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+     kVkGetPhysicalDeviceExternalImageFormatPropertiesNVParameters, 8,
+     sizeof(VkResult), true},
+    {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHX",
+     kVkGetPhysicalDeviceExternalSemaphorePropertiesKHXParameters, 3, 0, true},
+    {"vkGetPhysicalDeviceFeatures", kVkGetPhysicalDeviceFeaturesParameters, 2,
+     0, true},
+    {"vkGetPhysicalDeviceFeatures2KHR",
+     kVkGetPhysicalDeviceFeatures2KHRParameters, 2, 0, true},
+    {"vkGetPhysicalDeviceFormatProperties",
+     kVkGetPhysicalDeviceFormatPropertiesParameters, 3, 0, true},
+    {"vkGetPhysicalDeviceFormatProperties2KHR",
+     kVkGetPhysicalDeviceFormatProperties2KHRParameters, 3, 0, true},
+    {"vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX",
+     kVkGetPhysicalDeviceGeneratedCommandsPropertiesNVXParameters, 3, 0, true},
+    {"vkGetPhysicalDeviceImageFormatProperties",
+     kVkGetPhysicalDeviceImageFormatPropertiesParameters, 7, sizeof(VkResult),
+     true},
+    {"vkGetPhysicalDeviceImageFormatProperties2KHR",
+     kVkGetPhysicalDeviceImageFormatProperties2KHRParameters, 3,
+     sizeof(VkResult), true},
+    {"vkGetPhysicalDeviceMemoryProperties",
+     kVkGetPhysicalDeviceMemoryPropertiesParameters, 2, 0, true},
+    {"vkGetPhysicalDeviceMemoryProperties2KHR",
+     kVkGetPhysicalDeviceMemoryProperties2KHRParameters, 2, 0, true},
+#if defined(VK_USE_PLATFORM_MIR_KHR)
+    {"vkGetPhysicalDeviceMirPresentationSupportKHR",
+     kVkGetPhysicalDeviceMirPresentationSupportKHRParameters, 3,
+     sizeof(VkBool32), true},
+#endif  // VK_USE_PLATFORM_MIR_KHR
+    {"vkGetPhysicalDevicePresentRectanglesKHX",
+     kVkGetPhysicalDevicePresentRectanglesKHXParameters, 4, sizeof(VkResult),
+     true},
+    {"vkGetPhysicalDeviceProperties", kVkGetPhysicalDevicePropertiesParameters,
+     2, 0, true},
+    {"vkGetPhysicalDeviceProperties2KHR",
+     kVkGetPhysicalDeviceProperties2KHRParameters, 2, 0, true},
+    {"vkGetPhysicalDeviceQueueFamilyProperties",
+     kVkGetPhysicalDeviceQueueFamilyPropertiesParameters, 3, 0, true},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+     kVkGetPhysicalDeviceQueueFamilyProperties2KHRParameters, 3, 0, true},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties",
+     kVkGetPhysicalDeviceSparseImageFormatPropertiesParameters, 8, 0, true},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+     kVkGetPhysicalDeviceSparseImageFormatProperties2KHRParameters, 4, 0, true},
+    {"vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+     kVkGetPhysicalDeviceSurfaceCapabilities2EXTParameters, 3, sizeof(VkResult),
+     true},
+    {"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+     kVkGetPhysicalDeviceSurfaceCapabilitiesKHRParameters, 3, sizeof(VkResult),
+     true},
+    {"vkGetPhysicalDeviceSurfaceFormatsKHR",
+     kVkGetPhysicalDeviceSurfaceFormatsKHRParameters, 4, sizeof(VkResult),
+     true},
+    {"vkGetPhysicalDeviceSurfacePresentModesKHR",
+     kVkGetPhysicalDeviceSurfacePresentModesKHRParameters, 4, sizeof(VkResult),
+     true},
+    {"vkGetPhysicalDeviceSurfaceSupportKHR",
+     kVkGetPhysicalDeviceSurfaceSupportKHRParameters, 4, sizeof(VkResult),
+     true},
+#if defined(VK_USE_PLATFORM_WAYLAND_KHR)
+    {"vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+     kVkGetPhysicalDeviceWaylandPresentationSupportKHRParameters, 3,
+     sizeof(VkBool32), true},
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkGetPhysicalDeviceWin32PresentationSupportKHR",
+     kVkGetPhysicalDeviceWin32PresentationSupportKHRParameters, 2,
+     sizeof(VkBool32), true},
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+    {"vkGetPhysicalDeviceXcbPresentationSupportKHR",
+     kVkGetPhysicalDeviceXcbPresentationSupportKHRParameters, 4,
+     sizeof(VkBool32), true},
+#endif  // VK_USE_PLATFORM_XCB_KHR
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+    {"vkGetPhysicalDeviceXlibPresentationSupportKHR",
+     kVkGetPhysicalDeviceXlibPresentationSupportKHRParameters, 4,
+     sizeof(VkBool32), true},
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+    {"vkGetPipelineCacheData", kVkGetPipelineCacheDataParameters, 4,
+     sizeof(VkResult), true},
+    {"vkGetQueryPoolResults", kVkGetQueryPoolResultsParameters, 8,
+     sizeof(VkResult), true},
+#if defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)
+    {"vkGetRandROutputDisplayEXT", kVkGetRandROutputDisplayEXTParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkGetRefreshCycleDurationGOOGLE",
+     kVkGetRefreshCycleDurationGOOGLEParameters, 3, sizeof(VkResult), true},
+    {"vkGetRenderAreaGranularity", kVkGetRenderAreaGranularityParameters, 3, 0,
+     true},
+    {"vkGetSemaphoreFdKHX", kVkGetSemaphoreFdKHXParameters, 4, sizeof(VkResult),
+     true},
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    {"vkGetSemaphoreWin32HandleKHX", kVkGetSemaphoreWin32HandleKHXParameters, 4,
+     sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+    {"vkGetSwapchainCounterEXT", kVkGetSwapchainCounterEXTParameters, 4,
+     sizeof(VkResult), true},
+    {"vkGetSwapchainImagesKHR", kVkGetSwapchainImagesKHRParameters, 4,
+     sizeof(VkResult), true},
+    {"vkImportSemaphoreFdKHX", kVkImportSemaphoreFdKHXParameters, 2,
+     sizeof(VkResult), true},
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    {"vkImportSemaphoreWin32HandleKHX",
+     kVkImportSemaphoreWin32HandleKHXParameters, 2, sizeof(VkResult), true},
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+    {"vkInvalidateMappedMemoryRanges",
+     kVkInvalidateMappedMemoryRangesParameters, 3, sizeof(VkResult), true},
+    {"vkMapMemory", kVkMapMemoryParameters, 6, sizeof(VkResult), true},
+    {"vkMergePipelineCaches", kVkMergePipelineCachesParameters, 4,
+     sizeof(VkResult), true},
+    {"vkQueueBindSparse", kVkQueueBindSparseParameters, 4, sizeof(VkResult),
+     true},
+    {"vkQueuePresentKHR", kVkQueuePresentKHRParameters, 2, sizeof(VkResult),
+     true},
+    {"vkQueueSubmit", kVkQueueSubmitParameters, 4, sizeof(VkResult), true},
+    {"vkQueueWaitIdle", kVkQueueWaitIdleParameters, 1, sizeof(VkResult), true},
+    {"vkRegisterDeviceEventEXT", kVkRegisterDeviceEventEXTParameters, 4,
+     sizeof(VkResult), true},
+    {"vkRegisterDisplayEventEXT", kVkRegisterDisplayEventEXTParameters, 5,
+     sizeof(VkResult), true},
+    {"vkRegisterObjectsNVX", nullptr, 0, sizeof(VkResult), false},
+    {"vkReleaseDisplayEXT", kVkReleaseDisplayEXTParameters, 2, sizeof(VkResult),
+     true},
+    {"vkResetCommandBuffer", kVkResetCommandBufferParameters, 2,
+     sizeof(VkResult), true},
+    {"vkResetCommandPool", kVkResetCommandPoolParameters, 3, sizeof(VkResult),
+     true},
+    {"vkResetDescriptorPool", kVkResetDescriptorPoolParameters, 3,
+     sizeof(VkResult), true},
+    {"vkResetEvent", kVkResetEventParameters, 2, sizeof(VkResult), true},
+    {"vkResetFences", kVkResetFencesParameters, 3, sizeof(VkResult), true},
+    {"vkSetEvent", kVkSetEventParameters, 2, sizeof(VkResult), true},
+    {"vkSetHdrMetadataEXT", kVkSetHdrMetadataEXTParameters, 4, 0, true},
+    {"vkTrimCommandPoolKHR", kVkTrimCommandPoolKHRParameters, 3, 0, true},
+    {"vkUnmapMemory", kVkUnmapMemoryParameters, 2, 0, true},
+    {"vkUnregisterObjectsNVX", kVkUnregisterObjectsNVXParameters, 5,
+     sizeof(VkResult), true},
+    {"vkUpdateDescriptorSetWithTemplateKHR", nullptr, 0, 0, false},
+    {"vkUpdateDescriptorSets", kVkUpdateDescriptorSetsParameters, 5, 0, true},
+    {"vkWaitForFences", kVkWaitForFencesParameters, 5, sizeof(VkResult), true},
+};
+
+}  // anonymous namespace
+
+const char* const kHandleTypeNames[] = {
+    "VkInstance",
+    "VkPhysicalDevice",
+    "VkDevice",
+    "VkQueue",
+    "VkSemaphore",
+    "VkCommandBuffer",
+    "VkFence",
+    "VkDeviceMemory",
+    "VkBuffer",
+    "VkImage",
+    "VkEvent",
+    "VkQueryPool",
+    "VkBufferView",
+    "VkImageView",
+    "VkShaderModule",
+    "VkPipelineCache",
+    "VkPipelineLayout",
+    "VkRenderPass",
+    "VkPipeline",
+    "VkDescriptorSetLayout",
+    "VkSampler",
+    "VkDescriptorPool",
+    "VkDescriptorSet",
+    "VkFramebuffer",
+    "VkCommandPool",
+    "VkSurfaceKHR",
+    "VkSwapchainKHR",
+    "VkDisplayKHR",
+    "VkDisplayModeKHR",
+    "VkDescriptorUpdateTemplateKHR",
+    "VkDebugReportCallbackEXT",
+    "VkObjectTableNVX",
+    "VkIndirectCommandsLayoutNVX",
+};
+const uint32_t kHandleTypeCount =
+    sizeof(kHandleTypeNames) / sizeof(kHandleTypeNames[0]);
+
+const FunctionType* FindFunctionType(const char* name) {
+  const FunctionType* begin = kFunctionTypes;
+  const FunctionType* end =
+      kFunctionTypes + sizeof(kFunctionTypes) / sizeof(kFunctionTypes[0]);
+  while (begin != end) {
+    const FunctionType* middle = begin + (end - begin) / 2;
+    const int order = strcmp(middle->name, name);
+    if (order == 0) {
+      return middle;
+    }
+    if (order < 0) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return nullptr;
+}
+
+const StructType* FindStructType(VkStructureType s_type) {
+  switch (s_type) {
+    case VK_STRUCTURE_TYPE_APPLICATION_INFO:
+      return &kVkApplicationInfoType;
+    case VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO:
+      return &kVkInstanceCreateInfoType;
+    case VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO:
+      return &kVkDeviceQueueCreateInfoType;
+    case VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO:
+      return &kVkDeviceCreateInfoType;
+    case VK_STRUCTURE_TYPE_SUBMIT_INFO:
+      return &kVkSubmitInfoType;
+    case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO:
+      return &kVkMemoryAllocateInfoType;
+    case VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE:
+      return &kVkMappedMemoryRangeType;
+    case VK_STRUCTURE_TYPE_BIND_SPARSE_INFO:
+      return &kVkBindSparseInfoType;
+    case VK_STRUCTURE_TYPE_FENCE_CREATE_INFO:
+      return &kVkFenceCreateInfoType;
+    case VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO:
+      return &kVkSemaphoreCreateInfoType;
+    case VK_STRUCTURE_TYPE_EVENT_CREATE_INFO:
+      return &kVkEventCreateInfoType;
+    case VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO:
+      return &kVkQueryPoolCreateInfoType;
+    case VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO:
+      return &kVkBufferCreateInfoType;
+    case VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO:
+      return &kVkBufferViewCreateInfoType;
+    case VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO:
+      return &kVkImageCreateInfoType;
+    case VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO:
+      return &kVkImageViewCreateInfoType;
+    case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO:
+      return &kVkShaderModuleCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO:
+      return &kVkPipelineCacheCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO:
+      return &kVkPipelineShaderStageCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO:
+      return &kVkPipelineVertexInputStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO:
+      return &kVkPipelineInputAssemblyStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO:
+      return &kVkPipelineTessellationStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO:
+      return &kVkPipelineViewportStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO:
+      return &kVkPipelineRasterizationStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO:
+      return &kVkPipelineMultisampleStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO:
+      return &kVkPipelineDepthStencilStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO:
+      return &kVkPipelineColorBlendStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO:
+      return &kVkPipelineDynamicStateCreateInfoType;
+    case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO:
+      return &kVkGraphicsPipelineCreateInfoType;
+    case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO:
+      return &kVkComputePipelineCreateInfoType;
+    case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO:
+      return &kVkPipelineLayoutCreateInfoType;
+    case VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO:
+      return &kVkSamplerCreateInfoType;
+    case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO:
+      return &kVkDescriptorSetLayoutCreateInfoType;
+    case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO:
+      return &kVkDescriptorPoolCreateInfoType;
+    case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO:
+      return &kVkDescriptorSetAllocateInfoType;
+    case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET:
+      return &kVkWriteDescriptorSetType;
+    case VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET:
+      return &kVkCopyDescriptorSetType;
+    case VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO:
+      return &kVkFramebufferCreateInfoType;
+    case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO:
+      return &kVkRenderPassCreateInfoType;
+    case VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO:
+      return &kVkCommandPoolCreateInfoType;
+    case VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO:
+      return &kVkCommandBufferAllocateInfoType;
+    case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO:
+      return &kVkCommandBufferInheritanceInfoType;
+    case VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO:
+      return &kVkCommandBufferBeginInfoType;
+    case VK_STRUCTURE_TYPE_MEMORY_BARRIER:
+      return &kVkMemoryBarrierType;
+    case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER:
+      return &kVkBufferMemoryBarrierType;
+    case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER:
+      return &kVkImageMemoryBarrierType;
+    case VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO:
+      return &kVkRenderPassBeginInfoType;
+    case VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR:
+      return &kVkSwapchainCreateInfoKHRType;
+    case VK_STRUCTURE_TYPE_PRESENT_INFO_KHR:
+      return &kVkPresentInfoKHRType;
+    case VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR:
+      return &kVkDisplayModeCreateInfoKHRType;
+    case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR:
+      return &kVkDisplaySurfaceCreateInfoKHRType;
+    case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
+      return &kVkDisplayPresentInfoKHRType;
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+    case VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR:
+      return &kVkXlibSurfaceCreateInfoKHRType;
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+    case VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR:
+      return &kVkXcbSurfaceCreateInfoKHRType;
+#endif  // VK_USE_PLATFORM_XCB_KHR
+#if defined(VK_USE_PLATFORM_WAYLAND_KHR)
+    case VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR:
+      return &kVkWaylandSurfaceCreateInfoKHRType;
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+#if defined(VK_USE_PLATFORM_MIR_KHR)
+    case VK_STRUCTURE_TYPE_MIR_SURFACE_CREATE_INFO_KHR:
+      return &kVkMirSurfaceCreateInfoKHRType;
+#endif  // VK_USE_PLATFORM_MIR_KHR
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    case VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR:
+      return &kVkAndroidSurfaceCreateInfoKHRType;
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    case VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR:
+      return &kVkWin32SurfaceCreateInfoKHRType;
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR:
+      return &kVkPhysicalDeviceFeatures2KHRType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR:
+      return &kVkPhysicalDeviceProperties2KHRType;
+    case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2_KHR:
+      return &kVkFormatProperties2KHRType;
+    case VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2_KHR:
+      return &kVkImageFormatProperties2KHRType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2_KHR:
+      return &kVkPhysicalDeviceImageFormatInfo2KHRType;
+    case VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2_KHR:
+      return &kVkQueueFamilyProperties2KHRType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR:
+      return &kVkPhysicalDeviceMemoryProperties2KHRType;
+    case VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2_KHR:
+      return &kVkSparseImageFormatProperties2KHRType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2_KHR:
+      return &kVkPhysicalDeviceSparseImageFormatInfo2KHRType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
+      return &kVkPhysicalDevicePushDescriptorPropertiesKHRType;
+    case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR:
+      return &kVkPresentRegionsKHRType;
+    case VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR:
+      return &kVkDescriptorUpdateTemplateCreateInfoKHRType;
+    case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT:
+      return &kVkDebugReportCallbackCreateInfoEXTType;
+    case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD:
+      return &kVkPipelineRasterizationStateRasterizationOrderAMDType;
+    case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT:
+      return &kVkDebugMarkerObjectNameInfoEXTType;
+    case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT:
+      return &kVkDebugMarkerObjectTagInfoEXTType;
+    case VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT:
+      return &kVkDebugMarkerMarkerInfoEXTType;
+    case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
+      return &kVkDedicatedAllocationImageCreateInfoNVType;
+    case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
+      return &kVkDedicatedAllocationBufferCreateInfoNVType;
+    case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+      return &kVkDedicatedAllocationMemoryAllocateInfoNVType;
+    case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO_KHX:
+      return &kVkRenderPassMultiviewCreateInfoKHXType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES_KHX:
+      return &kVkPhysicalDeviceMultiviewFeaturesKHXType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES_KHX:
+      return &kVkPhysicalDeviceMultiviewPropertiesKHXType;
+    case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV:
+      return &kVkExternalMemoryImageCreateInfoNVType;
+    case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV:
+      return &kVkExportMemoryAllocateInfoNVType;
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV:
+      return &kVkImportMemoryWin32HandleInfoNVType;
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV:
+      return &kVkExportMemoryWin32HandleInfoNVType;
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+      return &kVkWin32KeyedMutexAcquireReleaseInfoNVType;
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+    case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO_KHX:
+      return &kVkMemoryAllocateFlagsInfoKHXType;
+    case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO_KHX:
+      return &kVkBindBufferMemoryInfoKHXType;
+    case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO_KHX:
+      return &kVkBindImageMemoryInfoKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO_KHX:
+      return &kVkDeviceGroupRenderPassBeginInfoKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO_KHX:
+      return &kVkDeviceGroupCommandBufferBeginInfoKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO_KHX:
+      return &kVkDeviceGroupSubmitInfoKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO_KHX:
+      return &kVkDeviceGroupBindSparseInfoKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHX:
+      return &kVkDeviceGroupPresentCapabilitiesKHXType;
+    case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHX:
+      return &kVkImageSwapchainCreateInfoKHXType;
+    case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHX:
+      return &kVkBindImageMemorySwapchainInfoKHXType;
+    case VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHX:
+      return &kVkAcquireNextImageInfoKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHX:
+      return &kVkDeviceGroupPresentInfoKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHX:
+      return &kVkDeviceGroupSwapchainCreateInfoKHXType;
+    case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
+      return &kVkValidationFlagsEXTType;
+#if defined(VK_USE_PLATFORM_VI_NN)
+    case VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN:
+      return &kVkViSurfaceCreateInfoNNType;
+#endif  // VK_USE_PLATFORM_VI_NN
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES_KHX:
+      return &kVkPhysicalDeviceGroupPropertiesKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO_KHX:
+      return &kVkDeviceGroupDeviceCreateInfoKHXType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO_KHX:
+      return &kVkPhysicalDeviceExternalImageFormatInfoKHXType;
+    case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES_KHX:
+      return &kVkExternalImageFormatPropertiesKHXType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO_KHX:
+      return &kVkPhysicalDeviceExternalBufferInfoKHXType;
+    case VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES_KHX:
+      return &kVkExternalBufferPropertiesKHXType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES_KHX:
+      return &kVkPhysicalDeviceIDPropertiesKHXType;
+    case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_KHX:
+      return &kVkExternalMemoryImageCreateInfoKHXType;
+    case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO_KHX:
+      return &kVkExternalMemoryBufferCreateInfoKHXType;
+    case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_KHX:
+      return &kVkExportMemoryAllocateInfoKHXType;
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHX:
+      return &kVkImportMemoryWin32HandleInfoKHXType;
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHX:
+      return &kVkExportMemoryWin32HandleInfoKHXType;
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    case VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHX:
+      return &kVkMemoryWin32HandlePropertiesKHXType;
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+    case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHX:
+      return &kVkImportMemoryFdInfoKHXType;
+    case VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHX:
+      return &kVkMemoryFdPropertiesKHXType;
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHX:
+      return &kVkWin32KeyedMutexAcquireReleaseInfoKHXType;
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO_KHX:
+      return &kVkPhysicalDeviceExternalSemaphoreInfoKHXType;
+    case VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES_KHX:
+      return &kVkExternalSemaphorePropertiesKHXType;
+    case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO_KHX:
+      return &kVkExportSemaphoreCreateInfoKHXType;
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHX:
+      return &kVkImportSemaphoreWin32HandleInfoKHXType;
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHX:
+      return &kVkExportSemaphoreWin32HandleInfoKHXType;
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+    case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHX:
+      return &kVkD3D12FenceSubmitInfoKHXType;
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+    case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHX:
+      return &kVkImportSemaphoreFdInfoKHXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GENERATED_COMMANDS_FEATURES_NVX:
+      return &kVkDeviceGeneratedCommandsFeaturesNVXType;
+    case VK_STRUCTURE_TYPE_DEVICE_GENERATED_COMMANDS_LIMITS_NVX:
+      return &kVkDeviceGeneratedCommandsLimitsNVXType;
+    case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NVX:
+      return &kVkIndirectCommandsLayoutCreateInfoNVXType;
+    case VK_STRUCTURE_TYPE_CMD_PROCESS_COMMANDS_INFO_NVX:
+      return &kVkCmdProcessCommandsInfoNVXType;
+    case VK_STRUCTURE_TYPE_CMD_RESERVE_SPACE_FOR_COMMANDS_INFO_NVX:
+      return &kVkCmdReserveSpaceForCommandsInfoNVXType;
+    case VK_STRUCTURE_TYPE_OBJECT_TABLE_CREATE_INFO_NVX:
+      return &kVkObjectTableCreateInfoNVXType;
+    case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV:
+      return &kVkPipelineViewportWScalingStateCreateInfoNVType;
+    case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES2_EXT:
+      return &kVkSurfaceCapabilities2EXTType;
+    case VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT:
+      return &kVkDisplayPowerInfoEXTType;
+    case VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT:
+      return &kVkDeviceEventInfoEXTType;
+    case VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT:
+      return &kVkDisplayEventInfoEXTType;
+    case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
+      return &kVkSwapchainCounterCreateInfoEXTType;
+    case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE:
+      return &kVkPresentTimesInfoGOOGLEType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
+      return &kVkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVXType;
+    case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV:
+      return &kVkPipelineViewportSwizzleStateCreateInfoNVType;
+    case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT:
+      return &kVkPhysicalDeviceDiscardRectanglePropertiesEXTType;
+    case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
+      return &kVkPipelineDiscardRectangleStateCreateInfoEXTType;
+    case VK_STRUCTURE_TYPE_HDR_METADATA_EXT:
+      return &kVkHdrMetadataEXTType;
+#if defined(VK_USE_PLATFORM_IOS_MVK)
+    case VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK:
+      return &kVkIOSSurfaceCreateInfoMVKType;
+#endif  // VK_USE_PLATFORM_IOS_MVK
+#if defined(VK_USE_PLATFORM_MACOS_MVK)
+    case VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK:
+      return &kVkMacOSSurfaceCreateInfoMVKType;
+#endif  // VK_USE_PLATFORM_MACOS_MVK
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace capture
+}  // namespace vulkan
@@ -0,0 +1,129 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_WRAPPER_CAPTURE_TABLES_H_
+#define VULKAN_WRAPPER_CAPTURE_TABLES_H_
+
+#include <cstdint>
+
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+
+// These tables describe the parameters of every Vulkan command, and the
+// members of every struct, that cannot simply be copied as bytes. They are
+// generated from vulkan.h by tools/generate_capture_tables.py, into
+// capture_tables.cpp, and are used by Capture and Replayer.
+namespace vulkan {
+namespace capture {
+
+// No Vulkan command has more parameters than this.
+const uint32_t kMaxParameters = 16;
+
+// What a struct member or a command parameter holds. Struct members that
+// are plain data are not described at all, since they are copied along with
+// the rest of the struct.
+enum FieldKind : uint8_t {
+  // A parameter that is plain data.
+  kValueField,
+  // A handle, which is different every time that the object is created.
+  kHandleField,
+  // A struct member that is itself a struct with fields.
+  kStructField,
+  // A const pointer to elements that the command reads.
+  kPointerField,
+  // A const pointer to handles that the command reads.
+  kHandlePointerField,
+  // A null-terminated string.
+  kStringField,
+  // A const pointer to null-terminated strings.
+  kStringArrayField,
+  // The pNext chain of a struct.
+  kNextField,
+  // A pointer to elements that the command writes.
+  kOutputField,
+  // A pointer to handles that the command writes, usually for the objects
+  // that it creates.
+  kOutputHandleField,
+  // A pointer to the number of elements behind another parameter, which
+  // the command both reads and writes.
+  kInOutCountField,
+  // The pAllocator parameter. This is never captured, and is replayed as
+  // nullptr.
+  kIgnoredField,
+};
+
+struct StructType;
+
+// Returns the number of elements behind a pointer. owner is the struct that
+// holds the pointer, or for a parameter, an array of the address of every
+// parameter of the command.
+typedef uint64_t (*CountFunction)(const void* owner);
+
+struct Field {
+  const char* name;
+  FieldKind kind;
+  // The offset of a struct member, or the index of a parameter.
+  uint32_t offset;
+  // The size of a value, or of each element behind a pointer.
+  uint32_t element_size;
+  // The type of each element, if it has fields of its own.
+  const StructType* element_type;
+  // The type of a handle, as an index into kHandleTypeNames.
+  uint32_t handle_type;
+  // Counts the elements behind a pointer. If this is nullptr, there is
+  // exactly one.
+  CountFunction count;
+};
+
+struct StructType {
+  const char* name;
+  uint32_t size;
+  // Whether the struct starts with s_type, and so can be in a pNext chain.
+  bool has_s_type;
+  VkStructureType s_type;
+  const Field* fields;
+  uint32_t field_count;
+};
+
+struct FunctionType {
+  const char* name;
+  const Field* parameters;
+  uint32_t parameter_count;
+  // The size of the result, or 0 for void commands.
+  uint32_t result_size;
+  // If this is false, the parameters could not be described. Calls are
+  // recorded without them, and are not replayed.
+  bool supported;
+};
+
+// Returns the parameter at index, given the address of every parameter.
+template <typename T>
+const T& Parameter(const void* const* parameters, uint32_t index) {
+  return *static_cast<const T*>(parameters[index]);
+}
+
+// The name of every type of handle.
+extern const char* const kHandleTypeNames[];
+extern const uint32_t kHandleTypeCount;
+
+// Returns the command with the given name, or nullptr if there is none.
+const FunctionType* FindFunctionType(const char* name);
+
+// Returns the struct with the given sType, or nullptr if there is none.
+const StructType* FindStructType(VkStructureType s_type);
+
+}  // namespace capture
+}  // namespace vulkan
+
+#endif  // VULKAN_WRAPPER_CAPTURE_TABLES_H_
@@ -66,9 +66,11 @@ class VkDevice {
       vendor_id_ = properties->vendorID;
       driver_version_ = properties->driverVersion;
     }
-    // Initialize the lazily resolved device functions.
+    // Initialize the device functions, which are resolved now if the
+    // library was asked to.
     functions_ = containers::make_unique<DeviceFunctions>(
-        container_allocator, device_, vkGetDeviceProcAddr, log_);
+        container_allocator, device_, vkGetDeviceProcAddr, log_,
+        instance->get_wrapper()->resolve_functions_eagerly());
     if (physical_device) {
       (*instance)->vkGetPhysicalDeviceMemoryProperties(
           physical_device, &physical_device_memory_properties_);
@@ -94,6 +96,12 @@ class VkDevice {
   logging::Logger* GetLogger() { return log_; }
 
   DeviceFunctions* functions() { return functions_.get(); }
+
+  // Returns the callbacks this device was created with, or nullptr.
+  // Objects created from this device can be given the same callbacks.
+  VkAllocationCallbacks* allocation_callbacks() {
+    return has_allocator_ ? &allocator_ : nullptr;
+  }
   ::VkPhysicalDevice physical_device() const { return physical_device_; }
 
   const VkPhysicalDeviceMemoryProperties& physical_device_memory_properties()
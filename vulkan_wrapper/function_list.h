@@ -0,0 +1,316 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// This file is generated by tools/generate_function_list.py from
+// third_party/vulkan/vulkan.h. Do not edit it by hand.
+//
+// It has no include guard, because it is meant to be included several
+// times. Before each inclusion, define the macros below for the kinds of
+// functions that you want to expand; the others expand to nothing. They are
+// all undefined again at the end.
+
+#ifndef VULKAN_INSTANCE_FUNCTION
+#define VULKAN_INSTANCE_FUNCTION(function)
+#endif
+#ifndef VULKAN_DEVICE_FUNCTION
+#define VULKAN_DEVICE_FUNCTION(function)
+#endif
+#ifndef VULKAN_QUEUE_FUNCTION
+#define VULKAN_QUEUE_FUNCTION(function)
+#endif
+#ifndef VULKAN_COMMAND_BUFFER_FUNCTION
+#define VULKAN_COMMAND_BUFFER_FUNCTION(function)
+#endif
+VULKAN_INSTANCE_FUNCTION(vkDestroyInstance)
+VULKAN_INSTANCE_FUNCTION(vkEnumeratePhysicalDevices)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceFeatures)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceFormatProperties)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceImageFormatProperties)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceProperties)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceQueueFamilyProperties)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceMemoryProperties)
+VULKAN_INSTANCE_FUNCTION(vkCreateDevice)
+VULKAN_DEVICE_FUNCTION(vkDestroyDevice)
+VULKAN_INSTANCE_FUNCTION(vkEnumerateDeviceExtensionProperties)
+VULKAN_INSTANCE_FUNCTION(vkEnumerateDeviceLayerProperties)
+VULKAN_DEVICE_FUNCTION(vkGetDeviceQueue)
+VULKAN_QUEUE_FUNCTION(vkQueueSubmit)
+VULKAN_QUEUE_FUNCTION(vkQueueWaitIdle)
+VULKAN_DEVICE_FUNCTION(vkDeviceWaitIdle)
+VULKAN_DEVICE_FUNCTION(vkAllocateMemory)
+VULKAN_DEVICE_FUNCTION(vkFreeMemory)
+VULKAN_DEVICE_FUNCTION(vkMapMemory)
+VULKAN_DEVICE_FUNCTION(vkUnmapMemory)
+VULKAN_DEVICE_FUNCTION(vkFlushMappedMemoryRanges)
+VULKAN_DEVICE_FUNCTION(vkInvalidateMappedMemoryRanges)
+VULKAN_DEVICE_FUNCTION(vkGetDeviceMemoryCommitment)
+VULKAN_DEVICE_FUNCTION(vkBindBufferMemory)
+VULKAN_DEVICE_FUNCTION(vkBindImageMemory)
+VULKAN_DEVICE_FUNCTION(vkGetBufferMemoryRequirements)
+VULKAN_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
+VULKAN_DEVICE_FUNCTION(vkGetImageSparseMemoryRequirements)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceSparseImageFormatProperties)
+VULKAN_QUEUE_FUNCTION(vkQueueBindSparse)
+VULKAN_DEVICE_FUNCTION(vkCreateFence)
+VULKAN_DEVICE_FUNCTION(vkDestroyFence)
+VULKAN_DEVICE_FUNCTION(vkResetFences)
+VULKAN_DEVICE_FUNCTION(vkGetFenceStatus)
+VULKAN_DEVICE_FUNCTION(vkWaitForFences)
+VULKAN_DEVICE_FUNCTION(vkCreateSemaphore)
+VULKAN_DEVICE_FUNCTION(vkDestroySemaphore)
+VULKAN_DEVICE_FUNCTION(vkCreateEvent)
+VULKAN_DEVICE_FUNCTION(vkDestroyEvent)
+VULKAN_DEVICE_FUNCTION(vkGetEventStatus)
+VULKAN_DEVICE_FUNCTION(vkSetEvent)
+VULKAN_DEVICE_FUNCTION(vkResetEvent)
+VULKAN_DEVICE_FUNCTION(vkCreateQueryPool)
+VULKAN_DEVICE_FUNCTION(vkDestroyQueryPool)
+VULKAN_DEVICE_FUNCTION(vkGetQueryPoolResults)
+VULKAN_DEVICE_FUNCTION(vkCreateBuffer)
+VULKAN_DEVICE_FUNCTION(vkDestroyBuffer)
+VULKAN_DEVICE_FUNCTION(vkCreateBufferView)
+VULKAN_DEVICE_FUNCTION(vkDestroyBufferView)
+VULKAN_DEVICE_FUNCTION(vkCreateImage)
+VULKAN_DEVICE_FUNCTION(vkDestroyImage)
+VULKAN_DEVICE_FUNCTION(vkGetImageSubresourceLayout)
+VULKAN_DEVICE_FUNCTION(vkCreateImageView)
+VULKAN_DEVICE_FUNCTION(vkDestroyImageView)
+VULKAN_DEVICE_FUNCTION(vkCreateShaderModule)
+VULKAN_DEVICE_FUNCTION(vkDestroyShaderModule)
+VULKAN_DEVICE_FUNCTION(vkCreatePipelineCache)
+VULKAN_DEVICE_FUNCTION(vkDestroyPipelineCache)
+VULKAN_DEVICE_FUNCTION(vkGetPipelineCacheData)
+VULKAN_DEVICE_FUNCTION(vkMergePipelineCaches)
+VULKAN_DEVICE_FUNCTION(vkCreateGraphicsPipelines)
+VULKAN_DEVICE_FUNCTION(vkCreateComputePipelines)
+VULKAN_DEVICE_FUNCTION(vkDestroyPipeline)
+VULKAN_DEVICE_FUNCTION(vkCreatePipelineLayout)
+VULKAN_DEVICE_FUNCTION(vkDestroyPipelineLayout)
+VULKAN_DEVICE_FUNCTION(vkCreateSampler)
+VULKAN_DEVICE_FUNCTION(vkDestroySampler)
+VULKAN_DEVICE_FUNCTION(vkCreateDescriptorSetLayout)
+VULKAN_DEVICE_FUNCTION(vkDestroyDescriptorSetLayout)
+VULKAN_DEVICE_FUNCTION(vkCreateDescriptorPool)
+VULKAN_DEVICE_FUNCTION(vkDestroyDescriptorPool)
+VULKAN_DEVICE_FUNCTION(vkResetDescriptorPool)
+VULKAN_DEVICE_FUNCTION(vkAllocateDescriptorSets)
+VULKAN_DEVICE_FUNCTION(vkFreeDescriptorSets)
+VULKAN_DEVICE_FUNCTION(vkUpdateDescriptorSets)
+VULKAN_DEVICE_FUNCTION(vkCreateFramebuffer)
+VULKAN_DEVICE_FUNCTION(vkDestroyFramebuffer)
+VULKAN_DEVICE_FUNCTION(vkCreateRenderPass)
+VULKAN_DEVICE_FUNCTION(vkDestroyRenderPass)
+VULKAN_DEVICE_FUNCTION(vkGetRenderAreaGranularity)
+VULKAN_DEVICE_FUNCTION(vkCreateCommandPool)
+VULKAN_DEVICE_FUNCTION(vkDestroyCommandPool)
+VULKAN_DEVICE_FUNCTION(vkResetCommandPool)
+VULKAN_DEVICE_FUNCTION(vkAllocateCommandBuffers)
+VULKAN_DEVICE_FUNCTION(vkFreeCommandBuffers)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkBeginCommandBuffer)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkEndCommandBuffer)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkResetCommandBuffer)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdBindPipeline)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetViewport)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetScissor)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetLineWidth)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetDepthBias)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetBlendConstants)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetDepthBounds)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetStencilCompareMask)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetStencilWriteMask)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetStencilReference)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdBindDescriptorSets)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdBindIndexBuffer)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdBindVertexBuffers)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDraw)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDrawIndexed)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDrawIndirect)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDrawIndexedIndirect)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDispatch)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDispatchIndirect)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdCopyBuffer)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdCopyImage)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdBlitImage)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdCopyBufferToImage)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdCopyImageToBuffer)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdUpdateBuffer)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdFillBuffer)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdClearColorImage)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdClearDepthStencilImage)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdClearAttachments)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdResolveImage)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetEvent)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdResetEvent)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdWaitEvents)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdPipelineBarrier)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdBeginQuery)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdEndQuery)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdResetQueryPool)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdWriteTimestamp)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdCopyQueryPoolResults)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdPushConstants)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdBeginRenderPass)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdNextSubpass)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdEndRenderPass)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdExecuteCommands)
+VULKAN_INSTANCE_FUNCTION(vkDestroySurfaceKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceSurfaceSupportKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceSurfaceCapabilitiesKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceSurfaceFormatsKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceSurfacePresentModesKHR)
+VULKAN_DEVICE_FUNCTION(vkCreateSwapchainKHR)
+VULKAN_DEVICE_FUNCTION(vkDestroySwapchainKHR)
+VULKAN_DEVICE_FUNCTION(vkGetSwapchainImagesKHR)
+VULKAN_DEVICE_FUNCTION(vkAcquireNextImageKHR)
+VULKAN_QUEUE_FUNCTION(vkQueuePresentKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceDisplayPropertiesKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceDisplayPlanePropertiesKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetDisplayPlaneSupportedDisplaysKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetDisplayModePropertiesKHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateDisplayModeKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetDisplayPlaneCapabilitiesKHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateDisplayPlaneSurfaceKHR)
+VULKAN_DEVICE_FUNCTION(vkCreateSharedSwapchainsKHR)
+
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateXlibSurfaceKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceXlibPresentationSupportKHR)
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateXcbSurfaceKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceXcbPresentationSupportKHR)
+#endif  // VK_USE_PLATFORM_XCB_KHR
+
+#if defined(VK_USE_PLATFORM_WAYLAND_KHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateWaylandSurfaceKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceWaylandPresentationSupportKHR)
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+
+#if defined(VK_USE_PLATFORM_MIR_KHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateMirSurfaceKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceMirPresentationSupportKHR)
+#endif  // VK_USE_PLATFORM_MIR_KHR
+
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateAndroidSurfaceKHR)
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateWin32SurfaceKHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceWin32PresentationSupportKHR)
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceFeatures2KHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceProperties2KHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceFormatProperties2KHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceImageFormatProperties2KHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceQueueFamilyProperties2KHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceMemoryProperties2KHR)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceSparseImageFormatProperties2KHR)
+VULKAN_DEVICE_FUNCTION(vkTrimCommandPoolKHR)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdPushDescriptorSetKHR)
+VULKAN_DEVICE_FUNCTION(vkCreateDescriptorUpdateTemplateKHR)
+VULKAN_DEVICE_FUNCTION(vkDestroyDescriptorUpdateTemplateKHR)
+VULKAN_DEVICE_FUNCTION(vkUpdateDescriptorSetWithTemplateKHR)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdPushDescriptorSetWithTemplateKHR)
+VULKAN_INSTANCE_FUNCTION(vkCreateDebugReportCallbackEXT)
+VULKAN_INSTANCE_FUNCTION(vkDestroyDebugReportCallbackEXT)
+VULKAN_INSTANCE_FUNCTION(vkDebugReportMessageEXT)
+VULKAN_DEVICE_FUNCTION(vkDebugMarkerSetObjectTagEXT)
+VULKAN_DEVICE_FUNCTION(vkDebugMarkerSetObjectNameEXT)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDebugMarkerBeginEXT)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDebugMarkerEndEXT)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDebugMarkerInsertEXT)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDrawIndirectCountAMD)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDrawIndexedIndirectCountAMD)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceExternalImageFormatPropertiesNV)
+
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+VULKAN_DEVICE_FUNCTION(vkGetMemoryWin32HandleNV)
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+
+VULKAN_DEVICE_FUNCTION(vkGetDeviceGroupPeerMemoryFeaturesKHX)
+VULKAN_DEVICE_FUNCTION(vkBindBufferMemory2KHX)
+VULKAN_DEVICE_FUNCTION(vkBindImageMemory2KHX)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetDeviceMaskKHX)
+VULKAN_DEVICE_FUNCTION(vkGetDeviceGroupPresentCapabilitiesKHX)
+VULKAN_DEVICE_FUNCTION(vkGetDeviceGroupSurfacePresentModesKHX)
+VULKAN_DEVICE_FUNCTION(vkAcquireNextImage2KHX)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdDispatchBaseKHX)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDevicePresentRectanglesKHX)
+
+#if defined(VK_USE_PLATFORM_VI_NN)
+VULKAN_INSTANCE_FUNCTION(vkCreateViSurfaceNN)
+#endif  // VK_USE_PLATFORM_VI_NN
+
+VULKAN_INSTANCE_FUNCTION(vkEnumeratePhysicalDeviceGroupsKHX)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceExternalBufferPropertiesKHX)
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+VULKAN_DEVICE_FUNCTION(vkGetMemoryWin32HandleKHX)
+VULKAN_DEVICE_FUNCTION(vkGetMemoryWin32HandlePropertiesKHX)
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+VULKAN_DEVICE_FUNCTION(vkGetMemoryFdKHX)
+VULKAN_DEVICE_FUNCTION(vkGetMemoryFdPropertiesKHX)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceExternalSemaphorePropertiesKHX)
+
+#if defined(VK_USE_PLATFORM_WIN32_KHX)
+VULKAN_DEVICE_FUNCTION(vkImportSemaphoreWin32HandleKHX)
+VULKAN_DEVICE_FUNCTION(vkGetSemaphoreWin32HandleKHX)
+#endif  // VK_USE_PLATFORM_WIN32_KHX
+
+VULKAN_DEVICE_FUNCTION(vkImportSemaphoreFdKHX)
+VULKAN_DEVICE_FUNCTION(vkGetSemaphoreFdKHX)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdProcessCommandsNVX)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdReserveSpaceForCommandsNVX)
+VULKAN_DEVICE_FUNCTION(vkCreateIndirectCommandsLayoutNVX)
+VULKAN_DEVICE_FUNCTION(vkDestroyIndirectCommandsLayoutNVX)
+VULKAN_DEVICE_FUNCTION(vkCreateObjectTableNVX)
+VULKAN_DEVICE_FUNCTION(vkDestroyObjectTableNVX)
+VULKAN_DEVICE_FUNCTION(vkRegisterObjectsNVX)
+VULKAN_DEVICE_FUNCTION(vkUnregisterObjectsNVX)
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetViewportWScalingNV)
+VULKAN_INSTANCE_FUNCTION(vkReleaseDisplayEXT)
+
+#if defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)
+VULKAN_INSTANCE_FUNCTION(vkAcquireXlibDisplayEXT)
+VULKAN_INSTANCE_FUNCTION(vkGetRandROutputDisplayEXT)
+#endif  // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+
+VULKAN_INSTANCE_FUNCTION(vkGetPhysicalDeviceSurfaceCapabilities2EXT)
+VULKAN_DEVICE_FUNCTION(vkDisplayPowerControlEXT)
+VULKAN_DEVICE_FUNCTION(vkRegisterDeviceEventEXT)
+VULKAN_DEVICE_FUNCTION(vkRegisterDisplayEventEXT)
+VULKAN_DEVICE_FUNCTION(vkGetSwapchainCounterEXT)
+VULKAN_DEVICE_FUNCTION(vkGetRefreshCycleDurationGOOGLE)
+VULKAN_DEVICE_FUNCTION(vkGetPastPresentationTimingGOOGLE)
+VULKAN_COMMAND_BUFFER_FUNCTION(vkCmdSetDiscardRectangleEXT)
+VULKAN_DEVICE_FUNCTION(vkSetHdrMetadataEXT)
+
+#if defined(VK_USE_PLATFORM_IOS_MVK)
+VULKAN_INSTANCE_FUNCTION(vkCreateIOSSurfaceMVK)
+#endif  // VK_USE_PLATFORM_IOS_MVK
+
+#if defined(VK_USE_PLATFORM_MACOS_MVK)
+VULKAN_INSTANCE_FUNCTION(vkCreateMacOSSurfaceMVK)
+#endif  // VK_USE_PLATFORM_MACOS_MVK
+
+#undef VULKAN_INSTANCE_FUNCTION
+#undef VULKAN_DEVICE_FUNCTION
+#undef VULKAN_QUEUE_FUNCTION
+#undef VULKAN_COMMAND_BUFFER_FUNCTION
@@ -47,7 +47,7 @@ class VkInstance {
     }
     functions_ = containers::make_unique<InstanceFunctions>(
         container_allocator, instance_, getProcAddrFunction(),
-        wrapper_->GetLogger());
+        wrapper_->GetLogger(), wrapper_->resolve_functions_eagerly());
     // functions_.reset(new InstanceFunctions(instance_, getProcAddrFunction(),
     // wrapper_->GetLogger()));
   }
@@ -81,6 +81,12 @@ class VkInstance {
 
   InstanceFunctions* functions() { return functions_.get(); }
 
+  // Returns the callbacks this instance was created with, or nullptr.
+  // Objects created from this instance can be given the same callbacks.
+  VkAllocationCallbacks* allocation_callbacks() {
+    return has_allocator_ ? &allocator_ : nullptr;
+  }
+
  private:
   ::VkInstance instance_;
   bool has_allocator_;
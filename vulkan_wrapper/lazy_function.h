@@ -16,15 +16,30 @@
 #ifndef VULKAN_WRAPPER_LAZY_FUNCTION_H_
 #define VULKAN_WRAPPER_LAZY_FUNCTION_H_
 
+#include "vulkan_wrapper/call_statistics.h"
+#include "vulkan_wrapper/capture.h"
+
 // This wraps a lazily initialized function pointer. It will be resolved
-// when it is first called.
+// when it is first called, unless Resolve is called before then.
 template <typename T, typename HANDLE, typename WRAPPER>
 class LazyFunction {
  public:
   // We retain a reference to the function name, so it must remain valid.
   // In practice this is expected to be used with string constants.
   LazyFunction(HANDLE handle, const char* function_name, WRAPPER* wrapper)
-      : handle_(handle), function_name_(function_name), wrapper_(wrapper) {}
+      : handle_(handle),
+        function_name_(function_name),
+        wrapper_(wrapper)
+#if VULKAN_CALL_STATISTICS
+        ,
+        statistics_id_(vulkan::CallStatistics::RegisterFunction(function_name))
+#endif
+#if VULKAN_CAPTURE
+        ,
+        capture_function_(vulkan::capture::FindFunctionType(function_name))
+#endif
+  {
+  }
 
   // When this functor is called, it will check if the function pointer
   // has been resolved. If not it will resolve it and then call the function.
@@ -32,10 +47,28 @@ class LazyFunction {
   template <typename... Args>
   typename std::result_of<T(Args...)>::type operator()(const Args&... args);
 
+  // Resolves the function pointer now, so that calls do not have to.
+  // Returns false if it could not be resolved, in which case calling it will
+  // try again, and crash.
+  bool Resolve() {
+    ptr_ = reinterpret_cast<T>(wrapper_->getProcAddr(handle_, function_name_));
+    return ptr_ != nullptr;
+  }
+
  private:
+  // Resolves the function pointer when it is first called. This is kept out
+  // of operator() so that every call site only has to test ptr_.
+  void ResolveOnFirstCall();
+
   HANDLE handle_;
   const char* function_name_;
   WRAPPER* wrapper_;
+#if VULKAN_CALL_STATISTICS
+  uint32_t statistics_id_;
+#endif
+#if VULKAN_CAPTURE
+  const vulkan::capture::FunctionType* capture_function_;
+#endif
   T ptr_ = nullptr;
 };
 
@@ -44,16 +77,28 @@ template <typename... Args>
 typename std::result_of<T(Args...)>::type LazyFunction<T, HANDLE, WRAPPER>::
 operator()(const Args&... args) {
   if (!ptr_) {
-    ptr_ = reinterpret_cast<T>(wrapper_->getProcAddr(handle_, function_name_));
-    if (ptr_) {
-      wrapper_->GetLogger()->LogInfo(function_name_, " for instance ", handle_,
-                                     " resolved");
-    } else {
-      wrapper_->GetLogger()->LogError(function_name_, " for instance ", handle_,
-                                      " could not be resolved, crashing now");
-    }
+    ResolveOnFirstCall();
+  }
+#if VULKAN_CALL_STATISTICS
+  vulkan::CallStatistics::ScopedCall counted_call(statistics_id_);
+#endif
+#if VULKAN_CAPTURE
+  if (vulkan::Capture* capture = vulkan::Capture::active()) {
+    return capture->Call(capture_function_, ptr_, args...);
   }
+#endif
   return ptr_(args...);
 }
 
+template <typename T, typename HANDLE, typename WRAPPER>
+void LazyFunction<T, HANDLE, WRAPPER>::ResolveOnFirstCall() {
+  if (Resolve()) {
+    wrapper_->GetLogger()->LogInfo(function_name_, " for instance ", handle_,
+                                   " resolved");
+  } else {
+    wrapper_->GetLogger()->LogError(function_name_, " for instance ", handle_,
+                                    " could not be resolved, crashing now");
+  }
+}
+
 #endif  //  VULKAN_WRAPPER_LAZY_FUNCTION_H_
\ No newline at end of file
@@ -18,8 +18,9 @@
 namespace vulkan {
 
 LibraryWrapper::LibraryWrapper(containers::Allocator* allocator,
-                               logging::Logger* logger)
-    : logger_(logger) {
+                               logging::Logger* logger,
+                               bool resolve_functions_eagerly)
+    : logger_(logger), resolve_functions_eagerly_(resolve_functions_eagerly) {
   vulkan_lib_ = dynamic_loader::OpenLibrary(allocator, "vulkan");
   if (vulkan_lib_) {
     if (vulkan_lib_->is_valid()) {
@@ -33,8 +33,14 @@ using LazyLibraryFunction = LazyFunction<T, ::VkInstance, LibraryWrapper>;
 // for all global-scope functions.
 class LibraryWrapper {
  public:
-  LibraryWrapper(containers::Allocator* allocator, logging::Logger* logger);
+  // If resolve_functions_eagerly is true, the function tables of instances
+  // and devices created from this library are filled in when they are
+  // created, instead of as each function is first called. Tests that look
+  // for the resolution of particular functions in traces leave it false.
+  LibraryWrapper(containers::Allocator* allocator, logging::Logger* logger,
+                 bool resolve_functions_eagerly = false);
   bool is_valid() { return vulkan_lib_ && vulkan_lib_->is_valid(); }
+  bool resolve_functions_eagerly() const { return resolve_functions_eagerly_; }
 
 #define LAZY_FUNCTION(function)                   \
   LazyLibraryFunction<PFN_##function> function = \
@@ -55,6 +61,7 @@ class LibraryWrapper {
   PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr;
 
   logging::Logger* logger_;
+  bool resolve_functions_eagerly_;
   containers::unique_ptr<dynamic_loader::DynamicLibrary> vulkan_lib_;
 };
 }
@@ -0,0 +1,888 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "vulkan_wrapper/replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+#include "vulkan_wrapper/capture.h"
+
+namespace vulkan {
+
+namespace {
+const char kMagic[8] = {'V', 'T', 'A', 'C', 'A', 'P', 'T', '\0'};
+const uint32_t kByteOrderMark = 0x01020304;
+// The magic, the version, the byte order mark, the pointer size and
+// VK_HEADER_VERSION.
+const size_t kHeaderSize = sizeof(kMagic) + 4 * sizeof(uint32_t);
+// No function has a longer name than this.
+const uint32_t kMaxNameLength = 128;
+
+uint64_t Now() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+// Returns the handle at address as a number, whatever its size.
+uint64_t HandleValue(const void* address, uint32_t size) {
+  if (size == sizeof(uint64_t)) {
+    uint64_t value;
+    memcpy(&value, address, sizeof(value));
+    return value;
+  }
+  uint32_t value;
+  memcpy(&value, address, sizeof(value));
+  return value;
+}
+
+void SetHandleValue(void* address, uint32_t size, uint64_t value) {
+  if (size == sizeof(uint64_t)) {
+    memcpy(address, &value, sizeof(value));
+    return;
+  }
+  const uint32_t narrow_value = static_cast<uint32_t>(value);
+  memcpy(address, &narrow_value, sizeof(narrow_value));
+}
+
+template <typename T>
+T& At(void* address) {
+  return *static_cast<T*>(address);
+}
+
+template <size_t... I>
+struct Indices {};
+template <size_t N, size_t... I>
+struct MakeIndices : MakeIndices<N - 1, N - 1, I...> {};
+template <size_t... I>
+struct MakeIndices<0, I...> {
+  typedef Indices<I...> type;
+};
+
+typedef void (*InvokeFunction)(PFN_vkVoidFunction function,
+                               void* const* parameters, void* result);
+
+// Calls a function of type F, with the parameters that parameters points
+// to, and stores what it returns in result.
+template <typename F>
+struct Invoker;
+
+template <typename R, typename... P>
+struct Invoker<R(VKAPI_PTR*)(P...)> {
+  static void Invoke(PFN_vkVoidFunction function, void* const* parameters,
+                     void* result) {
+    Invoke(function, parameters, result,
+           typename MakeIndices<sizeof...(P)>::type());
+  }
+
+  template <size_t... I>
+  static void Invoke(PFN_vkVoidFunction function, void* const* parameters,
+                     void* result, Indices<I...>) {
+    *static_cast<R*>(result) = reinterpret_cast<R(VKAPI_PTR*)(P...)>(
+        function)(*static_cast<P*>(parameters[I])...);
+  }
+};
+
+template <typename... P>
+struct Invoker<void(VKAPI_PTR*)(P...)> {
+  static void Invoke(PFN_vkVoidFunction function, void* const* parameters,
+                     void*) {
+    Invoke(function, parameters, typename MakeIndices<sizeof...(P)>::type());
+  }
+
+  template <size_t... I>
+  static void Invoke(PFN_vkVoidFunction function, void* const* parameters,
+                     Indices<I...>) {
+    reinterpret_cast<void(VKAPI_PTR*)(P...)>(function)(
+        *static_cast<P*>(parameters[I])...);
+  }
+};
+
+enum FunctionScope : uint8_t {
+  kGlobalFunction,
+  kInstanceFunction,
+  kDeviceFunction
+};
+
+struct FunctionEntry {
+  const char* name;
+  FunctionScope scope;
+  InvokeFunction invoke;
+};
+
+#define FUNCTION_ENTRY(function, scope) \
+  {#function, scope, &Invoker<PFN_##function>::Invoke},
+const FunctionEntry kFunctions[] = {
+    FUNCTION_ENTRY(vkCreateInstance, kGlobalFunction)
+    FUNCTION_ENTRY(vkEnumerateInstanceExtensionProperties, kGlobalFunction)
+    FUNCTION_ENTRY(vkEnumerateInstanceLayerProperties, kGlobalFunction)
+#define VULKAN_INSTANCE_FUNCTION(function) \
+  FUNCTION_ENTRY(function, kInstanceFunction)
+#define VULKAN_DEVICE_FUNCTION(function) \
+  FUNCTION_ENTRY(function, kDeviceFunction)
+#define VULKAN_QUEUE_FUNCTION(function) \
+  FUNCTION_ENTRY(function, kDeviceFunction)
+#define VULKAN_COMMAND_BUFFER_FUNCTION(function) \
+  FUNCTION_ENTRY(function, kDeviceFunction)
+#include "vulkan_wrapper/function_list.h"
+};
+#undef FUNCTION_ENTRY
+const uint32_t kFunctionCount = sizeof(kFunctions) / sizeof(kFunctions[0]);
+
+// Functions with these in their names need a window, or have parameters
+// that cannot be replayed, so they are skipped.
+const char* const kSkippedNames[] = {"Surface",      "Display",
+                                     "DebugReport",  "PresentationSupport",
+                                     "Swapchain",    "AcquireNextImage",
+                                     "DebugMarkerSetObject"};
+
+// Extensions with these in their names need a window.
+const char* const kWindowExtensionNames[] = {"surface", "swapchain",
+                                             "display", "present"};
+}  // anonymous namespace
+
+Replayer::Replayer(containers::Allocator* allocator, logging::Logger* logger)
+    : allocator_(allocator),
+      logger_(logger),
+      library_(allocator, logger),
+      data_(allocator),
+      position_(0),
+      call_allocator_(allocator),
+      output_handles_(allocator),
+      functions_(allocator),
+      handles_(allocator),
+      logged_missing_handles_(capture::kHandleTypeCount, false, allocator),
+      swapchains_(allocator),
+      mappings_(allocator),
+      memory_handle_type_(capture::kHandleTypeCount),
+      next_swapchain_(0),
+      instance_(VK_NULL_HANDLE),
+      physical_device_(VK_NULL_HANDLE),
+      device_(VK_NULL_HANDLE),
+      queue_(VK_NULL_HANDLE),
+      get_device_proc_addr_(nullptr),
+      queue_submit_(nullptr) {
+  for (uint32_t i = 0; i < capture::kHandleTypeCount; ++i) {
+    handles_.emplace_back(allocator);
+    if (strcmp(capture::kHandleTypeNames[i], "VkDeviceMemory") == 0) {
+      memory_handle_type_ = i;
+    }
+  }
+}
+
+bool Replayer::Load(const char* path) {
+  std::ifstream file(path, std::ios::in | std::ios::binary);
+  if (!file.is_open()) {
+    logger_->LogError("Could not open ", path);
+    return false;
+  }
+  file.seekg(0, std::ios::end);
+  data_.resize(static_cast<size_t>(file.tellg()));
+  file.seekg(0, std::ios::beg);
+  file.read(reinterpret_cast<char*>(data_.data()), data_.size());
+  if (!file || data_.size() < kHeaderSize ||
+      memcmp(data_.data(), kMagic, sizeof(kMagic)) != 0) {
+    logger_->LogError(path, " is not a capture");
+    return false;
+  }
+  uint32_t header[4];
+  memcpy(header, data_.data() + sizeof(kMagic), sizeof(header));
+  if (header[0] != Capture::kVersion || header[1] != kByteOrderMark ||
+      header[2] != sizeof(void*)) {
+    logger_->LogError(path, " was captured by a different version, or on a "
+                            "different platform");
+    return false;
+  }
+  if (header[3] != VK_HEADER_VERSION) {
+    logger_->LogError(path, " was captured with version ", header[3],
+                      " of vulkan.h, so it may not replay correctly");
+  }
+  return true;
+}
+
+bool Replayer::Replay(ReplayStatistics* statistics) {
+  *statistics = ReplayStatistics();
+  position_ = kHeaderSize;
+  functions_.clear();
+  for (auto& handles : handles_) {
+    handles.clear();
+  }
+  swapchains_.clear();
+  mappings_.clear();
+  next_swapchain_ = 0;
+  instance_ = VK_NULL_HANDLE;
+  physical_device_ = VK_NULL_HANDLE;
+  device_ = VK_NULL_HANDLE;
+  queue_ = VK_NULL_HANDLE;
+  get_device_proc_addr_ = nullptr;
+  queue_submit_ = nullptr;
+
+  const uint64_t start = Now();
+  while (position_ < data_.size()) {
+    const size_t record = position_;
+    uint8_t type = 0;
+    bool valid = Read(&type);
+    switch (type) {
+      case Capture::kFunctionRecord:
+        valid = valid && ReplayFunctionRecord();
+        break;
+      case Capture::kCallRecord:
+        valid = valid && ReplayCallRecord(statistics);
+        break;
+      case Capture::kMemoryRecord:
+        valid = valid && ReplayMemoryRecord();
+        break;
+      default:
+        valid = false;
+        break;
+    }
+    call_allocator_.EndFrame();
+    if (!valid) {
+      logger_->LogError("The capture is malformed at byte ", record);
+      return false;
+    }
+  }
+  statistics->nanoseconds = Now() - start;
+  return true;
+}
+
+bool Replayer::ReplayFunctionRecord() {
+  uint32_t id;
+  uint32_t length;
+  char name[kMaxNameLength + 1];
+  if (!Read(&id) || !Read(&length) || length > kMaxNameLength ||
+      !Read(name, length)) {
+    return false;
+  }
+  name[length] = '\0';
+  Function function = {capture::FindFunctionType(name), kReplayed,
+                       kFunctionCount, nullptr, nullptr, false};
+  for (uint32_t i = 0; i < kFunctionCount; ++i) {
+    if (strcmp(kFunctions[i].name, name) == 0) {
+      function.index = i;
+      break;
+    }
+  }
+
+  const struct {
+    const char* name;
+    Behavior behavior;
+  } kSpecialFunctions[] = {
+      {"vkCreateInstance", kCreateInstance},
+      {"vkCreateDevice", kCreateDevice},
+      {"vkGetDeviceQueue", kGetDeviceQueue},
+      {"vkMapMemory", kMapMemory},
+      {"vkUnmapMemory", kUnmapMemory},
+      {"vkFreeMemory", kFreeMemory},
+      {"vkCreateSwapchainKHR", kCreateSwapchain},
+      {"vkGetSwapchainImagesKHR", kGetSwapchainImages},
+      {"vkAcquireNextImageKHR", kAcquireNextImage},
+      {"vkQueuePresentKHR", kQueuePresent},
+      {"vkDestroySwapchainKHR", kDestroySwapchain}};
+  bool special = false;
+  for (const auto& special_function : kSpecialFunctions) {
+    if (strcmp(special_function.name, name) == 0) {
+      function.behavior = special_function.behavior;
+      special = true;
+    }
+  }
+  if (!special) {
+    for (const char* skipped : kSkippedNames) {
+      if (strstr(name, skipped)) {
+        function.behavior = kSkipped;
+      }
+    }
+  }
+  if (!function.type || !function.type->supported ||
+      function.index == kFunctionCount) {
+    logger_->LogError("Calls to ", name, " cannot be replayed");
+    function.behavior = kSkipped;
+  }
+  functions_.emplace(id, function);
+  return true;
+}
+
+bool Replayer::ReplayCallRecord(ReplayStatistics* statistics) {
+  uint32_t id;
+  uint32_t size;
+  if (!Read(&id) || !Read(&size)) {
+    return false;
+  }
+  const size_t end = position_ + size;
+  auto found = functions_.find(id);
+  if (found == functions_.end() || end > data_.size()) {
+    return false;
+  }
+  Function& function = found->second;
+  if (!function.type || !function.type->supported) {
+    position_ = end;
+    return true;
+  }
+
+  const capture::FunctionType* type = function.type;
+  void* parameters[capture::kMaxParameters];
+  uint64_t in_out_count = 0;
+  output_handles_.clear();
+  for (uint32_t i = 0; i < type->parameter_count; ++i) {
+    const capture::Field& field = type->parameters[i];
+    parameters[i] = Allocate(std::max<size_t>(field.element_size, 8));
+    if (!DecodeField(field, parameters[i], true, &in_out_count)) {
+      return false;
+    }
+  }
+  const uint8_t* captured_result = Skip(type->result_size);
+  void* result = type->result_size ? Allocate(type->result_size) : nullptr;
+  if (!captured_result || position_ != end) {
+    return false;
+  }
+
+  if (function.behavior == kSkipped) {
+    // Anything that the skipped call created keeps its handle from the
+    // file, so that the calls that use it do not report it as missing.
+    for (const OutputHandles& output : output_handles_) {
+      memcpy(output.replayed, output.captured,
+             output.count * output.field->element_size);
+    }
+  } else if (!Emulate(function, parameters, statistics)) {
+    if (function.behavior == kCreateInstance) {
+      VkInstanceCreateInfo* info = At<VkInstanceCreateInfo*>(parameters[0]);
+      RemoveWindowExtensions(
+          const_cast<const char**>(info->ppEnabledExtensionNames),
+          &info->enabledExtensionCount);
+    } else if (function.behavior == kCreateDevice) {
+      VkDeviceCreateInfo* info = At<VkDeviceCreateInfo*>(parameters[1]);
+      RemoveWindowExtensions(
+          const_cast<const char**>(info->ppEnabledExtensionNames),
+          &info->enabledExtensionCount);
+    }
+    PFN_vkVoidFunction pointer = Resolve(&function);
+    if (!pointer) {
+      return true;
+    }
+    const uint64_t start = Now();
+    kFunctions[function.index].invoke(pointer, parameters, result);
+    statistics->call_nanoseconds += Now() - start;
+    statistics->calls += 1;
+
+    const bool succeeded = !result || type->result_size != sizeof(VkResult) ||
+                           At<VkResult>(result) == VK_SUCCESS;
+    if (succeeded) {
+      switch (function.behavior) {
+        case kCreateInstance:
+          instance_ = *At<::VkInstance*>(parameters[2]);
+          get_device_proc_addr_ = reinterpret_cast<PFN_vkGetDeviceProcAddr>(
+              library_.getProcAddrFunction()(instance_,
+                                             "vkGetDeviceProcAddr"));
+          break;
+        case kCreateDevice:
+          physical_device_ = At<::VkPhysicalDevice>(parameters[0]);
+          device_ = *At<::VkDevice*>(parameters[3]);
+          queue_submit_ = reinterpret_cast<PFN_vkQueueSubmit>(
+              GetDeviceProcAddr("vkQueueSubmit"));
+          break;
+        case kGetDeviceQueue:
+          queue_ = *At<::VkQueue*>(parameters[3]);
+          break;
+        case kMapMemory:
+          mappings_[HandleValue(parameters[1], sizeof(VkDeviceMemory))] = {
+              static_cast<uint8_t*>(*At<void**>(parameters[5])),
+              At<VkDeviceSize>(parameters[2])};
+          break;
+        case kUnmapMemory:
+        case kFreeMemory:
+          mappings_.erase(HandleValue(parameters[1], sizeof(VkDeviceMemory)));
+          break;
+        default:
+          break;
+      }
+    }
+    if (type->result_size == sizeof(VkResult) && !function.logged_result &&
+        memcmp(result, captured_result, sizeof(VkResult)) != 0) {
+      VkResult captured;
+      memcpy(&captured, captured_result, sizeof(captured));
+      logger_->LogError(type->name, " returned ", At<VkResult>(result),
+                        " when it was replayed, but ", captured,
+                        " when it was captured");
+      function.logged_result = true;
+    }
+  }
+  for (const OutputHandles& output : output_handles_) {
+    MapOutputHandles(output);
+  }
+  return true;
+}
+
+bool Replayer::ReplayMemoryRecord() {
+  uint64_t memory;
+  uint64_t offset;
+  uint32_t size;
+  if (!Read(&memory) || !Read(&offset) || !Read(&size)) {
+    return false;
+  }
+  const uint8_t* data = Skip(size);
+  if (!data) {
+    return false;
+  }
+  auto& memory_handles = handles_[memory_handle_type_];
+  auto replayed_memory = memory_handles.find(memory);
+  if (replayed_memory == memory_handles.end()) {
+    return true;
+  }
+  auto mapping = mappings_.find(replayed_memory->second);
+  if (mapping == mappings_.end() || offset < mapping->second.offset) {
+    logger_->LogError("The capture writes to memory that is not mapped");
+    return true;
+  }
+  memcpy(mapping->second.data + (offset - mapping->second.offset), data,
+         size);
+  return true;
+}
+
+bool Replayer::Emulate(const Function& function, void* const* parameters,
+                       ReplayStatistics* statistics) {
+  switch (function.behavior) {
+    case kCreateSwapchain: {
+      const VkSwapchainCreateInfoKHR* info =
+          At<const VkSwapchainCreateInfoKHR*>(parameters[1]);
+      const uint64_t swapchain = ++next_swapchain_;
+      swapchains_.emplace(
+          swapchain,
+          Swapchain{info->imageFormat, info->imageExtent,
+                    info->imageArrayLayers, info->imageUsage,
+                    containers::vector<::VkImage>(allocator_),
+                    containers::vector<::VkDeviceMemory>(allocator_)});
+      SetHandleValue(At<void*>(parameters[3]), sizeof(VkSwapchainKHR),
+                     swapchain);
+      return true;
+    }
+    case kGetSwapchainImages: {
+      auto swapchain = swapchains_.find(
+          HandleValue(parameters[1], sizeof(VkSwapchainKHR)));
+      if (swapchain != swapchains_.end()) {
+        GetSwapchainImages(&swapchain->second, At<uint32_t*>(parameters[2]),
+                           At<::VkImage*>(parameters[3]));
+      }
+      return true;
+    }
+    case kAcquireNextImage:
+      SubmitNothing(queue_, 0, nullptr, At<::VkSemaphore>(parameters[3]),
+                    At<::VkFence>(parameters[4]));
+      return true;
+    case kQueuePresent: {
+      const VkPresentInfoKHR* info =
+          At<const VkPresentInfoKHR*>(parameters[1]);
+      SubmitNothing(At<::VkQueue>(parameters[0]), info->waitSemaphoreCount,
+                    info->pWaitSemaphores, VK_NULL_HANDLE, VK_NULL_HANDLE);
+      for (uint32_t i = 0; info->pResults && i < info->swapchainCount; ++i) {
+        info->pResults[i] = VK_SUCCESS;
+      }
+      statistics->frames += 1;
+      return true;
+    }
+    case kDestroySwapchain: {
+      auto swapchain = swapchains_.find(
+          HandleValue(parameters[1], sizeof(VkSwapchainKHR)));
+      if (swapchain == swapchains_.end()) {
+        return true;
+      }
+      PFN_vkDestroyImage destroy_image = reinterpret_cast<PFN_vkDestroyImage>(
+          GetDeviceProcAddr("vkDestroyImage"));
+      PFN_vkFreeMemory free_memory =
+          reinterpret_cast<PFN_vkFreeMemory>(GetDeviceProcAddr("vkFreeMemory"));
+      for (::VkImage image : swapchain->second.images) {
+        destroy_image(device_, image, nullptr);
+      }
+      for (::VkDeviceMemory memory : swapchain->second.memory) {
+        free_memory(device_, memory, nullptr);
+      }
+      swapchains_.erase(swapchain);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+VkResult Replayer::GetSwapchainImages(Swapchain* swapchain, uint32_t* count,
+                                      ::VkImage* images) {
+  if (!images) {
+    if (!swapchain->images.empty()) {
+      *count = static_cast<uint32_t>(swapchain->images.size());
+    }
+    return VK_SUCCESS;
+  }
+  if (swapchain->images.empty()) {
+    PFN_vkGetPhysicalDeviceMemoryProperties get_memory_properties =
+        reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties>(
+            library_.getProcAddrFunction()(
+                instance_, "vkGetPhysicalDeviceMemoryProperties"));
+    PFN_vkCreateImage create_image = reinterpret_cast<PFN_vkCreateImage>(
+        GetDeviceProcAddr("vkCreateImage"));
+    PFN_vkGetImageMemoryRequirements get_memory_requirements =
+        reinterpret_cast<PFN_vkGetImageMemoryRequirements>(
+            GetDeviceProcAddr("vkGetImageMemoryRequirements"));
+    PFN_vkAllocateMemory allocate_memory =
+        reinterpret_cast<PFN_vkAllocateMemory>(
+            GetDeviceProcAddr("vkAllocateMemory"));
+    PFN_vkBindImageMemory bind_memory = reinterpret_cast<PFN_vkBindImageMemory>(
+        GetDeviceProcAddr("vkBindImageMemory"));
+
+    VkPhysicalDeviceMemoryProperties properties;
+    get_memory_properties(physical_device_, &properties);
+    for (uint32_t i = 0; i < *count; ++i) {
+      VkImageCreateInfo info = {
+          VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+          nullptr,
+          0,
+          VK_IMAGE_TYPE_2D,
+          swapchain->format,
+          {swapchain->extent.width, swapchain->extent.height, 1},
+          1,
+          swapchain->array_layers,
+          VK_SAMPLE_COUNT_1_BIT,
+          VK_IMAGE_TILING_OPTIMAL,
+          swapchain->usage,
+          VK_SHARING_MODE_EXCLUSIVE,
+          0,
+          nullptr,
+          VK_IMAGE_LAYOUT_UNDEFINED};
+      ::VkImage image;
+      VkResult result = create_image(device_, &info, nullptr, &image);
+      if (result != VK_SUCCESS) {
+        logger_->LogError("Could not create an image for a swapchain");
+        return result;
+      }
+      swapchain->images.push_back(image);
+
+      VkMemoryRequirements requirements;
+      get_memory_requirements(device_, image, &requirements);
+      // Prefer device local memory, as a real swapchain would.
+      uint32_t memory_type = properties.memoryTypeCount;
+      for (uint32_t j = 0; j < properties.memoryTypeCount; ++j) {
+        if (!(requirements.memoryTypeBits & (1u << j))) {
+          continue;
+        }
+        if (memory_type == properties.memoryTypeCount ||
+            (properties.memoryTypes[j].propertyFlags &
+             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
+          memory_type = j;
+        }
+        if (properties.memoryTypes[j].propertyFlags &
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) {
+          break;
+        }
+      }
+      VkMemoryAllocateInfo allocate_info = {
+          VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, nullptr, requirements.size,
+          memory_type};
+      ::VkDeviceMemory memory;
+      result = allocate_memory(device_, &allocate_info, nullptr, &memory);
+      if (result != VK_SUCCESS) {
+        logger_->LogError("Could not allocate memory for a swapchain");
+        return result;
+      }
+      swapchain->memory.push_back(memory);
+      bind_memory(device_, image, memory, 0);
+    }
+  }
+  *count = std::min<uint32_t>(*count,
+                              static_cast<uint32_t>(swapchain->images.size()));
+  std::copy(swapchain->images.begin(), swapchain->images.begin() + *count,
+            images);
+  return VK_SUCCESS;
+}
+
+void Replayer::SubmitNothing(::VkQueue queue, uint32_t wait_count,
+                             const ::VkSemaphore* wait, ::VkSemaphore signal,
+                             ::VkFence fence) {
+  if (!queue || !queue_submit_ ||
+      (!wait_count && signal == VK_NULL_HANDLE && fence == VK_NULL_HANDLE)) {
+    return;
+  }
+  VkPipelineStageFlags* stages = static_cast<VkPipelineStageFlags*>(
+      Allocate(wait_count * sizeof(VkPipelineStageFlags)));
+  std::fill(stages, stages + wait_count, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+  VkSubmitInfo submit = {VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                         nullptr,
+                         wait_count,
+                         wait,
+                         stages,
+                         0,
+                         nullptr,
+                         signal == VK_NULL_HANDLE ? 0u : 1u,
+                         &signal};
+  queue_submit_(queue, 1, &submit, fence);
+}
+
+void Replayer::RemoveWindowExtensions(const char** names, uint32_t* count) {
+  uint32_t kept = 0;
+  for (uint32_t i = 0; i < *count; ++i) {
+    bool needs_window = false;
+    for (const char* window_name : kWindowExtensionNames) {
+      needs_window = needs_window || strstr(names[i], window_name);
+    }
+    if (!needs_window) {
+      names[kept++] = names[i];
+    }
+  }
+  *count = kept;
+}
+
+PFN_vkVoidFunction Replayer::Resolve(Function* function) {
+  const FunctionEntry& entry = kFunctions[function->index];
+  const void* owner = nullptr;
+  if (entry.scope == kInstanceFunction) {
+    owner = instance_;
+  } else if (entry.scope == kDeviceFunction) {
+    owner = device_;
+  }
+  if (function->pointer && function->resolved_for == owner) {
+    return function->pointer;
+  }
+  if (entry.scope == kDeviceFunction) {
+    function->pointer = GetDeviceProcAddr(entry.name);
+  } else {
+    function->pointer = library_.getProcAddrFunction()(
+        static_cast<::VkInstance>(const_cast<void*>(owner)), entry.name);
+  }
+  function->resolved_for = owner;
+  if (!function->pointer) {
+    logger_->LogError(entry.name, " could not be resolved, so it is skipped");
+  }
+  return function->pointer;
+}
+
+PFN_vkVoidFunction Replayer::GetDeviceProcAddr(const char* name) {
+  if (!get_device_proc_addr_ || device_ == VK_NULL_HANDLE) {
+    return nullptr;
+  }
+  return get_device_proc_addr_(device_, name);
+}
+
+bool Replayer::DecodeField(const capture::Field& field, void* address,
+                           bool parameter, uint64_t* in_out_count) {
+  const uint32_t element_size = field.element_size;
+  switch (field.kind) {
+    case capture::kValueField:
+      return !parameter || Read(address, element_size);
+    case capture::kHandleField:
+      if (parameter && !Read(address, element_size)) {
+        return false;
+      }
+      MapHandle(field.handle_type, address, element_size);
+      return true;
+    case capture::kStructField:
+      return DecodeFields(field.element_type, static_cast<uint8_t*>(address));
+    case capture::kStringField:
+      return DecodeString(static_cast<const char**>(address));
+    case capture::kIgnoredField:
+      At<void*>(address) = nullptr;
+      return true;
+    default:
+      break;
+  }
+
+  // Every other kind of field is a pointer, which is null if it is absent.
+  uint8_t present;
+  At<void*>(address) = nullptr;
+  if (!Read(&present)) {
+    return false;
+  }
+  if (!present) {
+    return true;
+  }
+  if (field.kind == capture::kNextField) {
+    int32_t s_type;
+    if (!Read(&s_type)) {
+      return false;
+    }
+    const capture::StructType* type =
+        capture::FindStructType(static_cast<VkStructureType>(s_type));
+    if (!type) {
+      return false;
+    }
+    uint8_t* next = static_cast<uint8_t*>(Allocate(type->size));
+    if (!Read(next, type->size) || !DecodeFields(type, next)) {
+      return false;
+    }
+    At<void*>(address) = next;
+    return true;
+  }
+  uint64_t count;
+  if (!Read(&count)) {
+    return false;
+  }
+  if (field.kind == capture::kInOutCountField) {
+    *in_out_count = count;
+    void* value = Allocate(sizeof(uint64_t));
+    if (element_size == sizeof(uint32_t)) {
+      At<uint32_t>(value) = static_cast<uint32_t>(count);
+    } else {
+      At<size_t>(value) = static_cast<size_t>(count);
+    }
+    At<void*>(address) = value;
+    return true;
+  }
+  // Unless the elements were only written by the call, each of them is in
+  // the file, so there cannot be more of them than there are bytes left.
+  if (field.kind != capture::kOutputField &&
+      count > data_.size() - position_) {
+    return false;
+  }
+  const size_t size = static_cast<size_t>(count) * element_size;
+  switch (field.kind) {
+    case capture::kPointerField:
+    case capture::kHandlePointerField: {
+      uint8_t* elements = static_cast<uint8_t*>(Allocate(size));
+      for (uint64_t i = 0; i < count; ++i) {
+        uint8_t* element = elements + i * element_size;
+        if (!Read(element, element_size) ||
+            (field.element_type &&
+             !DecodeFields(field.element_type, element))) {
+          return false;
+        }
+        if (field.kind == capture::kHandlePointerField) {
+          MapHandle(field.handle_type, element, element_size);
+        }
+      }
+      At<void*>(address) = elements;
+      return true;
+    }
+    case capture::kStringArrayField: {
+      const char** strings =
+          static_cast<const char**>(Allocate(count * sizeof(const char*)));
+      for (uint64_t i = 0; i < count; ++i) {
+        if (!DecodeString(&strings[i])) {
+          return false;
+        }
+      }
+      At<void*>(address) = strings;
+      return true;
+    }
+    case capture::kOutputField:
+    case capture::kOutputHandleField: {
+      // The application may have had room for more than was written.
+      const uint64_t capacity = std::max(count, *in_out_count);
+      uint8_t* elements =
+          static_cast<uint8_t*>(Allocate(capacity * element_size));
+      if (field.element_type && field.element_type->has_s_type) {
+        for (uint64_t i = 0; i < capacity; ++i) {
+          At<VkStructureType>(elements + i * element_size) =
+              field.element_type->s_type;
+        }
+      }
+      if (field.kind == capture::kOutputHandleField) {
+        const uint8_t* captured = Skip(size);
+        if (!captured) {
+          return false;
+        }
+        output_handles_.push_back({&field, captured, elements, count});
+      }
+      At<void*>(address) = elements;
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+bool Replayer::DecodeFields(const capture::StructType* type, uint8_t* data) {
+  uint64_t in_out_count = 0;
+  for (uint32_t i = 0; i < type->field_count; ++i) {
+    const capture::Field& field = type->fields[i];
+    if (!DecodeField(field, data + field.offset, false, &in_out_count)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Replayer::DecodeString(const char** value) {
+  uint8_t present;
+  uint32_t length;
+  *value = nullptr;
+  if (!Read(&present)) {
+    return false;
+  }
+  if (!present) {
+    return true;
+  }
+  if (!Read(&length) || length > data_.size() - position_) {
+    return false;
+  }
+  char* string = static_cast<char*>(Allocate(length + 1));
+  *value = string;
+  return Read(string, length);
+}
+
+void* Replayer::Allocate(size_t size) {
+  void* memory = call_allocator_.malloc(std::max<size_t>(size, 1));
+  memset(memory, 0, size);
+  return memory;
+}
+
+void Replayer::MapHandle(uint32_t handle_type, void* address, uint32_t size) {
+  const uint64_t captured = HandleValue(address, size);
+  if (!captured || handle_type >= capture::kHandleTypeCount) {
+    return;
+  }
+  auto& handles = handles_[handle_type];
+  auto replayed = handles.find(captured);
+  if (replayed != handles.end()) {
+    SetHandleValue(address, size, replayed->second);
+    return;
+  }
+  if (!logged_missing_handles_[handle_type]) {
+    logger_->LogError("The capture uses a ",
+                      capture::kHandleTypeNames[handle_type],
+                      " that it never created");
+    logged_missing_handles_[handle_type] = true;
+  }
+  SetHandleValue(address, size, 0);
+}
+
+void Replayer::MapOutputHandles(const OutputHandles& output) {
+  const uint32_t size = output.field->element_size;
+  auto& handles = handles_[output.field->handle_type];
+  for (uint64_t i = 0; i < output.count; ++i) {
+    const uint64_t captured = HandleValue(output.captured + i * size, size);
+    if (captured) {
+      handles[captured] = HandleValue(output.replayed + i * size, size);
+    }
+  }
+}
+
+bool Replayer::Read(void* data, size_t size) {
+  const uint8_t* bytes = Skip(size);
+  if (bytes) {
+    memcpy(data, bytes, size);
+  }
+  return bytes != nullptr;
+}
+
+const uint8_t* Replayer::Skip(size_t size) {
+  if (size > data_.size() - position_) {
+    return nullptr;
+  }
+  const uint8_t* bytes = data_.data() + position_;
+  position_ += size;
+  return bytes;
+}
+
+}  // namespace vulkan
@@ -0,0 +1,192 @@
+/* Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VULKAN_WRAPPER_REPLAY_H_
+#define VULKAN_WRAPPER_REPLAY_H_
+
+#include <cstdint>
+
+#include "support/containers/allocator.h"
+#include "support/containers/flat_hash_map.h"
+#include "support/containers/monotonic_allocator.h"
+#include "support/containers/vector.h"
+#include "support/log/log.h"
+#include "vulkan_helpers/vulkan_header_wrapper.h"
+#include "vulkan_wrapper/capture_tables.h"
+#include "vulkan_wrapper/library_wrapper.h"
+
+namespace vulkan {
+
+struct ReplayStatistics {
+  // The number of calls that were issued to the driver.
+  uint64_t calls;
+  // The number of calls to vkQueuePresentKHR.
+  uint64_t frames;
+  // The time that the whole replay took, and the part of it that was spent
+  // in the driver.
+  uint64_t nanoseconds;
+  uint64_t call_nanoseconds;
+};
+
+// Replayer issues the calls in a file written by Capture again, against
+// whichever driver the Vulkan loader picks. Handles are mapped from the ones
+// in the file to the ones that the driver returns, and what the application
+// wrote to mapped memory is copied into the replayed mappings.
+//
+// Nothing is presented. Surfaces are not created, and each swapchain is
+// replaced by images of the same size, format and usage. Acquiring an image
+// signals its semaphore and fence with an empty submit, and presenting
+// waits for its semaphores the same way.
+//
+// The file must have been captured by a build with the same pointer size,
+// byte order and vulkan.h, and only the last VkDevice that was created is
+// used to resolve device functions.
+class Replayer {
+ public:
+  Replayer(containers::Allocator* allocator, logging::Logger* logger);
+
+  // Reads the file at path. Returns false if it could not be read, or was
+  // not captured by a compatible build.
+  bool Load(const char* path);
+
+  // Issues every call in the file, and fills in statistics. This can be
+  // called more than once, as long as the file destroys everything that it
+  // creates. Returns false if the file is malformed.
+  bool Replay(ReplayStatistics* statistics);
+
+ private:
+  // How a function is replayed.
+  enum Behavior : uint8_t {
+    kReplayed,
+    // Functions that need a window, or whose parameters could not be
+    // captured, are not replayed.
+    kSkipped,
+    kCreateInstance,
+    kCreateDevice,
+    kGetDeviceQueue,
+    kMapMemory,
+    kUnmapMemory,
+    kFreeMemory,
+    kCreateSwapchain,
+    kGetSwapchainImages,
+    kAcquireNextImage,
+    kQueuePresent,
+    kDestroySwapchain
+  };
+  struct Function {
+    const capture::FunctionType* type;
+    Behavior behavior;
+    // The index of the function in the table of every function.
+    uint32_t index;
+    // The function pointer, and the instance or device that it was
+    // resolved for.
+    PFN_vkVoidFunction pointer;
+    const void* resolved_for;
+    // Whether a difference in the result has been logged.
+    bool logged_result;
+  };
+  struct Swapchain {
+    VkFormat format;
+    VkExtent2D extent;
+    uint32_t array_layers;
+    VkImageUsageFlags usage;
+    containers::vector<::VkImage> images;
+    containers::vector<::VkDeviceMemory> memory;
+  };
+  struct Mapping {
+    uint8_t* data;
+    VkDeviceSize offset;
+  };
+  // An array of handles that a call writes, which are mapped from the ones
+  // in the file once it returns.
+  struct OutputHandles {
+    const capture::Field* field;
+    const uint8_t* captured;
+    uint8_t* replayed;
+    uint64_t count;
+  };
+
+  bool ReplayFunctionRecord();
+  bool ReplayCallRecord(ReplayStatistics* statistics);
+  bool ReplayMemoryRecord();
+
+  // Issues a call to a function that has to be emulated. Returns false if
+  // it is not one of those.
+  bool Emulate(const Function& function, void* const* parameters,
+               ReplayStatistics* statistics);
+  VkResult GetSwapchainImages(Swapchain* swapchain, uint32_t* count,
+                              ::VkImage* images);
+  // Submits nothing to queue, to wait for and signal the given semaphores
+  // and fence.
+  void SubmitNothing(::VkQueue queue, uint32_t wait_count,
+                     const ::VkSemaphore* wait, ::VkSemaphore signal,
+                     ::VkFence fence);
+  // Removes the extensions that need a window from the create info of an
+  // instance or a device.
+  static void RemoveWindowExtensions(const char** names, uint32_t* count);
+
+  PFN_vkVoidFunction Resolve(Function* function);
+  PFN_vkVoidFunction GetDeviceProcAddr(const char* name);
+
+  bool DecodeField(const capture::Field& field, void* address, bool parameter,
+                   uint64_t* in_out_count);
+  bool DecodeFields(const capture::StructType* type, uint8_t* data);
+  bool DecodeString(const char** value);
+  // Returns size bytes of zeroes that live until the call returns.
+  void* Allocate(size_t size);
+  void MapHandle(uint32_t handle_type, void* address, uint32_t size);
+  void MapOutputHandles(const OutputHandles& output);
+
+  bool Read(void* data, size_t size);
+  template <typename T>
+  bool Read(T* value) {
+    return Read(value, sizeof(T));
+  }
+  // Returns the next size bytes of the file, or nullptr if there are not
+  // that many left.
+  const uint8_t* Skip(size_t size);
+
+  containers::Allocator* allocator_;
+  logging::Logger* logger_;
+  LibraryWrapper library_;
+  containers::vector<uint8_t> data_;
+  size_t position_;
+  // Holds everything that is decoded for a call, until it returns.
+  containers::FrameAllocator call_allocator_;
+  containers::vector<OutputHandles> output_handles_;
+
+  containers::flat_hash_map<uint32_t, Function> functions_;
+  // The handles that the driver returned, for the handles in the file, by
+  // type of handle.
+  containers::vector<containers::flat_hash_map<uint64_t, uint64_t>>
+      handles_;
+  containers::vector<bool> logged_missing_handles_;
+  containers::flat_hash_map<uint64_t, Swapchain> swapchains_;
+  // The replayed mappings, by replayed VkDeviceMemory.
+  containers::flat_hash_map<uint64_t, Mapping> mappings_;
+  uint32_t memory_handle_type_;
+  uint64_t next_swapchain_;
+
+  ::VkInstance instance_;
+  ::VkPhysicalDevice physical_device_;
+  ::VkDevice device_;
+  ::VkQueue queue_;
+  PFN_vkGetDeviceProcAddr get_device_proc_addr_;
+  PFN_vkQueueSubmit queue_submit_;
+};
+
+}  // namespace vulkan
+
+#endif  // VULKAN_WRAPPER_REPLAY_H_
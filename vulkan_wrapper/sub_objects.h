@@ -91,6 +91,23 @@ class VkSubObject {
     other.raw_object_ = VK_NULL_HANDLE;
   }
 
+  // Destroys the currently held object, and takes ownership of the object
+  // held by other.
+  VkSubObject& operator=(VkSubObject<T, O>&& other) {
+    if (this != &other) {
+      clean_up();
+      owner_ = other.owner_;
+      log_ = other.log_;
+      get_proc_addr_fn_ = other.get_proc_addr_fn_;
+      allocator_ = other.allocator_;
+      has_allocator_ = other.has_allocator_;
+      raw_object_ = other.raw_object_;
+      destruction_function_ = other.destruction_function_;
+      other.raw_object_ = VK_NULL_HANDLE;
+    }
+    return *this;
+  }
+
   logging::Logger* GetLogger() { return log_; }
 
   void initialize(type raw_object) {